@@ -0,0 +1,682 @@
+// UI bitmaps for the asset partition. tools/assetpack.py packs this file; it
+// is not compiled into the firmware. Format is Adafruit GFX drawBitmap: rows
+// MSB-first, each padded to a whole byte. IDs are the array names without
+// image_/_bits, upper-cased. Editing pixels only needs the asset partition
+// reflashed; adding, removing or renaming an array changes the ID set, so the
+// firmware has to be rebuilt with it.
+
+// ─────────────────────────────────────────────────────────────────────────────
+// Main menus
+// ─────────────────────────────────────────────────────────────────────────────
+// WiFi menu bitmap data
+const unsigned char image_wifi_Layer_10_bits[] = {
+    0x1f,0xff,0xf8,0x1f,0xff,0xf8,0x1f,0xff,0xf8,0xe0,0x00,0x00,0xe0,0x00,0x00,0xe0,0x00,0x00,0x1f,0xf0,0x00,0x1f,0xf0,0x00,0x1f,0xf0,0x00,0xe0,0x00,0x00,0xe0,0x00,0x00,0xe0,0x00,0x00,0x1f,0xff,0xf8,0x1f,0xff,0xf8,0x1f,0xff,0xf8,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xe0,0x00,0x38,0xe0,0x00,0x38,0xe0,0x00,0x38,0xff,0xff,0xf8,0xff,0xff,0xf8,0xff,0xff,0xf8,0xe0,0x00,0x38,0xe0,0x00,0x38,0xe0,0x00,0x38,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xff,0xff,0xf8,0xff,0xff,0xf8,0xff,0xff,0xf8,0x00,0x70,0x38,0x00,0x70,0x38,0x00,0x70,0x38,0x00,0x70,0x38,0x00,0x70,0x38,0x00,0x70,0x38,0x00,0x70,0x38,0x00,0x70,0x38,0x00,0x70,0x38,0x00,0x00,0x38,0x00,0x00,0x38,0x00,0x00,0x38,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xe0,0x00,0x38,0xe0,0x00,0x38,0xe0,0x00,0x38,0xff,0xff,0xf8,0xff,0xff,0xf8,0xff,0xff,0xf8,0xe0,0x00,0x38,0xe0,0x00,0x38,0xe0,0x00,0x38
+};
+
+const unsigned char image_wifi_Layer_11_bits[] = {
+    0x0f,0xf0,0x0f,0xf0,0x30,0x00,0x30,0x00,0xc3,0xc0,0xc3,0xc0,0xcc,0x30,0xcc,0x30,0xcc,0x30,0xcc,0x30,0xc3,0xc0,0xc3,0xc0,0xc0,0x00,0xc0,0x00,0xc0,0x00,0xc0,0x00,0xcc,0x00,0xcc,0x00,0xc3,0x00,0xc3,0x00,0xc0,0xc0,0xc0,0xc0,0xcc,0x30,0xcc,0x30,0xc3,0x00,0xc3,0x00,0xc0,0xc0,0xc0,0xc0,0xcc,0x30,0xcc,0x30,0xc3,0x00,0xc3,0x00,0xc0,0xc0,0xc0,0xc0,0xcc,0x30,0xcc,0x30,0xc3,0x00,0xc3,0x00,0xc0,0xc0,0xc0,0xc0,0xcc,0x30,0xcc,0x30,0xc3,0x00,0xc3,0x00,0xc0,0xc0,0xc0,0xc0,0xcc,0x30,0xcc,0x30,0xc3,0x00,0xc3,0x00,0xc0,0xc0,0xc0,0xc0,0xc0,0x30,0xc0,0x30,0xc0,0x00,0xc0,0x00,0x30,0x00,0x30,0x00,0x3c,0x00,0x3c,0x00,0x3f,0x00,0x3f,0x00,0x3f,0xc0,0x3f,0xc0,0x3f,0xf0,0x3f,0xf0,0x33,0xf0,0x33,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0
+};
+
+const unsigned char image_wifi_Layer_13_bits[] = {
+    0x3f,0xf8,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x38,0x38,0x08,0x20,0x08,0x20,0x07,0xc0
+};
+
+const unsigned char image_Layer_18_bits[] = {
+    0x04,0x20,0x00,0x00,0x06,0x60,0x00,0x00,0x00,0x00,0x00,0x00,0x18,0x18,0x0c,0x30,0x04,0x20,0x02,0x40,0x01,0x80,0xff,0xff,0x63,0xc6,0x36,0x6c,0x1c,0x38,0x08,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x06,0x60,0x08,0x10,0x06,0x20
+};
+
+const unsigned char image_Layer_20_bits[] = {
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0xf8,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x07,0xfe,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x07,0xfe,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0x3c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x38,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x70,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xe0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0xc0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x07,0x82,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0f,0x0f,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x07,0xfe,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0xfc,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x60,0x00,0x60,0x00,0x00,0x00,0x00,0x00,0x00,0x70,0x00,0xe0,0x00,0x00,0x00,0x00,0x00,0x00,0x7c,0x03,0xe0,0x00,0x00,0x00,0x00,0x00,0x00,0x3f,0xff,0xc0,0x00,0x00,0x00,0x00,0x00,0x02,0x0f,0xff,0x04,0x00,0x00,0x00,0x00,0x00,0x07,0x00,0xf0,0x0e,0x00,0x00,0x00,0x00,0x00,0x07,0xc0,0x00,0x3e,0x00,0x00,0x00,0x00,0x00,0x01,0xf0,0x00,0xf8,0x00,0x00,0x00,0x00,0x00,0x00,0xff,0xff,0xf0,0x00,0x00,0x00,0x00,0x00,0x00,0x3f,0xff,0xc0,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0xfc,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00
+};
+
+const unsigned char image_wifi_Layer_21_bits[] = {
+    0x0f,0x00,0x10,0xc0,0x20,0x20,0x20,0x30,0x20,0x10,0x20,0x10,0x20,0x10,0x10,0x20,0x00,0x70,0x00,0x00,0x00,0x00,0x1e,0x10,0x31,0xf0,0x20,0x10,0x20,0x10,0x20,0x00,0x30,0x00,0x10,0x00,0x0f,0x10,0x01,0xf0,0x00,0x10,0x20,0x00,0x30,0x00,0x3f,0x90,0x22,0x70,0x02,0x10,0x02,0x10,0x02,0x10,0x0e,0x10,0x11,0x30,0x20,0xe0,0x00,0x00,0x20,0x00,0x30,0x00,0x3f,0x90,0x22,0x70,0x02,0x10,0x02,0x10,0x02,0x10,0x0e,0x10,0x11,0x30,0x20,0xe0,0x80,0x00,0x80,0x00,0x80,0x00,0x80,0x00,0x80,0x00,0x80,0x00,0x80,0x00,0x80,0x00,0x80,0x00,0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x30,0x20,0x10,0x38,0x10,0x2f,0xd0,0x20,0x30,0x20,0x10,0x00,0x10,0x00,0x10,0x00,0x30,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x10,0x38,0x10,0x27,0xd0,0x20,0x30,0x20,0x10,0x00,0x10,0x00,0x10,0x20,0x00,0x20,0x00,0x3f,0x10,0x20,0xf0,0x00,0x30,0x07,0xc0,0x06,0x00,0x21,0x00,0x20,0xc0,0x3c,0x20,0x27,0xf0,0x00,0x10,0x20,0x10,0x30,0x00,0x3f,0x90,0x21,0x70,0x21,0x10,0x21,0x10,0x23,0x90,0x20,0x10,0x38,0x10,0x00,0x30
+};
+
+const unsigned char image_Layer_22_bits[] = {
+0x00,0x00,0x08,0x00,0x00,0x00,0x1c,0x00,0x00,0x00,0x3e,0x00,0x00,0x00,0x7f,0x00,0x00,0x00,0x7f,0x00,0x00,0x00,0x3f,0x80,0x00,0x00,0x1f,0xc0,0x00,0x00,0x0f,0xc0,0x00,0x0c,0x0f,0xe0,0x00,0x1e,0x07,0xe0,0x00,0x3e,0x03,0xe0,0x00,0x7f,0x03,0xf0,0x00,0x3f,0x83,0xf0,0x00,0x1f,0x81,0xf0,0x00,0x1f,0x81,0xf8,0x04,0x0f,0xc1,0xf8,0x0c,0x0f,0xc0,0xf8,0x1e,0x07,0xc0,0xf8,0x3e,0x07,0xc0,0xf8,0x7f,0x07,0xc0,0xf8,0xff,0x07,0xe0,0xf8,0xff,0x07,0xe0,0xf8,0x7f,0x07,0xc0,0xf8,0x3e,0x07,0xc0,0xf8,0x1e,0x07,0xc0,0xf8,0x0c,0x0f,0xc0,0xf8,0x04,0x0f,0xc1,0xf8,0x00,0x1f,0x81,0xf8,0x00,0x1f,0x81,0xf0,0x00,0x3f,0x83,0xf0,0x00,0x7f,0x03,0xf0,0x00,0x3e,0x03,0xe0,0x00,0x1e,0x07,0xe0,0x00,0x0c,0x0f,0xe0,0x00,0x00,0x0f,0xc0,0x00,0x00,0x1f,0xc0,0x00,0x00,0x3f,0x80,0x00,0x00,0x7f,0x00,0x00,0x00,0x7f,0x00,0x00,0x00,0x3e,0x00,0x00,0x00,0x1c,0x00,0x00,0x00,0x08,0x00
+};
+
+// Bluetooth menu bitmap data
+const unsigned char image_bt_Layer_2_bits[] = {
+    0x3f,0xf8,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x38,0x38,0x08,0x20,0x08,0x20,0x07,0xc0
+};
+
+const unsigned char image_bt_Layer_3_bits[] = {
+    0x0f,0xf0,0x0f,0xf0,0x30,0x00,0x30,0x00,0xc3,0xc0,0xc3,0xc0,0xcc,0x30,0xcc,0x30,0xcc,0x30,0xcc,0x30,0xc3,0xc0,0xc3,0xc0,0xc0,0x00,0xc0,0x00,0xc0,0x00,0xc0,0x00,0xcc,0x00,0xcc,0x00,0xc3,0x00,0xc3,0x00,0xc0,0xc0,0xc0,0xc0,0xcc,0x30,0xcc,0x30,0xc3,0x00,0xc3,0x00,0xc0,0xc0,0xc0,0xc0,0xcc,0x30,0xcc,0x30,0xc3,0x00,0xc3,0x00,0xc0,0xc0,0xc0,0xc0,0xcc,0x30,0xcc,0x30,0xc3,0x00,0xc3,0x00,0xc0,0xc0,0xc0,0xc0,0xcc,0x30,0xcc,0x30,0xc3,0x00,0xc3,0x00,0xc0,0xc0,0xc0,0xc0,0xcc,0x30,0xcc,0x30,0xc3,0x00,0xc3,0x00,0xc0,0xc0,0xc0,0xc0,0xc0,0x30,0xc0,0x30,0xc0,0x00,0xc0,0x00,0x30,0x00,0x30,0x00,0x3c,0x00,0x3c,0x00,0x3f,0x00,0x3f,0x00,0x3f,0xc0,0x3f,0xc0,0x3f,0xf0,0x3f,0xf0,0x33,0xf0,0x33,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0
+};
+
+const unsigned char image_bt_Layer_6_bits[] = {
+    0x00,0x0f,0xf8,0x00,0x00,0x00,0x38,0x0e,0x00,0x00,0x00,0x60,0x03,0x00,0x00,0x00,0x80,0x00,0x80,0x00,0x00,0x07,0xf0,0x00,0x00,0x00,0x1c,0x1c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0xe0,0x00,0x00,0x00,0x02,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x80,0x00,0x00,0x00,0x80,0xc0,0xc0,0x00,0x01,0xc0,0x01,0xc0,0x00,0x00,0xe0,0x03,0x80,0x00,0x00,0x70,0x07,0x80,0x00,0x00,0x70,0x07,0x00,0x00,0x00,0x38,0x0e,0x00,0x00,0x00,0x1c,0x1c,0x00,0x00,0x00,0x0e,0x38,0x00,0x00,0x00,0x0f,0x78,0x00,0x00,0x00,0x03,0xe0,0x00,0x00,0xff,0xff,0xff,0xff,0x80,0x7f,0xff,0xff,0xff,0x00,0x38,0x03,0xe0,0x0e,0x00,0x1c,0x07,0x78,0x1c,0x00,0x0e,0x0e,0x38,0x38,0x00,0x07,0x1c,0x1c,0x78,0x00,0x03,0xb8,0x0e,0xf0,0x00,0x03,0xf0,0x07,0xe0,0x00,0x01,0xe0,0x03,0xc0,0x00,0x00,0xc0,0x01,0x80,0x00,0x00,0x00,0xc0,0x00,0x00,0x00,0x00,0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0x20,0x00,0x00,0x00,0x03,0xe0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x04,0x00,0x00,0x00,0x1c,0x1c,0x00,0x00,0x00,0x07,0xf0,0x00,0x00,0x00,0xc0,0x01,0x80,0x00,0x00,0x60,0x03,0x00,0x00,0x00,0x3c,0x0e,0x00,0x00,0x00,0x0f,0xf8,0x00,0x00
+};
+
+const unsigned char image_bt_Layer_7_bits[] = {
+    0xff,0xfc,0xff,0xfc,0xc3,0x0c,0xc3,0x0c,0xc3,0x0c,0xc3,0x0c,0xc3,0x0c,0xc3,0x0c,0x3c,0xf0,0x3c,0xf0,0x00,0x00,0x00,0x00,0xff,0xfc,0xff,0xfc,0xc0,0x00,0xc0,0x00,0xc0,0x00,0xc0,0x00,0xc0,0x00,0xc0,0x00,0xc0,0x00,0xc0,0x00,0x00,0x00,0x00,0x00,0x3f,0xfc,0x3f,0xfc,0xc0,0x00,0xc0,0x00,0xc0,0x00,0xc0,0x00,0xc0,0x00,0xc0,0x00,0x3f,0xfc,0x3f,0xfc,0x00,0x00,0x00,0x00,0xff,0xfc,0xff,0xfc,0xc3,0x0c,0xc3,0x0c,0xc3,0x0c,0xc3,0x0c,0xc3,0x0c,0xc3,0x0c,0xc0,0x0c,0xc0,0x0c,0x00,0x00,0x00,0x00,0x00,0x3c,0x00,0x3c,0x00,0x0c,0x00,0x0c,0xff,0xfc,0xff,0xfc,0x00,0x0c,0x00,0x0c,0x00,0x3c,0x00,0x3c,0x00,0x00,0x00,0x00,0x3f,0xf0,0x3f,0xf0,0xc0,0x0c,0xc0,0x0c,0xc0,0x0c,0xc0,0x0c,0xc0,0x0c,0xc0,0x0c,0x3f,0xf0,0x3f,0xf0,0x00,0x00,0x00,0x00,0x3f,0xf0,0x3f,0xf0,0xc0,0x0c,0xc0,0x0c,0xc0,0x0c,0xc0,0x0c,0xc0,0x0c,0xc0,0x0c,0x3f,0xf0,0x3f,0xf0,0x00,0x00,0x00,0x00,0x00,0x3c,0x00,0x3c,0x00,0x0c,0x00,0x0c,0xff,0xfc,0xff,0xfc,0x00,0x0c,0x00,0x0c,0x00,0x3c,0x00,0x3c,0x00,0x00,0x00,0x00,0xff,0xfc,0xff,0xfc,0x03,0x00,0x03,0x00,0x03,0x00,0x03,0x00,0x03,0x00,0x03,0x00,0xff,0xfc,0xff,0xfc
+};
+
+const unsigned char image_bt_Layer_8_bits[] = {
+    0x0f,0x00,0x10,0xc0,0x20,0x20,0x20,0x30,0x20,0x10,0x20,0x10,0x20,0x10,0x10,0x20,0x00,0x70,0x00,0x00,0x00,0x00,0x1e,0x10,0x31,0xf0,0x20,0x10,0x20,0x10,0x20,0x00,0x30,0x00,0x10,0x00,0x0f,0x10,0x01,0xf0,0x00,0x10,0x20,0x00,0x30,0x00,0x3f,0x90,0x22,0x70,0x02,0x10,0x02,0x10,0x02,0x10,0x0e,0x10,0x11,0x30,0x20,0xe0,0x00,0x00,0x20,0x00,0x30,0x00,0x3f,0x90,0x22,0x70,0x02,0x10,0x02,0x10,0x02,0x10,0x0e,0x10,0x11,0x30,0x20,0xe0,0x80,0x00,0x80,0x00,0x80,0x00,0x80,0x00,0x80,0x00,0x80,0x00,0x80,0x00,0x80,0x00,0x80,0x00,0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x30,0x20,0x10,0x38,0x10,0x2f,0xd0,0x20,0x30,0x20,0x10,0x00,0x10,0x00,0x10,0x00,0x30,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x10,0x38,0x10,0x27,0xd0,0x20,0x30,0x20,0x10,0x00,0x10,0x00,0x10,0x20,0x00,0x20,0x00,0x3f,0x10,0x20,0xf0,0x00,0x30,0x07,0xc0,0x06,0x00,0x21,0x00,0x20,0xc0,0x3c,0x20,0x27,0xf0,0x00,0x10,0x20,0x10,0x30,0x00,0x3f,0x90,0x21,0x70,0x21,0x10,0x21,0x10,0x23,0x90,0x20,0x10,0x38,0x10,0x00,0x30
+};
+
+const unsigned char image_bt_Layer_9_bits[] = {
+    0x00,0x02,0x00,0x00,0x0f,0x00,0x00,0x0f,0x00,0x00,0x07,0x80,0x00,0x07,0xc0,0x00,0xc3,0xc0,0x01,0xc1,0xe0,0x01,0xe1,0xe0,0x01,0xe1,0xe0,0x00,0xf0,0xf0,0x10,0xf0,0xf0,0x38,0x70,0xf0,0x38,0x78,0xf0,0xf8,0x78,0xf0,0xf8,0x78,0xf0,0x38,0x78,0xf0,0x38,0x70,0xf0,0x10,0xf0,0xf0,0x00,0xf0,0xf0,0x01,0xe1,0xe0,0x01,0xe1,0xe0,0x01,0xc1,0xe0,0x00,0xc3,0xc0,0x00,0x07,0xc0,0x00,0x07,0x80,0x00,0x0f,0x00,0x00,0x0f,0x00,0x00,0x06,0x00
+};
+
+const unsigned char image_bt_Layer_10_bits[] = {
+    0x00,0x00,0x00,0xc0,0x00,0x00,0x00,0x10,0x00,0x00,0x03,0x88,0x00,0x00,0x00,0x24,0x00,0x00,0x29,0x90,0x00,0x00,0x44,0x42,0x00,0x00,0xa2,0x2a,0x00,0x01,0x31,0x28,0x00,0x02,0xc0,0x80,0x00,0x05,0x4c,0x40,0x00,0x09,0x90,0x20,0x00,0x16,0x19,0x20,0x00,0x22,0x61,0xa0,0x00,0x40,0x26,0x40,0x00,0x84,0x08,0x80,0x01,0x1b,0x09,0x00,0x02,0x21,0x32,0x00,0x04,0x21,0x04,0x00,0x09,0x21,0x08,0x00,0x15,0x13,0x10,0x00,0x26,0x0e,0x20,0x00,0x58,0x00,0x40,0x00,0x89,0x80,0x80,0x00,0x32,0x99,0x00,0x00,0x03,0x22,0x00,0x00,0x8c,0x34,0x00,0x00,0x44,0xc8,0x00,0x00,0x21,0x50,0x00,0x00,0x11,0x20,0x00,0x00,0x08,0x40,0x00,0x00,0x04,0x80,0x00,0x00
+};
+
+// IR menu bitmap data
+const unsigned char image_ir_Layer_2_bits[] = {
+    0x0f,0xf0,0x0f,0xf0,0x30,0x00,0x30,0x00,0xc3,0xc0,0xc3,0xc0,0xcc,0x30,0xcc,0x30,0xcc,0x30,0xcc,0x30,0xc3,0xc0,0xc3,0xc0,0xc0,0x00,0xc0,0x00,0xc0,0x00,0xc0,0x00,0xcc,0x00,0xcc,0x00,0xc3,0x00,0xc3,0x00,0xc0,0xc0,0xc0,0xc0,0xcc,0x30,0xcc,0x30,0xc3,0x00,0xc3,0x00,0xc0,0xc0,0xc0,0xc0,0xcc,0x30,0xcc,0x30,0xc3,0x00,0xc3,0x00,0xc0,0xc0,0xc0,0xc0,0xcc,0x30,0xcc,0x30,0xc3,0x00,0xc3,0x00,0xc0,0xc0,0xc0,0xc0,0xcc,0x30,0xcc,0x30,0xc3,0x00,0xc3,0x00,0xc0,0xc0,0xc0,0xc0,0xcc,0x30,0xcc,0x30,0xc3,0x00,0xc3,0x00,0xc0,0xc0,0xc0,0xc0,0xc0,0x30,0xc0,0x30,0xc0,0x00,0xc0,0x00,0x30,0x00,0x30,0x00,0x3c,0x00,0x3c,0x00,0x3f,0x00,0x3f,0x00,0x3f,0xc0,0x3f,0xc0,0x3f,0xf0,0x3f,0xf0,0x33,0xf0,0x33,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0
+};
+
+const unsigned char image_ir_Layer_3_bits[] = {
+    0x3f,0xf8,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x38,0x38,0x08,0x20,0x08,0x20,0x07,0xc0
+};
+
+const unsigned char image_ir_Layer_6_bits[] = {
+    0x0f,0x00,0x10,0xc0,0x20,0x20,0x20,0x30,0x20,0x10,0x20,0x10,0x20,0x10,0x10,0x20,0x00,0x70,0x00,0x00,0x00,0x00,0x1e,0x10,0x31,0xf0,0x20,0x10,0x20,0x10,0x20,0x00,0x30,0x00,0x10,0x00,0x0f,0x10,0x01,0xf0,0x00,0x10,0x20,0x00,0x30,0x00,0x3f,0x90,0x22,0x70,0x02,0x10,0x02,0x10,0x02,0x10,0x0e,0x10,0x11,0x30,0x20,0xe0,0x00,0x00,0x20,0x00,0x30,0x00,0x3f,0x90,0x22,0x70,0x02,0x10,0x02,0x10,0x02,0x10,0x0e,0x10,0x11,0x30,0x20,0xe0,0x80,0x00,0x80,0x00,0x80,0x00,0x80,0x00,0x80,0x00,0x80,0x00,0x80,0x00,0x80,0x00,0x80,0x00,0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x30,0x20,0x10,0x38,0x10,0x2f,0xd0,0x20,0x30,0x20,0x10,0x00,0x10,0x00,0x10,0x00,0x30,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x10,0x38,0x10,0x27,0xd0,0x20,0x30,0x20,0x10,0x00,0x10,0x00,0x10,0x20,0x00,0x20,0x00,0x3f,0x10,0x20,0xf0,0x00,0x30,0x07,0xc0,0x06,0x00,0x21,0x00,0x20,0xc0,0x3c,0x20,0x27,0xf0,0x00,0x10,0x20,0x10,0x30,0x00,0x3f,0x90,0x21,0x70,0x21,0x10,0x21,0x10,0x23,0x90,0x20,0x10,0x38,0x10,0x00,0x30
+};
+
+const unsigned char image_ir_Layer_8_bits[] = {
+    0x00,0x00,0x00,0x01,0xf8,0x00,0x00,0x00,0x00,0x00,0x1c,0x00,0x00,0x00,0x00,0x00,0x03,0x00,0x00,0x00,0x00,0x00,0xe1,0x80,0x00,0x00,0x00,0x00,0x38,0xc0,0x00,0x00,0x00,0x00,0x06,0x60,0x00,0x00,0x00,0x3c,0xe3,0x20,0x00,0x00,0x00,0xc6,0x19,0x30,0x00,0x00,0x00,0x83,0x0d,0x90,0x00,0x00,0x01,0x31,0x84,0x98,0x00,0x00,0x02,0x38,0xc6,0x98,0x00,0x00,0x04,0x90,0x66,0xc8,0x00,0x00,0x09,0xc0,0x30,0x48,0x00,0x00,0x12,0xc7,0x18,0x08,0x00,0x00,0x27,0x03,0x0c,0x00,0x00,0x00,0x43,0x18,0x04,0x00,0x00,0x00,0x98,0x1c,0xe6,0x00,0x00,0x01,0x1c,0x68,0x64,0x00,0x00,0x02,0x08,0x73,0x2c,0x00,0x00,0x04,0x00,0x23,0xd8,0x00,0x00,0x08,0x00,0x0d,0xb0,0x00,0x00,0x10,0x7c,0x0e,0x20,0x00,0x00,0x20,0xfe,0x36,0xc0,0x00,0x00,0x41,0x86,0x31,0x80,0x00,0x00,0x81,0x03,0x3b,0x00,0x00,0x01,0x01,0x03,0x02,0x00,0x00,0x02,0x31,0x83,0x0c,0x00,0x00,0x06,0x31,0x86,0x18,0x00,0x00,0x0d,0xc0,0xfc,0x10,0x00,0x00,0x18,0xc0,0x78,0x20,0x00,0x00,0x26,0x40,0x00,0xc0,0x00,0x00,0x67,0x18,0x00,0x80,0x00,0x00,0xdb,0x1c,0x41,0x00,0x00,0x00,0x9c,0x58,0xe2,0x00,0x00,0x00,0x8c,0xe1,0x64,0x00,0x00,0x00,0x81,0x63,0x88,0x00,0x00,0x00,0xc3,0x81,0x98,0x00,0x00,0x00,0x61,0x8c,0x20,0x00,0x00,0x00,0x10,0x0e,0x60,0x00,0x00,0x00,0x08,0x34,0xc0,0x00,0x00,0x00,0x0c,0x39,0x80,0x00,0x00,0x00,0x02,0x13,0x00,0x00,0x00,0x00,0x01,0x06,0x00,0x00,0x00,0x00,0x00,0xdc,0x00,0x00,0x00,0x00,0x00,0x78,0x00,0x00,0x00,0x00
+};
+
+const unsigned char image_ir_Layer_9_bits[] = {
+    0xc0,0x0c,0xc0,0x0c,0xff,0xfc,0xff,0xfc,0xc0,0x0c,0xc0,0x0c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xff,0xfc,0xff,0xfc,0x03,0x0c,0x03,0x0c,0x0f,0x0c,0x0f,0x0c,0x33,0x0c,0x33,0x0c,0xc0,0xf0,0xc0,0xf0
+};
+
+const unsigned char image_ir_Layer_10_bits[] = {
+    0x00,0x7e,0x00,0x01,0xc3,0x80,0x03,0x00,0xc0,0x00,0x3e,0x00,0x00,0xc3,0x00,0x00,0x00,0x00,0x00,0x3c,0x00,0x00,0x04,0x00,0x00,0x00,0x00,0x04,0x18,0x20,0x06,0x00,0x60,0x03,0x00,0xc0,0x03,0x81,0xc0,0x01,0xc3,0x80,0x00,0xe7,0x00,0x00,0x66,0x00,0x00,0x3c,0x00,0xff,0xff,0xff,0x7f,0xff,0xfe,0x38,0x7e,0x0c,0x18,0xe7,0x18,0x0d,0xc3,0xb0,0x07,0x81,0xe0,0x03,0x00,0xc0,0x00,0x18,0x00,0x00,0x00,0x00,0x00,0x24,0x00,0x00,0x3c,0x00,0x00,0x00,0x00,0x00,0xc3,0x00,0x00,0x3c,0x00,0x03,0x00,0xc0,0x01,0xc3,0x80,0x00,0x7e,0x00
+};
+
+const unsigned char image_ir_Layer_11_bits[] = {
+    0x00,0x00,0x3e,0x00,0x00,0x00,0xc3,0x80,0x80,0x01,0x00,0xc0,0x80,0x02,0x7e,0x40,0xf0,0x00,0xc1,0x00,0xbf,0x00,0x3c,0x00,0x91,0xf0,0x66,0x00,0x8b,0x7e,0x00,0x00,0x86,0x33,0xfc,0x00,0x86,0x33,0xfc,0x00,0x8b,0x7e,0x00,0x00,0x99,0xf0,0x66,0x00,0xbf,0x00,0x1c,0x00,0xf0,0x00,0xc1,0x00,0x80,0x02,0x7e,0x40,0x80,0x03,0x00,0xc0,0x00,0x00,0xc3,0x80,0x00,0x00,0x7e,0x00
+};
+
+// RF menu bitmap data
+const unsigned char image_rf_Layer_7_bits[] = {
+    0x0f,0xf0,0x0f,0xf0,0x30,0x00,0x30,0x00,0xc3,0xc0,0xc3,0xc0,0xcc,0x30,0xcc,0x30,0xcc,0x30,0xcc,0x30,0xc3,0xc0,0xc3,0xc0,0xc0,0x00,0xc0,0x00,0xc0,0x00,0xc0,0x00,0xcc,0x00,0xcc,0x00,0xc3,0x00,0xc3,0x00,0xc0,0xc0,0xc0,0xc0,0xcc,0x30,0xcc,0x30,0xc3,0x00,0xc3,0x00,0xc0,0xc0,0xc0,0xc0,0xcc,0x30,0xcc,0x30,0xc3,0x00,0xc3,0x00,0xc0,0xc0,0xc0,0xc0,0xcc,0x30,0xcc,0x30,0xc3,0x00,0xc3,0x00,0xc0,0xc0,0xc0,0xc0,0xcc,0x30,0xcc,0x30,0xc3,0x00,0xc3,0x00,0xc0,0xc0,0xc0,0xc0,0xcc,0x30,0xcc,0x30,0xc3,0x00,0xc3,0x00,0xc0,0xc0,0xc0,0xc0,0xc0,0x30,0xc0,0x30,0xc0,0x00,0xc0,0x00,0x30,0x00,0x30,0x00,0x3c,0x00,0x3c,0x00,0x3f,0x00,0x3f,0x00,0x3f,0xc0,0x3f,0xc0,0x3f,0xf0,0x3f,0xf0,0x33,0xf0,0x33,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0
+};
+
+const unsigned char image_rf_Layer_9_bits[] = {
+    0x3f,0xf8,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x38,0x38,0x08,0x20,0x08,0x20,0x07,0xc0
+};
+
+const unsigned char image_Layer_12_bits[] = {
+    0xff,0xfc,0xff,0xfc,0x03,0x0c,0x03,0x0c,0x0f,0x0c,0x0f,0x0c,0x33,0x0c,0x33,0x0c,0xc0,0xf0,0xc0,0xf0,0x00,0x00,0x00,0x00,0xff,0xfc,0xff,0xfc,0x03,0x0c,0x03,0x0c,0x03,0x0c,0x03,0x0c,0x03,0x0c,0x03,0x0c,0x00,0x0c,0x00,0x0c
+};
+
+const unsigned char image_Layer_13_bits[] = {
+    0x0f,0x00,0x10,0xc0,0x20,0x20,0x20,0x30,0x20,0x10,0x20,0x10,0x20,0x10,0x10,0x20,0x00,0x70,0x00,0x00,0x00,0x00,0x1e,0x10,0x31,0xf0,0x20,0x10,0x20,0x10,0x20,0x00,0x30,0x00,0x10,0x00,0x0f,0x10,0x01,0xf0,0x00,0x10,0x20,0x00,0x30,0x00,0x3f,0x90,0x22,0x70,0x02,0x10,0x02,0x10,0x02,0x10,0x0e,0x10,0x11,0x30,0x20,0xe0,0x00,0x00,0x20,0x00,0x30,0x00,0x3f,0x90,0x22,0x70,0x02,0x10,0x02,0x10,0x02,0x10,0x0e,0x10,0x11,0x30,0x20,0xe0,0x80,0x00,0x80,0x00,0x80,0x00,0x80,0x00,0x80,0x00,0x80,0x00,0x80,0x00,0x80,0x00,0x80,0x00,0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x30,0x20,0x10,0x38,0x10,0x2f,0xd0,0x20,0x30,0x20,0x10,0x00,0x10,0x00,0x10,0x00,0x30,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x10,0x38,0x10,0x27,0xd0,0x20,0x30,0x20,0x10,0x00,0x10,0x00,0x10,0x20,0x00,0x20,0x00,0x3f,0x10,0x20,0xf0,0x00,0x30,0x07,0xc0,0x06,0x00,0x21,0x00,0x20,0xc0,0x3c,0x20,0x27,0xf0,0x00,0x10,0x20,0x10,0x30,0x00,0x3f,0x90,0x21,0x70,0x21,0x10,0x21,0x10,0x23,0x90,0x20,0x10,0x38,0x10,0x00,0x30
+};
+
+const unsigned char image_Layer_14_bits[] = {
+    0x00,0x00,0x00,0x00,0x0f,0xfc,0x00,0x00,0x00,0x00,0x00,0x0f,0xfc,0x00,0x00,0x00,0x00,0x00,0xf0,0x0f,0xc0,0x00,0x00,0x00,0x00,0xf0,0x0f,0xc0,0xc0,0x00,0x00,0x03,0x00,0x00,0xf0,0xc0,0x00,0x00,0x03,0x00,0x00,0xf0,0xc0,0x00,0x00,0x0c,0x3f,0xfc,0x30,0xc0,0x00,0x00,0x0c,0x3f,0xfc,0x30,0xff,0x00,0x00,0x00,0xf0,0x03,0x00,0xff,0x00,0x00,0x00,0xf0,0x03,0x00,0xcf,0xff,0x00,0x00,0x0f,0xf0,0x00,0xcf,0xff,0x00,0x00,0x0f,0xf0,0x00,0xc3,0x03,0xff,0x00,0x3c,0x3c,0x00,0xc3,0x03,0xff,0x00,0x3c,0x3c,0x00,0xc0,0xcf,0x3f,0xfc,0x00,0x00,0x00,0xc0,0xcf,0x3f,0xfc,0x00,0x00,0x00,0xc0,0x3c,0x0f,0x0f,0xff,0xf0,0x00,0xc0,0x3c,0x0f,0x0f,0xff,0xf0,0x00,0xc0,0x3c,0x0f,0x0f,0xff,0xf0,0x00,0xc0,0x3c,0x0f,0x0f,0xff,0xf0,0x00,0xc0,0xcf,0x3f,0xfc,0x00,0x00,0x00,0xc0,0xcf,0x3f,0xfc,0x00,0x00,0x00,0xc3,0xc3,0xff,0x00,0x3c,0x3c,0x00,0xc3,0xc3,0xff,0x00,0x3c,0x3c,0x00,0xcf,0xff,0x00,0x00,0x03,0xf0,0x00,0xcf,0xff,0x00,0x00,0x03,0xf0,0x00,0xff,0x00,0x00,0x00,0xf0,0x03,0x00,0xff,0x00,0x00,0x00,0xf0,0x03,0x00,0xc0,0x00,0x00,0x0c,0x3f,0xfc,0x30,0xc0,0x00,0x00,0x0c,0x3f,0xfc,0x30,0xc0,0x00,0x00,0x0f,0x00,0x00,0xf0,0xc0,0x00,0x00,0x0f,0x00,0x00,0xf0,0x00,0x00,0x00,0x00,0xf0,0x0f,0xc0,0x00,0x00,0x00,0x00,0xf0,0x0f,0xc0,0x00,0x00,0x00,0x00,0x3f,0xfc,0x00,0x00,0x00,0x00,0x00,0x3f,0xfc,0x00
+};
+
+const unsigned char image_Layer_15_bits[] = {
+    0x00,0x00,0x10,0x00,0x00,0xc8,0x00,0x00,0x14,0x00,0x01,0x2a,0x00,0x0c,0x92,0x00,0x12,0x54,0x00,0x29,0x20,0x00,0x52,0x10,0x00,0xa2,0x50,0x01,0x04,0x90,0x02,0x00,0xa0,0x04,0xb1,0x40,0x09,0x12,0x80,0x15,0x11,0x00,0x24,0xb2,0x00,0x48,0x04,0x00,0x96,0x08,0x00,0x68,0xd0,0x00,0x11,0xa0,0x00,0x12,0x40,0x00,0x04,0x80,0x00,0x01,0x00,0x00,0x02,0x00,0x00
+};
+
+const unsigned char image_nrf_4_bits[] = {
+    0x00,0x00,0x01,0x00,0xff,0xff,0xe2,0x80,0x87,0xf8,0x01,0x00,0xa7,0xfc,0xfd,0x40,0x97,0xf8,0x7d,0x00,0x87,0xff,0xe2,0x80,0xa7,0xf8,0xe0,0x80,0x97,0xfd,0xe0,0x00,0x87,0xfa,0xe0,0x00,0xa7,0xdf,0xe0,0x00,0x86,0x1d,0xe0,0x00,0x96,0x1d,0xe0,0x00,0xa4,0x0e,0xe0,0x00,0x84,0x0d,0xe0,0x00,0x94,0x0e,0xe0,0x00,0xa7,0xd9,0xe0,0x00,0x87,0xf8,0xe0,0x00,0xff,0xff,0xe0,0x00
+};
+
+// NRF menu bitmap data
+const unsigned char image_nrf_Layer_7_bits[] = {
+    0x0f,0xf0,0x0f,0xf0,0x30,0x00,0x30,0x00,0xc3,0xc0,0xc3,0xc0,0xcc,0x30,0xcc,0x30,0xcc,0x30,0xcc,0x30,0xc3,0xc0,0xc3,0xc0,0xc0,0x00,0xc0,0x00,0xc0,0x00,0xc0,0x00,0xcc,0x00,0xcc,0x00,0xc3,0x00,0xc3,0x00,0xc0,0xc0,0xc0,0xc0,0xcc,0x30,0xcc,0x30,0xc3,0x00,0xc3,0x00,0xc0,0xc0,0xc0,0xc0,0xcc,0x30,0xcc,0x30,0xc3,0x00,0xc3,0x00,0xc0,0xc0,0xc0,0xc0,0xcc,0x30,0xcc,0x30,0xc3,0x00,0xc3,0x00,0xc0,0xc0,0xc0,0xc0,0xcc,0x30,0xcc,0x30,0xc3,0x00,0xc3,0x00,0xc0,0xc0,0xc0,0xc0,0xcc,0x30,0xcc,0x30,0xc3,0x00,0xc3,0x00,0xc0,0xc0,0xc0,0xc0,0xc0,0x30,0xc0,0x30,0xc0,0x00,0xc0,0x00,0x30,0x00,0x30,0x00,0x3c,0x00,0x3c,0x00,0x3f,0x00,0x3f,0x00,0x3f,0xc0,0x3f,0xc0,0x3f,0xf0,0x3f,0xf0,0x33,0xf0,0x33,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0
+};
+
+const unsigned char image_nrf_Layer_9_bits[] = {
+    0x3f,0xf8,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x38,0x38,0x08,0x20,0x08,0x20,0x07,0xc0
+};
+
+const unsigned char image_nrf_Layer_13_bits[] = {
+    0x0f,0x00,0x10,0xc0,0x20,0x20,0x20,0x30,0x20,0x10,0x20,0x10,0x20,0x10,0x10,0x20,0x00,0x70,0x00,0x00,0x00,0x00,0x1e,0x10,0x31,0xf0,0x20,0x10,0x20,0x10,0x20,0x00,0x30,0x00,0x10,0x00,0x0f,0x10,0x01,0xf0,0x00,0x10,0x20,0x00,0x30,0x00,0x3f,0x90,0x22,0x70,0x02,0x10,0x02,0x10,0x02,0x10,0x0e,0x10,0x11,0x30,0x20,0xe0,0x00,0x00,0x20,0x00,0x30,0x00,0x3f,0x90,0x22,0x70,0x02,0x10,0x02,0x10,0x02,0x10,0x0e,0x10,0x11,0x30,0x20,0xe0,0x80,0x00,0x80,0x00,0x80,0x00,0x80,0x00,0x80,0x00,0x80,0x00,0x80,0x00,0x80,0x00,0x80,0x00,0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x30,0x20,0x10,0x38,0x10,0x2f,0xd0,0x20,0x30,0x20,0x10,0x00,0x10,0x00,0x10,0x00,0x30,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x10,0x38,0x10,0x27,0xd0,0x20,0x30,0x20,0x10,0x00,0x10,0x00,0x10,0x20,0x00,0x20,0x00,0x3f,0x10,0x20,0xf0,0x00,0x30,0x07,0xc0,0x06,0x00,0x21,0x00,0x20,0xc0,0x3c,0x20,0x27,0xf0,0x00,0x10,0x20,0x10,0x30,0x00,0x3f,0x90,0x21,0x70,0x21,0x10,0x21,0x10,0x23,0x90,0x20,0x10,0x38,0x10,0x00,0x30
+};
+
+const unsigned char image_nrf_Layer_14_bits[] = {
+    0x00,0x00,0x3e,0x00,0x00,0x00,0xc3,0x80,0x80,0x01,0x00,0xc0,0x80,0x02,0x7e,0x40,0xf0,0x00,0xc1,0x00,0xbf,0x00,0x3c,0x00,0x91,0xf0,0x66,0x00,0x8b,0x7e,0x00,0x00,0x86,0x33,0xfc,0x00,0x86,0x33,0xfc,0x00,0x8b,0x7e,0x00,0x00,0x99,0xf0,0x66,0x00,0xbf,0x00,0x1c,0x00,0xf0,0x00,0xc1,0x00,0x80,0x02,0x7e,0x40,0x80,0x03,0x00,0xc0,0x00,0x00,0xc3,0x80,0x00,0x00,0x7e,0x00
+};
+
+const unsigned char image__5ti7rmt_RADIOradio_bits[] = {
+    0xe0,0x00,0x00,0x40,0x02,0x00,0x69,0xcc,0x00,0x07,0xcc,0x00,0x51,0xcc,0x00,0x77,0xc5,0x00,0x77,0xc5,0x00,0x77,0xfd,0x00,0x71,0xfc,0x80,0x72,0x0c,0xe0,0x74,0x0c,0xd0,0x71,0xfc,0xf0,0x75,0xfd,0xf8,0x75,0xfd,0xfc,0x75,0xfc,0x3c,0x75,0xfc,0xb4,0x75,0xfd,0x2e,0x75,0xfd,0xda,0x71,0xfd,0xdc,0x74,0x0c,0xb0,0x76,0x04,0xa0,0x77,0xfc,0x00,0x77,0xfc,0x00,0x56,0x44,0x00,0x06,0x64,0x00,0x04,0xc8,0x00,0x01,0xf0,0x00
+};
+
+const unsigned char image_nrf_1_bits[] = {
+    0x00,0x00,0x00,0x00,0x00,0x08,0xff,0xff,0xff,0xff,0xe0,0x0c,0xff,0xff,0xff,0xff,0xe0,0x26,0xc0,0xff,0xff,0xff,0xe0,0x32,0xc0,0x7f,0xff,0x00,0x00,0x13,0xcc,0x7f,0xff,0xf1,0xff,0x99,0xda,0x7f,0xff,0xc7,0xff,0x99,0xda,0x7f,0xff,0x1f,0xff,0x99,0xcc,0x7f,0xff,0x01,0xff,0x11,0xc0,0x7f,0xff,0xfc,0x00,0x13,0xc0,0x7f,0xff,0xff,0xe0,0x32,0xce,0x7f,0xff,0x01,0xe0,0x26,0xd2,0x7f,0xff,0x01,0xe0,0x0c,0xce,0x7f,0xff,0xc9,0xe0,0x08,0xc0,0x7f,0xff,0xc9,0xe0,0x00,0xc0,0x7f,0xff,0x01,0xe0,0x00,0xcc,0x7f,0xff,0x63,0xe0,0x00,0xda,0x7f,0x5f,0xff,0xe0,0x00,0xda,0x7d,0x5f,0x01,0xe0,0x00,0xcc,0x7d,0x5f,0x01,0xe0,0x00,0xc0,0x70,0x07,0xc9,0xe0,0x00,0xc0,0x40,0x03,0xc9,0xe0,0x00,0xce,0x70,0x07,0xc9,0xe0,0x00,0xd2,0x40,0x03,0x7f,0xe0,0x00,0xce,0x70,0x07,0x33,0xe0,0x00,0xc0,0x40,0x03,0x19,0xe0,0x00,0xc0,0x70,0x07,0x41,0xe0,0x00,0xcc,0x40,0x03,0x73,0xe0,0x00,0xda,0x70,0x07,0x9f,0xe0,0x00,0xda,0x7d,0x5f,0x8f,0xe0,0x00,0xce,0x7d,0x5f,0xb3,0xe0,0x00,0xc0,0x7f,0xff,0x01,0xe0,0x00,0xc0,0xff,0xff,0xbf,0xe0,0x00,0xff,0xff,0xff,0xff,0xe0,0x00,0xff,0xff,0xff,0xff,0xe0,0x00
+};
+
+const unsigned char image_nrf_Layer_17_bits[] = {
+    0xff,0xfc,0xff,0xfc,0x00,0xc0,0x00,0xc0,0x03,0x00,0x03,0x00,0x0c,0x00,0x0c,0x00,0xff,0xfc,0xff,0xfc,0x00,0x00,0x00,0x00,0xff,0xfc,0xff,0xfc,0x03,0x0c,0x03,0x0c,0x0f,0x0c,0x0f,0x0c,0x33,0x0c,0x33,0x0c,0xc0,0xf0,0xc0,0xf0,0x00,0x00,0x00,0x00,0xff,0xfc,0xff,0xfc,0x03,0x0c,0x03,0x0c,0x03,0x0c,0x03,0x0c,0x03,0x0c,0x03,0x0c,0x00,0x0c,0x00,0x0c
+};
+
+// Radio menu bitmap data
+const unsigned char image_radio_Layer_2_bits[] = {
+    0x3f,0xf8,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x38,0x38,0x08,0x20,0x08,0x20,0x07,0xc0
+};
+
+const unsigned char image_radio_Layer_3_bits[] = {
+    0x0f,0xf0,0x0f,0xf0,0x30,0x00,0x30,0x00,0xc3,0xc0,0xc3,0xc0,0xcc,0x30,0xcc,0x30,0xcc,0x30,0xcc,0x30,0xc3,0xc0,0xc3,0xc0,0xc0,0x00,0xc0,0x00,0xc0,0x00,0xc0,0x00,0xcc,0x00,0xcc,0x00,0xc3,0x00,0xc3,0x00,0xc0,0xc0,0xc0,0xc0,0xcc,0x30,0xcc,0x30,0xc3,0x00,0xc3,0x00,0xc0,0xc0,0xc0,0xc0,0xcc,0x30,0xcc,0x30,0xc3,0x00,0xc3,0x00,0xc0,0xc0,0xc0,0xc0,0xcc,0x30,0xcc,0x30,0xc3,0x00,0xc3,0x00,0xc0,0xc0,0xc0,0xc0,0xcc,0x30,0xcc,0x30,0xc3,0x00,0xc3,0x00,0xc0,0xc0,0xc0,0xc0,0xcc,0x30,0xcc,0x30,0xc3,0x00,0xc3,0x00,0xc0,0xc0,0xc0,0xc0,0xc0,0x30,0xc0,0x30,0xc0,0x00,0xc0,0x00,0x30,0x00,0x30,0x00,0x3c,0x00,0x3c,0x00,0x3f,0x00,0x3f,0x00,0x3f,0xc0,0x3f,0xc0,0x3f,0xf0,0x3f,0xf0,0x33,0xf0,0x33,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0
+};
+
+const unsigned char image_radio_Layer_6_bits[] = {
+    0x70,0x00,0x00,0x00,0x00,0x00,0xf8,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x70,0x00,0x00,0x70,0x00,0x00,0x18,0x00,0x00,0x02,0x3e,0xb5,0xc8,0x00,0x00,0x38,0x82,0xb5,0xe0,0x00,0x00,0x0e,0x1a,0xb5,0xe0,0x00,0x00,0x00,0x3a,0xb5,0xe0,0x00,0x00,0x78,0x1a,0xb5,0xe0,0x00,0x00,0x77,0x46,0xb5,0xe4,0x00,0x00,0x67,0x7e,0xb5,0xe6,0x00,0x00,0x6f,0x7e,0xb5,0x66,0x00,0x00,0x6f,0x7e,0xb5,0x66,0x00,0x00,0x6f,0x7e,0xb5,0x67,0x00,0x00,0x6f,0x3e,0xb5,0x67,0x00,0x00,0x6f,0x3f,0xff,0xe3,0x00,0x00,0x6f,0x3e,0x22,0x23,0x00,0x00,0x6f,0x03,0xaa,0xa0,0xc0,0x00,0x6f,0x6f,0xba,0xa7,0x70,0x00,0x6f,0x4c,0x00,0xe1,0xec,0x00,0x6f,0x43,0xff,0x27,0xfc,0x00,0x6f,0x64,0x00,0xe5,0xf6,0x00,0x6f,0x77,0xff,0xe5,0xf7,0x00,0x6f,0x47,0xff,0xe5,0xfb,0x00,0x6f,0x67,0xff,0xe7,0xfb,0x80,0x6f,0x67,0xff,0xe6,0xff,0xc0,0x6f,0x47,0xff,0xe6,0xfe,0x00,0x6f,0x67,0xff,0xe6,0xfe,0xe0,0x6f,0x67,0xff,0xe7,0xe3,0x80,0x6f,0x67,0xff,0xe5,0x1f,0xe0,0x6f,0x67,0xff,0xe2,0xf9,0x70,0x6f,0x67,0xff,0xe5,0xce,0x34,0x6f,0x47,0xff,0xe3,0x77,0x3c,0x6f,0x77,0xff,0xe7,0x1c,0xfc,0x6f,0x47,0xff,0xe7,0x67,0x1c,0x6f,0x67,0xff,0xe7,0xf3,0x98,0x6f,0x67,0xff,0xe7,0x9c,0xe8,0x6f,0x47,0xff,0xe3,0xb3,0xb0,0x6f,0x77,0xff,0xe1,0xb9,0xc0,0x6f,0x74,0x00,0xe1,0x8e,0x40,0x6f,0x77,0xff,0xa0,0xf3,0x00,0x6f,0x7c,0x00,0x60,0xd8,0x00,0x6f,0x62,0x22,0x20,0x00,0x00,0x6f,0x7b,0xba,0xa0,0x00,0x00,0x6f,0x6a,0xaa,0xa0,0x00,0x00,0x6f,0x7f,0xff,0xe0,0x00,0x00,0x77,0x72,0xe0,0xe0,0x00,0x00,0x73,0x6d,0x65,0x60,0x00,0x00,0x7c,0x6f,0x7d,0x60,0x00,0x00,0x00,0x6d,0x6d,0x60,0x00,0x00,0x00,0x61,0x61,0x60,0x00,0x00,0x00,0x30,0xf0,0xc0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0xff,0x00,0x00,0x00
+};
+
+const unsigned char image_radio_Layer_7_bits[] = {
+    0x0f,0x00,0x10,0xc0,0x20,0x20,0x20,0x30,0x20,0x10,0x20,0x10,0x20,0x10,0x10,0x20,0x00,0x70,0x00,0x00,0x00,0x00,0x1e,0x10,0x31,0xf0,0x20,0x10,0x20,0x10,0x20,0x00,0x30,0x00,0x10,0x00,0x0f,0x10,0x01,0xf0,0x00,0x10,0x20,0x00,0x30,0x00,0x3f,0x90,0x22,0x70,0x02,0x10,0x02,0x10,0x02,0x10,0x0e,0x10,0x11,0x30,0x20,0xe0,0x00,0x00,0x20,0x00,0x30,0x00,0x3f,0x90,0x22,0x70,0x02,0x10,0x02,0x10,0x02,0x10,0x0e,0x10,0x11,0x30,0x20,0xe0,0x80,0x00,0x80,0x00,0x80,0x00,0x80,0x00,0x80,0x00,0x80,0x00,0x80,0x00,0x80,0x00,0x80,0x00,0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x30,0x20,0x10,0x38,0x10,0x2f,0xd0,0x20,0x30,0x20,0x10,0x00,0x10,0x00,0x10,0x00,0x30,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x10,0x38,0x10,0x27,0xd0,0x20,0x30,0x20,0x10,0x00,0x10,0x00,0x10,0x20,0x00,0x20,0x00,0x3f,0x10,0x20,0xf0,0x00,0x30,0x07,0xc0,0x06,0x00,0x21,0x00,0x20,0xc0,0x3c,0x20,0x27,0xf0,0x00,0x10,0x20,0x10,0x30,0x00,0x3f,0x90,0x21,0x70,0x21,0x10,0x21,0x10,0x23,0x90,0x20,0x10,0x38,0x10,0x00,0x30
+};
+
+const unsigned char image_radio_Layer_8_bits[] = {
+    0xff,0xfc,0xff,0xfc,0x03,0x0c,0x03,0x0c,0x0f,0x0c,0x0f,0x0c,0x33,0x0c,0x33,0x0c,0xc0,0xf0,0xc0,0xf0,0x00,0x00,0x00,0x00,0xff,0xc0,0xff,0xc0,0x0c,0x30,0x0c,0x30,0x0c,0x0c,0x0c,0x0c,0x0c,0x30,0x0c,0x30,0xff,0xc0,0xff,0xc0,0x00,0x00,0x00,0x00,0xff,0xfc,0xff,0xfc,0xc0,0x0c,0xc0,0x0c,0xc0,0x0c,0xc0,0x0c,0xc0,0x0c,0xc0,0x0c,0x3f,0xf0,0x3f,0xf0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xc0,0x0c,0xc0,0x0c,0xff,0xfc,0xff,0xfc,0xc0,0x0c,0xc0,0x0c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3f,0xf0,0x3f,0xf0,0xc0,0x0c,0xc0,0x0c,0xc0,0x0c,0xc0,0x0c,0xc0,0x0c,0xc0,0x0c,0x3f,0xf0,0x3f,0xf0
+};
+
+const unsigned char image_radio_map_pin_bits[] = {
+    0x00,0x1f,0x00,0x00,0x7f,0x80,0x01,0xff,0xf0,0x0f,0xc0,0x70,0x1f,0xc0,0x38,0x3f,0x80,0x18,0x7f,0x80,0x08,0xff,0x80,0x08,0xff,0x80,0x08,0x7f,0x80,0x08,0x3f,0x80,0x18,0x1f,0x80,0x18,0x0f,0xc0,0x70,0x07,0xf0,0xf0,0x00,0xff,0xe0,0x00,0x7f,0x80
+};
+
+// GPS menu bitmap data
+const unsigned char image_gps_Layer_2_bits[] = {
+    0x3f,0xf8,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x38,0x38,0x08,0x20,0x08,0x20,0x07,0xc0
+};
+
+const unsigned char image_gps_Layer_3_bits[] = {
+    0x0f,0xf0,0x0f,0xf0,0x30,0x00,0x30,0x00,0xc3,0xc0,0xc3,0xc0,0xcc,0x30,0xcc,0x30,0xcc,0x30,0xcc,0x30,0xc3,0xc0,0xc3,0xc0,0xc0,0x00,0xc0,0x00,0xc0,0x00,0xc0,0x00,0xcc,0x00,0xcc,0x00,0xc3,0x00,0xc3,0x00,0xc0,0xc0,0xc0,0xc0,0xcc,0x30,0xcc,0x30,0xc3,0x00,0xc3,0x00,0xc0,0xc0,0xc0,0xc0,0xcc,0x30,0xcc,0x30,0xc3,0x00,0xc3,0x00,0xc0,0xc0,0xc0,0xc0,0xcc,0x30,0xcc,0x30,0xc3,0x00,0xc3,0x00,0xc0,0xc0,0xc0,0xc0,0xcc,0x30,0xcc,0x30,0xc3,0x00,0xc3,0x00,0xc0,0xc0,0xc0,0xc0,0xcc,0x30,0xcc,0x30,0xc3,0x00,0xc3,0x00,0xc0,0xc0,0xc0,0xc0,0xc0,0x30,0xc0,0x30,0xc0,0x00,0xc0,0x00,0x30,0x00,0x30,0x00,0x3c,0x00,0x3c,0x00,0x3f,0x00,0x3f,0x00,0x3f,0xc0,0x3f,0xc0,0x3f,0xf0,0x3f,0xf0,0x33,0xf0,0x33,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0
+};
+
+const unsigned char image_gps_Layer_6_bits[] = {
+    0x40,0x00,0x00,0x00,0x04,0x00,0x17,0xca,0x00,0x33,0xcc,0x00,0x63,0xcc,0x00,0x57,0xcd,0x00,0x77,0xc5,0x00,0x77,0xc5,0x00,0x77,0x55,0x00,0x77,0xfd,0x40,0x71,0xf5,0xe0,0x75,0xfc,0xd0,0x75,0xfd,0xf8,0x71,0xfd,0xf0,0x75,0xfd,0xd8,0x75,0xfd,0xe4,0x71,0xfd,0x56,0x71,0xfd,0x52,0x75,0xfd,0xae,0x75,0xfc,0xe8,0x75,0xfc,0xd0,0x75,0x54,0x00,0x77,0xfc,0x00,0x55,0xcc,0x00,0x67,0x64,0x00,0x04,0x44,0x00,0x00,0x00,0x00
+};
+
+const unsigned char image_gps_Layer_7_bits[] = {
+    0x0f,0x00,0x10,0xc0,0x20,0x20,0x20,0x30,0x20,0x10,0x20,0x10,0x20,0x10,0x10,0x20,0x00,0x70,0x00,0x00,0x00,0x00,0x1e,0x10,0x31,0xf0,0x20,0x10,0x20,0x10,0x20,0x00,0x30,0x00,0x10,0x00,0x0f,0x10,0x01,0xf0,0x00,0x10,0x20,0x00,0x30,0x00,0x3f,0x90,0x22,0x70,0x02,0x10,0x02,0x10,0x02,0x10,0x0e,0x10,0x11,0x30,0x20,0xe0,0x00,0x00,0x20,0x00,0x30,0x00,0x3f,0x90,0x22,0x70,0x02,0x10,0x02,0x10,0x02,0x10,0x0e,0x10,0x11,0x30,0x20,0xe0,0x80,0x00,0x80,0x00,0x80,0x00,0x80,0x00,0x80,0x00,0x80,0x00,0x80,0x00,0x80,0x00,0x80,0x00,0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x30,0x20,0x10,0x38,0x10,0x2f,0xd0,0x20,0x30,0x20,0x10,0x00,0x10,0x00,0x10,0x00,0x30,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x10,0x38,0x10,0x27,0xd0,0x20,0x30,0x20,0x10,0x00,0x10,0x00,0x10,0x20,0x00,0x20,0x00,0x3f,0x10,0x20,0xf0,0x00,0x30,0x07,0xc0,0x06,0x00,0x21,0x00,0x20,0xc0,0x3c,0x20,0x27,0xf0,0x00,0x10,0x20,0x10,0x30,0x00,0x3f,0x90,0x21,0x70,0x21,0x10,0x21,0x10,0x23,0x90,0x20,0x10,0x38,0x10,0x00,0x30
+};
+
+const unsigned char image_gps_Layer_8_bits[] = {
+    0x00,0x00,0x03,0xfe,0x00,0x00,0x00,0x00,0x3f,0xff,0xc0,0x00,0x00,0x00,0x3f,0xff,0xc0,0x00,0x00,0x01,0xff,0xff,0xf8,0x00,0x00,0x07,0xff,0xff,0xfc,0x00,0x00,0x3f,0xfe,0x00,0xff,0x00,0x00,0xff,0xf0,0x00,0x3f,0x00,0x00,0xff,0xf0,0x00,0x3f,0x00,0x03,0xff,0xe0,0x00,0x0f,0x80,0x07,0xff,0xc0,0x00,0x07,0x80,0x0f,0xff,0xc0,0x00,0x07,0x80,0x0f,0xff,0xc0,0x00,0x07,0x80,0x3f,0xff,0x80,0x00,0x03,0xc0,0x7f,0xff,0x80,0x00,0x03,0xc0,0xff,0xff,0x80,0x00,0x03,0xc0,0xff,0xff,0x80,0x00,0x03,0xc0,0xff,0xff,0x80,0x00,0x03,0xc0,0xff,0xff,0x80,0x00,0x03,0xc0,0x7f,0xff,0x80,0x00,0x03,0xc0,0x3f,0xff,0x80,0x00,0x03,0xc0,0x0f,0xff,0xc0,0x00,0x07,0x80,0x0f,0xff,0xc0,0x00,0x07,0x80,0x07,0xff,0xc0,0x00,0x07,0x80,0x03,0xff,0xe0,0x00,0x0f,0x80,0x00,0xff,0xf0,0x00,0x3f,0x00,0x00,0xff,0xf0,0x00,0x3f,0x00,0x00,0x3f,0xfe,0x00,0xff,0x00,0x00,0x07,0xff,0xff,0xfc,0x00,0x00,0x01,0xff,0xff,0xf8,0x00,0x00,0x00,0x3f,0xff,0xc0,0x00,0x00,0x00,0x3f,0xff,0xc0,0x00,0x00,0x00,0x03,0xfe,0x00,0x00
+};
+
+const unsigned char image_gps_Layer_9_bits[] = {
+    0x00,0x70,0x00,0x80,0x06,0x7a,0x03,0x80,0x0f,0x01,0x8e,0x80,0x1f,0x39,0xde,0x80,0x1f,0x7c,0x5d,0x80,0x1e,0x7e,0x53,0x80,0x20,0x7e,0x13,0x00,0xef,0x3d,0xce,0x00,0xef,0xbd,0xc2,0x00,0xef,0x81,0xc0,0x00,0xef,0xbd,0xc6,0x00,0x27,0x7c,0x4f,0x00,0x08,0x7e,0x13,0x00,0x1e,0x7e,0x53,0x80,0x1f,0x7d,0xdd,0x80,0x1f,0x39,0xde,0x80,0x0f,0x33,0x8f,0x80,0x00,0xf8,0x01,0x80,0x00,0x70,0x00,0x80
+};
+
+const unsigned char image_gps_Layer_10_bits[] = {
+    0x3f,0xf0,0x3f,0xf0,0xc0,0x0c,0xc0,0x0c,0xc0,0x0c,0xc0,0x0c,0xcc,0x0c,0xcc,0x0c,0xfc,0x3c,0xfc,0x3c,0x00,0x00,0x00,0x00,0xff,0xfc,0xff,0xfc,0x03,0x0c,0x03,0x0c,0x03,0x0c,0x03,0x0c,0x03,0x0c,0x03,0x0c,0x00,0xf0,0x00,0xf0,0x00,0x00,0x00,0x00,0x30,0xf0,0x30,0xf0,0xc3,0x0c,0xc3,0x0c,0xc3,0x0c,0xc3,0x0c,0xc3,0x0c,0xc3,0x0c,0x3c,0x30,0x3c,0x30
+};
+
+// RPI menu bitmap data
+const unsigned char image_rpi_Layer_2_bits[] = {
+    0x3f,0xf8,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x38,0x38,0x08,0x20,0x08,0x20,0x07,0xc0
+};
+
+const unsigned char image_rpi_Layer_3_bits[] = {
+    0x0f,0xf0,0x0f,0xf0,0x30,0x00,0x30,0x00,0xc3,0xc0,0xc3,0xc0,0xcc,0x30,0xcc,0x30,0xcc,0x30,0xcc,0x30,0xc3,0xc0,0xc3,0xc0,0xc0,0x00,0xc0,0x00,0xc0,0x00,0xc0,0x00,0xcc,0x00,0xcc,0x00,0xc3,0x00,0xc3,0x00,0xc0,0xc0,0xc0,0xc0,0xcc,0x30,0xcc,0x30,0xc3,0x00,0xc3,0x00,0xc0,0xc0,0xc0,0xc0,0xcc,0x30,0xcc,0x30,0xc3,0x00,0xc3,0x00,0xc0,0xc0,0xc0,0xc0,0xcc,0x30,0xcc,0x30,0xc3,0x00,0xc3,0x00,0xc0,0xc0,0xc0,0xc0,0xcc,0x30,0xcc,0x30,0xc3,0x00,0xc3,0x00,0xc0,0xc0,0xc0,0xc0,0xcc,0x30,0xcc,0x30,0xc3,0x00,0xc3,0x00,0xc0,0xc0,0xc0,0xc0,0xc0,0x30,0xc0,0x30,0xc0,0x00,0xc0,0x00,0x30,0x00,0x30,0x00,0x3c,0x00,0x3c,0x00,0x3f,0x00,0x3f,0x00,0x3f,0xc0,0x3f,0xc0,0x3f,0xf0,0x3f,0xf0,0x33,0xf0,0x33,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0
+};
+
+const unsigned char image_rpi_Layer_6_bits[] = {
+    0x00,0x00,0x3e,0x00,0x00,0x00,0xc0,0x00,0x00,0x3e,0x00,0x00,0x01,0xc0,0x00,0x01,0xff,0x80,0x00,0x07,0xc0,0x00,0x38,0x3f,0x8c,0x00,0x1f,0xc0,0x00,0xfe,0x0e,0x0f,0x80,0xff,0xc0,0x00,0xfe,0x00,0x03,0x80,0xf8,0xc0,0x00,0xfe,0x00,0x03,0x80,0xf8,0xc0,0x07,0xfe,0x0f,0x83,0xe3,0xf8,0xc0,0x07,0xfe,0x3f,0xf3,0xe3,0xe7,0xc0,0x07,0xfe,0x3f,0xf0,0x63,0xe7,0xc0,0x07,0xf8,0x3f,0xfc,0x63,0x1f,0xc0,0x07,0xf8,0x3f,0xfc,0x63,0x1f,0xc0,0x00,0xc0,0x3f,0xfc,0x03,0x1f,0x00,0x18,0x00,0x3f,0xfc,0x03,0x1f,0x00,0x18,0x3e,0x3f,0xf0,0x60,0xff,0x00,0xf8,0xfe,0x0f,0xf3,0xe0,0xf8,0x00,0xf8,0xfe,0x0f,0xf3,0xe0,0xf8,0x00,0xf8,0xff,0xcf,0xf3,0xe0,0x18,0x00,0xf8,0xff,0xc0,0x03,0xe0,0x00,0x00,0xf8,0xff,0xc0,0x03,0xe0,0x00,0x00,0xf8,0xff,0xcf,0xf3,0xe0,0x18,0x00,0xf8,0xff,0xcf,0xf3,0xe0,0x38,0x00,0xf8,0xfe,0x0f,0xf3,0xe0,0xf8,0x00,0x18,0x3e,0x3f,0xf0,0x60,0xff,0x00,0x18,0x00,0x3f,0xfc,0x03,0x1f,0x00,0x00,0xc0,0x3f,0xfc,0x03,0x1f,0x00,0x00,0xc0,0x3f,0xfc,0x03,0x1f,0x00,0x07,0xf8,0x3f,0xfc,0x63,0x1f,0xc0,0x07,0xfe,0x3f,0xf0,0x63,0xe7,0xc0,0x07,0xfe,0x3f,0xf3,0xe3,0xe7,0xc0,0x07,0xfe,0x0f,0x83,0xe3,0xf8,0xc0,0x07,0xfe,0x0f,0x83,0xe3,0xf8,0xc0,0x00,0xfe,0x00,0x03,0x80,0xf8,0xc0,0x00,0xfe,0x0e,0x0f,0x80,0xff,0xc0,0x00,0x38,0x3f,0x8c,0x00,0x1f,0xc0,0x00,0x01,0xff,0x80,0x00,0x07,0xc0,0x00,0x01,0xff,0x80,0x00,0x07,0xc0,0x00,0x00,0x3e,0x00,0x00,0x00,0xc0
+};
+
+const unsigned char image_rpi_Layer_7_bits[] = {
+    0x0f,0x00,0x10,0xc0,0x20,0x20,0x20,0x30,0x20,0x10,0x20,0x10,0x20,0x10,0x10,0x20,0x00,0x70,0x00,0x00,0x00,0x00,0x1e,0x10,0x31,0xf0,0x20,0x10,0x20,0x10,0x20,0x00,0x30,0x00,0x10,0x00,0x0f,0x10,0x01,0xf0,0x00,0x10,0x20,0x00,0x30,0x00,0x3f,0x90,0x22,0x70,0x02,0x10,0x02,0x10,0x02,0x10,0x0e,0x10,0x11,0x30,0x20,0xe0,0x00,0x00,0x20,0x00,0x30,0x00,0x3f,0x90,0x22,0x70,0x02,0x10,0x02,0x10,0x02,0x10,0x0e,0x10,0x11,0x30,0x20,0xe0,0x80,0x00,0x80,0x00,0x80,0x00,0x80,0x00,0x80,0x00,0x80,0x00,0x80,0x00,0x80,0x00,0x80,0x00,0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x30,0x20,0x10,0x38,0x10,0x2f,0xd0,0x20,0x30,0x20,0x10,0x00,0x10,0x00,0x10,0x00,0x30,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x10,0x38,0x10,0x27,0xd0,0x20,0x30,0x20,0x10,0x00,0x10,0x00,0x10,0x20,0x00,0x20,0x00,0x3f,0x10,0x20,0xf0,0x00,0x30,0x07,0xc0,0x06,0x00,0x21,0x00,0x20,0xc0,0x3c,0x20,0x27,0xf0,0x00,0x10,0x20,0x10,0x30,0x00,0x3f,0x90,0x21,0x70,0x21,0x10,0x21,0x10,0x23,0x90,0x20,0x10,0x38,0x10,0x00,0x30
+};
+
+const unsigned char image_rpi_Layer_8_bits[] = {
+    0x1f,0xf8,0x15,0x58,0x12,0x48,0x12,0x48,0x12,0x48,0x12,0x48,0x10,0x08,0x3f,0xfc,0x60,0x06,0xc0,0x03,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x83,0xc1,0x8e,0xf1,0x88,0x19,0x90,0x09,0x90,0x0d,0xb0,0x05,0xb2,0x25,0xb6,0x75,0xb6,0x35,0xb0,0x85,0x91,0x8d,0x9c,0x39,0x84,0x31,0x87,0xe1,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0xc0,0x03,0x75,0x5e,0x1f,0xf8
+};
+
+const unsigned char image_rpi_Layer_9_bits[] = {
+    0xff,0xfc,0xff,0xfc,0x03,0x0c,0x03,0x0c,0x0f,0x0c,0x0f,0x0c,0x33,0x0c,0x33,0x0c,0xc0,0xf0,0xc0,0xf0,0x00,0x00,0x00,0x00,0xff,0xfc,0xff,0xfc,0x03,0x0c,0x03,0x0c,0x03,0x0c,0x03,0x0c,0x03,0x0c,0x03,0x0c,0x00,0xf0,0x00,0xf0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xc0,0x0c,0xc0,0x0c,0xff,0xfc,0xff,0xfc,0xc0,0x0c,0xc0,0x0c
+};
+
+const unsigned char image_rpi_map_pin_bits[] = {
+    0x00,0x00,0xfe,0x00,0x00,0x07,0xff,0xc0,0x00,0x1f,0xff,0xf0,0x00,0x3f,0xff,0xf8,0x00,0xff,0x80,0xf8,0x03,0xfe,0x00,0x38,0x07,0xfc,0x00,0x1c,0x0f,0xf8,0x00,0x0c,0x1f,0xf8,0x00,0x0c,0x3f,0xf0,0x00,0x06,0x7f,0xf0,0x00,0x06,0xff,0xf0,0x00,0x06,0xff,0xf0,0x00,0x06,0xff,0xf0,0x00,0x06,0x7f,0xf0,0x00,0x06,0x3f,0xf0,0x00,0x06,0x1f,0xf8,0x00,0x0c,0x07,0xfc,0x00,0x1c,0x03,0xfe,0x00,0x38,0x00,0xff,0x80,0xf8,0x00,0x3f,0xff,0xf8,0x00,0x1f,0xff,0xf0,0x00,0x07,0xff,0xc0,0x00,0x00,0xfe,0x00
+};
+
+const unsigned char image_rpi_Layer_10_bits[] = {
+    0x3f,0xf0,0x3f,0xf0,0xc0,0x0c,0xc0,0x0c,0xc0,0x0c,0xc0,0x0c,0xc0,0x0c,0xc0,0x0c,0x30,0x30,0x30,0x30,0x00,0x00,0x00,0x00,0x3f,0xf0,0x3f,0xf0,0xc0,0x0c,0xc0,0x0c,0xc0,0x0c,0xc0,0x0c,0xc0,0x0c,0xc0,0x0c,0x3f,0xf0,0x3f,0xf0,0x00,0x00,0x00,0x00,0xff,0xfc,0xff,0xfc,0x00,0xc0,0x00,0xc0,0x03,0x00,0x03,0x00,0x0c,0x00,0x0c,0x00,0xff,0xfc,0xff,0xfc,0x00,0x00,0x00,0x00,0xff,0xfc,0xff,0xfc,0x00,0xc0,0x00,0xc0,0x03,0x00,0x03,0x00,0x0c,0x00,0x0c,0x00,0xff,0xfc,0xff,0xfc,0x00,0x00,0x00,0x00,0xff,0xfc,0xff,0xfc,0xc3,0x0c,0xc3,0x0c,0xc3,0x0c,0xc3,0x0c,0xc3,0x0c,0xc3,0x0c,0xc0,0x0c,0xc0,0x0c,0x00,0x00,0x00,0x00,0x3f,0xf0,0x3f,0xf0,0xc0,0x0c,0xc0,0x0c,0xc0,0x0c,0xc0,0x0c,0xc0,0x0c,0xc0,0x0c,0x30,0x30,0x30,0x30,0x00,0x00,0x00,0x00,0x00,0x3c,0x00,0x3c,0x00,0x0c,0x00,0x0c,0xff,0xfc,0xff,0xfc,0x00,0x0c,0x00,0x0c,0x00,0x3c,0x00,0x3c
+};
+
+// Bad USB menu bitmap data
+const unsigned char image_badusb_Layer_2_bits[] = {
+    0x3f,0xf8,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x38,0x38,0x08,0x20,0x08,0x20,0x07,0xc0
+};
+
+const unsigned char image_badusb_Layer_3_bits[] = {
+    0x0f,0xf0,0x0f,0xf0,0x30,0x00,0x30,0x00,0xc3,0xc0,0xc3,0xc0,0xcc,0x30,0xcc,0x30,0xcc,0x30,0xcc,0x30,0xc3,0xc0,0xc3,0xc0,0xc0,0x00,0xc0,0x00,0xc0,0x00,0xc0,0x00,0xcc,0x00,0xcc,0x00,0xc3,0x00,0xc3,0x00,0xc0,0xc0,0xc0,0xc0,0xcc,0x30,0xcc,0x30,0xc3,0x00,0xc3,0x00,0xc0,0xc0,0xc0,0xc0,0xcc,0x30,0xcc,0x30,0xc3,0x00,0xc3,0x00,0xc0,0xc0,0xc0,0xc0,0xcc,0x30,0xcc,0x30,0xc3,0x00,0xc3,0x00,0xc0,0xc0,0xc0,0xc0,0xcc,0x30,0xcc,0x30,0xc3,0x00,0xc3,0x00,0xc0,0xc0,0xc0,0xc0,0xcc,0x30,0xcc,0x30,0xc3,0x00,0xc3,0x00,0xc0,0xc0,0xc0,0xc0,0xc0,0x30,0xc0,0x30,0xc0,0x00,0xc0,0x00,0x30,0x00,0x30,0x00,0x3c,0x00,0x3c,0x00,0x3f,0x00,0x3f,0x00,0x3f,0xc0,0x3f,0xc0,0x3f,0xf0,0x3f,0xf0,0x33,0xf0,0x33,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0
+};
+
+const unsigned char image_rspi_1_bits[] = {
+    0x00,0x70,0x00,0x80,0x00,0xf8,0x01,0x80,0x0f,0x33,0x8f,0x80,0x0f,0x01,0x8e,0x80,0x1f,0x7d,0xdd,0x80,0x1e,0x7e,0x53,0x80,0x08,0x7e,0x13,0x00,0x27,0x7c,0x4f,0x00,0xef,0x3d,0xce,0x00,0xef,0x81,0xc0,0x00,0xef,0xbd,0xc2,0x00,0xef,0x3d,0xce,0x00,0x20,0x7e,0x13,0x00,0x08,0x7e,0x13,0x00,0x1f,0x7c,0x5d,0x80,0x1f,0x39,0xde,0x80,0x0f,0x01,0x8e,0x80,0x06,0x7a,0x03,0x80,0x00,0xf8,0x01,0x80
+};
+
+const unsigned char image_USB_KILLER_bits[] = {
+    0x03,0xff,0xf0,0x00,0x07,0xff,0xf8,0x00,0x06,0x00,0x18,0x00,0x06,0x00,0x18,0x00,0x06,0x73,0x18,0x00,0x06,0x73,0x98,0x00,0x06,0x73,0x98,0x00,0x06,0x73,0x98,0x00,0x06,0x31,0x18,0x00,0x06,0x00,0x18,0x00,0x06,0xaa,0xb8,0x00,0x1f,0xff,0xfe,0x00,0x1f,0xff,0xff,0x00,0x38,0x00,0x07,0x00,0x60,0x00,0x01,0x80,0xe0,0x00,0x01,0x80,0xe0,0x00,0x01,0xc0,0xe0,0x00,0x00,0xc0,0xe0,0x00,0x00,0xc0,0xe0,0x00,0x00,0xc0,0xe0,0x00,0x00,0xc0,0xe0,0x00,0x00,0xc0,0xe0,0x00,0x00,0xc0,0xe0,0x7f,0x80,0xc0,0xe0,0xff,0xc0,0xc0,0xe1,0xe0,0xf0,0xc0,0xe3,0x80,0x38,0xc0,0xe3,0x00,0x38,0xc0,0xe6,0x00,0x18,0xc0,0xe6,0x00,0x0c,0xc0,0xee,0x00,0x0c,0xc0,0xec,0x00,0x0c,0xc0,0xec,0x71,0xcc,0xc0,0xec,0xf1,0xec,0xc0,0xec,0xf1,0xec,0xc0,0xec,0xe4,0xec,0xc0,0xee,0x04,0x0c,0xc0,0xe6,0x0e,0x0c,0xc0,0xe7,0x0a,0x38,0xc0,0xe3,0xc0,0x78,0xc0,0xe1,0xc0,0xf0,0xc0,0xe0,0xc0,0xe0,0xc0,0xe0,0xff,0xc0,0xc0,0xe0,0x7f,0xc0,0xc0,0xe0,0x00,0x00,0xc0,0xe0,0x00,0x00,0xc0,0xe0,0x00,0x00,0xc0,0xe0,0x00,0x00,0xc0,0xe0,0x00,0x00,0xc0,0xe0,0x00,0x00,0xc0,0xe0,0x00,0x00,0xc0,0xe0,0x00,0x00,0xc0,0xe0,0x00,0x00,0xc0,0xe0,0x00,0x00,0xc0,0xe0,0x00,0x01,0xc0,0x60,0x00,0x01,0x80,0x70,0x00,0x03,0x80,0x3c,0x00,0x0f,0x00,0x1f,0xff,0xfe,0x00,0x07,0xff,0xf8,0x00
+};
+
+const unsigned char image_badusb_Layer_9_bits[] = {
+    0x0f,0x00,0x10,0xc0,0x20,0x20,0x20,0x30,0x20,0x10,0x20,0x10,0x20,0x10,0x10,0x20,0x00,0x70,0x00,0x00,0x00,0x00,0x1e,0x10,0x31,0xf0,0x20,0x10,0x20,0x10,0x20,0x00,0x30,0x00,0x10,0x00,0x0f,0x10,0x01,0xf0,0x00,0x10,0x20,0x00,0x30,0x00,0x3f,0x90,0x22,0x70,0x02,0x10,0x02,0x10,0x02,0x10,0x0e,0x10,0x11,0x30,0x20,0xe0,0x00,0x00,0x20,0x00,0x30,0x00,0x3f,0x90,0x22,0x70,0x02,0x10,0x02,0x10,0x02,0x10,0x0e,0x10,0x11,0x30,0x20,0xe0,0x80,0x00,0x80,0x00,0x80,0x00,0x80,0x00,0x80,0x00,0x80,0x00,0x80,0x00,0x80,0x00,0x80,0x00,0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x30,0x20,0x10,0x38,0x10,0x2f,0xd0,0x20,0x30,0x20,0x10,0x00,0x10,0x00,0x10,0x00,0x30,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x10,0x38,0x10,0x27,0xd0,0x20,0x30,0x20,0x10,0x00,0x10,0x00,0x10,0x20,0x00,0x20,0x00,0x3f,0x10,0x20,0xf0,0x00,0x30,0x07,0xc0,0x06,0x00,0x21,0x00,0x20,0xc0,0x3c,0x20,0x27,0xf0,0x00,0x10,0x20,0x10,0x30,0x00,0x3f,0x90,0x21,0x70,0x21,0x10,0x21,0x10,0x23,0x90,0x20,0x10,0x38,0x10,0x00,0x30
+};
+
+const unsigned char image_badusb_Layer_10_bits[] = {
+    0xff,0xfc,0xff,0xfc,0xc3,0x0c,0xc3,0x0c,0xc3,0x0c,0xc3,0x0c,0xc3,0x0c,0xc3,0x0c,0x3c,0xf0,0x3c,0xf0,0x00,0x00,0x00,0x00,0xff,0xc0,0xff,0xc0,0x0c,0x30,0x0c,0x30,0x0c,0x0c,0x0c,0x0c,0x0c,0x30,0x0c,0x30,0xff,0xc0,0xff,0xc0,0x00,0x00,0x00,0x00,0xff,0xfc,0xff,0xfc,0xc0,0x0c,0xc0,0x0c,0xc0,0x0c,0xc0,0x0c,0xc0,0x0c,0xc0,0x0c,0x3f,0xf0,0x3f,0xf0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3f,0xfc,0x3f,0xfc,0xc0,0x00,0xc0,0x00,0xc0,0x00,0xc0,0x00,0xc0,0x00,0xc0,0x00,0x3f,0xfc,0x3f,0xfc,0x00,0x00,0x00,0x00,0x30,0xf0,0x30,0xf0,0xc3,0x0c,0xc3,0x0c,0xc3,0x0c,0xc3,0x0c,0xc3,0x0c,0xc3,0x0c,0x3c,0x30,0x3c,0x30,0x00,0x00,0x00,0x00,0xff,0xfc,0xff,0xfc,0xc3,0x0c,0xc3,0x0c,0xc3,0x0c,0xc3,0x0c,0xc3,0x0c,0xc3,0x0c,0x3c,0xf0,0x3c,0xf0
+};
+
+const unsigned char image_equ2z4c_SETTINGSsettings_bits[] = {
+    0x00,0x3f,0x00,0x00,0x00,0x6c,0x80,0x00,0x00,0x13,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x20,0x40,0x00,0x01,0x69,0x60,0x00,0x01,0x69,0x60,0x00,0x00,0x00,0x00,0x00,0x00,0xff,0xe0,0x00,0x47,0x80,0x6c,0x00,0xcf,0x80,0x28,0x40,0xa1,0x80,0x21,0xc0,0xc7,0x80,0x2c,0xa0,0xc1,0x80,0x20,0xa0,0xa1,0x80,0x20,0xa0,0xa7,0x80,0x2d,0x40,0x41,0x80,0x20,0x80,0x0f,0x80,0x68,0x00,0x00,0xff,0xe0,0x00,0x01,0x00,0x00,0x00,0x01,0x69,0x60,0x00,0x00,0x49,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x11,0x00,0x00,0x00,0x1e,0x80,0x00,0x00,0x31,0x00,0x00,0x00,0x0e,0x00,0x00
+};
+
+// Settings menu bitmap data
+const unsigned char image_settings_Layer_2_bits[] = {
+    0x3f,0xf8,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x38,0x38,0x08,0x20,0x08,0x20,0x07,0xc0
+};
+
+const unsigned char image_settings_Layer_3_bits[] = {
+    0x0f,0xf0,0x0f,0xf0,0x30,0x00,0x30,0x00,0xc3,0xc0,0xc3,0xc0,0xcc,0x30,0xcc,0x30,0xcc,0x30,0xcc,0x30,0xc3,0xc0,0xc3,0xc0,0xc0,0x00,0xc0,0x00,0xc0,0x00,0xc0,0x00,0xcc,0x00,0xcc,0x00,0xc3,0x00,0xc3,0x00,0xc0,0xc0,0xc0,0xc0,0xcc,0x30,0xcc,0x30,0xc3,0x00,0xc3,0x00,0xc0,0xc0,0xc0,0xc0,0xcc,0x30,0xcc,0x30,0xc3,0x00,0xc3,0x00,0xc0,0xc0,0xc0,0xc0,0xcc,0x30,0xcc,0x30,0xc3,0x00,0xc3,0x00,0xc0,0xc0,0xc0,0xc0,0xcc,0x30,0xcc,0x30,0xc3,0x00,0xc3,0x00,0xc0,0xc0,0xc0,0xc0,0xcc,0x30,0xcc,0x30,0xc3,0x00,0xc3,0x00,0xc0,0xc0,0xc0,0xc0,0xc0,0x30,0xc0,0x30,0xc0,0x00,0xc0,0x00,0x30,0x00,0x30,0x00,0x3c,0x00,0x3c,0x00,0x3f,0x00,0x3f,0x00,0x3f,0xc0,0x3f,0xc0,0x3f,0xf0,0x3f,0xf0,0x33,0xf0,0x33,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0
+};
+
+const unsigned char image_settings_Layer_7_bits[] = {
+    0x00,0x00,0x01,0xfe,0x00,0x00,0x00,0x00,0x00,0x07,0xff,0x00,0x00,0x00,0x00,0x00,0x0e,0x01,0xc0,0x00,0x00,0x00,0x00,0x1c,0x78,0xc0,0x00,0x00,0x00,0x00,0x01,0xfe,0x00,0x00,0x00,0x00,0x00,0x03,0x87,0x00,0x00,0x00,0x00,0x00,0x02,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x06,0x08,0x30,0x00,0x00,0x00,0x01,0x86,0x08,0x30,0x00,0x00,0x00,0x01,0xb6,0xc9,0xb6,0x00,0x00,0x00,0x01,0xb6,0xc9,0xb6,0x00,0x00,0x00,0x01,0xb6,0xc9,0xb6,0x00,0x00,0x00,0x01,0xb6,0x49,0x36,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x00,0x7f,0xff,0xf8,0x00,0x00,0x00,0x00,0xff,0xff,0xfc,0x00,0x00,0x00,0x1d,0xff,0xff,0xfc,0xf8,0x00,0x10,0x1d,0xc0,0x00,0x1c,0xf0,0x20,0x30,0x01,0xc0,0x00,0x0c,0x00,0x70,0x70,0x7d,0xc0,0x00,0x0c,0xe0,0x30,0x66,0x7d,0xc0,0x00,0x0c,0xe1,0x98,0xcc,0x01,0xc0,0x00,0x0c,0x01,0xd8,0xcc,0x1d,0xc0,0x00,0x0c,0xf0,0xcc,0xd8,0x1d,0xc0,0x00,0x0c,0xf8,0xcc,0xd8,0x01,0xc0,0x00,0x0c,0x00,0x6c,0xd8,0x01,0xc0,0x00,0x0c,0x00,0x6c,0xd8,0x7d,0xc0,0x00,0x0c,0xe0,0xcc,0xcc,0x01,0xc0,0x00,0x0c,0x00,0xcc,0xcc,0x01,0xc0,0x00,0x0c,0x01,0xd8,0x66,0x1d,0xc0,0x00,0x0c,0xf9,0x98,0x30,0x1d,0xc0,0x00,0x0c,0xf0,0x30,0x30,0x01,0xc0,0x00,0x0c,0x00,0x60,0x00,0x7d,0xc0,0x00,0x0c,0xe0,0x00,0x00,0x7d,0xe0,0x00,0x1c,0xe0,0x00,0x00,0x00,0xff,0xff,0xfc,0x00,0x00,0x00,0x00,0xff,0xff,0xfc,0x00,0x00,0x00,0x00,0x7f,0xff,0xf0,0x00,0x00,0x00,0x01,0x00,0x00,0x02,0x00,0x00,0x00,0x01,0xb6,0xc9,0xb6,0x00,0x00,0x00,0x01,0xb6,0xc9,0xb6,0x00,0x00,0x00,0x01,0x36,0xc9,0xb6,0x00,0x00,0x00,0x00,0x30,0xc1,0x86,0x00,0x00,0x00,0x00,0x20,0x41,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x03,0x00,0x00,0x00,0x00,0x00,0x03,0x8f,0x00,0x00,0x00,0x00,0x00,0x09,0xfe,0x40,0x00,0x00,0x00,0x00,0x1c,0x30,0xc0,0x00,0x00,0x00,0x00,0x0f,0x03,0x80,0x00,0x00,0x00,0x00,0x03,0xff,0x00,0x00,0x00,0x00,0x00,0x00,0xfc,0x00,0x00,0x00
+};
+
+const unsigned char image_settings_Layer_8_bits[] = {
+    0x0f,0x00,0x10,0xc0,0x20,0x20,0x20,0x30,0x20,0x10,0x20,0x10,0x20,0x10,0x10,0x20,0x00,0x70,0x00,0x00,0x00,0x00,0x1e,0x10,0x31,0xf0,0x20,0x10,0x20,0x10,0x20,0x00,0x30,0x00,0x10,0x00,0x0f,0x10,0x01,0xf0,0x00,0x10,0x20,0x00,0x30,0x00,0x3f,0x90,0x22,0x70,0x02,0x10,0x02,0x10,0x02,0x10,0x0e,0x10,0x11,0x30,0x20,0xe0,0x00,0x00,0x20,0x00,0x30,0x00,0x3f,0x90,0x22,0x70,0x02,0x10,0x02,0x10,0x02,0x10,0x0e,0x10,0x11,0x30,0x20,0xe0,0x80,0x00,0x80,0x00,0x80,0x00,0x80,0x00,0x80,0x00,0x80,0x00,0x80,0x00,0x80,0x00,0x80,0x00,0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x30,0x20,0x10,0x38,0x10,0x2f,0xd0,0x20,0x30,0x20,0x10,0x00,0x10,0x00,0x10,0x00,0x30,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x10,0x38,0x10,0x27,0xd0,0x20,0x30,0x20,0x10,0x00,0x10,0x00,0x10,0x20,0x00,0x20,0x00,0x3f,0x10,0x20,0xf0,0x00,0x30,0x07,0xc0,0x06,0x00,0x21,0x00,0x20,0xc0,0x3c,0x20,0x27,0xf0,0x00,0x10,0x20,0x10,0x30,0x00,0x3f,0x90,0x21,0x70,0x21,0x10,0x21,0x10,0x23,0x90,0x20,0x10,0x38,0x10,0x00,0x30
+};
+
+const unsigned char image_g87a5zi_USB_KILLERusb_killer_bits[] = {
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3f,0xc0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x40,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x2b,0x40,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x2b,0x40,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x40,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7f,0xe0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xc0,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x80,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x80,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x80,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x80,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x8f,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x99,0x90,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0xa0,0xd0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0xa0,0x50,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0xc0,0x50,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0xd9,0xd0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0xd9,0xd0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0xa6,0x50,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0xb0,0xd0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x91,0x90,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x8f,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x80,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x80,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x80,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x80,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x80,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x80,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xc0,0x60,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3f,0xc0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00
+};
+
+const unsigned char image_settings_Layer_9_bits[] = {
+    0x30,0xf0,0x30,0xf0,0xc3,0x0c,0xc3,0x0c,0xc3,0x0c,0xc3,0x0c,0xc3,0x0c,0xc3,0x0c,0x3c,0x30,0x3c,0x30,0x00,0x00,0x00,0x00,0xff,0xfc,0xff,0xfc,0xc3,0x0c,0xc3,0x0c,0xc3,0x0c,0xc3,0x0c,0xc3,0x0c,0xc3,0x0c,0xc0,0x0c,0xc0,0x0c,0x00,0x00,0x00,0x00,0x00,0x3c,0x00,0x3c,0x00,0x0c,0x00,0x0c,0xff,0xfc,0xff,0xfc,0x00,0x0c,0x00,0x0c,0x00,0x3c,0x00,0x3c,0x00,0x00,0x00,0x00,0x00,0x3c,0x00,0x3c,0x00,0x0c,0x00,0x0c,0xff,0xfc,0xff,0xfc,0x00,0x0c,0x00,0x0c,0x00,0x3c,0x00,0x3c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xc0,0x0c,0xc0,0x0c,0xff,0xfc,0xff,0xfc,0xc0,0x0c,0xc0,0x0c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xff,0xfc,0xff,0xfc,0x00,0xc0,0x00,0xc0,0x03,0x00,0x03,0x00,0x0c,0x00,0x0c,0x00,0xff,0xfc,0xff,0xfc,0x00,0x00,0x00,0x00,0x3f,0xf0,0x3f,0xf0,0xc0,0x0c,0xc0,0x0c,0xc0,0x0c,0xc0,0x0c,0xcc,0x0c,0xcc,0x0c,0xfc,0x3c,0xfc,0x3c,0x00,0x00,0x00,0x00,0x30,0xf0,0x30,0xf0,0xc3,0x0c,0xc3,0x0c,0xc3,0x0c,0xc3,0x0c,0xc3,0x0c,0xc3,0x0c,0x3c,0x30,0x3c,0x30
+};
+
+const unsigned char image_extra_1_bits[] = {
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0xfc,0x00,0x00,0x03,0xfc,0x00,0x0f,0xf3,0xfc,0x00,0x1f,0xf3,0xfc,0x00,0x1f,0xf3,0xfc,0x00,0x1f,0xf3,0xfc,0x00,0x1f,0xf3,0xfc,0x00,0x1f,0xf3,0xfc,0x00,0x1f,0xf3,0xfc,0x00,0x1f,0xf0,0x00,0x00,0x1f,0xf8,0x00,0x00,0x1f,0xff,0xf8,0x00,0x1f,0xff,0xf8,0x00,0x1f,0xff,0xf8,0x00,0x1f,0xff,0xf8,0x00,0x1f,0xff,0xf8,0x00,0x1f,0xff,0xf8,0x00,0x1f,0xff,0xf8,0x00,0x1f,0xff,0xf8,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00
+};
+
+const unsigned char image_ojp6uhu_USB_KILLERusb_killer_bits[] = {
+    0x1f,0xf8,0x15,0x58,0x12,0x48,0x12,0x48,0x12,0x48,0x12,0x48,0x10,0x08,0x3f,0xfc,0x60,0x06,0xc0,0x03,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x83,0xc1,0x8e,0xf1,0x88,0x19,0x90,0x09,0x90,0x0d,0xb0,0x05,0xb2,0x25,0xb6,0x75,0xb6,0x35,0xb0,0x85,0x91,0x8d,0x9c,0x39,0x84,0x31,0x87,0xe1,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0xc0,0x03,0x75,0x5e,0x1f,0xf8
+};
+
+// EXTRAS MENU BITMAPS
+const unsigned char image_extras_Layer_2_bits[] = {
+    0x3f,0xf8,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x38,0x38,0x08,0x20,0x08,0x20,0x07,0xc0
+};
+
+const unsigned char image_extras_Layer_3_bits[] = {
+    0x0f,0xf0,0x0f,0xf0,0x30,0x00,0x30,0x00,0xc3,0xc0,0xc3,0xc0,0xcc,0x30,0xcc,0x30,0xcc,0x30,0xcc,0x30,0xc3,0xc0,0xc3,0xc0,0xc0,0x00,0xc0,0x00,0xc0,0x00,0xc0,0x00,0xcc,0x00,0xcc,0x00,0xc3,0x00,0xc3,0x00,0xc0,0xc0,0xc0,0xc0,0xcc,0x30,0xcc,0x30,0xc3,0x00,0xc3,0x00,0xc0,0xc0,0xc0,0xc0,0xcc,0x30,0xcc,0x30,0xc3,0x00,0xc3,0x00,0xc0,0xc0,0xc0,0xc0,0xcc,0x30,0xcc,0x30,0xc3,0x00,0xc3,0x00,0xc0,0xc0,0xc0,0xc0,0xcc,0x30,0xcc,0x30,0xc3,0x00,0xc3,0x00,0xc0,0xc0,0xc0,0xc0,0xcc,0x30,0xcc,0x30,0xc3,0x00,0xc3,0x00,0xc0,0xc0,0xc0,0xc0,0xc0,0x30,0xc0,0x30,0xc0,0x00,0xc0,0x00,0x30,0x00,0x30,0x00,0x3c,0x00,0x3c,0x00,0x3f,0x00,0x3f,0x00,0x3f,0xc0,0x3f,0xc0,0x3f,0xf0,0x3f,0xf0,0x33,0xf0,0x33,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0
+};
+
+const unsigned char image_extras_Layer_7_bits[] = {
+    0x00,0x0f,0x00,0x00,0x00,0x30,0x80,0x00,0x00,0x0f,0x00,0x00,0x00,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x92,0x40,0x00,0x00,0xda,0xd0,0x00,0x00,0xd2,0x50,0x00,0x00,0x7f,0xe0,0x00,0x02,0xff,0xee,0x00,0x40,0x80,0x20,0x40,0x56,0x80,0x2c,0xa0,0xa2,0x80,0x2c,0xa0,0xa0,0x80,0x20,0x60,0xa6,0x80,0x2c,0xa0,0xa0,0x80,0x20,0xa0,0x42,0x80,0x2c,0x40,0x06,0x80,0x2c,0x00,0x00,0xff,0xe0,0x00,0x00,0x7f,0xc0,0x00,0x00,0xda,0xd0,0x00,0x00,0x5a,0xd0,0x00,0x00,0x40,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x1b,0x00,0x00,0x00,0x24,0x80,0x00,0x00,0x1f,0x00,0x00
+};
+
+const unsigned char image_extras_Layer_8_bits[] = {
+    0x0f,0x00,0x10,0xc0,0x20,0x20,0x20,0x30,0x20,0x10,0x20,0x10,0x20,0x10,0x10,0x20,0x00,0x70,0x00,0x00,0x00,0x00,0x1e,0x10,0x31,0xf0,0x20,0x10,0x20,0x10,0x20,0x00,0x30,0x00,0x10,0x00,0x0f,0x10,0x01,0xf0,0x00,0x10,0x20,0x00,0x30,0x00,0x3f,0x90,0x22,0x70,0x02,0x10,0x02,0x10,0x02,0x10,0x0e,0x10,0x11,0x30,0x20,0xe0,0x00,0x00,0x20,0x00,0x30,0x00,0x3f,0x90,0x22,0x70,0x02,0x10,0x02,0x10,0x02,0x10,0x0e,0x10,0x11,0x30,0x20,0xe0,0x80,0x00,0x80,0x00,0x80,0x00,0x80,0x00,0x80,0x00,0x80,0x00,0x80,0x00,0x80,0x00,0x80,0x00,0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x30,0x20,0x10,0x38,0x10,0x2f,0xd0,0x20,0x30,0x20,0x10,0x00,0x10,0x00,0x10,0x00,0x30,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x10,0x38,0x10,0x27,0xd0,0x20,0x30,0x20,0x10,0x00,0x10,0x00,0x10,0x20,0x00,0x20,0x00,0x3f,0x10,0x20,0xf0,0x00,0x30,0x07,0xc0,0x06,0x00,0x21,0x00,0x20,0xc0,0x3c,0x20,0x27,0xf0,0x00,0x10,0x20,0x10,0x30,0x00,0x3f,0x90,0x21,0x70,0x21,0x10,0x21,0x10,0x23,0x90,0x20,0x10,0x38,0x10,0x00,0x30
+};
+
+const unsigned char image_ot3p4l1_filesfiles_bits[] = {
+    0x3f,0xff,0x80,0x7f,0xff,0xc0,0xc0,0x00,0x60,0xd6,0xad,0x60,0xd6,0xad,0x60,0xd6,0xad,0x60,0xd6,0xad,0x60,0xc0,0x00,0x60,0xc0,0x00,0x30,0xc0,0x00,0x10,0xc0,0x00,0x18,0xc0,0x00,0x18,0xc0,0x00,0x18,0xc0,0x00,0x18,0xc0,0x00,0x18,0xc0,0x00,0x18,0xc0,0x00,0x18,0xc0,0x00,0x18,0xdf,0xff,0xd8,0xdf,0xff,0xd8,0xd8,0x00,0xd8,0xd8,0x00,0xd8,0xd8,0x00,0xd8,0xdf,0xff,0xd8,0xc0,0x00,0x18,0xc0,0x00,0x18,0x60,0x00,0x30,0x3f,0xff,0xe0
+};
+
+const unsigned char image_extras_Layer_11_bits[] = {
+    0xff,0xfc,0xff,0xfc,0xc3,0x0c,0xc3,0x0c,0xc3,0x0c,0xc3,0x0c,0xc3,0x0c,0xc3,0x0c,0xc0,0x0c,0xc0,0x0c,0x00,0x00,0x00,0x00,0xf0,0x3c,0xf0,0x3c,0x0c,0xc0,0x0c,0xc0,0x03,0x00,0x03,0x00,0x0c,0xc0,0x0c,0xc0,0xf0,0x3c,0xf0,0x3c,0x00,0x00,0x00,0x00,0x00,0x3c,0x00,0x3c,0x00,0x0c,0x00,0x0c,0xff,0xfc,0xff,0xfc,0x00,0x0c,0x00,0x0c,0x00,0x3c,0x00,0x3c,0x00,0x00,0x00,0x00,0xff,0xfc,0xff,0xfc,0x03,0x0c,0x03,0x0c,0x0f,0x0c,0x0f,0x0c,0x33,0x0c,0x33,0x0c,0xc0,0xf0,0xc0,0xf0,0x00,0x00,0x00,0x00,0xff,0xc0,0xff,0xc0,0x0c,0x30,0x0c,0x30,0x0c,0x0c,0x0c,0x0c,0x0c,0x30,0x0c,0x30,0xff,0xc0,0xff,0xc0
+};
+
+// FILES MENU BITMAPS
+const unsigned char image_files_Layer_2_bits[] = {
+    0x3f,0xf8,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x38,0x38,0x08,0x20,0x08,0x20,0x07,0xc0
+};
+
+const unsigned char image_files_Layer_3_bits[] = {
+    0x0f,0xf0,0x0f,0xf0,0x30,0x00,0x30,0x00,0xc3,0xc0,0xc3,0xc0,0xcc,0x30,0xcc,0x30,0xcc,0x30,0xcc,0x30,0xc3,0xc0,0xc3,0xc0,0xc0,0x00,0xc0,0x00,0xc0,0x00,0xc0,0x00,0xcc,0x00,0xcc,0x00,0xc3,0x00,0xc3,0x00,0xc0,0xc0,0xc0,0xc0,0xcc,0x30,0xcc,0x30,0xc3,0x00,0xc3,0x00,0xc0,0xc0,0xc0,0xc0,0xcc,0x30,0xcc,0x30,0xc3,0x00,0xc3,0x00,0xc0,0xc0,0xc0,0xc0,0xcc,0x30,0xcc,0x30,0xc3,0x00,0xc3,0x00,0xc0,0xc0,0xc0,0xc0,0xcc,0x30,0xcc,0x30,0xc3,0x00,0xc3,0x00,0xc0,0xc0,0xc0,0xc0,0xcc,0x30,0xcc,0x30,0xc3,0x00,0xc3,0x00,0xc0,0xc0,0xc0,0xc0,0xc0,0x30,0xc0,0x30,0xc0,0x00,0xc0,0x00,0x30,0x00,0x30,0x00,0x3c,0x00,0x3c,0x00,0x3f,0x00,0x3f,0x00,0x3f,0xc0,0x3f,0xc0,0x3f,0xf0,0x3f,0xf0,0x33,0xf0,0x33,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0
+};
+
+const unsigned char image_mi1byse_extraextra_bitsfil[] = {
+    0x00,0x01,0xff,0x80,0x00,0x03,0xff,0xc0,0x7f,0xe3,0xff,0xc0,0xff,0xf3,0xff,0xc0,0xff,0xf3,0xff,0xc0,0xff,0xf3,0xff,0xc0,0xff,0xf3,0xff,0xc0,0xff,0xf3,0xff,0xc0,0xff,0xf3,0xff,0xc0,0xff,0xf3,0xff,0xc0,0xff,0xf3,0xff,0xc0,0xff,0xf3,0xff,0xc0,0xff,0xf0,0x00,0x00,0xff,0xf8,0x00,0x00,0xff,0xff,0xfe,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0x7f,0xff,0xff,0x00
+};
+
+const unsigned char image_files_Layer_8_bits[] = {
+    0x0f,0x00,0x10,0xc0,0x20,0x20,0x20,0x30,0x20,0x10,0x20,0x10,0x20,0x10,0x10,0x20,0x00,0x70,0x00,0x00,0x00,0x00,0x1e,0x10,0x31,0xf0,0x20,0x10,0x20,0x10,0x20,0x00,0x30,0x00,0x10,0x00,0x0f,0x10,0x01,0xf0,0x00,0x10,0x20,0x00,0x30,0x00,0x3f,0x90,0x22,0x70,0x02,0x10,0x02,0x10,0x02,0x10,0x0e,0x10,0x11,0x30,0x20,0xe0,0x00,0x00,0x20,0x00,0x30,0x00,0x3f,0x90,0x22,0x70,0x02,0x10,0x02,0x10,0x02,0x10,0x0e,0x10,0x11,0x30,0x20,0xe0,0x80,0x00,0x80,0x00,0x80,0x00,0x80,0x00,0x80,0x00,0x80,0x00,0x80,0x00,0x80,0x00,0x80,0x00,0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x30,0x20,0x10,0x38,0x10,0x2f,0xd0,0x20,0x30,0x20,0x10,0x00,0x10,0x00,0x10,0x00,0x30,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x10,0x38,0x10,0x27,0xd0,0x20,0x30,0x20,0x10,0x00,0x10,0x00,0x10,0x20,0x00,0x20,0x00,0x3f,0x10,0x20,0xf0,0x00,0x30,0x07,0xc0,0x06,0x00,0x21,0x00,0x20,0xc0,0x3c,0x20,0x27,0xf0,0x00,0x10,0x20,0x10,0x30,0x00,0x3f,0x90,0x21,0x70,0x21,0x10,0x21,0x10,0x23,0x90,0x20,0x10,0x38,0x10,0x00,0x30
+};
+
+const unsigned char image_files_Layer_10_bits[] = {
+    0xff,0xfc,0xff,0xfc,0x03,0x0c,0x03,0x0c,0x03,0x0c,0x03,0x0c,0x03,0x0c,0x03,0x0c,0x00,0x0c,0x00,0x0c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xc0,0x0c,0xc0,0x0c,0xff,0xfc,0xff,0xfc,0xc0,0x0c,0xc0,0x0c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xff,0xfc,0xff,0xfc,0xc0,0x00,0xc0,0x00,0xc0,0x00,0xc0,0x00,0xc0,0x00,0xc0,0x00,0xc0,0x00,0xc0,0x00,0x00,0x00,0x00,0x00,0xff,0xfc,0xff,0xfc,0xc3,0x0c,0xc3,0x0c,0xc3,0x0c,0xc3,0x0c,0xc3,0x0c,0xc3,0x0c,0xc0,0x0c,0xc0,0x0c,0x00,0x00,0x00,0x00,0x30,0xf0,0x30,0xf0,0xc3,0x0c,0xc3,0x0c,0xc3,0x0c,0xc3,0x0c,0xc3,0x0c,0xc3,0x0c,0x3c,0x30,0x3c,0x30
+};
+
+// RFID MENU BITMAPS
+const unsigned char image_rfid_Layer_2_bits[] = {
+    0x0f,0xf0,0x0f,0xf0,0x30,0x00,0x30,0x00,0xc3,0xc0,0xc3,0xc0,0xcc,0x30,0xcc,0x30,0xcc,0x30,0xcc,0x30,0xc3,0xc0,0xc3,0xc0,0xc0,0x00,0xc0,0x00,0xc0,0x00,0xc0,0x00,0xcc,0x00,0xcc,0x00,0xc3,0x00,0xc3,0x00,0xc0,0xc0,0xc0,0xc0,0xcc,0x30,0xcc,0x30,0xc3,0x00,0xc3,0x00,0xc0,0xc0,0xc0,0xc0,0xcc,0x30,0xcc,0x30,0xc3,0x00,0xc3,0x00,0xc0,0xc0,0xc0,0xc0,0xcc,0x30,0xcc,0x30,0xc3,0x00,0xc3,0x00,0xc0,0xc0,0xc0,0xc0,0xcc,0x30,0xcc,0x30,0xc3,0x00,0xc3,0x00,0xc0,0xc0,0xc0,0xc0,0xcc,0x30,0xcc,0x30,0xc3,0x00,0xc3,0x00,0xc0,0xc0,0xc0,0xc0,0xc0,0x30,0xc0,0x30,0xc0,0x00,0xc0,0x00,0x30,0x00,0x30,0x00,0x3c,0x00,0x3c,0x00,0x3f,0x00,0x3f,0x00,0x3f,0xc0,0x3f,0xc0,0x3f,0xf0,0x3f,0xf0,0x33,0xf0,0x33,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0
+};
+
+const unsigned char image_rfid_Layer_3_bits[] = {
+    0x3f,0xf8,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x38,0x38,0x08,0x20,0x08,0x20,0x07,0xc0
+};
+
+const unsigned char image_filesrfid_Layer_6_bits[] = {
+    0x7f,0xff,0xc0,0x40,0x00,0x40,0xd6,0xad,0x60,0xd6,0xad,0x60,0xd6,0xad,0x60,0xd6,0xad,0x60,0xd6,0xad,0x60,0xc0,0x00,0x60,0xc0,0x00,0x30,0xc0,0x00,0x18,0xc0,0x00,0x18,0xc0,0x00,0x18,0xc0,0x00,0x18,0xc0,0x00,0x18,0xc0,0x00,0x18,0xc0,0x00,0x18,0xc0,0x00,0x18,0xc0,0x00,0x18,0xdf,0xff,0xd8,0xd8,0x00,0xd8,0xd8,0x00,0xd8,0xd8,0x00,0xd8,0xdf,0xff,0xd8,0xdf,0xff,0xd8,0xc0,0x00,0x18,0xc0,0x00,0x10,0x7f,0xff,0xf0
+};
+
+const unsigned char image_rfid_Layer_6_bits[] = {
+    0x7f,0xff,0xff,0xff,0xf0,0xff,0xff,0xff,0xff,0xf8,0xe0,0x00,0x00,0x00,0x38,0xdf,0xbf,0xff,0xff,0xd8,0xdf,0x5f,0xff,0xff,0xd8,0xde,0xa0,0x00,0x00,0xd8,0xdd,0x50,0x00,0x00,0xd8,0xda,0xb0,0x00,0x04,0xd8,0xd5,0x6f,0xff,0xfc,0xd8,0xca,0x97,0xff,0xfc,0xd8,0xd5,0x28,0x00,0x1c,0xd8,0xdb,0x50,0x00,0x1c,0xd8,0xd8,0xa0,0x00,0x1c,0xd8,0xd8,0xc7,0xff,0x1c,0xd8,0xd8,0xc7,0xff,0x1c,0xd8,0xd8,0xc7,0xff,0x1c,0xd8,0xd8,0xc0,0x31,0x1c,0xd8,0xd8,0xc0,0x31,0x1c,0xd8,0xd8,0xc0,0x73,0x1c,0xd8,0xd8,0xc7,0xff,0x1c,0xd8,0xd8,0xc7,0xdf,0x1c,0xd8,0xd8,0xc0,0x0c,0x1c,0xd8,0xd8,0xc0,0x00,0x1c,0xd8,0xd8,0xc0,0x00,0x1c,0xd8,0xd8,0xc7,0xff,0x1c,0xd8,0xd8,0xc7,0xff,0x1c,0xd8,0xd8,0xc0,0x33,0x1c,0xd8,0xd8,0x80,0x33,0x0c,0xd8,0xd8,0xc0,0x33,0x1c,0xd8,0xd9,0xc0,0x33,0x1c,0xd8,0xd8,0x00,0x23,0x00,0xd8,0xd8,0x00,0x00,0x00,0xd8,0xdf,0xc0,0x00,0x1f,0xd8,0xcf,0xc7,0xff,0x1f,0x98,0xff,0xc7,0xff,0x1f,0xf8,0x7f,0xc0,0x00,0x1f,0xf0,0x3f,0xc0,0x00,0x1f,0xe0,0x00,0x07,0xff,0x00,0x00,0x00,0x07,0xff,0x00,0x00,0x00,0x07,0xff,0x00,0x00,0x00,0x06,0x01,0x00,0x00,0x00,0x06,0x03,0x00,0x00,0x00,0x06,0x03,0x00,0x00,0x00,0x07,0x07,0x40,0x00,0x00,0x03,0xfe,0x20,0x00,0x00,0x01,0xfc,0xb0,0x00,0x00,0x00,0x71,0x50,0x00,0x00,0x00,0x06,0xa0,0x00,0x00,0x00,0x03,0x40,0x00,0x00,0x00,0x00,0x80,0x00,0x00,0x00,0x06,0x00,0x00
+};
+
+const unsigned char image_rfid_Layer_8_bits[] = {
+    0x00,0x3f,0x00,0x00,0x00,0xff,0xc0,0x00,0x00,0xff,0xc0,0x00,0x00,0x47,0x80,0x00,0x00,0x07,0x00,0x00,0x00,0x0e,0x00,0x00,0x00,0x1c,0x00,0x00,0x00,0x38,0x00,0x00,0x00,0x70,0x00,0x00,0x00,0xf0,0x40,0x00,0x01,0xe1,0xe0,0x00,0x00,0xff,0xc0,0x00,0x00,0x7f,0x80,0x00,0x0c,0x00,0x0c,0x00,0x0e,0x00,0x1c,0x00,0x0f,0x80,0x7c,0x00,0x07,0xff,0xf8,0x00,0x41,0xff,0xe0,0x80,0xe0,0x1e,0x01,0xc0,0xf8,0x00,0x07,0xc0,0x3e,0x00,0x1f,0x00,0x1f,0xff,0xfe,0x00,0x07,0xff,0xf8,0x00,0x00,0x7f,0x80,0x00
+};
+
+const unsigned char image_rfid_Layer_9_bits[] = {
+    0xff,0xfc,0xff,0xfc,0x03,0x0c,0x03,0x0c,0x0f,0x0c,0x0f,0x0c,0x33,0x0c,0x33,0x0c,0xc0,0xf0,0xc0,0xf0,0x00,0x00,0x00,0x00,0xff,0xfc,0xff,0xfc,0x03,0x0c,0x03,0x0c,0x03,0x0c,0x03,0x0c,0x03,0x0c,0x03,0x0c,0x00,0x0c,0x00,0x0c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xc0,0x0c,0xc0,0x0c,0xff,0xfc,0xff,0xfc,0xc0,0x0c,0xc0,0x0c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xff,0xfc,0xff,0xfc,0xc0,0x0c,0xc0,0x0c,0xc0,0x0c,0xc0,0x0c,0xc0,0x0c,0xc0,0x0c,0x3f,0xf0,0x3f,0xf0
+};
+
+const unsigned char image_rfid_Layer_10_bits[] = {
+    0x0f,0x00,0x10,0xc0,0x20,0x20,0x20,0x30,0x20,0x10,0x20,0x10,0x20,0x10,0x10,0x20,0x00,0x70,0x00,0x00,0x00,0x00,0x1e,0x10,0x31,0xf0,0x20,0x10,0x20,0x10,0x20,0x00,0x30,0x00,0x10,0x00,0x0f,0x10,0x01,0xf0,0x00,0x10,0x20,0x00,0x30,0x00,0x3f,0x90,0x22,0x70,0x02,0x10,0x02,0x10,0x02,0x10,0x0e,0x10,0x11,0x30,0x20,0xe0,0x00,0x00,0x20,0x00,0x30,0x00,0x3f,0x90,0x22,0x70,0x02,0x10,0x02,0x10,0x02,0x10,0x0e,0x10,0x11,0x30,0x20,0xe0,0x80,0x00,0x80,0x00,0x80,0x00,0x80,0x00,0x80,0x00,0x80,0x00,0x80,0x00,0x80,0x00,0x80,0x00,0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x30,0x20,0x10,0x38,0x10,0x2f,0xd0,0x20,0x30,0x20,0x10,0x00,0x10,0x00,0x10,0x00,0x30,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x10,0x38,0x10,0x27,0xd0,0x20,0x30,0x20,0x10,0x00,0x10,0x00,0x10,0x20,0x00,0x20,0x00,0x3f,0x10,0x20,0xf0,0x00,0x30,0x07,0xc0,0x06,0x00,0x21,0x00,0x20,0xc0,0x3c,0x20,0x27,0xf0,0x00,0x10,0x20,0x10,0x30,0x00,0x3f,0x90,0x21,0x70,0x21,0x10,0x21,0x10,0x23,0x90,0x20,0x10,0x38,0x10,0x00,0x30
+};
+
+// SHARED ICON BITMAPS (used across multiple menus)
+const unsigned char image_files_Layer_6_bits[] = {
+    0x0f,0xff,0xff,0xff,0x80,0x00,0x3f,0xff,0xff,0xff,0xe0,0x00,0x7f,0xff,0xff,0xff,0xf0,0x00,0x70,0x00,0x00,0x00,0x70,0x00,0xf0,0x00,0x00,0x00,0x38,0x00,0xe7,0x39,0xdc,0xe7,0x38,0x00,0xe7,0x39,0xdc,0xe7,0x38,0x00,0xe7,0x39,0xdc,0xe7,0x38,0x00,0xe7,0x39,0xdc,0xe7,0x38,0x00,0xe7,0x39,0xdc,0xe7,0x38,0x00,0xe7,0x39,0xdc,0xe7,0x38,0x00,0xe7,0x39,0xdc,0xe7,0x38,0x00,0xe7,0x39,0xdc,0xe7,0x38,0x00,0xe7,0x39,0x8c,0xe7,0x38,0x00,0xe0,0x00,0x00,0x00,0x38,0x00,0xe0,0x00,0x00,0x00,0x3c,0x00,0xe0,0x00,0x00,0x00,0x1e,0x00,0xe0,0x00,0x00,0x00,0x0f,0x00,0xe0,0x00,0x00,0x00,0x07,0x00,0xe0,0x00,0x00,0x00,0x03,0x80,0xe0,0x00,0x00,0x00,0x03,0x80,0xe0,0x00,0x00,0x00,0x03,0x80,0xe0,0x00,0x00,0x00,0x03,0x80,0xe0,0x00,0x00,0x00,0x03,0x80,0xe0,0x00,0x00,0x00,0x03,0x80,0xe0,0x00,0x00,0x00,0x03,0x80,0xe0,0x00,0x00,0x00,0x03,0x80,0xe0,0x00,0x00,0x00,0x03,0x80,0xe0,0x00,0x00,0x00,0x03,0x80,0xe0,0x00,0x00,0x00,0x03,0x80,0xe0,0x00,0x00,0x00,0x03,0x80,0xe0,0x00,0x00,0x00,0x03,0x80,0xe0,0x00,0x00,0x00,0x03,0x80,0xe0,0x00,0x00,0x00,0x03,0x80,0xe0,0x00,0x00,0x00,0x03,0x80,0xe0,0x00,0x00,0x00,0x03,0x80,0xe3,0xff,0xff,0xff,0xe3,0x80,0xe3,0xff,0xff,0xff,0xe3,0x80,0xe3,0xff,0xff,0xff,0xe3,0x80,0xe3,0x80,0x00,0x00,0xe3,0x80,0xe3,0x80,0x00,0x00,0xe3,0x80,0xe3,0x80,0x00,0x00,0xe3,0x80,0xe3,0x80,0x00,0x00,0xe3,0x80,0xe3,0x80,0x00,0x00,0xe3,0x80,0xe3,0x80,0x00,0x00,0xe3,0x80,0xe3,0xff,0xff,0xff,0xe3,0x80,0xe3,0xff,0xff,0xff,0xe3,0x80,0xe3,0xff,0xff,0xff,0xe3,0x80,0xe0,0x00,0x00,0x00,0x03,0x80,0xe0,0x00,0x00,0x00,0x03,0x80,0xe0,0x00,0x00,0x00,0x03,0x80,0xf0,0x00,0x00,0x00,0x07,0x00,0x7c,0x00,0x00,0x00,0x1f,0x00,0x3f,0xff,0xff,0xff,0xfe,0x00,0x1f,0xff,0xff,0xff,0xfc,0x00
+};
+
+const unsigned char image_mi1byse_extraextra_bits[] = {
+    0x00,0x00,0x00,0x07,0xff,0xff,0xc0,0x00,0x00,0x00,0x0f,0xff,0xff,0xe0,0x00,0x00,0x00,0x0f,0xff,0xff,0xf0,0x00,0x00,0x00,0x0f,0xff,0xff,0xf0,0x3f,0xff,0xfc,0x0f,0xff,0xff,0xf0,0x7f,0xff,0xfe,0x0f,0xff,0xff,0xf0,0xff,0xff,0xff,0x0f,0xff,0xff,0xf0,0xff,0xff,0xff,0x0f,0xff,0xff,0xf0,0xff,0xff,0xff,0x0f,0xff,0xff,0xf0,0xff,0xff,0xff,0x0f,0xff,0xff,0xf0,0xff,0xff,0xff,0x0f,0xff,0xff,0xf0,0xff,0xff,0xff,0x0f,0xff,0xff,0xf0,0xff,0xff,0xff,0x0f,0xff,0xff,0xf0,0xff,0xff,0xff,0x0f,0xff,0xff,0xf0,0xff,0xff,0xff,0x0f,0xff,0xff,0xf0,0xff,0xff,0xff,0x0f,0xff,0xff,0xf0,0xff,0xff,0xff,0x0f,0xff,0xff,0xf0,0xff,0xff,0xff,0x0f,0xff,0xff,0xf0,0xff,0xff,0xff,0x0f,0xff,0xff,0xf0,0xff,0xff,0xff,0x0f,0xff,0xff,0xf0,0xff,0xff,0xff,0x0f,0xff,0xff,0xf0,0xff,0xff,0xff,0x0f,0xff,0xff,0xf0,0xff,0xff,0xff,0x0f,0xff,0xff,0xf0,0xff,0xff,0xff,0x07,0xff,0xff,0xe0,0xff,0xff,0xff,0x00,0x00,0x00,0x00,0xff,0xff,0xff,0x00,0x00,0x00,0x00,0xff,0xff,0xff,0x80,0x00,0x00,0x00,0xff,0xff,0xff,0xc0,0x00,0x00,0x00,0xff,0xff,0xff,0xff,0xff,0xfc,0x00,0xff,0xff,0xff,0xff,0xff,0xfe,0x00,0xff,0xff,0xff,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0xff,0xff,0xff,0x00,0x7f,0xff,0xff,0xff,0xff,0xfe,0x00,0x3f,0xff,0xff,0xff,0xff,0xfc,0x00
+};
+
+const unsigned char image_yhj24xz_RFIDrfid_bits[] = {
+    0xff,0xff,0xc0,0x80,0x00,0x40,0xff,0xff,0xc0,0xfc,0x00,0xc0,0xfb,0xfe,0xc0,0xf0,0x06,0xc0,0xc0,0x06,0xc0,0xcb,0xf6,0xc0,0xc8,0x56,0xc0,0xc8,0xd6,0xc0,0xcb,0xf6,0xc0,0xc8,0x06,0xc0,0xcb,0xf6,0xc0,0xc8,0x56,0xc0,0xc8,0x56,0xc0,0xc0,0x10,0xc0,0xf8,0x07,0xc0,0xfb,0xf7,0xc0,0x78,0x07,0x80,0x03,0xf0,0x00,0x02,0x10,0x00,0x02,0x10,0x00,0x01,0xe0,0x00,0x00,0xdc,0x00,0x00,0x18,0x00,0x00,0x20,0x00
+};
+
+// NFC menu bitmap data
+const unsigned char image_nfc_Layer_2_bits[] = {
+    0x0f,0xf0,0x0f,0xf0,0x30,0x00,0x30,0x00,0xc3,0xc0,0xc3,0xc0,0xcc,0x30,0xcc,0x30,0xcc,0x30,0xcc,0x30,0xc3,0xc0,0xc3,0xc0,0xc0,0x00,0xc0,0x00,0xc0,0x00,0xc0,0x00,0xcc,0x00,0xcc,0x00,0xc3,0x00,0xc3,0x00,0xc0,0xc0,0xc0,0xc0,0xcc,0x30,0xcc,0x30,0xc3,0x00,0xc3,0x00,0xc0,0xc0,0xc0,0xc0,0xcc,0x30,0xcc,0x30,0xc3,0x00,0xc3,0x00,0xc0,0xc0,0xc0,0xc0,0xcc,0x30,0xcc,0x30,0xc3,0x00,0xc3,0x00,0xc0,0xc0,0xc0,0xc0,0xcc,0x30,0xcc,0x30,0xc3,0x00,0xc3,0x00,0xc0,0xc0,0xc0,0xc0,0xcc,0x30,0xcc,0x30,0xc3,0x00,0xc3,0x00,0xc0,0xc0,0xc0,0xc0,0xc0,0x30,0xc0,0x30,0xc0,0x00,0xc0,0x00,0x30,0x00,0x30,0x00,0x3c,0x00,0x3c,0x00,0x3f,0x00,0x3f,0x00,0x3f,0xc0,0x3f,0xc0,0x3f,0xf0,0x3f,0xf0,0x33,0xf0,0x33,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0
+};
+
+const unsigned char image_nfc_Layer_3_bits[] = {
+    0x3f,0xf8,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x38,0x38,0x08,0x20,0x08,0x20,0x07,0xc0
+};
+
+const unsigned char image_nfc_Layer_6_bits[] = {
+    0x00,0x00,0x00,0x78,0x00,0x00,0x00,0x00,0x00,0x07,0xff,0x00,0x00,0x00,0x00,0x00,0x3f,0xff,0xe0,0x00,0x00,0x00,0x00,0x7f,0xff,0xf8,0x00,0x00,0x00,0x00,0xff,0xff,0xf8,0x00,0x00,0x00,0x00,0x7f,0xff,0xf0,0x00,0x00,0x00,0x00,0x3c,0x0f,0xe0,0x00,0x00,0x00,0x00,0x10,0x1f,0xc0,0x00,0x00,0x00,0x00,0x00,0x1f,0xc0,0x00,0x00,0x00,0x00,0x00,0x3f,0x00,0x00,0x00,0x00,0x00,0x00,0x7f,0x00,0x00,0x00,0x00,0x00,0x00,0xfe,0x00,0x00,0x00,0x00,0x00,0x01,0xfc,0x00,0x00,0x00,0x00,0x00,0x03,0xf8,0x00,0x00,0x00,0x00,0x00,0x07,0xf0,0x00,0x00,0x00,0x00,0x00,0x0f,0xe0,0x00,0x00,0x00,0x00,0x00,0x1f,0xc0,0x00,0x00,0x00,0x00,0x00,0x3f,0x80,0x00,0x00,0x00,0x00,0x00,0x3f,0x80,0x00,0x00,0x00,0x00,0x00,0x7f,0x00,0x30,0x00,0x00,0x00,0x00,0xfe,0x00,0xf8,0x00,0x00,0x00,0x01,0xfe,0x03,0xfc,0x00,0x00,0x00,0x03,0xff,0xff,0xfe,0x00,0x00,0x00,0x00,0xff,0xff,0xf8,0x00,0x00,0x00,0x00,0x7f,0xff,0xf0,0x00,0x00,0x00,0x00,0x1f,0xff,0xc0,0x00,0x00,0x00,0x00,0x03,0xfe,0x00,0x00,0x00,0x00,0x70,0x00,0x00,0x00,0x70,0x00,0x00,0x78,0x00,0x00,0x00,0xf0,0x00,0x00,0xfe,0x00,0x00,0x03,0xf8,0x00,0x01,0xff,0x80,0x00,0x0f,0xfc,0x00,0x00,0xff,0xe0,0x00,0x3f,0xf8,0x00,0x00,0x3f,0xff,0x07,0xff,0xe0,0x00,0x00,0x1f,0xff,0xff,0xff,0xc0,0x00,0x10,0x07,0xff,0xff,0xff,0x00,0x00,0x30,0x01,0xff,0xff,0xfc,0x00,0x60,0x3c,0x00,0x3f,0xff,0xe0,0x01,0xf0,0x7e,0x00,0x01,0xfc,0x00,0x03,0xf0,0xff,0x00,0x00,0x00,0x00,0x0f,0xf8,0x7f,0xe0,0x00,0x00,0x00,0x3f,0xf0,0x3f,0xf8,0x00,0x00,0x00,0xff,0xe0,0x0f,0xfe,0x00,0x00,0x03,0xff,0x80,0x07,0xff,0xc0,0x00,0x3f,0xff,0x00,0x01,0xff,0xff,0xff,0xff,0xfc,0x00,0x00,0x7f,0xff,0xff,0xff,0xf0,0x00,0x00,0x1f,0xff,0xff,0xff,0xc0,0x00,0x00,0x03,0xff,0xff,0xfe,0x00,0x00,0x00,0x00,0x3f,0xff,0xe0,0x00,0x00,0x00,0x00,0x01,0xf8,0x00,0x00,0x00
+};
+
+const unsigned char image_nfc_Layer_7_bits[] = {
+    0xff,0xfc,0xff,0xfc,0x00,0xc0,0x00,0xc0,0x03,0x00,0x03,0x00,0x0c,0x00,0x0c,0x00,0xff,0xfc,0xff,0xfc,0x00,0x00,0x00,0x00,0xff,0xfc,0xff,0xfc,0x03,0x0c,0x03,0x0c,0x03,0x0c,0x03,0x0c,0x03,0x0c,0x03,0x0c,0x00,0x0c,0x00,0x0c,0x00,0x00,0x00,0x00,0x3f,0xf0,0x3f,0xf0,0xc0,0x0c,0xc0,0x0c,0xc0,0x0c,0xc0,0x0c,0xc0,0x0c,0xc0,0x0c,0x30,0x30,0x30,0x30
+};
+
+const unsigned char image_nfc_Layer_8_bits[] = {
+    0x00,0x02,0x00,0x00,0x0f,0x00,0x00,0x0f,0x00,0x00,0x07,0x80,0x00,0x07,0xc0,0x00,0xc3,0xc0,0x01,0xc1,0xe0,0x01,0xe1,0xe0,0x01,0xe1,0xe0,0x00,0xf0,0xf0,0x10,0xf0,0xf0,0x38,0x70,0xf0,0x38,0x78,0xf0,0xf8,0x78,0xf0,0xf8,0x78,0xf0,0x38,0x78,0xf0,0x38,0x70,0xf0,0x10,0xf0,0xf0,0x00,0xf0,0xf0,0x01,0xe1,0xe0,0x01,0xe1,0xe0,0x01,0xc1,0xe0,0x00,0xc3,0xc0,0x00,0x07,0xc0,0x00,0x07,0x80,0x00,0x0f,0x00,0x00,0x0f,0x00,0x00,0x06,0x00
+};
+
+const unsigned char image_nfc_Layer_9_bits[] = {
+    0xff,0xff,0xc0,0x80,0x00,0x40,0xff,0xff,0xc0,0xfc,0x00,0xc0,0xfb,0xfe,0xc0,0xf0,0x06,0xc0,0xc0,0x06,0xc0,0xcb,0xf6,0xc0,0xc8,0x56,0xc0,0xc8,0xd6,0xc0,0xcb,0xf6,0xc0,0xc8,0x06,0xc0,0xcb,0xf6,0xc0,0xc8,0x56,0xc0,0xc8,0x56,0xc0,0xc0,0x10,0xc0,0xf8,0x07,0xc0,0xfb,0xf7,0xc0,0x78,0x07,0x80,0x03,0xf0,0x00,0x02,0x10,0x00,0x02,0x10,0x00,0x01,0xe0,0x00,0x00,0xdc,0x00,0x00,0x18,0x00,0x00,0x20,0x00
+};
+
+const unsigned char image_nfc_Layer_10_bits[] = {
+    0x0f,0x00,0x10,0xc0,0x20,0x20,0x20,0x30,0x20,0x10,0x20,0x10,0x20,0x10,0x10,0x20,0x00,0x70,0x00,0x00,0x00,0x00,0x1e,0x10,0x31,0xf0,0x20,0x10,0x20,0x10,0x20,0x00,0x30,0x00,0x10,0x00,0x0f,0x10,0x01,0xf0,0x00,0x10,0x20,0x00,0x30,0x00,0x3f,0x90,0x22,0x70,0x02,0x10,0x02,0x10,0x02,0x10,0x0e,0x10,0x11,0x30,0x20,0xe0,0x00,0x00,0x20,0x00,0x30,0x00,0x3f,0x90,0x22,0x70,0x02,0x10,0x02,0x10,0x02,0x10,0x0e,0x10,0x11,0x30,0x20,0xe0,0x80,0x00,0x80,0x00,0x80,0x00,0x80,0x00,0x80,0x00,0x80,0x00,0x80,0x00,0x80,0x00,0x80,0x00,0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x30,0x20,0x10,0x38,0x10,0x2f,0xd0,0x20,0x30,0x20,0x10,0x00,0x10,0x00,0x10,0x00,0x30,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x10,0x38,0x10,0x27,0xd0,0x20,0x30,0x20,0x10,0x00,0x10,0x00,0x10,0x20,0x00,0x20,0x00,0x3f,0x10,0x20,0xf0,0x00,0x30,0x07,0xc0,0x06,0x00,0x21,0x00,0x20,0xc0,0x3c,0x20,0x27,0xf0,0x00,0x10,0x20,0x10,0x30,0x00,0x3f,0x90,0x21,0x70,0x21,0x10,0x21,0x10,0x23,0x90,0x20,0x10,0x38,0x10,0x00,0x30
+};
+
+//Options
+const unsigned char OptionsLayer_7_bits[] = {
+    0x0f,0xf0,0x0f,0xf0,0x30,0x00,0x30,0x00,0xc3,0xc0,0xc3,0xc0,0xcc,0x30,0xcc,0x30,0xcc,0x30,0xcc,0x30,0xc3,0xc0,0xc3,0xc0,0xc0,0x00,0xc0,0x00,0xc0,0x00,0xc0,0x00,0xcc,0x00,0xcc,0x00,0xc3,0x00,0xc3,0x00,0xc0,0xc0,0xc0,0xc0,0xcc,0x30,0xcc,0x30,0xc3,0x00,0xc3,0x00,0xc0,0xc0,0xc0,0xc0,0xcc,0x30,0xcc,0x30,0xc3,0x00,0xc3,0x00,0xc0,0xc0,0xc0,0xc0,0xcc,0x30,0xcc,0x30,0xc3,0x00,0xc3,0x00,0xc0,0xc0,0xc0,0xc0,0xcc,0x30,0xcc,0x30,0xc3,0x00,0xc3,0x00,0xc0,0xc0,0xc0,0xc0,0xcc,0x30,0xcc,0x30,0xc3,0x00,0xc3,0x00,0xc0,0xc0,0xc0,0xc0,0xc0,0x30,0xc0,0x30,0xc0,0x00,0xc0,0x00,0x30,0x00,0x30,0x00,0x3c,0x00,0x3c,0x00,0x3f,0x00,0x3f,0x00,0x3f,0xc0,0x3f,0xc0,0x3f,0xf0,0x3f,0xf0,0x33,0xf0,0x33,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0
+};
+
+const unsigned char OptionsLayer_9_bits[] = {
+    0x3f,0xf8,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x38,0x38,0x08,0x20,0x08,0x20,0x07,0xc0
+};
+
+// ─────────────────────────────────────────────────────────────────────────────
+// Submenus
+// ─────────────────────────────────────────────────────────────────────────────
+// WiFi submenumenu bitmap data
+const unsigned char image__16_bits[] = {
+    0x01,0x00,0x03,0x00,0x01,0x80,0x0c,0xc0,0x0c,0xc0,0x0c,0xc0,0x46,0xc0,0xc6,0xc0,0x44,0xc0,0x0c,0xc0,0x0c,0xc0,0x09,0x80,0x01,0x80,0x03,0x00
+};
+
+const unsigned char image_battery_empty_bits[] = {
+    0x3f,0xf8,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x38,0x38,0x08,0x20,0x08,0x20,0x07,0xc0
+};
+
+const unsigned char image_Layer_9_bits[] = {
+    0x7e,0x80,0x70,0x80,0x7e,0x00,0x00,0x82,0xfe,0x82,0x00,0x00,0xfe,0x12,0x12,0x12,0x02,0x00,0x00,0x82,0xfe,0x82
+};
+
+const unsigned char image_passport_left_bits[] = {
+    0x0f,0xf0,0x0f,0xf0,0x30,0x00,0x30,0x00,0xc3,0xc0,0xc3,0xc0,0xcc,0x30,0xcc,0x30,0xcc,0x30,0xcc,0x30,0xc3,0xc0,0xc3,0xc0,0xc0,0x00,0xc0,0x00,0xc0,0x00,0xc0,0x00,0xcc,0x00,0xcc,0x00,0xc3,0x00,0xc3,0x00,0xc0,0xc0,0xc0,0xc0,0xcc,0x30,0xcc,0x30,0xc3,0x00,0xc3,0x00,0xc0,0xc0,0xc0,0xc0,0xcc,0x30,0xcc,0x30,0xc3,0x00,0xc3,0x00,0xc0,0xc0,0xc0,0xc0,0xcc,0x30,0xcc,0x30,0xc3,0x00,0xc3,0x00,0xc0,0xc0,0xc0,0xc0,0xcc,0x30,0xcc,0x30,0xc3,0x00,0xc3,0x00,0xc0,0xc0,0xc0,0xc0,0xcc,0x30,0xcc,0x30,0xc3,0x00,0xc3,0x00,0xc0,0xc0,0xc0,0xc0,0xc0,0x30,0xc0,0x30,0xc0,0x00,0xc0,0x00,0x30,0x00,0x30,0x00,0x3c,0x00,0x3c,0x00,0x3f,0x00,0x3f,0x00,0x3f,0xc0,0x3f,0xc0,0x3f,0xf0,0x3f,0xf0,0x33,0xf0,0x33,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0
+};
+
+//Bluetooth submenu bitmap data
+const unsigned char image_bleLayer_2_bits[] = {
+    0x3f,0xf8,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x38,0x38,0x08,0x20,0x08,0x20,0x07,0xc0
+};
+
+const unsigned char image_bleLayer_3_bits[] = {
+    0x0f,0xf0,0x0f,0xf0,0x30,0x00,0x30,0x00,0xc3,0xc0,0xc3,0xc0,0xcc,0x30,0xcc,0x30,0xcc,0x30,0xcc,0x30,0xc3,0xc0,0xc3,0xc0,0xc0,0x00,0xc0,0x00,0xc0,0x00,0xc0,0x00,0xcc,0x00,0xcc,0x00,0xc3,0x00,0xc3,0x00,0xc0,0xc0,0xc0,0xc0,0xcc,0x30,0xcc,0x30,0xc3,0x00,0xc3,0x00,0xc0,0xc0,0xc0,0xc0,0xcc,0x30,0xcc,0x30,0xc3,0x00,0xc3,0x00,0xc0,0xc0,0xc0,0xc0,0xcc,0x30,0xcc,0x30,0xc3,0x00,0xc3,0x00,0xc0,0xc0,0xc0,0xc0,0xcc,0x30,0xcc,0x30,0xc3,0x00,0xc3,0x00,0xc0,0xc0,0xc0,0xc0,0xcc,0x30,0xcc,0x30,0xc3,0x00,0xc3,0x00,0xc0,0xc0,0xc0,0xc0,0xc0,0x30,0xc0,0x30,0xc0,0x00,0xc0,0x00,0x30,0x00,0x30,0x00,0x3c,0x00,0x3c,0x00,0x3f,0x00,0x3f,0x00,0x3f,0xc0,0x3f,0xc0,0x3f,0xf0,0x3f,0xf0,0x33,0xf0,0x33,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0
+};
+
+const unsigned char image_bleLayer_6_bits[] = {
+    0x03,0xe0,0x00,0x04,0x10,0x00,0x01,0xc0,0x00,0x00,0x00,0x00,0x01,0xc0,0x00,0x00,0x00,0x00,0x08,0x88,0x00,0x0c,0x18,0x00,0x04,0x10,0x00,0x02,0x20,0x00,0x03,0x60,0x00,0xff,0xff,0x80,0x61,0xc3,0x00,0x33,0x66,0x00,0x1e,0x3c,0x00,0x0c,0x18,0x00,0x00,0x80,0x00,0x00,0x00,0x00,0x01,0xc0,0x00,0x00,0x00,0x00,0x01,0xc0,0x00,0x04,0x10,0x00,0x03,0xe0,0x00
+};
+
+const unsigned char image_bleLayer_8_bits[] = {
+    0xfe,0x92,0x92,0x92,0x6c,0x00,0xfe,0x80,0x80,0x80,0x80,0x00,0x7e,0x80,0x80,0x80,0x7e,0x00,0xfe,0x92,0x92,0x92,0x82,0x00,0x06,0x02,0xfe,0x02,0x06,0x00,0x7c,0x82,0x82,0x82,0x7c,0x00,0x7c,0x82,0x82,0x82,0x7c,0x00,0x06,0x02,0xfe,0x02,0x06,0x00,0xfe,0x10,0x10,0x10,0xfe
+};
+
+//Ir submenu bitmap data
+const unsigned char image_irLayer_2_bits[] = {
+    0x0f,0xf0,0x0f,0xf0,0x30,0x00,0x30,0x00,0xc3,0xc0,0xc3,0xc0,0xcc,0x30,0xcc,0x30,0xcc,0x30,0xcc,0x30,0xc3,0xc0,0xc3,0xc0,0xc0,0x00,0xc0,0x00,0xc0,0x00,0xc0,0x00,0xcc,0x00,0xcc,0x00,0xc3,0x00,0xc3,0x00,0xc0,0xc0,0xc0,0xc0,0xcc,0x30,0xcc,0x30,0xc3,0x00,0xc3,0x00,0xc0,0xc0,0xc0,0xc0,0xcc,0x30,0xcc,0x30,0xc3,0x00,0xc3,0x00,0xc0,0xc0,0xc0,0xc0,0xcc,0x30,0xcc,0x30,0xc3,0x00,0xc3,0x00,0xc0,0xc0,0xc0,0xc0,0xcc,0x30,0xcc,0x30,0xc3,0x00,0xc3,0x00,0xc0,0xc0,0xc0,0xc0,0xcc,0x30,0xcc,0x30,0xc3,0x00,0xc3,0x00,0xc0,0xc0,0xc0,0xc0,0xc0,0x30,0xc0,0x30,0xc0,0x00,0xc0,0x00,0x30,0x00,0x30,0x00,0x3c,0x00,0x3c,0x00,0x3f,0x00,0x3f,0x00,0x3f,0xc0,0x3f,0xc0,0x3f,0xf0,0x3f,0xf0,0x33,0xf0,0x33,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0
+};
+
+const unsigned char image_irLayer_3_bits[] = {
+    0x3f,0xf8,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x38,0x38,0x08,0x20,0x08,0x20,0x07,0xc0
+};
+
+const unsigned char image_irLayer_6_bits[] = {
+    0x3f,0xfc,0x20,0x04,0x20,0x04,0x3f,0xfc,0x08,0x10,0x06,0x60,0x03,0xc0,0x30,0x0c,0x48,0x12,0x47,0xe2,0x40,0x02,0x38,0x1c,0x07,0xe0,0x00,0x00,0x60,0x06,0x90,0x09,0x8f,0xf1,0x80,0x01,0x40,0x02,0x20,0x04,0x1f,0xf8
+};
+
+const unsigned char image_irLayer_8_bits[] = {
+    0x82,0xfe,0x82,0x00,0x00,0xfe,0x12,0x32,0x52,0x8c
+};
+
+//RF submenu bitmap data
+const unsigned char image_rfLayer_13_1_bits[] = {
+    0xfe,0x12,0x32,0x52,0x8c,0x00,0xfe,0x12,0x12,0x12,0x02
+};
+
+const unsigned char image_rfLayer_13_bits[] = {
+    0x00,0x1f,0x00,0x00,0x61,0xc0,0x00,0x80,0x60,0x01,0x3f,0x20,0x00,0x60,0x80,0x80,0x1e,0x00,0xf8,0x33,0x00,0xbf,0x00,0x00,0x19,0xfe,0x00,0x19,0xfe,0x00,0xbf,0x00,0x00,0xf8,0x33,0x00,0x80,0x0e,0x00,0x00,0x60,0x80,0x01,0x3f,0x20,0x01,0x80,0x60,0x00,0x61,0xc0,0x00,0x3f,0x00
+};
+
+const unsigned char image_rfLayer_7_bits[] = {
+    0x0f,0xf0,0x0f,0xf0,0x30,0x00,0x30,0x00,0xc3,0xc0,0xc3,0xc0,0xcc,0x30,0xcc,0x30,0xcc,0x30,0xcc,0x30,0xc3,0xc0,0xc3,0xc0,0xc0,0x00,0xc0,0x00,0xc0,0x00,0xc0,0x00,0xcc,0x00,0xcc,0x00,0xc3,0x00,0xc3,0x00,0xc0,0xc0,0xc0,0xc0,0xcc,0x30,0xcc,0x30,0xc3,0x00,0xc3,0x00,0xc0,0xc0,0xc0,0xc0,0xcc,0x30,0xcc,0x30,0xc3,0x00,0xc3,0x00,0xc0,0xc0,0xc0,0xc0,0xcc,0x30,0xcc,0x30,0xc3,0x00,0xc3,0x00,0xc0,0xc0,0xc0,0xc0,0xcc,0x30,0xcc,0x30,0xc3,0x00,0xc3,0x00,0xc0,0xc0,0xc0,0xc0,0xcc,0x30,0xcc,0x30,0xc3,0x00,0xc3,0x00,0xc0,0xc0,0xc0,0xc0,0xc0,0x30,0xc0,0x30,0xc0,0x00,0xc0,0x00,0x30,0x00,0x30,0x00,0x3c,0x00,0x3c,0x00,0x3f,0x00,0x3f,0x00,0x3f,0xc0,0x3f,0xc0,0x3f,0xf0,0x3f,0xf0,0x33,0xf0,0x33,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0
+};
+
+const unsigned char image_rfLayer_8_bits[] = {
+    0x3f,0xf8,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x38,0x38,0x08,0x20,0x08,0x20,0x07,0xc0
+};
+
+//NRF submenu bitmap data
+const unsigned char image_nrfimage_2_bits[] = {
+    0x07,0xe0,0x00,0x08,0x18,0x00,0x30,0x06,0x00,0x47,0xe1,0x00,0x88,0x19,0x00,0x10,0x04,0x00,0x23,0xe0,0x00,0x04,0x10,0x00,0x01,0xc0,0x00,0x01,0xc0,0x00,0x01,0xc0,0x00,0x00,0x00,0x00,0x04,0x10,0x00,0x23,0xe4,0x00,0x98,0x08,0x80,0x4c,0x11,0x00,0x63,0xe2,0x00,0x10,0x04,0x00,0x0f,0xf8,0x00
+};
+
+const unsigned char image_nrfLayer_14_bits[] = {
+    0xfe,0x08,0x10,0x20,0xfe,0x00,0xfe,0x12,0x32,0x52,0x8c,0x00,0xfe,0x12,0x12,0x12,0x02
+};
+
+const unsigned char image_nrfLayer_15_bits[] = {
+    0x80
+};
+
+const unsigned char image_nrfLayer_7_bits[] = {
+    0x0f,0xf0,0x0f,0xf0,0x30,0x00,0x30,0x00,0xc3,0xc0,0xc3,0xc0,0xcc,0x30,0xcc,0x30,0xcc,0x30,0xcc,0x30,0xc3,0xc0,0xc3,0xc0,0xc0,0x00,0xc0,0x00,0xc0,0x00,0xc0,0x00,0xcc,0x00,0xcc,0x00,0xc3,0x00,0xc3,0x00,0xc0,0xc0,0xc0,0xc0,0xcc,0x30,0xcc,0x30,0xc3,0x00,0xc3,0x00,0xc0,0xc0,0xc0,0xc0,0xcc,0x30,0xcc,0x30,0xc3,0x00,0xc3,0x00,0xc0,0xc0,0xc0,0xc0,0xcc,0x30,0xcc,0x30,0xc3,0x00,0xc3,0x00,0xc0,0xc0,0xc0,0xc0,0xcc,0x30,0xcc,0x30,0xc3,0x00,0xc3,0x00,0xc0,0xc0,0xc0,0xc0,0xcc,0x30,0xcc,0x30,0xc3,0x00,0xc3,0x00,0xc0,0xc0,0xc0,0xc0,0xc0,0x30,0xc0,0x30,0xc0,0x00,0xc0,0x00,0x30,0x00,0x30,0x00,0x3c,0x00,0x3c,0x00,0x3f,0x00,0x3f,0x00,0x3f,0xc0,0x3f,0xc0,0x3f,0xf0,0x3f,0xf0,0x33,0xf0,0x33,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0
+};
+
+const unsigned char image_nrfLayer_9_bits[] = {
+    0x7f,0xf0,0x80,0x08,0x80,0x08,0x80,0x08,0x80,0x08,0x80,0x08,0x80,0x08,0x80,0x08,0x80,0x08,0x80,0x08,0x80,0x08,0x80,0x08,0x80,0x08,0x80,0x08,0x80,0x08,0x80,0x08,0x80,0x08,0x80,0x08,0x80,0x08,0x80,0x08,0x70,0x70,0x10,0x40,0x10,0x40,0x0f,0x80
+};
+
+//radio submenu bitmap data
+const unsigned char image_RadioLayer_2_bits[] = {
+    0x3f,0xf8,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x38,0x38,0x08,0x20,0x08,0x20,0x07,0xc0
+};
+
+const unsigned char image_RadioLayer_3_bits[] = {
+    0x0f,0xf0,0x0f,0xf0,0x30,0x00,0x30,0x00,0xc3,0xc0,0xc3,0xc0,0xcc,0x30,0xcc,0x30,0xcc,0x30,0xcc,0x30,0xc3,0xc0,0xc3,0xc0,0xc0,0x00,0xc0,0x00,0xc0,0x00,0xc0,0x00,0xcc,0x00,0xcc,0x00,0xc3,0x00,0xc3,0x00,0xc0,0xc0,0xc0,0xc0,0xcc,0x30,0xcc,0x30,0xc3,0x00,0xc3,0x00,0xc0,0xc0,0xc0,0xc0,0xcc,0x30,0xcc,0x30,0xc3,0x00,0xc3,0x00,0xc0,0xc0,0xc0,0xc0,0xcc,0x30,0xcc,0x30,0xc3,0x00,0xc3,0x00,0xc0,0xc0,0xc0,0xc0,0xcc,0x30,0xcc,0x30,0xc3,0x00,0xc3,0x00,0xc0,0xc0,0xc0,0xc0,0xcc,0x30,0xcc,0x30,0xc3,0x00,0xc3,0x00,0xc0,0xc0,0xc0,0xc0,0xc0,0x30,0xc0,0x30,0xc0,0x00,0xc0,0x00,0x30,0x00,0x30,0x00,0x3c,0x00,0x3c,0x00,0x3f,0x00,0x3f,0x00,0x3f,0xc0,0x3f,0xc0,0x3f,0xf0,0x3f,0xf0,0x33,0xf0,0x33,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0
+};
+
+const unsigned char image_RadioLayer_6_bits[] = {
+    0x40,0x00,0x00,0x00,0x04,0x00,0x17,0xca,0x00,0x33,0xcc,0x00,0x63,0xcc,0x00,0x57,0xcd,0x00,0x77,0xc5,0x00,0x77,0xc5,0x00,0x77,0x55,0x00,0x77,0xfd,0x40,0x71,0xf5,0xe0,0x75,0xfc,0xd0,0x75,0xfd,0xf8,0x71,0xfd,0xf0,0x75,0xfd,0xd8,0x75,0xfd,0xe4,0x71,0xfd,0x56,0x71,0xfd,0x52,0x75,0xfd,0xae,0x75,0xfc,0xe8,0x75,0xfc,0xd0,0x75,0x54,0x00,0x77,0xfc,0x00,0x55,0xcc,0x00,0x67,0x64,0x00,0x04,0x44,0x00,0x00,0x00,0x00
+};
+
+const unsigned char image_RadioLayer_8_bits[] = {
+    0xfe,0x12,0x32,0x52,0x8c,0x00,0xf8,0x24,0x22,0x24,0xf8,0x00,0xfe,0x82,0x82,0x82,0x7c,0x00,0x00,0x82,0xfe,0x82,0x00,0x00,0x7c,0x82,0x82,0x82,0x7c
+};
+
+//Gps submenu bitmap data
+const unsigned char image_GpsLayer_6_bits[] = {
+    0x01,0xf8,0x07,0xfe,0x1f,0x06,0x3e,0x02,0x7c,0x01,0xfc,0x01,0xfc,0x01,0x7c,0x01,0x1e,0x02,0x0f,0x8e,0x03,0xfc,0x00,0xf0
+};
+
+const unsigned char image_GpsLayer_2_bits[] = {
+    0x3f,0xf8,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x38,0x38,0x08,0x20,0x08,0x20,0x07,0xc0
+};
+
+const unsigned char image_GpsLayer_3_bits[] = {
+    0x0f,0xf0,0x0f,0xf0,0x30,0x00,0x30,0x00,0xc3,0xc0,0xc3,0xc0,0xcc,0x30,0xcc,0x30,0xcc,0x30,0xcc,0x30,0xc3,0xc0,0xc3,0xc0,0xc0,0x00,0xc0,0x00,0xc0,0x00,0xc0,0x00,0xcc,0x00,0xcc,0x00,0xc3,0x00,0xc3,0x00,0xc0,0xc0,0xc0,0xc0,0xcc,0x30,0xcc,0x30,0xc3,0x00,0xc3,0x00,0xc0,0xc0,0xc0,0xc0,0xcc,0x30,0xcc,0x30,0xc3,0x00,0xc3,0x00,0xc0,0xc0,0xc0,0xc0,0xcc,0x30,0xcc,0x30,0xc3,0x00,0xc3,0x00,0xc0,0xc0,0xc0,0xc0,0xcc,0x30,0xcc,0x30,0xc3,0x00,0xc3,0x00,0xc0,0xc0,0xc0,0xc0,0xcc,0x30,0xcc,0x30,0xc3,0x00,0xc3,0x00,0xc0,0xc0,0xc0,0xc0,0xc0,0x30,0xc0,0x30,0xc0,0x00,0xc0,0x00,0x30,0x00,0x30,0x00,0x3c,0x00,0x3c,0x00,0x3f,0x00,0x3f,0x00,0x3f,0xc0,0x3f,0xc0,0x3f,0xf0,0x3f,0xf0,0x33,0xf0,0x33,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0
+};
+
+const unsigned char image_GpsLayer_8_bits[] = {
+    0x7c,0x82,0x82,0xa2,0xe6,0x00,0xfe,0x12,0x12,0x12,0x0c,0x00,0x4c,0x92,0x92,0x92,0x64
+};
+
+//Rpi submenu bitmap data
+const unsigned char image_RpiLayer_2_bits[] = {
+0x3f,0xf8,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x38,0x38,0x08,0x20,0x08,0x20,0x07,0xc0
+};
+
+const unsigned char image_RpiLayer_3_bits[] = {
+0x0f,0xf0,0x0f,0xf0,0x30,0x00,0x30,0x00,0xc3,0xc0,0xc3,0xc0,0xcc,0x30,0xcc,0x30,0xcc,0x30,0xcc,0x30,0xc3,0xc0,0xc3,0xc0,0xc0,0x00,0xc0,0x00,0xc0,0x00,0xc0,0x00,0xcc,0x00,0xcc,0x00,0xc3,0x00,0xc3,0x00,0xc0,0xc0,0xc0,0xc0,0xcc,0x30,0xcc,0x30,0xc3,0x00,0xc3,0x00,0xc0,0xc0,0xc0,0xc0,0xcc,0x30,0xcc,0x30,0xc3,0x00,0xc3,0x00,0xc0,0xc0,0xc0,0xc0,0xcc,0x30,0xcc,0x30,0xc3,0x00,0xc3,0x00,0xc0,0xc0,0xc0,0xc0,0xcc,0x30,0xcc,0x30,0xc3,0x00,0xc3,0x00,0xc0,0xc0,0xc0,0xc0,0xcc,0x30,0xcc,0x30,0xc3,0x00,0xc3,0x00,0xc0,0xc0,0xc0,0xc0,0xc0,0x30,0xc0,0x30,0xc0,0x00,0xc0,0x00,0x30,0x00,0x30,0x00,0x3c,0x00,0x3c,0x00,0x3f,0x00,0x3f,0x00,0x3f,0xc0,0x3f,0xc0,0x3f,0xf0,0x3f,0xf0,0x33,0xf0,0x33,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0
+};
+
+const unsigned char image_RpiLayer_6_bits[] = {
+0x1c,0x00,0x20,0x3e,0x00,0x60,0xcc,0xe3,0xe0,0xc0,0x63,0xa0,0xdf,0x77,0x60,0x9f,0x94,0xe0,0x1f,0x84,0xc0,0xdf,0x13,0xc0,0xcf,0x73,0x80,0xe0,0x70,0x00,0xef,0x70,0x80,0xcf,0x73,0x80,0x1f,0x84,0xc0,0x1f,0x84,0xc0,0xdf,0x17,0x60,0xce,0x77,0xa0,0xc0,0x63,0xa0,0x9e,0x80,0xe0,0x3e,0x00,0x60
+};
+
+const unsigned char image_RpiLayer_8_1_bits[] = {
+0xfe,0x12,0x32,0x52,0x8c,0x00,0xfe,0x12,0x12,0x12,0x0c,0x00,0x00,0x82,0xfe,0x82
+};
+
+const unsigned char image_RpiLayer_9_bits[] = {
+0x7c,0x82,0x82,0x82,0x44,0x00,0x7c,0x82,0x82,0x82,0x7c,0x00,0xfe,0x08,0x10,0x20,0xfe,0x00,0xfe,0x08,0x10,0x20,0xfe,0x00,0xfe,0x92,0x92,0x92,0x82,0x00,0x7c,0x82,0x82,0x82,0x44,0x00,0x06,0x02,0xfe,0x02,0x06
+};
+
+//BadUsb submenu bitmap data
+const unsigned char image_BadLayer_2_bits[] = {
+0x3f,0xf8,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x38,0x38,0x08,0x20,0x08,0x20,0x07,0xc0
+};
+
+const unsigned char image_BadLayer_3_bits[] = {
+0x0f,0xf0,0x0f,0xf0,0x30,0x00,0x30,0x00,0xc3,0xc0,0xc3,0xc0,0xcc,0x30,0xcc,0x30,0xcc,0x30,0xcc,0x30,0xc3,0xc0,0xc3,0xc0,0xc0,0x00,0xc0,0x00,0xc0,0x00,0xc0,0x00,0xcc,0x00,0xcc,0x00,0xc3,0x00,0xc3,0x00,0xc0,0xc0,0xc0,0xc0,0xcc,0x30,0xcc,0x30,0xc3,0x00,0xc3,0x00,0xc0,0xc0,0xc0,0xc0,0xcc,0x30,0xcc,0x30,0xc3,0x00,0xc3,0x00,0xc0,0xc0,0xc0,0xc0,0xcc,0x30,0xcc,0x30,0xc3,0x00,0xc3,0x00,0xc0,0xc0,0xc0,0xc0,0xcc,0x30,0xcc,0x30,0xc3,0x00,0xc3,0x00,0xc0,0xc0,0xc0,0xc0,0xcc,0x30,0xcc,0x30,0xc3,0x00,0xc3,0x00,0xc0,0xc0,0xc0,0xc0,0xc0,0x30,0xc0,0x30,0xc0,0x00,0xc0,0x00,0x30,0x00,0x30,0x00,0x3c,0x00,0x3c,0x00,0x3f,0x00,0x3f,0x00,0x3f,0xc0,0x3f,0xc0,0x3f,0xf0,0x3f,0xf0,0x33,0xf0,0x33,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0
+};
+
+const unsigned char image_BadLayer_8_bits[] = {
+0xfe,0x92,0x92,0x92,0x6c,0x00,0xf8,0x24,0x22,0x24,0xf8,0x00,0xfe,0x82,0x82,0x82,0x7c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7e,0x80,0x80,0x80,0x7e,0x00,0x4c,0x92,0x92,0x92,0x64,0x00,0xfe,0x92,0x92,0x92,0x6c
+};
+
+const unsigned char image_BadLayer_6_bits[] = {
+0x1f,0xc0,0x10,0x20,0x15,0x20,0x15,0xa0,0x14,0x20,0x1f,0xe0,0x3f,0xf0,0x40,0x08,0xc0,0x08,0xc0,0x08,0xc0,0x08,0xc0,0x08,0xcf,0x88,0xd8,0x68,0xd0,0x28,0xf0,0x28,0xe4,0xa8,0xec,0xe8,0xf0,0x28,0xd3,0x68,0xc8,0xc8,0xcf,0x88,0xc0,0x08,0xc0,0x08,0xc0,0x08,0xc0,0x08,0xc0,0x08,0xc0,0x08,0x40,0x18,0x3f,0xf0
+};
+
+//Settings submenu bitmap data
+const unsigned char image_SetLayer_11_bits[] = {
+0x03,0x00,0x03,0x00,0x00,0x00,0x0b,0x80,0x07,0xc0,0x08,0x40,0xd8,0x6c,0xd8,0x6c,0x18,0x60,0x0f,0xc0,0x0b,0x80,0x00,0x00,0x03,0x00,0x03,0x00
+};
+
+const unsigned char image_SetLayer_12_bits[] = {
+0x4c,0x92,0x92,0x92,0x64,0x00,0xfe,0x92,0x92,0x92,0x82,0x00,0x06,0x02,0xfe,0x02,0x06,0x00,0x06,0x02,0xfe,0x02,0x06,0x00,0x00,0x82,0xfe,0x82,0x00,0x00,0xfe,0x08,0x10,0x20,0xfe,0x00,0x7c,0x82,0x82,0xa2,0xe6,0x00,0x4c,0x92,0x92,0x92,0x64
+};
+
+const unsigned char image_SetLayer_6_bits[] = {
+0x3f,0xf8,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x38,0x38,0x08,0x20,0x08,0x20,0x07,0xc0
+};
+
+const unsigned char image_SetLayer_7_bits[] = {
+0x0f,0xf0,0x0f,0xf0,0x30,0x00,0x30,0x00,0xc3,0xc0,0xc3,0xc0,0xcc,0x30,0xcc,0x30,0xcc,0x30,0xcc,0x30,0xc3,0xc0,0xc3,0xc0,0xc0,0x00,0xc0,0x00,0xc0,0x00,0xc0,0x00,0xcc,0x00,0xcc,0x00,0xc3,0x00,0xc3,0x00,0xc0,0xc0,0xc0,0xc0,0xcc,0x30,0xcc,0x30,0xc3,0x00,0xc3,0x00,0xc0,0xc0,0xc0,0xc0,0xcc,0x30,0xcc,0x30,0xc3,0x00,0xc3,0x00,0xc0,0xc0,0xc0,0xc0,0xcc,0x30,0xcc,0x30,0xc3,0x00,0xc3,0x00,0xc0,0xc0,0xc0,0xc0,0xcc,0x30,0xcc,0x30,0xc3,0x00,0xc3,0x00,0xc0,0xc0,0xc0,0xc0,0xcc,0x30,0xcc,0x30,0xc3,0x00,0xc3,0x00,0xc0,0xc0,0xc0,0xc0,0xc0,0x30,0xc0,0x30,0xc0,0x00,0xc0,0x00,0x30,0x00,0x30,0x00,0x3c,0x00,0x3c,0x00,0x3f,0x00,0x3f,0x00,0x3f,0xc0,0x3f,0xc0,0x3f,0xf0,0x3f,0xf0,0x33,0xf0,0x33,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0
+};
+
+//Extras submenu bitmap data
+const unsigned char image_exLayer_2_bits[] = {
+0x3f,0xf8,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x38,0x38,0x08,0x20,0x08,0x20,0x07,0xc0
+};
+
+const unsigned char image_exLayer_3_bits[] = {
+0x0f,0xf0,0x0f,0xf0,0x30,0x00,0x30,0x00,0xc3,0xc0,0xc3,0xc0,0xcc,0x30,0xcc,0x30,0xcc,0x30,0xcc,0x30,0xc3,0xc0,0xc3,0xc0,0xc0,0x00,0xc0,0x00,0xc0,0x00,0xc0,0x00,0xcc,0x00,0xcc,0x00,0xc3,0x00,0xc3,0x00,0xc0,0xc0,0xc0,0xc0,0xcc,0x30,0xcc,0x30,0xc3,0x00,0xc3,0x00,0xc0,0xc0,0xc0,0xc0,0xcc,0x30,0xcc,0x30,0xc3,0x00,0xc3,0x00,0xc0,0xc0,0xc0,0xc0,0xcc,0x30,0xcc,0x30,0xc3,0x00,0xc3,0x00,0xc0,0xc0,0xc0,0xc0,0xcc,0x30,0xcc,0x30,0xc3,0x00,0xc3,0x00,0xc0,0xc0,0xc0,0xc0,0xcc,0x30,0xcc,0x30,0xc3,0x00,0xc3,0x00,0xc0,0xc0,0xc0,0xc0,0xc0,0x30,0xc0,0x30,0xc0,0x00,0xc0,0x00,0x30,0x00,0x30,0x00,0x3c,0x00,0x3c,0x00,0x3f,0x00,0x3f,0x00,0x3f,0xc0,0x3f,0xc0,0x3f,0xf0,0x3f,0xf0,0x33,0xf0,0x33,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0
+};
+
+const unsigned char image_exLayer_7_bits[] = {
+0x00,0xf8,0x7d,0xf8,0xfd,0xf8,0xfd,0xf8,0xfd,0xf8,0xfd,0xf8,0xfc,0x00,0xff,0xf0,0xff,0xf0,0xff,0xf0,0xff,0xf0,0xff,0xf0,0xff,0xf0
+};
+
+const unsigned char image_exLayer_8_1_bits[] = {
+0xfe,0x92,0x92,0x92,0x82,0x00,0xc6,0x28,0x10,0x28,0xc6,0x00,0x06,0x02,0xfe,0x02,0x06,0x00,0xfe,0x12,0x32,0x52,0x8c,0x00,0xf8,0x24,0x22,0x24,0xf8
+};
+
+const unsigned char image_exLayer_8_bits[] = {
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3f,0xc0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x40,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x2b,0x40,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x2b,0x40,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x40,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7f,0xe0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xc0,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x80,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x80,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x80,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x80,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x8f,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x99,0x90,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0xa0,0xd0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0xa0,0x50,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0xc0,0x50,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0xd9,0xd0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0xd9,0xd0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0xa6,0x50,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0xb0,0xd0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x91,0x90,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x8f,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x80,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x80,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x80,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x80,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x80,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x80,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xc0,0x60,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3f,0xc0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00
+};
+
+//Files submenu bitmap data
+const unsigned char image_fileLayer_6_bits[] = {
+0xff,0xf8,0xa5,0x48,0xa5,0x68,0xa5,0x68,0xa5,0x68,0x80,0x04,0x80,0x06,0x80,0x02,0x80,0x02,0x80,0x02,0x80,0x02,0x80,0x02,0x80,0x02,0xbf,0xfa,0xa0,0x0a,0xa0,0x0a,0xbf,0xfa,0x80,0x02,0x80,0x02,0x7f,0xfc
+};
+
+const unsigned char image_fileLayer_2_bits[] = {
+0x3f,0xf8,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x38,0x38,0x08,0x20,0x08,0x20,0x07,0xc0
+};
+
+const unsigned char image_fileLayer_3_bits[] = {
+0x0f,0xf0,0x0f,0xf0,0x30,0x00,0x30,0x00,0xc3,0xc0,0xc3,0xc0,0xcc,0x30,0xcc,0x30,0xcc,0x30,0xcc,0x30,0xc3,0xc0,0xc3,0xc0,0xc0,0x00,0xc0,0x00,0xc0,0x00,0xc0,0x00,0xcc,0x00,0xcc,0x00,0xc3,0x00,0xc3,0x00,0xc0,0xc0,0xc0,0xc0,0xcc,0x30,0xcc,0x30,0xc3,0x00,0xc3,0x00,0xc0,0xc0,0xc0,0xc0,0xcc,0x30,0xcc,0x30,0xc3,0x00,0xc3,0x00,0xc0,0xc0,0xc0,0xc0,0xcc,0x30,0xcc,0x30,0xc3,0x00,0xc3,0x00,0xc0,0xc0,0xc0,0xc0,0xcc,0x30,0xcc,0x30,0xc3,0x00,0xc3,0x00,0xc0,0xc0,0xc0,0xc0,0xcc,0x30,0xcc,0x30,0xc3,0x00,0xc3,0x00,0xc0,0xc0,0xc0,0xc0,0xc0,0x30,0xc0,0x30,0xc0,0x00,0xc0,0x00,0x30,0x00,0x30,0x00,0x3c,0x00,0x3c,0x00,0x3f,0x00,0x3f,0x00,0x3f,0xc0,0x3f,0xc0,0x3f,0xf0,0x3f,0xf0,0x33,0xf0,0x33,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0
+};
+
+const unsigned char image_fileLayer_7_bits[] = {
+0xfe,0x12,0x12,0x12,0x02,0x00,0x00,0x82,0xfe,0x82,0x00,0x00,0xfe,0x80,0x80,0x80,0x80,0x00,0xfe,0x92,0x92,0x92,0x82,0x00,0x4c,0x92,0x92,0x92,0x64
+};
+
+//rfid submenu bitmap data
+const unsigned char image_rfidLayer_2_bits[] = {
+0x0f,0xf0,0x0f,0xf0,0x30,0x00,0x30,0x00,0xc3,0xc0,0xc3,0xc0,0xcc,0x30,0xcc,0x30,0xcc,0x30,0xcc,0x30,0xc3,0xc0,0xc3,0xc0,0xc0,0x00,0xc0,0x00,0xc0,0x00,0xc0,0x00,0xcc,0x00,0xcc,0x00,0xc3,0x00,0xc3,0x00,0xc0,0xc0,0xc0,0xc0,0xcc,0x30,0xcc,0x30,0xc3,0x00,0xc3,0x00,0xc0,0xc0,0xc0,0xc0,0xcc,0x30,0xcc,0x30,0xc3,0x00,0xc3,0x00,0xc0,0xc0,0xc0,0xc0,0xcc,0x30,0xcc,0x30,0xc3,0x00,0xc3,0x00,0xc0,0xc0,0xc0,0xc0,0xcc,0x30,0xcc,0x30,0xc3,0x00,0xc3,0x00,0xc0,0xc0,0xc0,0xc0,0xcc,0x30,0xcc,0x30,0xc3,0x00,0xc3,0x00,0xc0,0xc0,0xc0,0xc0,0xc0,0x30,0xc0,0x30,0xc0,0x00,0xc0,0x00,0x30,0x00,0x30,0x00,0x3c,0x00,0x3c,0x00,0x3f,0x00,0x3f,0x00,0x3f,0xc0,0x3f,0xc0,0x3f,0xf0,0x3f,0xf0,0x33,0xf0,0x33,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0
+};
+
+const unsigned char image_rfidLayer_3_bits[] = {
+0x3f,0xf8,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x38,0x38,0x08,0x20,0x08,0x20,0x07,0xc0
+};
+
+const unsigned char image_rfidLayer_6_bits[] = {
+0x7f,0xff,0xc0,0xc0,0x00,0x60,0xb3,0xff,0xa0,0xa0,0x00,0xa0,0x87,0xfe,0xa0,0x86,0x02,0xa0,0xac,0x02,0xa0,0xa9,0xf2,0xa0,0xa8,0x42,0xa0,0xa8,0x52,0xa0,0xa9,0xb2,0xa0,0xa8,0x02,0xa0,0xa9,0xf2,0xa0,0xa8,0x52,0xa0,0xa8,0x52,0xa0,0xa0,0x50,0xa0,0xb8,0x03,0xa0,0xf9,0xf3,0xe0,0x78,0x03,0xc0,0x01,0xf0,0x00,0x01,0x00,0x00,0x01,0x10,0x00,0x01,0xf4,0x00,0x00,0x40,0x00,0x00,0x10,0x00,0x00,0x10,0x00
+};
+
+const unsigned char image_rfidLayer_8_bits[] = {
+0xfe,0x12,0x32,0x52,0x8c,0x00,0xfe,0x12,0x12,0x12,0x02,0x00,0x00,0x82,0xfe,0x82,0x00,0x00,0xfe,0x82,0x82,0x82,0x7c
+};
+
+//Nfc submenu bitmap data
+const unsigned char image_nfcLayer_2_bits[] = {
+0x0f,0xf0,0x0f,0xf0,0x30,0x00,0x30,0x00,0xc3,0xc0,0xc3,0xc0,0xcc,0x30,0xcc,0x30,0xcc,0x30,0xcc,0x30,0xc3,0xc0,0xc3,0xc0,0xc0,0x00,0xc0,0x00,0xc0,0x00,0xc0,0x00,0xcc,0x00,0xcc,0x00,0xc3,0x00,0xc3,0x00,0xc0,0xc0,0xc0,0xc0,0xcc,0x30,0xcc,0x30,0xc3,0x00,0xc3,0x00,0xc0,0xc0,0xc0,0xc0,0xcc,0x30,0xcc,0x30,0xc3,0x00,0xc3,0x00,0xc0,0xc0,0xc0,0xc0,0xcc,0x30,0xcc,0x30,0xc3,0x00,0xc3,0x00,0xc0,0xc0,0xc0,0xc0,0xcc,0x30,0xcc,0x30,0xc3,0x00,0xc3,0x00,0xc0,0xc0,0xc0,0xc0,0xcc,0x30,0xcc,0x30,0xc3,0x00,0xc3,0x00,0xc0,0xc0,0xc0,0xc0,0xc0,0x30,0xc0,0x30,0xc0,0x00,0xc0,0x00,0x30,0x00,0x30,0x00,0x3c,0x00,0x3c,0x00,0x3f,0x00,0x3f,0x00,0x3f,0xc0,0x3f,0xc0,0x3f,0xf0,0x3f,0xf0,0x33,0xf0,0x33,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0
+};
+
+const unsigned char image_nfcLayer_3_bits[] = {
+0x3f,0xf8,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x38,0x38,0x08,0x20,0x08,0x20,0x07,0xc0
+};
+
+const unsigned char image_nfcLayer_6_bits[] = {
+0x01,0x00,0x0f,0xc0,0x01,0x80,0x03,0x00,0x06,0x00,0x0c,0xc0,0x07,0x80,0x10,0x20,0x1c,0xe0,0x47,0x88,0x70,0x38,0x1f,0xe0,0x03,0x00
+};
+
+const unsigned char image_nfcLayer_8_bits[] = {
+0xfe,0x08,0x10,0x20,0xfe,0x00,0xfe,0x12,0x12,0x12,0x02,0x00,0x7c,0x82,0x82,0x82,0x44
+};
@@ -8,6 +8,10 @@ env.Append(CXXFLAGS=["-Wno-conversion-null"])
 
 from SCons.Script import AlwaysBuild
 import os
+import sys
+
+sys.path.insert(0, os.path.join(env.subst("$PROJECT_DIR"), "tools"))
+import assetpack
 
 def _chip() -> str:
     mcu = (env.BoardConfig().get("build.mcu", "esp32") or "esp32").lower()
@@ -22,6 +26,32 @@ def _offsets(chip: str):
     boot = "0x1000" if chip == "esp32" else "0x0"
     return boot, "0x8000", "0x10000"
 
+def _assets_partition():
+    """(offset, size) of the 'assets' row in this env's partition table."""
+    csv = env.GetProjectOption("board_build.partitions", "")
+    path = os.path.join(env.subst("$PROJECT_DIR"), csv)
+    if not os.path.isfile(path):
+        return None
+    with open(path) as f:
+        for line in f:
+            cols = [c.strip() for c in line.split("#", 1)[0].split(",")]
+            if len(cols) >= 5 and cols[0] == "assets":
+                return cols[3], int(cols[4], 0)
+    return None
+
+# Pack UI bitmaps (and refresh asset_ids.h) before anything compiles
+_ASSETS_BIN = os.path.join(env.subst("$BUILD_DIR"), "assets.bin")
+_assets_part = _assets_partition()
+assetpack.build(
+    os.path.join(env.subst("$PROJECT_DIR"), "assets", "ui_bitmaps.c"),
+    _ASSETS_BIN,
+    os.path.join(env.subst("$PROJECT_DIR"), "src", "UserInterface", "bitmaps", "asset_ids.h"),
+    _assets_part[1] if _assets_part else 0,
+)
+if _assets_part:
+    # Regular uploads write the assets partition too
+    env.Append(FLASH_EXTRA_IMAGES=[(_assets_part[0], _ASSETS_BIN)])
+
 def _merge_action(*args, **kwargs):
     build_dir = env.subst("$BUILD_DIR")
     out_dir   = os.path.join(env.subst("$PROJECT_DIR"), "files")
@@ -37,6 +67,8 @@ def _merge_action(*args, **kwargs):
         f'{part} "{build_dir}/partitions.bin" '
         f'{app} "{build_dir}/firmware.bin"'
     )
+    if _assets_part:
+        cmd += f' {_assets_part[0]} "{_ASSETS_BIN}"'
     print(f"[merge_bin] → {cmd}")
     return env.Execute(cmd)
 
@@ -53,6 +85,56 @@ merge_target = env.AddCustomTarget(
 )
 AlwaysBuild(merge_target)
 
+# A delta (and fw_update) rewrites only the app slot; the assets partition
+# keeps whatever pack was last flashed. Packs are looked up by per-name keys
+# (tools/assetpack.py), so existing bitmaps keep drawing across releases, but
+# a bitmap that was added, renamed or resized in this release stays blank
+# until `pio run -t upload_assets` (or a full flash) writes the new pack.
+def _delta_action(*args, **kwargs):
+    # Base = the firmware.bin the devices are running now (keep one per release)
+    base = os.environ.get("FW_BASE") or env.GetProjectOption("custom_delta_base", "")
+    if not base:
+        print("[delta] set FW_BASE=<old firmware.bin> or custom_delta_base in platformio.ini")
+        return 1
+    project = env.subst("$PROJECT_DIR")
+    out = os.path.join(project, "files", f"Infiltra-{env.subst('$PIOENV')}.delta")
+    cmd = (
+        f'"$PYTHONEXE" "{os.path.join(project, "tools", "fwdelta.py")}" diff '
+        f'"{base}" "{env.subst("$BUILD_DIR")}/firmware.bin" "{out}"'
+    )
+    print(f"[delta] → {cmd}")
+    return env.Execute(cmd)
+
+delta_target = env.AddCustomTarget(
+    name="delta",
+    dependencies=["$BUILD_DIR/firmware.bin"],
+    actions=[_delta_action],
+    title="Firmware Delta",
+    description="Diff FW_BASE against this firmware.bin into ./files/Infiltra-${PIOENV}.delta",
+)
+AlwaysBuild(delta_target)
+
+def _upload_assets_action(*args, **kwargs):
+    if not _assets_part:
+        print("[assets] no 'assets' partition in this env's partition table")
+        return 1
+    port = env.subst("$UPLOAD_PORT")
+    cmd = (
+        'pio pkg exec -p "tool-esptoolpy" -- esptool.py '
+        f'--chip {_chip()} ' + (f'--port "{port}" ' if port else '') +
+        f'write_flash {_assets_part[0]} "{_ASSETS_BIN}"'
+    )
+    print(f"[assets] → {cmd}")
+    return env.Execute(cmd)
+
+env.AddCustomTarget(
+    name="upload_assets",
+    dependencies=None,
+    actions=[_upload_assets_action],
+    title="Upload Assets",
+    description="Write the packed UI bitmaps to the assets partition (no app reflash)",
+)
+
 env.AddCustomTarget(
     name="upload_nobuild",
     dependencies=None,
@@ -0,0 +1,128 @@
+#include "assets.h"
+#include <esp_partition.h>
+
+static constexpr const char* kLabel      = "assets";
+static constexpr uint16_t    kVersionMin = 2;        // keyed index
+static constexpr uint16_t    kVersionMax = 2;
+static constexpr uint16_t    kMissing    = 0xFFFF;
+
+struct __attribute__((packed)) AssetHeader {
+  char     magic[4];
+  uint16_t version;
+  uint16_t count;
+  uint32_t totalSize;
+  uint16_t entrySize;      // newer packs may append fields to an entry
+  uint16_t reserved;
+  uint32_t dataHash;
+};
+
+struct AssetEntry {
+  uint32_t key;            // FNV-1a of the AssetId name, ascending
+  uint32_t offset;
+  uint32_t size;
+};
+
+static bool                 sTried = false;
+static const uint8_t*       sBase = nullptr;        // mapped image
+static uint16_t             sSlot[(uint16_t)AssetId::COUNT];   // index entry per ID
+static spi_flash_mmap_handle_t sMap = 0;
+static const uint8_t        sBlank[ASSET_MAX_SIZE] = {};
+
+static uint32_t fnv1a(const uint8_t* p, size_t n) {
+  uint32_t h = 0x811C9DC5;
+  while (n--) h = (h ^ *p++) * 0x01000193;
+  return h;
+}
+
+static const AssetEntry& entryAt(const uint8_t* base, uint16_t i) {
+  const AssetHeader* h = (const AssetHeader*)base;
+  return *(const AssetEntry*)(base + sizeof(AssetHeader) + (size_t)i * h->entrySize);
+}
+
+static bool validate(const uint8_t* base, size_t partSize) {
+  const AssetHeader* h = (const AssetHeader*)base;
+  if (memcmp(h->magic, "FTWA", 4) != 0) {
+    Serial.println("[assets] partition not written (pio run -t upload_assets)");
+    return false;
+  }
+  if (h->version < kVersionMin || h->version > kVersionMax || h->entrySize < sizeof(AssetEntry)) {
+    Serial.printf("[assets] pack format v%u not supported, reflash assets\n", h->version);
+    return false;
+  }
+  if (h->totalSize > partSize || h->totalSize < sizeof(AssetHeader) + (uint32_t)h->count * h->entrySize) {
+    Serial.println("[assets] bad image size");
+    return false;
+  }
+  if (fnv1a(base + sizeof(AssetHeader), h->totalSize - sizeof(AssetHeader)) != h->dataHash) {
+    Serial.println("[assets] image corrupt");
+    return false;
+  }
+  for (uint16_t i = 0; i < h->count; ++i) {
+    const AssetEntry& e = entryAt(base, i);
+    if (e.offset + e.size > h->totalSize || (i && e.key <= entryAt(base, i - 1).key)) {
+      Serial.println("[assets] bad index");
+      return false;
+    }
+  }
+  return true;
+}
+
+// Binary search by key; an ID the pack lacks, or whose bitmap changed size,
+// stays blank instead of drawing someone else's bytes.
+static uint16_t lookup(const uint8_t* base, uint16_t id) {
+  const AssetHeader* h = (const AssetHeader*)base;
+  uint16_t lo = 0, hi = h->count;
+  while (lo < hi) {
+    uint16_t mid = lo + (hi - lo) / 2;
+    const AssetEntry& e = entryAt(base, mid);
+    if (e.key == ASSET_KEYS[id]) return e.size == ASSET_SIZES[id] ? mid : kMissing;
+    if (e.key < ASSET_KEYS[id]) lo = mid + 1;
+    else                        hi = mid;
+  }
+  return kMissing;
+}
+
+bool assetsBegin() {
+  if (sTried) return sBase != nullptr;
+  sTried = true;
+
+  const esp_partition_t* part = esp_partition_find_first(ESP_PARTITION_TYPE_DATA,
+                                                         ESP_PARTITION_SUBTYPE_ANY, kLabel);
+  if (!part) {
+    Serial.println("[assets] no assets partition in the partition table");
+    return false;
+  }
+  const void* ptr = nullptr;
+  if (esp_partition_mmap(part, 0, part->size, SPI_FLASH_MMAP_DATA, &ptr, &sMap) != ESP_OK) {
+    Serial.println("[assets] mmap failed");
+    return false;
+  }
+  if (!validate((const uint8_t*)ptr, part->size)) {
+    spi_flash_munmap(sMap);
+    return false;
+  }
+  sBase = (const uint8_t*)ptr;
+  uint16_t missing = 0;
+  for (uint16_t i = 0; i < (uint16_t)AssetId::COUNT; ++i) {
+    sSlot[i] = lookup(sBase, i);
+    if (sSlot[i] == kMissing) missing++;
+  }
+  if (missing) Serial.printf("[assets] %u bitmaps missing or resized in the pack, reflash assets\n", missing);
+  return true;
+}
+
+bool assetsReady() { return sBase != nullptr; }
+
+const uint8_t* asset(AssetId id) {
+  if (!sTried) assetsBegin();
+  uint16_t i = (uint16_t)id;
+  if (!sBase || i >= (uint16_t)AssetId::COUNT || sSlot[i] == kMissing) return sBlank;
+  return sBase + entryAt(sBase, sSlot[i]).offset;
+}
+
+size_t assetSize(AssetId id) {
+  if (!sTried) assetsBegin();
+  uint16_t i = (uint16_t)id;
+  if (!sBase || i >= (uint16_t)AssetId::COUNT || sSlot[i] == kMissing) return 0;
+  return entryAt(sBase, sSlot[i]).size;
+}
@@ -0,0 +1,15 @@
+#pragma once
+#include <Arduino.h>
+#include "../../UserInterface/bitmaps/asset_ids.h"
+
+// UI bitmaps live in the "assets" data partition (tools/assetpack.py), not in
+// the app image. The partition is memory-mapped once and asset() hands out
+// pointers straight into flash, so drawing reads in place with no RAM copy.
+// Each AssetId is looked up by a stable key, so a pack built for an older or
+// newer firmware still serves every bitmap both agree on. A missing
+// partition, or an ID the pack lacks, gets a blank bitmap and the UI runs.
+
+bool           assetsBegin();                // idempotent; maps and validates
+bool           assetsReady();
+const uint8_t* asset(AssetId id);            // never null
+size_t         assetSize(AssetId id);
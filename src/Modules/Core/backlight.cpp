@@ -0,0 +1,46 @@
+#include "backlight.h"
+#include "settings.h"
+
+// The backlight GPIO is the panel's TFT_BL from platformio.ini. The StickC
+// Plus 1.1 powers its backlight from the AXP192's LDO2 rather than a GPIO,
+// so LEDC has nothing to drive there and brightness stays at full.
+#if defined(TFT_BL) && !defined(M5STICK_C_PLUS_1_1)
+  #define BACKLIGHT_LEDC 1
+#else
+  #define BACKLIGHT_LEDC 0
+#endif
+
+static constexpr uint8_t  kChannel   = 7;        // LEDC channel, clear of anything else
+static constexpr uint32_t kFreqHz    = 5000;
+static constexpr uint8_t  kBits      = 8;
+static constexpr uint8_t  kDimPct    = 10;
+static const uint16_t     kSaverSec[] = { 0, 30, 60, 120, 300 };   // Bat Saver enum
+
+static bool sDimmed = false;
+
+static void writePct(uint8_t pct) {
+#if BACKLIGHT_LEDC
+  ledcWrite(kChannel, (uint32_t)pct * ((1u << kBits) - 1) / 100);
+#endif
+}
+
+void backlightBegin() {
+#if BACKLIGHT_LEDC
+  ledcSetup(kChannel, kFreqHz, kBits);
+  ledcAttachPin(TFT_BL, kChannel);
+#endif
+  backlightApply();
+}
+
+void backlightApply() {
+  if (!sDimmed) writePct(settingsGet(Setting::BRIGHTNESS));
+}
+
+void backlightPoll(uint32_t idleMs) {
+  uint16_t timeoutS = kSaverSec[settingsGet(Setting::BAT_SAVER)];
+  bool dim = timeoutS && idleMs >= timeoutS * 1000UL;
+  if (dim == sDimmed) return;
+  sDimmed = dim;
+  uint8_t full = settingsGet(Setting::BRIGHTNESS);
+  writePct(dim ? min(kDimPct, full) : full);
+}
@@ -0,0 +1,9 @@
+#pragma once
+#include <Arduino.h>
+
+// PWM backlight driven from the Brightness setting, with the Bat Saver
+// timeout dimming the panel after a period without input.
+
+void backlightBegin();                  // reads only the Brightness key
+void backlightApply();                  // re-read Brightness (after a change)
+void backlightPoll(uint32_t idleMs);    // Bat Saver; call every loop
@@ -0,0 +1,273 @@
+#include "ble_scan.h"
+#include <NimBLEDevice.h>
+
+static constexpr uint16_t kSlots       = 256;     // hash slots, load ≤ 40 %
+static constexpr uint8_t  kSlotBits    = 8;
+static constexpr uint8_t  kEmpty       = 0xFF;
+static constexpr uint8_t  kEmaDiv      = 4;       // alpha = 1/4
+static constexpr uint16_t kItvl        = 160;     // 100 ms, in 0.625 ms units
+static constexpr uint16_t kWindow      = 80;      // 50 ms: radio listens half the time
+static constexpr uint32_t kHousekeepMs = 1000;
+static constexpr uint32_t kTaskStack   = 3072;
+
+static BleDev   sDevs[BLE_SCAN_MAX_DEVS];         // dense, first-seen order
+static int16_t  sRssiQ4[BLE_SCAN_MAX_DEVS];       // EMA in 1/16 dBm
+static uint8_t  sOrder[BLE_SCAN_MAX_DEVS];        // indices into sDevs, strongest first
+static uint8_t  sPos[BLE_SCAN_MAX_DEVS];          // inverse of sOrder
+static uint8_t  sHash[kSlots];                    // index into sDevs, kEmpty = free
+static uint16_t sCount = 0;
+static volatile uint32_t sGen = 0;
+static portMUX_TYPE sLock = portMUX_INITIALIZER_UNLOCKED;
+
+static TaskHandle_t  sTask     = nullptr;
+static volatile bool sRun      = false;
+static bool          sOwnStack = false;           // we brought NimBLE up, so we take it down
+static volatile uint32_t sReports = 0;
+static uint32_t      sDropped  = 0;
+
+// Fields of one advertising report; pointers into the controller's buffer
+struct AdvFields {
+  const uint8_t* name;
+  uint8_t        nameLen;
+  int8_t         txPower;
+  uint16_t       company;
+};
+
+// ─────────────────────────────────────────────────────────────────────────────
+// Advertising data, parsed in place
+// ─────────────────────────────────────────────────────────────────────────────
+static void parseAdv(const uint8_t* p, uint8_t len, AdvFields& f) {
+  f = { nullptr, 0, INT8_MIN, 0xFFFF };
+  for (uint16_t i = 0; i + 1 < len; i += 1 + p[i]) {
+    uint8_t n = p[i];
+    if (!n || i + 1 + n > len) break;                // zero padding or truncated
+    const uint8_t* v  = p + i + 2;
+    uint8_t        vn = n - 1;
+    switch (p[i + 1]) {
+      case 0x08:                                     // shortened name, unless complete seen
+        if (!f.name) { f.name = v; f.nameLen = vn; }
+        break;
+      case 0x09: f.name = v; f.nameLen = vn; break;
+      case 0x0A: if (vn >= 1) f.txPower = (int8_t)v[0]; break;
+      case 0xFF: if (vn >= 2) f.company = v[0] | v[1] << 8; break;
+    }
+  }
+}
+
+// ─────────────────────────────────────────────────────────────────────────────
+// Table (callers hold sLock)
+// ─────────────────────────────────────────────────────────────────────────────
+static uint8_t slotOf(const uint8_t* a, uint8_t type) {
+  uint32_t h = ((uint32_t)a[2] << 24 | (uint32_t)a[3] << 16 | (uint32_t)a[4] << 8 | a[5]) ^
+               ((uint32_t)a[0] << 8 | a[1]) ^ ((uint32_t)type << 16);
+  return (uint8_t)((h * 2654435761u) >> (32 - kSlotBits));
+}
+
+static int find(const uint8_t* addr, uint8_t type) {
+  for (uint8_t s = slotOf(addr, type);; s = (uint8_t)(s + 1)) {
+    uint8_t i = sHash[s];
+    if (i == kEmpty) return -1;
+    if (sDevs[i].addrType == type && !memcmp(sDevs[i].addr, addr, 6)) return i;
+  }
+}
+
+static void link(uint8_t i) {
+  uint8_t s = slotOf(sDevs[i].addr, sDevs[i].addrType);
+  while (sHash[s] != kEmpty) s = (uint8_t)(s + 1);
+  sHash[s] = i;
+}
+
+static void place(uint8_t p, uint8_t i) {
+  sOrder[p] = i;
+  sPos[i]   = p;
+}
+
+// One device's dBm changed: slide it to its new rank, shifting the entries between
+static void reposition(uint8_t i) {
+  const int8_t r = sDevs[i].rssi;
+  uint8_t p = sPos[i];
+  while (p > 0 && sDevs[sOrder[p - 1]].rssi < r) { place(p, sOrder[p - 1]); p--; }
+  while (p + 1 < sCount && sDevs[sOrder[p + 1]].rssi > r) { place(p, sOrder[p + 1]); p++; }
+  place(p, i);
+}
+
+static int8_t toDbm(int16_t q4) { return (int8_t)((q4 + (q4 < 0 ? -8 : 8)) / 16); }
+
+static bool sameName(const BleDev& d, const AdvFields& f) {
+  uint8_t n = min<uint8_t>(f.nameLen, sizeof(d.name) - 1);
+  return !memcmp(d.name, f.name, n) && d.name[n] == '\0';
+}
+
+static void merge(const uint8_t* addr, uint8_t type, int8_t rssi, bool connectable,
+                  const AdvFields& f, uint32_t now) {
+  int i = find(addr, type);
+  if (i < 0) {
+    if (sCount == BLE_SCAN_MAX_DEVS) { sDropped++; return; }
+    i = sCount++;
+    BleDev& d = sDevs[i];
+    memcpy(d.addr, addr, 6);
+    d.addrType    = type;
+    d.name[0]     = '\0';
+    d.rssi        = rssi;
+    d.txPower     = f.txPower;
+    d.company     = f.company;
+    d.connectable = connectable;
+    d.lastSeenMs  = now;
+    d.gen         = ++sGen;
+    sRssiQ4[i]    = (int16_t)(rssi * 16);
+    if (f.name) {
+      uint8_t n = min<uint8_t>(f.nameLen, sizeof(d.name) - 1);
+      memcpy(d.name, f.name, n);
+      d.name[n] = '\0';
+    }
+    link((uint8_t)i);
+    sPos[i] = (uint8_t)i;                            // enters at the bottom, then rises
+    sOrder[i] = (uint8_t)i;
+    reposition((uint8_t)i);
+    return;
+  }
+
+  BleDev& d = sDevs[i];
+  d.lastSeenMs = now;
+  sRssiQ4[i] += (int16_t)((rssi * 16 - sRssiQ4[i]) / kEmaDiv);
+  int8_t dbm   = toDbm(sRssiQ4[i]);
+  bool changed = false;
+  if (dbm != d.rssi) { d.rssi = dbm; reposition((uint8_t)i); changed = true; }
+  // Fields a report leaves out keep their last value; devices rotate payloads
+  if (f.name && !sameName(d, f)) {
+    uint8_t n = min<uint8_t>(f.nameLen, sizeof(d.name) - 1);
+    memcpy(d.name, f.name, n);
+    d.name[n] = '\0';
+    changed = true;
+  }
+  if (f.txPower != INT8_MIN && f.txPower != d.txPower) { d.txPower = f.txPower; changed = true; }
+  if (f.company != 0xFFFF && f.company != d.company)   { d.company = f.company; changed = true; }
+  if (connectable != d.connectable)                    { d.connectable = connectable; changed = true; }
+  if (changed) d.gen = ++sGen;
+}
+
+// Drops stale devices; survivors keep their relative rank
+static void age(uint32_t now) {
+  uint8_t remap[BLE_SCAN_MAX_DEVS];
+  uint16_t n = 0;
+  for (uint16_t i = 0; i < sCount; ++i) {
+    if (now - sDevs[i].lastSeenMs > BLE_SCAN_AGE_MS) { remap[i] = kEmpty; continue; }
+    if (n != i) {
+      sDevs[n]   = sDevs[i];
+      sRssiQ4[n] = sRssiQ4[i];
+    }
+    remap[i] = (uint8_t)n++;
+  }
+  if (n == sCount) return;
+
+  uint16_t p = 0;
+  for (uint16_t q = 0; q < sCount; ++q) {
+    uint8_t i = remap[sOrder[q]];
+    if (i != kEmpty) place((uint8_t)p++, i);
+  }
+  sCount = n;
+  sGen++;
+  memset(sHash, kEmpty, sizeof(sHash));
+  for (uint8_t i = 0; i < sCount; ++i) link(i);
+}
+
+// ─────────────────────────────────────────────────────────────────────────────
+// Discovery (NimBLE host task)
+// ─────────────────────────────────────────────────────────────────────────────
+static int onGap(struct ble_gap_event* e, void*) {
+  if (e->type != BLE_GAP_EVENT_DISC) return 0;       // DISC_COMPLETE: housekeeping restarts
+  const ble_gap_disc_desc& r = e->disc;
+  AdvFields f;
+  parseAdv(r.data, r.length_data, f);
+
+  uint8_t addr[6];
+  for (uint8_t k = 0; k < 6; ++k) addr[k] = r.addr.val[5 - k];
+  bool connectable = r.event_type == BLE_HCI_ADV_RPT_EVTYPE_ADV_IND ||
+                     r.event_type == BLE_HCI_ADV_RPT_EVTYPE_DIR_IND;
+  uint32_t now = millis();
+
+  portENTER_CRITICAL(&sLock);
+  merge(addr, r.addr.type, r.rssi, connectable, f, now);
+  portEXIT_CRITICAL(&sLock);
+  sReports++;
+  return 0;
+}
+
+static bool startDiscovery() {
+  struct ble_gap_disc_params p = {};
+  p.itvl              = kItvl;
+  p.window            = kWindow;
+  p.filter_policy     = BLE_HCI_SCAN_FILT_NO_WL;
+  p.passive           = 1;
+  p.filter_duplicates = 0;                           // every report, so RSSI keeps updating
+  return ble_gap_disc(BLE_OWN_ADDR_PUBLIC, BLE_HS_FOREVER, &p, onGap, nullptr) == 0;
+}
+
+// ─────────────────────────────────────────────────────────────────────────────
+// Housekeeping task
+// ─────────────────────────────────────────────────────────────────────────────
+static void houseTask(void*) {
+  while (sRun) {
+    ulTaskNotifyTake(pdTRUE, pdMS_TO_TICKS(kHousekeepMs));
+    if (!sRun) break;
+    if (!ble_gap_disc_active()) startDiscovery();
+    uint32_t now = millis();
+    portENTER_CRITICAL(&sLock);
+    age(now);
+    portEXIT_CRITICAL(&sLock);
+  }
+  sTask = nullptr;
+  vTaskDelete(nullptr);
+}
+
+// ─────────────────────────────────────────────────────────────────────────────
+// Public API
+// ─────────────────────────────────────────────────────────────────────────────
+bool bleScanStart() {
+  if (sTask) return true;
+  portENTER_CRITICAL(&sLock);
+  sCount = 0;
+  memset(sHash, kEmpty, sizeof(sHash));
+  portEXIT_CRITICAL(&sLock);
+  sReports = sDropped = 0;
+  sGen++;
+
+  sOwnStack = !NimBLEDevice::getInitialized();
+  if (sOwnStack) NimBLEDevice::init("");            // returns once the host has synced
+  if (!startDiscovery()) { bleScanStop(); return false; }
+  sRun = true;
+  if (xTaskCreatePinnedToCore(houseTask, "blescan", kTaskStack, nullptr, 1, &sTask, 0) != pdPASS) {
+    sTask = nullptr;
+    bleScanStop();
+    return false;
+  }
+  return true;
+}
+
+void bleScanStop() {
+  sRun = false;
+  if (sTask) xTaskNotifyGive(sTask);
+  while (sTask) vTaskDelay(pdMS_TO_TICKS(10));
+  if (ble_gap_disc_active()) ble_gap_disc_cancel();
+  if (sOwnStack) NimBLEDevice::deinit(true);
+  sOwnStack = false;
+}
+
+uint32_t bleScanGeneration() { return sGen; }
+
+uint16_t bleScanRows(uint16_t first, BleDev* out, uint16_t max) {
+  portENTER_CRITICAL(&sLock);
+  uint16_t n = first < sCount ? min<uint16_t>(max, sCount - first) : 0;
+  for (uint16_t k = 0; k < n; ++k) out[k] = sDevs[sOrder[first + k]];
+  portEXIT_CRITICAL(&sLock);
+  return n;
+}
+
+BleScanStats bleScanStats() {
+  BleScanStats s = {};
+  s.running = sTask != nullptr;
+  s.devices = sCount;
+  s.reports = sReports;
+  s.dropped = sDropped;
+  return s;
+}
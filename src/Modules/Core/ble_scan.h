@@ -0,0 +1,44 @@
+#pragma once
+#include <Arduino.h>
+
+// Background BLE device survey. Discovery runs passively and continuously on
+// the NimBLE host task (core 0): each advertising report is parsed in place
+// from the controller's buffer — only the fields that changed are copied into
+// a fixed table keyed by address type + address. RSSI is smoothed with an
+// exponential moving average, and devices not heard for BLE_SCAN_AGE_MS are
+// dropped by a small housekeeping task that also restarts discovery if the
+// controller ever ends it.
+//
+// The table keeps an index ordered by smoothed RSSI (strongest first). A
+// change at display precision moves one entry up or down by insertion, so
+// the order is never rebuilt wholesale. Changes stamp the device with a new
+// generation number; the UI polls bleScanGeneration() and redraws only rows
+// whose generation differs from what it drew, as with Core/wifi_scan.
+
+static constexpr uint8_t  BLE_SCAN_MAX_DEVS = 96;
+static constexpr uint32_t BLE_SCAN_AGE_MS   = 30000;
+
+struct BleDev {
+  uint8_t  addr[6];         // as printed, most significant byte first
+  uint8_t  addrType;        // BLE_ADDR_PUBLIC / RANDOM / …
+  char     name[21];        // complete or shortened local name, may be empty
+  int8_t   rssi;            // smoothed, dBm
+  int8_t   txPower;         // advertised, or INT8_MIN
+  uint16_t company;         // manufacturer data company ID, or 0xFFFF
+  bool     connectable;
+  uint32_t lastSeenMs;
+  uint32_t gen;             // generation of the last visible change
+};
+
+struct BleScanStats {
+  bool     running;
+  uint16_t devices;
+  uint32_t reports;         // advertising reports handled
+  uint32_t dropped;         // new devices ignored because the table was full
+};
+
+bool     bleScanStart();                           // brings the stack up if needed
+void     bleScanStop();                            // and takes it down again
+uint32_t bleScanGeneration();
+uint16_t bleScanRows(uint16_t first, BleDev* out, uint16_t max);    // copies, strongest first
+BleScanStats bleScanStats();
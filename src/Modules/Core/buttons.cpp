@@ -16,6 +16,22 @@
 #include "././Modules/Functions/bgone.h"
 #include "././UserInterface/menus/menu_enums.h"
 #include "././Modules/Functions/ir_read.h"
+#include "././Modules/Functions/ir_macro.h"
+#include "././Modules/Functions/settings_screen.h"
+#include "././Modules/Functions/file_browser.h"
+#include "././Modules/Functions/web_files.h"
+#include "././Modules/Functions/fw_update.h"
+#include "././Modules/Functions/ap_list.h"
+#include "././Modules/Functions/pkt_monitor.h"
+#include "././Modules/Functions/pcap_sniffer.h"
+#include "././Modules/Functions/ble_list.h"
+#include "././Modules/Functions/wardriver.h"
+#include "././Modules/Functions/gps_view.h"
+#include "././Modules/Functions/mic_spect.h"
+#include "././Modules/Functions/rf_spectrum.h"
+#include "././Modules/Functions/rf_visualizer.h"
+#include "././Modules/Functions/nrf_spectrum.h"
+#include "profile.h"
 
 // --------- Inputs (Cardputer keyboard vs Stick pins) ----------
 #if defined(M5CARDPUTER)
@@ -46,6 +62,7 @@ static bool currA=false,currB=false,currC=false;
 
 static bool lastExitSpecial=false;
 static bool currExitSpecial=false;
+static uint32_t lastInputMs=0;      // Bat Saver idle timer
 
 void initButtons() {
 #if defined(M5CARDPUTER)
@@ -81,8 +98,11 @@ void updateButtons() {
   currC = !digitalRead(BTN_C_PIN);
   currExitSpecial = false;
 #endif
+  if (currA || currB || currC || currExitSpecial) lastInputMs = millis();
 }
 
+uint32_t buttonsIdleMs(){ return millis() - lastInputMs; }
+
 bool btnAPressed(){ return currA && !lastA; }
 bool btnBPressed(){ return currB && !lastB; }
 bool btnCPressed(){ return currC && !lastC; }
@@ -93,6 +113,62 @@ void finalizeButtons() {
   lastExitSpecial = currExitSpecial;
 }
 
+// ---------- Full-screen apps ----------
+// Apps that only need enter/draw/input/exit register here instead of getting
+// their own flag threaded through main.cpp.
+struct AppEntry {
+  MenuState menu;
+  int       idx;
+  void (*reset)();
+  void (*draw)(TFT_eSPI&);
+  void (*input)(bool a, bool b, bool c, bool& exitReq);
+  void (*redrawMenu)();
+};
+
+template <Setting... Fields>
+static void openSettings() {
+  static const Setting fields[] = { Fields... };
+  settingsScreenOpen(fields, sizeof...(Fields));
+}
+
+static const AppEntry kApps[] = {
+  { WIFI_SUBMENU,     1, apListOpen,   apListDraw,        apListInput,        drawWiFisubmenu },
+  { WIFI_SUBMENU,     3, pktMonitorOpen, pktMonitorDraw,    pktMonitorInput,    drawWiFisubmenu },
+  { WIFI_SUBMENU,     4, pcapSnifferOpen, pcapSnifferDraw,  pcapSnifferInput,   drawWiFisubmenu },
+  { BLUETOOTH_SUBMENU, 1, bleListOpen, bleListDraw,       bleListInput,       drawBluetoothSubmenu },
+  { GPS_SUBMENU,      1, wardriverOpen, wardriverDraw,     wardriverInput,     drawGpsSubmenu },
+  { GPS_SUBMENU,      2, gpsViewOpen,   gpsViewDraw,       gpsViewInput,       drawGpsSubmenu },
+  { GPS_SUBMENU,      4, gpsCoordsOpen, gpsViewDraw,       gpsViewInput,       drawGpsSubmenu },
+  { RF_SUBMENU,       1, rfSpectrumOpenFindFq,     rfSpectrumDraw, rfSpectrumInput, drawRfSubmenu },
+  { RF_SUBMENU,       2, rfVisualizerOpen,         rfVisualizerDraw, rfVisualizerInput, drawRfSubmenu },
+  { RF_SUBMENU,       5, rfSpectrumOpenSpectogram, rfSpectrumDraw, rfSpectrumInput, drawRfSubmenu },
+  { NRF_SUBMENU,      2, nrfSpectrumOpen, nrfSpectrumDraw,  nrfSpectrumInput,   drawNrfSubmenu },
+  { EXTRAS_SUBMENU,   2, micSpectOpen,  micSpectDraw,      micSpectInput,      drawExtrasSubmenu },
+  { IR_SUBMENU,       3, irMacroReset, irMacroDrawScreen, irMacroHandleInput, drawIrSubmenu },
+  { SETTINGS_SUBMENU, 1, openSettings<Setting::THEME>,      settingsScreenDraw, settingsScreenInput, drawSettingsSubmenu },
+  { SETTINGS_SUBMENU, 2, openSettings<Setting::BRIGHTNESS>, settingsScreenDraw, settingsScreenInput, drawSettingsSubmenu },
+  { SETTINGS_SUBMENU, 3, openSettings<Setting::AUDIO>,      settingsScreenDraw, settingsScreenInput, drawSettingsSubmenu },
+  { SETTINGS_SUBMENU, 4, openSettings<Setting::VOLUME>,     settingsScreenDraw, settingsScreenInput, drawSettingsSubmenu },
+  { SETTINGS_SUBMENU, 5, openSettings<Setting::UTC_OFFSET>, settingsScreenDraw, settingsScreenInput, drawSettingsSubmenu },
+  { SETTINGS_SUBMENU, 6, openSettings<Setting::BAT_SAVER>,  settingsScreenDraw, settingsScreenInput, drawSettingsSubmenu },
+  { SETTINGS_SUBMENU, 7, openSettings<Setting::IR_TX_GPIO, Setting::IR_RX_GPIO>,
+                         settingsScreenDraw, settingsScreenInput, drawSettingsSubmenu },
+  { SETTINGS_SUBMENU, 8, fwUpdateOpen, fwUpdateDraw, fwUpdateInput, drawSettingsSubmenu },
+  { FILES_SUBMENU,    1, fileBrowserOpenSd,    fileBrowserDraw, fileBrowserInput, drawFilesSubmenu },
+  { FILES_SUBMENU,    2, fileBrowserOpenFlash, fileBrowserDraw, fileBrowserInput, drawFilesSubmenu },
+  { FILES_SUBMENU,    4, webFilesStart,        webFilesDraw,    webFilesInput,    drawFilesSubmenu },
+};
+static const AppEntry* sApp = nullptr;   // running app, if any
+
+int buttonsActiveApp() { return sApp ? sApp->idx : -1; }
+
+static const AppEntry* findApp(MenuState menu, int idx) {
+  for (const AppEntry& app : kApps) {
+    if (app.menu == menu && app.idx == idx) return &app;
+  }
+  return nullptr;
+}
+
 // Centralize “entering a submenu row” behavior
 static void handleSubmenuAction(
   MenuState currentMenu,
@@ -103,6 +179,13 @@ static void handleSubmenuAction(
   bool& inBGone,
   bool& inIRRead
 ) {
+  if (const AppEntry* app = findApp(currentMenu, idx)) {
+    app->reset();
+    app->draw(*tft);
+    sApp = app;
+    return;
+  }
+
   // EXTRAS → Stopwatch opens dedicated UI
   if (currentMenu == EXTRAS_SUBMENU && idx == 1) {
     resetStopwatch();
@@ -127,11 +210,41 @@ static void handleSubmenuAction(
     return;
   }
 
+  // IR → Analyzer (index 6): IR Read in histogram view
+  if (currentMenu == IR_SUBMENU && idx == 6) {
+    irReadReset();
+    irReadSetAnalyzer(true);
+    irReadDrawScreen(*tft);
+    inIRRead = true;
+    return;
+  }
+
   // default: layered option screen
   drawOptionsLayerBackground(*tft);
   inOptionScreen = true;
 }
 
+// ---------- Top-level ring ----------
+// Main menus in B/C order; menus hidden by the device profile are skipped.
+static void (* const kRing[])() = {
+  drawWiFiMenu, drawBluetoothMenu, drawIRMenu, drawRFMenu, drawNRFMenu,
+  drawRadioMenu, drawGPSMenu, drawRPIMenu, drawBadUSBMenu, drawSettingsMenu,
+  drawExtrasMenu, drawFilesMenu, drawRfidMenu, drawNfcMenu,
+};
+static constexpr int kRingLen = sizeof(kRing) / sizeof(kRing[0]);
+
+static void stepRing(MenuState& menu, int dir) {
+  if (menu & 1) return;                          // MenuState of ring entry i is 2 * i
+  int i = menu / 2;
+  for (int k = 1; k < kRingLen; ++k) {
+    int j = (i + dir * k + kRingLen) % kRingLen;
+    if (profileMenuHidden((MenuState)(2 * j))) continue;
+    menu = (MenuState)(2 * j);
+    kRing[j]();
+    return;
+  }
+}
+
 void handleAllButtonLogic(
   TFT_eSPI* tft,
   bool& inOptionScreen,
@@ -142,6 +255,32 @@ void handleAllButtonLogic(
 ) {
   unsigned long now = millis();
 
+  // ---------- Registered app ----------
+  if (sApp) {
+    bool exitReq = false;
+#if defined(M5CARDPUTER)
+    sApp->input(btnAPressed(), btnBPressed(), btnCPressed() || btnExitSpecialPressed(), exitReq);
+#else
+    sApp->input(btnAPressed(), btnBPressed(), btnCPressed(), exitReq);
+#endif
+    if (exitReq) {
+      const AppEntry* app = sApp;
+      sApp = nullptr;
+      tft->fillScreen(TFT_BLACK);
+      tft->setRotation(ROT_TOP);
+#if defined(M5CARDPUTER)
+      drawOptionsLayerBackground(*tft);
+#endif
+      app->redrawMenu();
+      finalizeButtons();
+      return;
+    }
+    sApp->draw(*tft);
+    finalizeButtons();
+    delay(30);
+    return;
+  }
+
   // ---------- IR Read mode ----------
   if (inIRRead) {
     bool exitReq = false;
@@ -318,46 +457,8 @@ void handleAllButtonLogic(
   if (!inOptionScreen && !inStopwatch && !inIRRead && !inBGone) {
     static unsigned long last = 0;
     if (now - last > 200) {
-      if (btnBPressed()) {
-        last = now;
-        switch(currentMenu) {
-          case WIFI_MENU:        currentMenu=NFC_MENU;         drawNfcMenu();        break;
-          case BLUETOOTH_MENU:   currentMenu=WIFI_MENU;        drawWiFiMenu();       break;
-          case IR_MENU:          currentMenu=BLUETOOTH_MENU;   drawBluetoothMenu();  break;
-          case RF_MENU:          currentMenu=IR_MENU;          drawIRMenu();         break;
-          case NRF_MENU:         currentMenu=RF_MENU;          drawRFMenu();         break;
-          case RADIO_MENU:       currentMenu=NRF_MENU;         drawNRFMenu();        break;
-          case GPS_MENU:         currentMenu=RADIO_MENU;       drawRadioMenu();      break;
-          case RPI_MENU:         currentMenu=GPS_MENU;         drawGPSMenu();        break;
-          case BADUSB_MENU:      currentMenu=RPI_MENU;         drawRPIMenu();        break;
-          case SETTINGS_MENU:    currentMenu=BADUSB_MENU;      drawBadUSBMenu();     break;
-          case EXTRAS_MENU:      currentMenu=SETTINGS_MENU;    drawSettingsMenu();   break;
-          case FILES_MENU:       currentMenu=EXTRAS_MENU;      drawExtrasMenu();     break;
-          case RFID_MENU:        currentMenu=FILES_MENU;       drawFilesMenu();      break;
-          case NFC_MENU:         currentMenu=RFID_MENU;        drawRfidMenu();       break;
-          default: break;
-        }
-      }
-      if (btnCPressed()) {
-        last = now;
-        switch(currentMenu) {
-          case WIFI_MENU:        currentMenu=BLUETOOTH_MENU;  drawBluetoothMenu();   break;
-          case BLUETOOTH_MENU:   currentMenu=IR_MENU;         drawIRMenu();          break;
-          case IR_MENU:          currentMenu=RF_MENU;         drawRFMenu();          break;
-          case RF_MENU:          currentMenu=NRF_MENU;        drawNRFMenu();         break;
-          case NRF_MENU:         currentMenu=RADIO_MENU;      drawRadioMenu();       break;
-          case RADIO_MENU:       currentMenu=GPS_MENU;        drawGPSMenu();         break;
-          case GPS_MENU:         currentMenu=RPI_MENU;        drawRPIMenu();         break;
-          case RPI_MENU:         currentMenu=BADUSB_MENU;     drawBadUSBMenu();      break;
-          case BADUSB_MENU:      currentMenu=SETTINGS_MENU;   drawSettingsMenu();    break;
-          case SETTINGS_MENU:    currentMenu=EXTRAS_MENU;     drawExtrasMenu();      break;
-          case EXTRAS_MENU:      currentMenu=FILES_MENU;      drawFilesMenu();       break;
-          case FILES_MENU:       currentMenu=RFID_MENU;       drawRfidMenu();        break;
-          case RFID_MENU:        currentMenu=NFC_MENU;        drawNfcMenu();         break;
-          case NFC_MENU:         currentMenu=WIFI_MENU;       drawWiFiMenu();        break;
-          default: break;
-        }
-      }
+      if (btnBPressed()) { last = now; stepRing(currentMenu, -1); }
+      if (btnCPressed()) { last = now; stepRing(currentMenu, +1); }
     }
   }
 
@@ -8,6 +8,8 @@ bool btnAPressed();
 bool btnBPressed();
 bool btnCPressed();
 void finalizeButtons();
+uint32_t buttonsIdleMs();            // since the last key/button activity
+int  buttonsActiveApp();             // submenu row of the running registered app, -1 if none
 
 void handleAllButtonLogic(
   TFT_eSPI* tft,
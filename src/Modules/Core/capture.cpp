@@ -0,0 +1,402 @@
+#include "capture.h"
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+static constexpr uint32_t kFileMagic  = 0x43575446;   // "FTWC"
+static constexpr uint32_t kChunkMagic = 0x4B4E4843;   // "CHNK"
+static constexpr uint32_t kIndexMagic = 0x58444946;   // "FIDX"
+static constexpr uint32_t kEndMagic   = 0x444E4546;   // "FEND"
+static constexpr uint32_t kHeaderSize = 24;
+static constexpr uint32_t kChunkHdr   = 24;
+static constexpr uint32_t kRecordHdr  = 8;
+static constexpr uint32_t kIndexHdr   = 20;
+static constexpr uint32_t kTrailer    = 8;
+static constexpr uint32_t kMinChunk   = 256;
+static constexpr uint16_t kScanIndex  = 512;          // reader, when the file has no index
+
+// Both targets (ESP32, x86/ARM hosts) are little endian, as is the format
+static inline uint32_t rd32(const uint8_t* p) { uint32_t v; memcpy(&v, p, 4); return v; }
+static inline uint16_t rd16(const uint8_t* p) { uint16_t v; memcpy(&v, p, 2); return v; }
+static inline void     wr32(uint8_t* p, uint32_t v) { memcpy(p, &v, 4); }
+static inline void     wr16(uint8_t* p, uint16_t v) { memcpy(p, &v, 2); }
+
+uint32_t captureCrc32(uint32_t crc, const void* data, size_t len) {
+  static const uint32_t kNibble[16] = {
+    0x00000000, 0x1DB71064, 0x3B6E20C8, 0x26D930AC, 0x76DC4190, 0x6B6B51F4, 0x4DB26158, 0x5005713C,
+    0xEDB88320, 0xF00F9344, 0xD6D6A3E8, 0xCB61B38C, 0x9B64C2B0, 0x86D3D2D4, 0xA00AE278, 0xBDBDF21C,
+  };
+  const uint8_t* p = (const uint8_t*)data;
+  crc = ~crc;
+  while (len--) {
+    crc ^= *p++;
+    crc = (crc >> 4) ^ kNibble[crc & 15];
+    crc = (crc >> 4) ^ kNibble[crc & 15];
+  }
+  return ~crc;
+}
+
+// ─────────────────────────────────────────────────────────────────────────────
+// Shared: header, chunk headers, index
+// ─────────────────────────────────────────────────────────────────────────────
+struct ChunkHdr {
+  uint32_t seq, len, t0, t1, crc;
+};
+
+static bool readAt(FILE* f, uint32_t off, void* dst, size_t len) {
+  return fseek(f, (long)off, SEEK_SET) == 0 && fread(dst, 1, len, f) == len;
+}
+
+static uint32_t fileSize(FILE* f) {
+  if (fseek(f, 0, SEEK_END) != 0) return 0;
+  long n = ftell(f);
+  return n > 0 ? (uint32_t)n : 0;
+}
+
+static bool readHeader(FILE* f, CaptureInfo& info) {
+  uint8_t h[kHeaderSize];
+  if (!readAt(f, 0, h, sizeof(h))) return false;
+  if (rd32(h) != kFileMagic || rd16(h + 4) != CAPTURE_VERSION || rd16(h + 6) != kHeaderSize) return false;
+  if (rd32(h + 20) != captureCrc32(0, h, 20)) return false;
+  info.startUnix  = rd32(h + 8);
+  info.chunkBytes = rd32(h + 12);
+  return info.chunkBytes >= kMinChunk && info.chunkBytes <= 0xFFFF;
+}
+
+static bool readChunkHdr(FILE* f, uint32_t off, uint32_t chunkBytes, ChunkHdr& c) {
+  uint8_t h[kChunkHdr];
+  if (!readAt(f, off, h, sizeof(h)) || rd32(h) != kChunkMagic) return false;
+  c.seq = rd32(h + 4);
+  c.len = rd32(h + 8);
+  c.t0  = rd32(h + 12);
+  c.t1  = rd32(h + 16);
+  c.crc = rd32(h + 20);
+  return c.len + kChunkHdr <= chunkBytes;
+}
+
+static bool indexAlloc(CaptureIndex& ix, uint16_t max) {
+  free(ix.entries);
+  ix.entries = (CaptureIndex::Entry*)malloc(sizeof(CaptureIndex::Entry) * max);
+  ix.count   = 0;
+  ix.max     = ix.entries ? max : 0;
+  ix.stride  = 1;
+  return ix.entries != nullptr;
+}
+
+static void indexFree(CaptureIndex& ix) {
+  free(ix.entries);
+  ix = CaptureIndex();
+}
+
+// Entry i always describes chunk i * stride
+static void indexAdd(CaptureIndex& ix, uint32_t seq, uint32_t offset, uint32_t tMs) {
+  if (!ix.max || seq % ix.stride) return;
+  if (ix.count == ix.max) {
+    uint16_t n = 0;
+    for (uint16_t i = 0; i < ix.count; i += 2) ix.entries[n++] = ix.entries[i];
+    ix.count   = n;
+    ix.stride *= 2;
+    if (seq % ix.stride) return;
+  }
+  ix.entries[ix.count++] = { offset, tMs };
+}
+
+// Valid trailer + index → index loaded, info.dataEnd = index offset
+static bool loadIndex(FILE* f, uint32_t size, uint16_t minMax, CaptureIndex& ix, CaptureInfo& info) {
+  uint8_t t[kTrailer], h[kIndexHdr];
+  if (size < kHeaderSize + kIndexHdr + 4 + kTrailer) return false;
+  if (!readAt(f, size - kTrailer, t, sizeof(t)) || rd32(t + 4) != kEndMagic) return false;
+  uint32_t at = rd32(t);
+  if (at < kHeaderSize || at > size - kTrailer - kIndexHdr - 4) return false;
+  if (!readAt(f, at, h, sizeof(h)) || rd32(h) != kIndexMagic) return false;
+  uint32_t count = rd32(h + 4), stride = rd32(h + 8);
+  if (count > 0xFFFF || !stride || (stride & (stride - 1)) ||
+      at + kIndexHdr + count * 8 + 4 + kTrailer != size) return false;
+
+  uint16_t cap = (uint16_t)(count > minMax ? count : minMax);
+  if (!indexAlloc(ix, cap ? cap : 1)) return false;
+  uint32_t crc = captureCrc32(0, h, sizeof(h));
+  for (uint32_t i = 0; i < count; ++i) {
+    uint8_t e[8];
+    if (fread(e, 1, sizeof(e), f) != sizeof(e)) return false;
+    crc = captureCrc32(crc, e, sizeof(e));
+    ix.entries[i] = { rd32(e), rd32(e + 4) };
+  }
+  uint8_t c[4];
+  if (fread(c, 1, sizeof(c), f) != sizeof(c) || rd32(c) != crc) { ix.count = 0; return false; }
+  ix.count      = (uint16_t)count;
+  ix.stride     = stride;
+  info.chunks   = rd32(h + 12);
+  info.lastMs   = rd32(h + 16);
+  info.firstMs  = count ? ix.entries[0].tMs : 0;
+  info.dataEnd  = at;
+  return true;
+}
+
+// Rebuilds the index by walking the chunks; stops at the first one that is
+// truncated, out of sequence or fails its CRC.
+static void scanChunks(FILE* f, uint32_t size, uint8_t* buf, CaptureIndex& ix, CaptureInfo& info) {
+  uint32_t off = kHeaderSize;
+  ChunkHdr c;
+  info.chunks = 0;
+  while (off + kChunkHdr <= size && readChunkHdr(f, off, info.chunkBytes, c)) {
+    if (c.seq != info.chunks || off + kChunkHdr + c.len > size) break;
+    if (!readAt(f, off, buf, kChunkHdr + c.len)) break;
+    uint32_t crc = captureCrc32(captureCrc32(0, buf, 20), buf + kChunkHdr, c.len);
+    if (crc != c.crc) break;
+    indexAdd(ix, c.seq, off, c.t0);
+    if (!info.chunks) info.firstMs = c.t0;
+    info.lastMs = c.t1;
+    info.chunks++;
+    off += kChunkHdr + c.len;
+  }
+  info.dataEnd      = off;
+  info.indexRebuilt = true;
+}
+
+// ─────────────────────────────────────────────────────────────────────────────
+// Writer
+// ─────────────────────────────────────────────────────────────────────────────
+bool CaptureWriter::fail(const char* why) {
+  _error = why;
+  return false;
+}
+
+bool CaptureWriter::open(const char* path, const CaptureConfig& cfg) {
+  close();
+  _error = nullptr;
+  _cfg = cfg;
+  if (_cfg.chunkBytes < kMinChunk) _cfg.chunkBytes = kMinChunk;
+  if (_cfg.indexMax < 2) _cfg.indexMax = 2;
+  _used = _seq = _end = _records = _lastMs = 0;
+
+  CaptureInfo info = {};
+  FILE* f = fopen(path, "rb");
+  uint32_t size = f ? fileSize(f) : 0;
+  if (f && !size) { fclose(f); f = nullptr; }       // left empty by a failed create
+  if (f) {
+    bool ok = readHeader(f, info);
+    if (ok) {
+      _cfg.chunkBytes = (uint16_t)info.chunkBytes;       // the file's chunk size wins
+      _buf = (uint8_t*)malloc(_cfg.chunkBytes);
+      ok = _buf && (loadIndex(f, size, _cfg.indexMax, _index, info) ||
+                    (indexAlloc(_index, _cfg.indexMax) && (scanChunks(f, size, _buf, _index, info), true)));
+    }
+    fclose(f);
+    if (!ok) { close(); return fail("not a capture file"); }
+    // Drop the old index (rewritten on close) or a torn tail
+    if (info.dataEnd != size && truncate(path, (off_t)info.dataEnd) != 0) {
+      close();
+      return fail("cannot truncate");
+    }
+    _seq    = info.chunks;
+    _end    = info.dataEnd;
+    _lastMs = info.lastMs;
+    _file   = fopen(path, "ab");
+  } else {
+    _buf = (uint8_t*)malloc(_cfg.chunkBytes);
+    if (!_buf || !indexAlloc(_index, _cfg.indexMax)) { close(); return fail("out of memory"); }
+    _file = fopen(path, "wb");
+    if (_file) {
+      uint8_t h[kHeaderSize] = {};
+      wr32(h, kFileMagic);
+      wr16(h + 4, CAPTURE_VERSION);
+      wr16(h + 6, kHeaderSize);
+      wr32(h + 8, _cfg.startUnix);
+      wr32(h + 12, _cfg.chunkBytes);
+      wr32(h + 20, captureCrc32(0, h, 20));
+      if (fwrite(h, 1, sizeof(h), _file) != sizeof(h)) { close(); return fail("write failed"); }
+      _end = kHeaderSize;
+    }
+  }
+  if (!_file) { close(); return fail("cannot open"); }
+  setvbuf(_file, nullptr, _IONBF, 0);             // whole chunks per write
+  return true;
+}
+
+bool CaptureWriter::append(CaptureType type, uint32_t tMs, const void* data, uint16_t len, uint8_t flags) {
+  if (!_file) return false;
+  uint32_t need = kRecordHdr + len;
+  if (kChunkHdr + need > _cfg.chunkBytes) return fail("record larger than a chunk");
+  if (kChunkHdr + _used + need > _cfg.chunkBytes && !seal()) return false;
+
+  if (!_used) _t0 = _t1 = tMs;
+  if (tMs > _t1) _t1 = tMs;
+  uint8_t* p = _buf + kChunkHdr + _used;
+  p[0] = (uint8_t)type;
+  p[1] = flags;
+  wr16(p + 2, len);
+  wr32(p + 4, tMs);
+  if (len) memcpy(p + kRecordHdr, data, len);
+  _used += need;
+  _records++;
+  return true;
+}
+
+bool CaptureWriter::seal() {
+  if (!_used) return true;
+  wr32(_buf,      kChunkMagic);
+  wr32(_buf + 4,  _seq);
+  wr32(_buf + 8,  _used);
+  wr32(_buf + 12, _t0);
+  wr32(_buf + 16, _t1);
+  wr32(_buf + 20, captureCrc32(captureCrc32(0, _buf, 20), _buf + kChunkHdr, _used));
+
+  size_t n = kChunkHdr + _used;
+  if (fwrite(_buf, 1, n, _file) != n) return fail("write failed");
+  fflush(_file);
+  fsync(fileno(_file));
+
+  indexAdd(_index, _seq, _end, _t0);
+  _end   += n;
+  _lastMs = _t1;
+  _seq++;
+  _used = 0;
+  return true;
+}
+
+void CaptureWriter::poll(uint32_t nowMs) {
+  if (_file && _used && nowMs - _t0 >= _cfg.maxAgeMs) seal();
+}
+
+bool CaptureWriter::flush() {
+  return _file && seal();
+}
+
+bool CaptureWriter::close() {
+  bool ok = true;
+  if (_file) {
+    ok = seal();
+
+    uint8_t h[kIndexHdr];
+    wr32(h,      kIndexMagic);
+    wr32(h + 4,  _index.count);
+    wr32(h + 8,  _index.stride);
+    wr32(h + 12, _seq);
+    wr32(h + 16, _lastMs);
+    uint32_t crc = captureCrc32(0, h, sizeof(h));
+    ok = fwrite(h, 1, sizeof(h), _file) == sizeof(h) && ok;
+    for (uint16_t i = 0; i < _index.count; ++i) {
+      uint8_t e[8];
+      wr32(e,     _index.entries[i].offset);
+      wr32(e + 4, _index.entries[i].tMs);
+      crc = captureCrc32(crc, e, sizeof(e));
+      ok = fwrite(e, 1, sizeof(e), _file) == sizeof(e) && ok;
+    }
+    uint8_t t[4 + kTrailer];
+    wr32(t,     crc);
+    wr32(t + 4, _end);
+    wr32(t + 8, kEndMagic);
+    ok = fwrite(t, 1, sizeof(t), _file) == sizeof(t) && ok;
+    fflush(_file);
+    fsync(fileno(_file));
+    fclose(_file);
+    _file = nullptr;
+    if (!ok && !_error) _error = "write failed";
+  }
+  free(_buf);
+  _buf = nullptr;
+  indexFree(_index);
+  return ok;
+}
+
+// ─────────────────────────────────────────────────────────────────────────────
+// Reader
+// ─────────────────────────────────────────────────────────────────────────────
+bool CaptureReader::fail(const char* why) {
+  _error = why;
+  return false;
+}
+
+bool CaptureReader::open(const char* path) {
+  close();
+  _error = nullptr;
+  _info  = {};
+  _file  = fopen(path, "rb");
+  if (!_file) return fail("cannot open");
+  uint32_t size = fileSize(_file);
+  if (!readHeader(_file, _info)) { close(); return fail("not a capture file"); }
+  _buf = (uint8_t*)malloc(_info.chunkBytes);
+  if (!_buf) { close(); return fail("out of memory"); }
+
+  if (!loadIndex(_file, size, 0, _index, _info)) {
+    if (!indexAlloc(_index, kScanIndex)) { close(); return fail("out of memory"); }
+    scanChunks(_file, size, _buf, _index, _info);
+    _info.badTailBytes = size - _info.dataEnd;
+  }
+  return seek(0);
+}
+
+void CaptureReader::close() {
+  if (_file) fclose(_file);
+  _file = nullptr;
+  free(_buf);
+  _buf = nullptr;
+  indexFree(_index);
+  _len = _pos = _next = 0;
+}
+
+bool CaptureReader::loadChunk(uint32_t offset) {
+  ChunkHdr c;
+  if (!readChunkHdr(_file, offset, _info.chunkBytes, c) || offset + kChunkHdr + c.len > _info.dataEnd ||
+      !readAt(_file, offset, _buf, kChunkHdr + c.len)) {
+    _next = _info.dataEnd;
+    return fail("bad chunk header");
+  }
+  _next = offset + kChunkHdr + c.len;
+  _pos  = kChunkHdr;
+  _len  = kChunkHdr + c.len;
+  if (captureCrc32(captureCrc32(0, _buf, 20), _buf + kChunkHdr, c.len) != c.crc) {
+    _info.badChunks++;                            // skip it, keep reading
+    _len = _pos;
+  }
+  return true;
+}
+
+bool CaptureReader::next(CaptureRecord& rec) {
+  if (!_file) return false;
+  for (;;) {
+    if (_pos + kRecordHdr <= _len) {
+      const uint8_t* p = _buf + _pos;
+      uint16_t size = rd16(p + 2);
+      if (_pos + kRecordHdr + size <= _len) {
+        rec.type  = p[0];
+        rec.flags = p[1];
+        rec.size  = size;
+        rec.tMs   = rd32(p + 4);
+        rec.data  = p + kRecordHdr;
+        _pos += kRecordHdr + size;
+        return true;
+      }
+    }
+    if (_next >= _info.dataEnd || !loadChunk(_next)) return false;
+  }
+}
+
+bool CaptureReader::seek(uint32_t tMs) {
+  if (!_file) return false;
+  _len = _pos = 0;
+  _next = kHeaderSize;
+
+  // Last index entry starting at or before tMs
+  int lo = 0, hi = (int)_index.count - 1, hit = -1;
+  while (lo <= hi) {
+    int mid = (lo + hi) / 2;
+    if (_index.entries[mid].tMs <= tMs) { hit = mid; lo = mid + 1; }
+    else hi = mid - 1;
+  }
+  if (hit >= 0) _next = _index.entries[hit].offset;
+
+  // Skip whole chunks that end before tMs (≤ stride of them), headers only
+  ChunkHdr c;
+  while (_next < _info.dataEnd && readChunkHdr(_file, _next, _info.chunkBytes, c) && c.t1 < tMs &&
+         _next + kChunkHdr + c.len < _info.dataEnd) {
+    _next += kChunkHdr + c.len;
+  }
+  if (_next >= _info.dataEnd || !loadChunk(_next)) return _next >= _info.dataEnd;
+
+  while (_pos + kRecordHdr <= _len && rd32(_buf + _pos + 4) < tMs) {
+    _pos += kRecordHdr + rd16(_buf + _pos + 2);
+  }
+  return true;
+}
@@ -0,0 +1,131 @@
+#pragma once
+#include <stdint.h>
+#include <stddef.h>
+#include <stdio.h>
+
+// Capture container (.ftc): typed, timestamped records grouped into chunks,
+// for IR frames, scan results, GPS fixes, audio, … Layout (little endian):
+//
+//   header  24 bytes  "FTWC", u16 version, u16 header size, u32 start (Unix
+//                     time, 0 if unknown), u32 max chunk size, u32 reserved,
+//                     u32 CRC-32 of the preceding 20 bytes
+//   chunk   24 bytes  "CHNK", u32 sequence, u32 payload size, u32 first and
+//                     u32 last record time, u32 CRC-32 of those 20 bytes and
+//                     the payload; then the payload: records of
+//                     u8 type, u8 flags, u16 size, u32 time (ms from start), data
+//   index   (on close) "FIDX", u32 count, u32 stride, u32 chunks, u32 last
+//                     record time, count × (u32 offset, u32 first time),
+//                     u32 CRC-32 of the block
+//   trailer 8 bytes   u32 index offset, "FEND"
+//
+// Records are collected in RAM and each chunk goes to the file with one write
+// followed by an fsync, so a power cut loses at most the open chunk. Nothing
+// past the last good chunk is trusted: opening a file without a valid index
+// (a crash, a torn write) rescans the chunk CRCs, and the writer truncates
+// the torn tail before appending. The index holds at most indexMax entries;
+// when it fills, every other entry is dropped and the stride doubles, so
+// seek() reads at most `stride` chunk headers past the entry it lands on.
+//
+// No Arduino dependencies: tools/capture.py reads the same format on a host.
+
+static constexpr uint16_t CAPTURE_VERSION = 1;
+
+enum class CaptureType : uint8_t {
+  IR_FRAME = 1,
+  WIFI_AP  = 2,
+  GPS_FIX  = 3,
+  AUDIO    = 4,
+  MARK     = 5,      // user bookmark / annotation
+};
+
+struct CaptureConfig {
+  uint16_t chunkBytes = 4096;   // payload + 24-byte header
+  uint16_t maxAgeMs   = 1000;   // poll() seals older chunks
+  uint16_t indexMax   = 512;    // 8 bytes each
+  uint32_t startUnix  = 0;      // new files only
+};
+
+struct CaptureRecord {
+  uint8_t        type;
+  uint8_t        flags;
+  uint16_t       size;
+  uint32_t       tMs;           // must not go backwards within a file
+  const uint8_t* data;          // valid until the next read/seek
+};
+
+struct CaptureInfo {
+  uint32_t startUnix;
+  uint32_t chunkBytes;
+  uint32_t chunks;
+  uint32_t firstMs, lastMs;
+  uint32_t dataEnd;             // end of the last good chunk
+  uint32_t badTailBytes;        // ignored after dataEnd (torn write / junk)
+  uint32_t badChunks;           // CRC failures skipped while reading
+  bool     indexRebuilt;        // no valid index on open
+};
+
+// Sparse chunk index shared by the reader and writer
+struct CaptureIndex {
+  struct Entry { uint32_t offset, tMs; };
+  Entry*   entries = nullptr;
+  uint16_t count   = 0;
+  uint16_t max     = 0;
+  uint32_t stride  = 1;         // chunks per entry, power of two
+};
+
+class CaptureWriter {
+public:
+  ~CaptureWriter() { close(); }
+  bool open(const char* path, const CaptureConfig& cfg = CaptureConfig());   // create or append
+  bool append(CaptureType type, uint32_t tMs, const void* data, uint16_t len, uint8_t flags = 0);
+  void poll(uint32_t nowMs);                 // seal the open chunk after maxAgeMs
+  bool flush();                              // seal + fsync
+  bool close();                              // flush, write the index
+  bool        active() const { return _file != nullptr; }
+  const char* error()  const { return _error; }
+  uint32_t    records() const { return _records; }
+  uint32_t    bytes()  const { return _end; }
+
+private:
+  bool seal();
+  bool fail(const char* why);
+
+  FILE*        _file = nullptr;
+  CaptureConfig _cfg;
+  CaptureIndex _index;
+  uint8_t*     _buf  = nullptr;             // chunk header + payload
+  uint32_t     _used = 0;                   // payload bytes in _buf
+  uint32_t     _t0 = 0, _t1 = 0;            // open chunk
+  uint32_t     _lastMs = 0;                 // last sealed record time
+  uint32_t     _seq = 0;
+  uint32_t     _end = 0;                    // file offset of the next chunk
+  uint32_t     _records = 0;
+  const char*  _error = nullptr;
+};
+
+class CaptureReader {
+public:
+  ~CaptureReader() { close(); }
+  bool open(const char* path);
+  void close();
+  bool next(CaptureRecord& rec);             // false at the end of the good data
+  bool seek(uint32_t tMs);                   // next() returns the first record at or after tMs
+  bool rewind() { return seek(0); }
+  const CaptureInfo& info() const { return _info; }
+  const char* error() const { return _error; }
+
+private:
+  bool loadChunk(uint32_t offset);
+  bool fail(const char* why);
+
+  FILE*        _file = nullptr;
+  CaptureInfo  _info = {};
+  CaptureIndex _index;
+  uint8_t*     _buf  = nullptr;
+  uint32_t     _len  = 0;                   // payload bytes in _buf
+  uint32_t     _pos  = 0;                   // next record in _buf
+  uint32_t     _next = 0;                   // file offset of the next chunk
+  const char*  _error = nullptr;
+};
+
+uint32_t captureCrc32(uint32_t crc, const void* data, size_t len);   // zlib-compatible
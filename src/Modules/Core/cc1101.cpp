@@ -0,0 +1,153 @@
+#include "cc1101.h"
+
+#if defined(LILYGO_CC1101)
+#include <SPI.h>
+#include <TFT_eSPI.h>
+
+#ifndef CC1101_CS_PIN
+  #define CC1101_CS_PIN 12
+#endif
+#ifndef CC1101_GDO0_PIN
+  #define CC1101_GDO0_PIN 3
+#endif
+#ifndef CC1101_GDO2_PIN
+  #define CC1101_GDO2_PIN 38
+#endif
+#ifndef CC1101_SW0_PIN
+  #define CC1101_SW0_PIN 48
+#endif
+#ifndef CC1101_SW1_PIN
+  #define CC1101_SW1_PIN 47
+#endif
+#ifndef CC1101_PWR_PIN
+  #define CC1101_PWR_PIN 15
+#endif
+
+static constexpr uint32_t kSpiHz      = 5000000;
+static constexpr uint8_t  kBurst      = 0x40;
+static constexpr uint8_t  kRead       = 0x80;
+static constexpr uint8_t  kPartnum    = 0x00;
+static constexpr uint32_t kReadyUs    = 1000;     // SO low after CS: crystal running
+
+static SPIClass* sSpi = nullptr;
+static SPISettings sSettings(kSpiHz, MSBFIRST, SPI_MODE0);
+
+// ─────────────────────────────────────────────────────────────────────────────
+// Bus
+// ─────────────────────────────────────────────────────────────────────────────
+static void select() {
+  sSpi->beginTransaction(sSettings);
+  digitalWrite(CC1101_CS_PIN, LOW);
+  uint32_t t0 = micros();
+  while (digitalRead(TFT_MISO) && micros() - t0 < kReadyUs) {}
+}
+
+static void deselect() {
+  digitalWrite(CC1101_CS_PIN, HIGH);
+  sSpi->endTransaction();
+}
+
+void cc1101Strobe(uint8_t cmd) {
+  select();
+  sSpi->transfer(cmd);
+  deselect();
+}
+
+void cc1101Write(uint8_t reg, uint8_t value) {
+  select();
+  sSpi->transfer(reg);
+  sSpi->transfer(value);
+  deselect();
+}
+
+void cc1101WriteBurst(uint8_t reg, const uint8_t* data, uint8_t len) {
+  if (len == 1) { cc1101Write(reg, data[0]); return; }
+  select();
+  sSpi->transfer(reg | kBurst);
+  for (uint8_t i = 0; i < len; ++i) sSpi->transfer(data[i]);
+  deselect();
+}
+
+uint8_t cc1101Read(uint8_t reg) {
+  select();
+  sSpi->transfer(reg | kRead);
+  uint8_t v = sSpi->transfer(0);
+  deselect();
+  return v;
+}
+
+void cc1101ReadBurst(uint8_t reg, uint8_t* data, uint8_t len) {
+  select();
+  sSpi->transfer(reg | kRead | kBurst);
+  for (uint8_t i = 0; i < len; ++i) data[i] = sSpi->transfer(0);
+  deselect();
+}
+
+uint8_t cc1101Status(uint8_t reg) {
+  select();
+  sSpi->transfer(reg | kRead | kBurst);
+  uint8_t v = sSpi->transfer(0);
+  deselect();
+  return v;
+}
+
+int8_t cc1101RssiDbm() {
+  int16_t raw = (int8_t)cc1101Status(CC_RSSI);    // two's complement, ½ dB steps
+  return (int8_t)(raw / 2 - 74);
+}
+
+// ─────────────────────────────────────────────────────────────────────────────
+// Board
+// ─────────────────────────────────────────────────────────────────────────────
+void cc1101Antenna(uint32_t hz) {
+  bool sw1 = hz < 700000000;                      // 315 and 433 paths
+  bool sw0 = hz > 400000000;                      // 433 and 868/915 paths
+  digitalWrite(CC1101_SW1_PIN, sw1);
+  digitalWrite(CC1101_SW0_PIN, sw0);
+}
+
+int cc1101Gdo0Pin() { return CC1101_GDO0_PIN; }
+
+bool cc1101Begin() {
+  pinMode(CC1101_PWR_PIN, OUTPUT);
+  digitalWrite(CC1101_PWR_PIN, HIGH);
+  pinMode(CC1101_SW0_PIN, OUTPUT);
+  pinMode(CC1101_SW1_PIN, OUTPUT);
+  pinMode(CC1101_CS_PIN, OUTPUT);
+  digitalWrite(CC1101_CS_PIN, HIGH);
+  pinMode(CC1101_GDO0_PIN, INPUT);
+  pinMode(CC1101_GDO2_PIN, INPUT);
+  sSpi = &TFT_eSPI::getSPIinstance();             // shared with the display
+
+  cc1101Strobe(CC_SRES);
+  delay(1);
+  uint8_t part = cc1101Status(CC_PARTNUM), ver = cc1101Status(CC_VERSION);
+  if (part != kPartnum || ver == 0x00 || ver == 0xFF) {
+    cc1101End();
+    return false;
+  }
+  return true;
+}
+
+void cc1101End() {                               // the power rail also feeds other parts: leave it on
+  if (!sSpi) return;
+  cc1101Strobe(CC_SIDLE);
+  cc1101Strobe(CC_SPWD);
+  sSpi = nullptr;
+}
+
+#else   // no CC1101 on this board
+
+bool    cc1101Begin() { return false; }
+void    cc1101End() {}
+void    cc1101Strobe(uint8_t) {}
+void    cc1101Write(uint8_t, uint8_t) {}
+void    cc1101WriteBurst(uint8_t, const uint8_t*, uint8_t) {}
+uint8_t cc1101Read(uint8_t) { return 0; }
+void    cc1101ReadBurst(uint8_t, uint8_t*, uint8_t) {}
+uint8_t cc1101Status(uint8_t) { return 0; }
+int8_t  cc1101RssiDbm() { return -128; }
+void    cc1101Antenna(uint32_t) {}
+int     cc1101Gdo0Pin() { return -1; }
+
+#endif
@@ -0,0 +1,51 @@
+#pragma once
+#include <Arduino.h>
+
+// Minimal CC1101 access for the lilygo-cc1101 board: register and strobe
+// I/O over the SPI bus the display already uses (TFT_eSPI's SPIClass, with
+// the radio's own chip select), plus the board's power and antenna switch.
+// Callers run on the UI task, so display and radio transactions never
+// interleave. On boards without the radio cc1101Begin() returns false.
+//
+// Pins default to the LilyGO T-Embed CC1101 and can be overridden with
+// -DCC1101_CS_PIN, -DCC1101_GDO0_PIN, -DCC1101_GDO2_PIN, -DCC1101_SW0_PIN,
+// -DCC1101_SW1_PIN and -DCC1101_PWR_PIN.
+
+static constexpr uint32_t CC1101_XOSC_HZ = 26000000;
+
+// Configuration registers
+enum : uint8_t {
+  CC_IOCFG2 = 0x00, CC_IOCFG1, CC_IOCFG0, CC_FIFOTHR, CC_SYNC1, CC_SYNC0, CC_PKTLEN,
+  CC_PKTCTRL1, CC_PKTCTRL0, CC_ADDR, CC_CHANNR, CC_FSCTRL1, CC_FSCTRL0, CC_FREQ2,
+  CC_FREQ1, CC_FREQ0, CC_MDMCFG4, CC_MDMCFG3, CC_MDMCFG2, CC_MDMCFG1, CC_MDMCFG0,
+  CC_DEVIATN, CC_MCSM2, CC_MCSM1, CC_MCSM0, CC_FOCCFG, CC_BSCFG, CC_AGCCTRL2,
+  CC_AGCCTRL1, CC_AGCCTRL0, CC_WOREVT1, CC_WOREVT0, CC_WORCTRL, CC_FREND1, CC_FREND0,
+  CC_FSCAL3, CC_FSCAL2, CC_FSCAL1, CC_FSCAL0, CC_RCCTRL1, CC_RCCTRL0, CC_FSTEST,
+  CC_PTEST, CC_AGCTEST, CC_TEST2, CC_TEST1, CC_TEST0,
+};
+
+// Command strobes
+enum : uint8_t {
+  CC_SRES = 0x30, CC_SFSTXON, CC_SXOFF, CC_SCAL, CC_SRX, CC_STX, CC_SIDLE,
+  CC_SWOR = 0x38, CC_SPWD, CC_SFRX, CC_SFTX, CC_SWORRST, CC_SNOP,
+};
+
+// Status registers (read with the burst bit)
+enum : uint8_t {
+  CC_PARTNUM = 0x30, CC_VERSION, CC_FREQEST, CC_LQI, CC_RSSI, CC_MARCSTATE,
+};
+
+static constexpr uint8_t CC_MARC_IDLE = 0x01;
+static constexpr uint8_t CC_MARC_RX   = 0x0D;
+
+bool    cc1101Begin();                              // power, reset, chip check
+void    cc1101End();                                // radio to power-down state
+void    cc1101Strobe(uint8_t cmd);
+void    cc1101Write(uint8_t reg, uint8_t value);
+void    cc1101WriteBurst(uint8_t reg, const uint8_t* data, uint8_t len);
+uint8_t cc1101Read(uint8_t reg);
+void    cc1101ReadBurst(uint8_t reg, uint8_t* data, uint8_t len);
+uint8_t cc1101Status(uint8_t reg);
+int8_t  cc1101RssiDbm();                            // current RSSI register, dBm
+void    cc1101Antenna(uint32_t hz);                 // board RF switch for that band
+int     cc1101Gdo0Pin();
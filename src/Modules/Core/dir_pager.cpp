@@ -0,0 +1,157 @@
+#include "dir_pager.h"
+#include <dirent.h>
+#include <strings.h>
+
+static constexpr uint8_t kWindow = 2;             // pages held in RAM
+
+struct Page {
+  int32_t  index;                                // -1 = empty
+  uint8_t  count;
+  uint32_t stamp;                                // LRU
+  DirEntry entries[DIR_PAGE_SIZE];
+};
+
+static DIR*     sPageDir = nullptr;              // page loads
+static DIR*     sScanDir = nullptr;              // background count
+static long     sPageOff[DIR_MAX_PAGES];         // telldir() at page starts
+static uint16_t sPagesKnown = 0;
+static Page     sPages[kWindow];
+static uint32_t sStamp = 0;
+
+static uint32_t sCount = 0;                      // counted by the scan
+static bool     sCountDone = false;
+static int32_t  sLastPage = -1;                  // known last page (short or empty read)
+static uint8_t  sLastPageCount = 0;
+
+// ─────────────────────────────────────────────────────────────────────────────
+// Helpers
+// ─────────────────────────────────────────────────────────────────────────────
+static bool listable(const struct dirent* d) {
+  return d->d_name[0] != '.';                    // ".", ".." and hidden files
+}
+
+static void rememberPage(uint32_t page, long off) {
+  if (page < DIR_MAX_PAGES && page == sPagesKnown) sPageOff[sPagesKnown++] = off;
+}
+
+static bool before(const DirEntry& a, const DirEntry& b) {
+  if (a.dir != b.dir) return a.dir;
+  return strcasecmp(a.name, b.name) < 0;
+}
+
+static void sortPage(Page& p) {                  // insertion sort, 32 entries
+  for (uint8_t i = 1; i < p.count; ++i) {
+    DirEntry e = p.entries[i];
+    int8_t j = i - 1;
+    while (j >= 0 && before(e, p.entries[j])) { p.entries[j + 1] = p.entries[j]; --j; }
+    p.entries[j + 1] = e;
+  }
+}
+
+// Position sPageDir at the start of `page`, recording page starts on the way.
+static bool seekPage(uint32_t page) {
+  uint32_t from = min<uint32_t>(page, sPagesKnown ? sPagesKnown - 1 : 0);
+  if (!sPagesKnown) return false;
+  seekdir(sPageDir, sPageOff[from]);
+  for (uint32_t p = from; p < page; ++p) {
+    uint8_t n = 0;
+    struct dirent* d;
+    while (n < DIR_PAGE_SIZE && (d = readdir(sPageDir))) if (listable(d)) ++n;
+    if (n < DIR_PAGE_SIZE) return false;         // directory ends before `page`
+    rememberPage(p + 1, telldir(sPageDir));
+  }
+  return true;
+}
+
+static Page* loadPage(uint32_t page) {
+  for (Page& p : sPages) {
+    if (p.index == (int32_t)page) { p.stamp = ++sStamp; return &p; }
+  }
+  if (sLastPage >= 0 && (int32_t)page > sLastPage) return nullptr;
+
+  Page* victim = &sPages[0];
+  for (Page& p : sPages) if (p.stamp < victim->stamp) victim = &p;
+  victim->index = -1;
+  victim->count = 0;
+  if (!seekPage(page)) return nullptr;
+
+  struct dirent* d;
+  while (victim->count < DIR_PAGE_SIZE && (d = readdir(sPageDir))) {
+    if (!listable(d)) continue;
+    DirEntry& e = victim->entries[victim->count++];
+    e.dir = d->d_type == DT_DIR;
+    size_t n = strlcpy(e.name, d->d_name, sizeof(e.name) - (e.dir ? 1 : 0));
+    if (e.dir) {
+      n = min(n, sizeof(e.name) - 2);
+      e.name[n] = '/';
+      e.name[n + 1] = '\0';
+    }
+  }
+  if (victim->count == DIR_PAGE_SIZE) {
+    rememberPage(page + 1, telldir(sPageDir));
+  } else {
+    sLastPage = page;
+    sLastPageCount = victim->count;
+    if (!victim->count) return nullptr;
+  }
+  sortPage(*victim);
+  victim->index = page;
+  victim->stamp = ++sStamp;
+  return victim;
+}
+
+// ─────────────────────────────────────────────────────────────────────────────
+// Public API
+// ─────────────────────────────────────────────────────────────────────────────
+bool dirPagerOpen(const char* vfsPath) {
+  dirPagerClose();
+  sPageDir = opendir(vfsPath);
+  if (!sPageDir) return false;
+  sScanDir = opendir(vfsPath);
+  sPageOff[0] = telldir(sPageDir);
+  sPagesKnown = 1;
+  for (Page& p : sPages) { p.index = -1; p.stamp = 0; }
+  sCount = 0;
+  sCountDone = !sScanDir;
+  sLastPage = -1;
+  return true;
+}
+
+void dirPagerClose() {
+  if (sPageDir) closedir(sPageDir);
+  if (sScanDir) closedir(sScanDir);
+  sPageDir = sScanDir = nullptr;
+  sPagesKnown = 0;
+}
+
+const DirEntry* dirPagerGet(uint32_t idx) {
+  if (!sPageDir) return nullptr;
+  Page* p = loadPage(idx / DIR_PAGE_SIZE);
+  uint8_t i = idx % DIR_PAGE_SIZE;
+  return p && i < p->count ? &p->entries[i] : nullptr;
+}
+
+uint32_t dirPagerCount() {
+  if (sLastPage >= 0) return (uint32_t)sLastPage * DIR_PAGE_SIZE + sLastPageCount;
+  return sCount;
+}
+
+bool dirPagerCountDone() { return sCountDone || sLastPage >= 0; }
+
+void dirPagerStep(uint16_t budget) {
+  if (sCountDone || sLastPage >= 0) return;
+  struct dirent* d;
+  while (budget--) {
+    if (!(d = readdir(sScanDir))) {
+      sCountDone = true;
+      sLastPage = sCount / DIR_PAGE_SIZE;
+      sLastPageCount = sCount % DIR_PAGE_SIZE;
+      if (!sLastPageCount && sLastPage) { --sLastPage; sLastPageCount = DIR_PAGE_SIZE; }
+      closedir(sScanDir);
+      sScanDir = nullptr;
+      return;
+    }
+    if (!listable(d)) continue;
+    if (++sCount % DIR_PAGE_SIZE == 0) rememberPage(sCount / DIR_PAGE_SIZE, telldir(sScanDir));
+  }
+}
@@ -0,0 +1,27 @@
+#pragma once
+#include <Arduino.h>
+
+// Windowed directory listing for huge folders.
+//
+// Entries are read straight from the VFS (opendir/readdir, no String or File
+// per entry) one page at a time; only two pages live in RAM. Each page is
+// sorted on its own when it's loaded (folders first, then by name), so the
+// first screen costs one page of reads no matter how large the directory is.
+// Page start positions are remembered with telldir() as they are discovered,
+// and the total count is filled in incrementally by dirPagerStep().
+
+static constexpr uint8_t  DIR_PAGE_SIZE = 32;
+static constexpr uint8_t  DIR_NAME_LEN  = 40;
+static constexpr uint16_t DIR_MAX_PAGES = 256;    // seek table; later pages are reached by skipping
+
+struct DirEntry {
+  char name[DIR_NAME_LEN];                       // folders carry a trailing '/'
+  bool dir;
+};
+
+bool            dirPagerOpen(const char* vfsPath);   // e.g. "/sd/captures", "/littlefs"
+void            dirPagerClose();
+const DirEntry* dirPagerGet(uint32_t idx);           // nullptr past the end
+uint32_t        dirPagerCount();                     // entries known so far
+bool            dirPagerCountDone();
+void            dirPagerStep(uint16_t budget);       // count up to `budget` more entries
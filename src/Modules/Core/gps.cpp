@@ -0,0 +1,175 @@
+#include "gps.h"
+#include "nmea.h"
+#include "profile.h"
+#include <driver/uart.h>
+
+#if defined(M5CARDPUTER)
+  #ifndef GPS_RX_PIN
+    #define GPS_RX_PIN 1
+  #endif
+  #ifndef GPS_TX_PIN
+    #define GPS_TX_PIN 2
+  #endif
+#elif defined(LILYGO_CC1101)
+  // Qwiic header. GPIO43/44 are the UART0 console on this env.
+  #ifndef GPS_RX_PIN
+    #define GPS_RX_PIN 8
+  #endif
+  #ifndef GPS_TX_PIN
+    #define GPS_TX_PIN 18
+  #endif
+#else
+  #ifndef GPS_RX_PIN
+    #define GPS_RX_PIN 33
+  #endif
+  #ifndef GPS_TX_PIN
+    #define GPS_TX_PIN 32
+  #endif
+#endif
+
+static constexpr uart_port_t kPort       = UART_NUM_1;
+static constexpr int         kRxRing     = 2048;      // ≈ 180 ms at 115200
+static constexpr int         kEvents     = 16;
+static constexpr uint32_t    kTaskStack  = 3072;
+static constexpr uint32_t    kPollMs     = 100;       // how fast gpsEnd() is noticed
+static constexpr int32_t     kDefaultBaud = 9600;
+
+static NmeaParser        sParser;
+static QueueHandle_t     sEvents = nullptr;
+static TaskHandle_t      sTask   = nullptr;
+static volatile bool     sRun    = false;
+static volatile uint32_t sBytes  = 0;
+static volatile uint32_t sOverruns = 0;
+
+// Seqlock: odd while the reader task is writing sShared
+static GpsFix            sShared = {};
+static volatile uint32_t sSeq    = 0;
+
+// ─────────────────────────────────────────────────────────────────────────────
+// Publish / snapshot
+// ─────────────────────────────────────────────────────────────────────────────
+static void publish(const GpsFix& f) {
+  uint32_t s = sSeq;
+  __atomic_store_n(&sSeq, s + 1, __ATOMIC_RELAXED);
+  __atomic_thread_fence(__ATOMIC_RELEASE);
+  memcpy(&sShared, &f, sizeof(f));
+  __atomic_store_n(&sSeq, s + 2, __ATOMIC_RELEASE);
+}
+
+uint32_t gpsSnapshot(GpsFix& out) {
+  uint32_t s1, s2;
+  do {
+    s1 = __atomic_load_n(&sSeq, __ATOMIC_ACQUIRE);
+    if (s1 & 1) continue;                             // writer mid-copy; it's a few µs
+    memcpy(&out, &sShared, sizeof(out));
+    __atomic_thread_fence(__ATOMIC_ACQUIRE);
+    s2 = __atomic_load_n(&sSeq, __ATOMIC_RELAXED);
+  } while ((s1 & 1) || s1 != s2);
+  return s1 / 2;
+}
+
+// ─────────────────────────────────────────────────────────────────────────────
+// Reader task
+// ─────────────────────────────────────────────────────────────────────────────
+static void readerTask(void*) {
+  char buf[256];
+  uart_event_t ev;
+  while (sRun) {
+    if (xQueueReceive(sEvents, &ev, pdMS_TO_TICKS(kPollMs)) != pdTRUE) continue;
+    switch (ev.type) {
+      case UART_DATA: {
+        size_t left = ev.size;
+        size_t applied = 0;
+        while (left) {
+          int n = uart_read_bytes(kPort, (uint8_t*)buf, min(left, sizeof(buf)), 0);
+          if (n <= 0) break;
+          sBytes += n;
+          applied += sParser.feed(buf, n);
+          left -= n;
+        }
+        if (applied) {
+          GpsFix f = sParser.fix();
+          f.stampMs = millis();
+          publish(f);
+        }
+        break;
+      }
+      case UART_FIFO_OVF:
+      case UART_BUFFER_FULL:
+        sOverruns++;
+        uart_flush_input(kPort);
+        xQueueReset(sEvents);
+        break;
+      default:
+        break;
+    }
+  }
+  sTask = nullptr;
+  vTaskDelete(nullptr);
+}
+
+// ─────────────────────────────────────────────────────────────────────────────
+// Public API
+// ─────────────────────────────────────────────────────────────────────────────
+// On the ESP32-S3 the serial console is UART0 on GPIO43/44 unless USB CDC
+// carries it; a receiver there would fight the console.
+static bool consolePin(int pin) {
+#if CONFIG_IDF_TARGET_ESP32S3 && !ARDUINO_USB_CDC_ON_BOOT
+  return pin == 43 || pin == 44;
+#else
+  return false;
+#endif
+}
+
+bool gpsBegin() {
+  if (sTask) return true;
+  if (consolePin(GPS_RX_PIN) || consolePin(GPS_TX_PIN)) {
+    Serial.println("[gps] GPS_RX_PIN/GPS_TX_PIN overlap the serial console");
+    return false;
+  }
+  uart_config_t cfg = {};
+  cfg.baud_rate  = profileParam(ProfileParam::GPS_BAUD, kDefaultBaud);
+  cfg.data_bits  = UART_DATA_8_BITS;
+  cfg.parity     = UART_PARITY_DISABLE;
+  cfg.stop_bits  = UART_STOP_BITS_1;
+  cfg.flow_ctrl  = UART_HW_FLOWCTRL_DISABLE;
+  cfg.source_clk = UART_SCLK_APB;
+  if (uart_driver_install(kPort, kRxRing, 0, kEvents, &sEvents, 0) != ESP_OK) return false;
+  if (uart_param_config(kPort, &cfg) != ESP_OK ||
+      uart_set_pin(kPort, GPS_TX_PIN, GPS_RX_PIN, UART_PIN_NO_CHANGE, UART_PIN_NO_CHANGE) != ESP_OK) {
+    uart_driver_delete(kPort);
+    return false;
+  }
+
+  sParser.reset();
+  sBytes = sOverruns = 0;
+  sRun = true;
+  if (xTaskCreatePinnedToCore(readerTask, "gps", kTaskStack, nullptr, 2, &sTask, 0) != pdPASS) {
+    sRun  = false;
+    sTask = nullptr;
+    uart_driver_delete(kPort);
+    return false;
+  }
+  return true;
+}
+
+void gpsEnd() {
+  if (!sTask) return;
+  sRun = false;
+  while (sTask) vTaskDelay(pdMS_TO_TICKS(10));
+  uart_driver_delete(kPort);
+  sEvents = nullptr;
+}
+
+GpsStats gpsStats() {
+  const NmeaStats& p = sParser.stats();
+  GpsStats s = {};
+  s.running        = sTask != nullptr;
+  s.bytes          = sBytes;
+  s.sentences      = p.sentences;
+  s.ignored        = p.ignored;
+  s.checksumErrors = p.checksumErrors;
+  s.malformed      = p.malformed;
+  s.overruns       = sOverruns;
+  return s;
+}
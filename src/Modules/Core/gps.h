@@ -0,0 +1,31 @@
+#pragma once
+#include <Arduino.h>
+#include "gps_fix.h"
+
+// GPS receiver service. The IDF UART driver collects bytes into its RX ring
+// buffer and posts events; a reader task on core 0 drains each event's bytes
+// in one read and feeds them through the NMEA parser (Core/nmea). After
+// every batch that applied a sentence the fix is published into a seqlock
+// slot, so any task can take a consistent snapshot without locks and
+// without ever blocking the reader.
+//
+// Pins default to each board's Grove (Qwiic on the lilygo-cc1101) port;
+// override with -DGPS_RX_PIN / -DGPS_TX_PIN. Pins shared with the UART0
+// console (GPIO43/44 on an S3 without USB CDC) are refused by gpsBegin().
+// The baud rate is the profile parameter "gps_baud" (9600 unless set; 10 Hz
+// receivers usually want 115200).
+
+struct GpsStats {
+  bool     running;
+  uint32_t bytes;
+  uint32_t sentences;       // applied (GGA, RMC, GSA)
+  uint32_t ignored;         // valid sentences of other types
+  uint32_t checksumErrors;
+  uint32_t malformed;
+  uint32_t overruns;        // FIFO or ring buffer overflowed; input was flushed
+};
+
+bool     gpsBegin();                  // idempotent
+void     gpsEnd();
+uint32_t gpsSnapshot(GpsFix& out);    // fixes published so far, 0 = none yet (out untouched)
+GpsStats gpsStats();
@@ -0,0 +1,24 @@
+#pragma once
+#include <stdint.h>
+
+// One position fix as consumers see it. Fixed point throughout so it can be
+// copied, compared and logged without floats or formatting surprises.
+
+struct GpsFix {
+  bool     valid;           // position usable (RMC status A or GGA quality > 0)
+  uint8_t  quality;         // GGA fix quality, 0 = none
+  uint8_t  mode;            // GSA: 1 = none, 2 = 2D, 3 = 3D
+  uint8_t  sats;            // used in the solution
+  int32_t  latE7;           // degrees × 1e7, north positive
+  int32_t  lonE7;           // degrees × 1e7, east positive
+  int32_t  altCm;           // above mean sea level
+  uint16_t hdopX100;
+  uint16_t pdopX100;
+  uint16_t vdopX100;
+  uint32_t speedCmS;        // over ground
+  uint16_t courseX100;      // degrees true
+  uint16_t year;            // UTC date and time of the fix
+  uint8_t  month, day, hour, minute, second;
+  uint16_t millis;
+  uint32_t stampMs;         // millis() when the fix was published
+};
@@ -0,0 +1,514 @@
+#include "http_files.h"
+#include <sys/socket.h>
+#include <sys/select.h>
+#include <sys/stat.h>
+#include <netinet/in.h>
+#include <dirent.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <errno.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <strings.h>
+#include <ctype.h>
+#include <time.h>
+
+#ifndef MSG_NOSIGNAL
+  #define MSG_NOSIGNAL 0
+#endif
+
+static constexpr uint8_t  kMaxRoots   = 4;
+static constexpr uint16_t kUrlLen     = 192;
+static constexpr uint16_t kPathLen    = 256;
+static constexpr uint8_t  kChunkHead  = 6;      // "XXXX\r\n"
+static constexpr uint8_t  kChunkTail  = 2;      // "\r\n"
+
+enum class ConnState : uint8_t { FREE, REQUEST, SEND };
+enum class Body      : uint8_t { NONE, FILE_DATA, DIR_LIST, ROOT_LIST };
+
+struct Conn {
+  int       fd;
+  ConnState state;
+  Body      body;
+  char*     buf;                 // HTTP_CHUNK bytes
+  uint16_t  len, off;            // pending bytes are buf[off, len)
+  FILE*     file;
+  uint64_t  remaining;           // file bytes still to read
+  DIR*      dir;
+  uint8_t   rootIdx;             // ROOT_LIST progress
+  bool      started;             // listing header sent
+  bool      lastChunk;           // chunked terminator queued
+  char      url[kUrlLen];        // raw request path, for listing links
+  uint32_t  lastMs;
+};
+
+static int            sListen = -1;
+static uint16_t       sPort = 0;
+static HttpRoot       sRoots[kMaxRoots];
+static uint8_t        sRootCount = 0;
+static Conn           sConns[HTTP_MAX_CLIENTS];
+static HttpFilesStats sStats;
+
+static uint32_t nowMs() {
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return (uint32_t)(ts.tv_sec * 1000u + ts.tv_nsec / 1000000u);
+}
+
+// ─────────────────────────────────────────────────────────────────────────────
+// Connections
+// ─────────────────────────────────────────────────────────────────────────────
+static void closeConn(Conn& c) {
+  if (c.file) fclose(c.file);
+  if (c.dir)  closedir(c.dir);
+  if (c.fd >= 0) close(c.fd);
+  free(c.buf);
+  memset(&c, 0, sizeof(c));
+  c.fd = -1;
+  c.state = ConnState::FREE;
+}
+
+static void setNonBlocking(int fd) {
+  fcntl(fd, F_SETFL, fcntl(fd, F_GETFL, 0) | O_NONBLOCK);
+}
+
+static void acceptClients() {
+  for (;;) {
+    int fd = accept(sListen, nullptr, nullptr);
+    if (fd < 0) return;
+    Conn* c = nullptr;
+    for (Conn& k : sConns) if (k.state == ConnState::FREE) { c = &k; break; }
+    char* buf = c ? (char*)malloc(HTTP_CHUNK) : nullptr;
+    if (!buf) {
+      static const char busy[] = "HTTP/1.1 503 Service Unavailable\r\nContent-Length: 0\r\nConnection: close\r\n\r\n";
+      send(fd, busy, sizeof(busy) - 1, MSG_NOSIGNAL);
+      close(fd);
+      sStats.errors++;
+      continue;
+    }
+    setNonBlocking(fd);
+    memset(c, 0, sizeof(*c));
+    c->fd = fd;
+    c->buf = buf;
+    c->state = ConnState::REQUEST;
+    c->lastMs = nowMs();
+  }
+}
+
+// ─────────────────────────────────────────────────────────────────────────────
+// Helpers
+// ─────────────────────────────────────────────────────────────────────────────
+static bool urlDecode(const char* in, size_t n, char* out, size_t cap) {
+  size_t o = 0;
+  for (size_t i = 0; i < n; ++i) {
+    char ch = in[i];
+    if (ch == '%' && i + 2 < n) {
+      char hex[3] = { in[i + 1], in[i + 2], 0 };
+      ch = (char)strtol(hex, nullptr, 16);
+      i += 2;
+    } else if (ch == '+') {
+      ch = ' ';
+    }
+    if (!ch || o + 1 >= cap) return false;
+    out[o++] = ch;
+  }
+  out[o] = '\0';
+  return true;
+}
+
+static size_t urlEncode(const char* in, char* out, size_t cap) {
+  static const char hex[] = "0123456789ABCDEF";
+  size_t o = 0;
+  for (; *in && o + 4 < cap; ++in) {
+    unsigned char ch = (unsigned char)*in;
+    if (isalnum(ch) || strchr("-_.~/", ch)) {
+      out[o++] = ch;
+    } else {
+      out[o++] = '%';
+      out[o++] = hex[ch >> 4];
+      out[o++] = hex[ch & 15];
+    }
+  }
+  out[o] = '\0';
+  return o;
+}
+
+static size_t htmlEscape(const char* in, char* out, size_t cap) {
+  size_t o = 0;
+  for (; *in && o + 6 < cap; ++in) {
+    switch (*in) {
+      case '&': memcpy(out + o, "&amp;", 5); o += 5; break;
+      case '<': memcpy(out + o, "&lt;", 4);  o += 4; break;
+      case '>': memcpy(out + o, "&gt;", 4);  o += 4; break;
+      case '"': memcpy(out + o, "&quot;", 6); o += 6; break;
+      default:  out[o++] = *in; break;
+    }
+  }
+  out[o] = '\0';
+  return o;
+}
+
+static const char* contentType(const char* path) {
+  const char* dot = strrchr(path, '.');
+  if (!dot) return "application/octet-stream";
+  if (!strcasecmp(dot, ".html") || !strcasecmp(dot, ".htm")) return "text/html";
+  if (!strcasecmp(dot, ".json")) return "application/json";
+  if (!strcasecmp(dot, ".pcap")) return "application/vnd.tcpdump.pcap";
+  if (!strcasecmp(dot, ".txt") || !strcasecmp(dot, ".log") || !strcasecmp(dot, ".csv") ||
+      !strcasecmp(dot, ".ir")  || !strcasecmp(dot, ".sub")) return "text/plain";
+  return "application/octet-stream";
+}
+
+// Map a decoded URL path onto a VFS path; false for unknown roots or "..".
+static int mapPath(const char* urlPath, char* out, size_t cap) {
+  if (strstr(urlPath, "..")) return -1;
+  for (uint8_t i = 0; i < sRootCount; ++i) {
+    size_t n = strlen(sRoots[i].urlPrefix);
+    if (strncmp(urlPath, sRoots[i].urlPrefix, n) != 0) continue;
+    if (urlPath[n] != '\0' && urlPath[n] != '/') continue;
+    if (snprintf(out, cap, "%s%s", sRoots[i].fsPath, urlPath + n) >= (int)cap) return -1;
+    size_t len = strlen(out);
+    while (len > 1 && out[len - 1] == '/') out[--len] = '\0';
+    return i;
+  }
+  return -1;
+}
+
+// "bytes=a-b" / "bytes=a-" / "bytes=-n"; false if absent or not a single range
+static bool parseRange(const char* v, uint64_t size, uint64_t& first, uint64_t& last, bool& satisfiable) {
+  satisfiable = true;
+  if (strncasecmp(v, "bytes=", 6) != 0 || strchr(v, ',')) return false;
+  v += 6;
+  char* end;
+  if (*v == '-') {
+    uint64_t n = strtoull(v + 1, &end, 10);
+    if (end == v + 1) return false;
+    if (!n || !size) { satisfiable = false; return true; }
+    first = n >= size ? 0 : size - n;
+    last  = size - 1;
+    return true;
+  }
+  first = strtoull(v, &end, 10);
+  if (end == v || *end != '-') return false;
+  const char* b = end + 1;
+  last = (*b >= '0' && *b <= '9') ? strtoull(b, nullptr, 10) : size - 1;
+  if (first >= size || last < first) { satisfiable = false; return true; }
+  if (last >= size) last = size - 1;
+  return true;
+}
+
+static void respondStatus(Conn& c, int code, const char* reason, const char* extra = "") {
+  c.len = c.off = 0;
+  c.len = snprintf(c.buf, HTTP_CHUNK,
+                   "HTTP/1.1 %d %s\r\nContent-Length: 0\r\n%sConnection: close\r\n\r\n",
+                   code, reason, extra);
+  c.body  = Body::NONE;
+  c.state = ConnState::SEND;
+  if (code >= 400) sStats.errors++;
+}
+
+// ─────────────────────────────────────────────────────────────────────────────
+// Request handling
+// ─────────────────────────────────────────────────────────────────────────────
+static const char* findHeader(const char* req, const char* name) {
+  size_t n = strlen(name);
+  for (const char* p = strstr(req, "\r\n"); p; p = strstr(p + 2, "\r\n")) {
+    if (!strncasecmp(p + 2, name, n) && p[2 + n] == ':') {
+      const char* v = p + 3 + n;
+      while (*v == ' ') ++v;
+      return v;
+    }
+  }
+  return nullptr;
+}
+
+static void startListing(Conn& c, bool head, Body body) {
+  c.len = c.off = 0;
+  c.len = snprintf(c.buf, HTTP_CHUNK,
+                   "HTTP/1.1 200 OK\r\nContent-Type: text/html; charset=utf-8\r\n"
+                   "Transfer-Encoding: chunked\r\nConnection: close\r\n\r\n");
+  c.body  = head ? Body::NONE : body;
+  c.state = ConnState::SEND;
+  if (head && c.dir) { closedir(c.dir); c.dir = nullptr; }
+}
+
+static void handleRequest(Conn& c) {
+  sStats.requests++;
+  char* req = c.buf;
+  char* sp1 = strchr(req, ' ');
+  char* sp2 = sp1 ? strchr(sp1 + 1, ' ') : nullptr;
+  if (!sp1 || !sp2) { respondStatus(c, 400, "Bad Request"); return; }
+
+  bool head = (size_t)(sp1 - req) == 4 && !strncmp(req, "HEAD", 4);
+  bool get  = (size_t)(sp1 - req) == 3 && !strncmp(req, "GET", 3);
+  if (!head && !get) { respondStatus(c, 405, "Method Not Allowed", "Allow: GET, HEAD\r\n"); return; }
+
+  const char* rawPath = sp1 + 1;
+  size_t rawLen = sp2 - rawPath;
+  if (const char* q = (const char*)memchr(rawPath, '?', rawLen)) rawLen = q - rawPath;
+  if (rawLen >= sizeof(c.url)) { respondStatus(c, 414, "URI Too Long"); return; }
+  memcpy(c.url, rawPath, rawLen);
+  c.url[rawLen] = '\0';
+
+  char urlPath[kUrlLen];
+  if (!urlDecode(rawPath, rawLen, urlPath, sizeof(urlPath))) { respondStatus(c, 400, "Bad Request"); return; }
+
+  if (!strcmp(urlPath, "/")) { startListing(c, head, Body::ROOT_LIST); return; }
+
+  char path[kPathLen];
+  if (mapPath(urlPath, path, sizeof(path)) < 0) { respondStatus(c, 404, "Not Found"); return; }
+
+  struct stat st;
+  if (stat(path, &st) != 0) {
+    // Mount points don't always stat; try them as folders
+    if (!(c.dir = opendir(path))) { respondStatus(c, 404, "Not Found"); return; }
+    startListing(c, head, Body::DIR_LIST);
+    return;
+  }
+  if (S_ISDIR(st.st_mode)) {
+    if (!(c.dir = opendir(path))) { respondStatus(c, 404, "Not Found"); return; }
+    startListing(c, head, Body::DIR_LIST);
+    return;
+  }
+
+  uint64_t size  = (uint64_t)st.st_size;
+  uint64_t first = 0, last = size ? size - 1 : 0;
+  bool partial = false, ok = true;
+  // Keep a private copy: the header value lives in c.buf, which is about to be reused
+  if (const char* r = findHeader(req, "Range")) {
+    char range[64];
+    size_t n = strcspn(r, "\r\n");
+    n = n < sizeof(range) - 1 ? n : sizeof(range) - 1;
+    memcpy(range, r, n);
+    range[n] = '\0';
+    partial = parseRange(range, size, first, last, ok);
+  }
+  if (partial && !ok) {
+    char extra[48];
+    snprintf(extra, sizeof(extra), "Content-Range: bytes */%llu\r\n", (unsigned long long)size);
+    respondStatus(c, 416, "Range Not Satisfiable", extra);
+    return;
+  }
+
+  c.file = fopen(path, "rb");
+  if (!c.file) { respondStatus(c, 403, "Forbidden"); return; }
+  setvbuf(c.file, nullptr, _IONBF, 0);            // fread straight into c.buf
+  if (first && fseek(c.file, (long)first, SEEK_SET) != 0) { respondStatus(c, 500, "Internal Server Error"); return; }
+
+  c.remaining = size ? last - first + 1 : 0;
+  c.off = 0;
+  int n = snprintf(c.buf, HTTP_CHUNK, "HTTP/1.1 %s\r\nContent-Type: %s\r\nContent-Length: %llu\r\n"
+                   "Accept-Ranges: bytes\r\n", partial ? "206 Partial Content" : "200 OK",
+                   contentType(path), (unsigned long long)c.remaining);
+  if (partial) {
+    n += snprintf(c.buf + n, HTTP_CHUNK - n, "Content-Range: bytes %llu-%llu/%llu\r\n",
+                  (unsigned long long)first, (unsigned long long)last, (unsigned long long)size);
+  }
+  n += snprintf(c.buf + n, HTTP_CHUNK - n, "Connection: close\r\n\r\n");
+  c.len = n;
+  c.body = head ? Body::NONE : Body::FILE_DATA;
+  c.state = ConnState::SEND;
+}
+
+static void readRequest(Conn& c) {
+  for (;;) {
+    ssize_t n = recv(c.fd, c.buf + c.len, HTTP_CHUNK - 1 - c.len, 0);
+    if (n == 0 || (n < 0 && errno != EAGAIN && errno != EWOULDBLOCK)) { closeConn(c); return; }
+    if (n < 0) return;
+    c.len += n;
+    c.lastMs = nowMs();
+    c.buf[c.len] = '\0';
+    if (strstr(c.buf, "\r\n\r\n")) { handleRequest(c); return; }
+    if (c.len >= HTTP_CHUNK - 1) { respondStatus(c, 431, "Request Header Fields Too Large"); return; }
+  }
+}
+
+// ─────────────────────────────────────────────────────────────────────────────
+// Body producers: refill c.buf once everything queued has been sent
+// ─────────────────────────────────────────────────────────────────────────────
+// Wrap buf[kChunkHead, kChunkHead + n) as one HTTP chunk.
+static void frameChunk(Conn& c, size_t n) {
+  char head[kChunkHead + 1];
+  snprintf(head, sizeof(head), "%04X\r\n", (unsigned)n);
+  memcpy(c.buf, head, kChunkHead);
+  memcpy(c.buf + kChunkHead + n, "\r\n", kChunkTail);
+  c.len = kChunkHead + n + kChunkTail;
+}
+
+static bool appendLink(Conn& c, size_t& n, const char* href, const char* label, bool dir) {
+  char enc[kPathLen * 3], esc[kPathLen * 2];
+  urlEncode(href, enc, sizeof(enc));
+  htmlEscape(label, esc, sizeof(esc));
+  size_t cap = HTTP_CHUNK - kChunkHead - kChunkTail;
+  int w = snprintf(c.buf + kChunkHead + n, cap - n, "<li><a href=\"%s%s\">%s%s</a></li>\n",
+                   enc, dir ? "/" : "", esc, dir ? "/" : "");
+  if (w < 0 || n + w >= cap) return false;
+  n += w;
+  return true;
+}
+
+static void refillListing(Conn& c) {
+  if (c.lastChunk) { c.body = Body::NONE; return; }
+  const size_t cap = HTTP_CHUNK - kChunkHead - kChunkTail;
+  size_t n = 0;
+
+  // Links are absolute: decoded request path + entry name, re-encoded
+  char base[kUrlLen];
+  size_t bl = strlen(c.url);
+  while (bl > 1 && c.url[bl - 1] == '/') --bl;
+  if (!urlDecode(c.url, bl, base, sizeof(base))) base[0] = '\0';
+
+  if (!c.started) {
+    char esc[kUrlLen * 2];
+    htmlEscape(base, esc, sizeof(esc));
+    n = snprintf(c.buf + kChunkHead, cap, "<!DOCTYPE html><html><body><h3>%s</h3><ul>\n", esc);
+    if (c.body == Body::DIR_LIST) {
+      char parent[kUrlLen];
+      strcpy(parent, base);
+      char* slash = strrchr(parent, '/');
+      if (slash && slash != parent) *slash = '\0';
+      else strcpy(parent, "/");
+      appendLink(c, n, parent, "..", false);
+    }
+    c.started = true;
+  }
+
+  if (c.body == Body::ROOT_LIST) {
+    while (c.rootIdx < sRootCount &&
+           appendLink(c, n, sRoots[c.rootIdx].urlPrefix, sRoots[c.rootIdx].urlPrefix + 1, true)) c.rootIdx++;
+    if (c.rootIdx < sRootCount) { frameChunk(c, n); return; }
+  } else if (c.dir) {
+    for (;;) {
+      long pos = telldir(c.dir);
+      struct dirent* d = readdir(c.dir);
+      if (!d) break;
+      if (d->d_name[0] == '.') continue;
+      char href[kPathLen + kUrlLen];
+      snprintf(href, sizeof(href), "%s/%s", base, d->d_name);
+      if (!appendLink(c, n, href, d->d_name, d->d_type == DT_DIR)) {
+        seekdir(c.dir, pos);                       // retry in the next chunk
+        frameChunk(c, n);
+        return;
+      }
+    }
+    closedir(c.dir);
+    c.dir = nullptr;
+  }
+
+  n += snprintf(c.buf + kChunkHead + n, cap - n, "</ul></body></html>\n");
+  frameChunk(c, n);
+  memcpy(c.buf + c.len, "0\r\n\r\n", 5);        // terminating chunk
+  c.len += 5;
+  c.lastChunk = true;
+}
+
+static void refill(Conn& c) {
+  c.off = c.len = 0;
+  switch (c.body) {
+    case Body::FILE_DATA: {
+      size_t want = c.remaining < HTTP_CHUNK ? (size_t)c.remaining : HTTP_CHUNK;
+      size_t n = want ? fread(c.buf, 1, want, c.file) : 0;
+      c.len = n;
+      c.remaining -= n;
+      if (!n || !c.remaining) c.body = Body::NONE;  // short read ends the transfer
+      break;
+    }
+    case Body::DIR_LIST:
+    case Body::ROOT_LIST:
+      refillListing(c);
+      break;
+    case Body::NONE:
+      break;
+  }
+}
+
+static void pumpSend(Conn& c) {
+  for (;;) {
+    if (c.off == c.len) {
+      if (c.body == Body::NONE) { closeConn(c); return; }
+      refill(c);
+      if (c.off == c.len) continue;
+    }
+    ssize_t n = send(c.fd, c.buf + c.off, c.len - c.off, MSG_DONTWAIT | MSG_NOSIGNAL);
+    if (n < 0) {
+      if (errno == EAGAIN || errno == EWOULDBLOCK) return;   // window full
+      sStats.errors++;
+      closeConn(c);
+      return;
+    }
+    c.off += n;
+    c.lastMs = nowMs();
+    sStats.bytesSent += n;
+  }
+}
+
+// ─────────────────────────────────────────────────────────────────────────────
+// Public API
+// ─────────────────────────────────────────────────────────────────────────────
+bool httpFilesStart(uint16_t port, const HttpRoot* roots, uint8_t count) {
+  httpFilesStop();
+  sRootCount = count < kMaxRoots ? count : kMaxRoots;
+  memcpy(sRoots, roots, sRootCount * sizeof(HttpRoot));
+  for (Conn& c : sConns) { memset(&c, 0, sizeof(c)); c.fd = -1; }
+  memset(&sStats, 0, sizeof(sStats));
+
+  sListen = socket(AF_INET, SOCK_STREAM, 0);
+  if (sListen < 0) return false;
+  int one = 1;
+  setsockopt(sListen, SOL_SOCKET, SO_REUSEADDR, &one, sizeof(one));
+  struct sockaddr_in addr = {};
+  addr.sin_family = AF_INET;
+  addr.sin_port = htons(port);
+  addr.sin_addr.s_addr = htonl(INADDR_ANY);
+  if (bind(sListen, (struct sockaddr*)&addr, sizeof(addr)) != 0 || listen(sListen, HTTP_MAX_CLIENTS) != 0) {
+    close(sListen);
+    sListen = -1;
+    return false;
+  }
+  setNonBlocking(sListen);
+  socklen_t len = sizeof(addr);
+  getsockname(sListen, (struct sockaddr*)&addr, &len);
+  sPort = ntohs(addr.sin_port);
+  return true;
+}
+
+void httpFilesPoll(uint32_t timeoutMs) {
+  if (sListen < 0) return;
+  fd_set rd, wr;
+  FD_ZERO(&rd);
+  FD_ZERO(&wr);
+  FD_SET(sListen, &rd);
+  int maxFd = sListen;
+  for (Conn& c : sConns) {
+    if (c.state == ConnState::FREE) continue;
+    FD_SET(c.fd, c.state == ConnState::REQUEST ? &rd : &wr);
+    if (c.fd > maxFd) maxFd = c.fd;
+  }
+  struct timeval tv = { (long)(timeoutMs / 1000), (long)(timeoutMs % 1000) * 1000 };
+  if (select(maxFd + 1, &rd, &wr, nullptr, &tv) < 0) return;
+
+  if (FD_ISSET(sListen, &rd)) acceptClients();
+  for (Conn& c : sConns) {
+    if (c.state == ConnState::FREE) continue;
+    if (c.state == ConnState::REQUEST && FD_ISSET(c.fd, &rd)) readRequest(c);
+    if (c.state == ConnState::SEND) pumpSend(c);
+    if (c.state != ConnState::FREE && nowMs() - c.lastMs > HTTP_IDLE_MS) { sStats.errors++; closeConn(c); }
+  }
+}
+
+void httpFilesStop() {
+  for (Conn& c : sConns) if (c.state != ConnState::FREE) closeConn(c);
+  if (sListen >= 0) close(sListen);
+  sListen = -1;
+  sPort = 0;
+}
+
+uint16_t httpFilesPort() { return sPort; }
+
+HttpFilesStats httpFilesStats() {
+  HttpFilesStats s = sStats;
+  s.clients = 0;
+  for (const Conn& c : sConns) if (c.state != ConnState::FREE) s.clients++;
+  return s;
+}
@@ -0,0 +1,37 @@
+#pragma once
+#include <stdint.h>
+#include <stddef.h>
+
+// Small HTTP/1.1 file server on plain BSD sockets (lwIP on the device, POSIX
+// on a host build, so it can be driven by a loopback client).
+//
+// GET/HEAD only. Each client owns one HTTP_CHUNK buffer: file bytes are
+// fread() into it and handed to send() as the TCP window allows, so a
+// download never holds more than one chunk in RAM and never builds a String.
+// Up to HTTP_MAX_CLIENTS transfers are interleaved; single byte ranges
+// (Range: bytes=a-b, a-, -n) are answered with 206 for resuming. Folders are
+// listed as HTML, streamed with chunked transfer encoding.
+
+#ifndef HTTP_CHUNK
+  #define HTTP_CHUNK 4096
+#endif
+static constexpr uint8_t  HTTP_MAX_CLIENTS = 4;
+static constexpr uint32_t HTTP_IDLE_MS     = 15000;
+
+struct HttpRoot {
+  const char* urlPrefix;      // "/sd"
+  const char* fsPath;         // VFS path it maps to
+};
+
+struct HttpFilesStats {
+  uint8_t  clients;
+  uint32_t requests;
+  uint64_t bytesSent;
+  uint32_t errors;            // 4xx/5xx answers and broken connections
+};
+
+bool           httpFilesStart(uint16_t port, const HttpRoot* roots, uint8_t count);   // port 0 = any
+void           httpFilesPoll(uint32_t timeoutMs);      // select() + pump every client
+void           httpFilesStop();
+uint16_t       httpFilesPort();
+HttpFilesStats httpFilesStats();
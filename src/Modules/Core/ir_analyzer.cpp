@@ -0,0 +1,194 @@
+#include "ir_analyzer.h"
+
+static constexpr uint16_t kTickUs      = 50;     // IRremote MICROS_PER_TICK
+static constexpr uint8_t  kMaxClusters = 4;
+
+struct Cluster { uint16_t centerUs; uint32_t weight; };
+
+static uint16_t   sMarks[IR_AN_BINS];
+static uint16_t   sSpaces[IR_AN_BINS];
+static uint32_t   sMarkUs[IR_AN_BINS];           // per-bin sums → exact centroids
+static uint32_t   sSpaceUs[IR_AN_BINS];
+static uint16_t   sPeak = 0;
+static uint8_t    sLenHist[256];                 // data durations per frame
+static uint32_t   sHdrMarkSum = 0, sHdrSpaceSum = 0;
+static uint16_t   sHdrFrames = 0;
+static uint32_t   sLastDataUs = 0;               // Manchester bit count estimate
+static IrAnalysis sResult;
+
+// ─────────────────────────────────────────────────────────────────────────────
+// Classification (histogram-sized work only)
+// ─────────────────────────────────────────────────────────────────────────────
+static uint8_t findClusters(const uint16_t* hist, const uint32_t* sums, Cluster* out) {
+  uint16_t peak = 0;
+  for (uint8_t i = 0; i < IR_AN_BINS; ++i) peak = max(peak, hist[i]);
+  if (!peak) return 0;
+  const uint16_t floorCount = max<uint16_t>(1, peak / 10);   // ignore stray edges
+
+  uint8_t  n = 0;
+  uint32_t w = 0, acc = 0;
+  for (uint8_t i = 0; i <= IR_AN_BINS; ++i) {
+    bool in = i < IR_AN_BINS && hist[i] >= floorCount;
+    if (in) {
+      w   += hist[i];
+      acc += sums[i];
+    } else if (w) {
+      if (n < kMaxClusters) out[n++] = { (uint16_t)(acc / w), w };
+      w = acc = 0;
+    }
+  }
+  return n;
+}
+
+static bool nearRatio(uint16_t big, uint16_t small, float lo, float hi) {
+  if (!small) return false;
+  float r = float(big) / float(small);
+  return r >= lo && r <= hi;
+}
+
+static void classify() {
+  Cluster mc[kMaxClusters], sc[kMaxClusters];
+  uint8_t nm = findClusters(sMarks, sMarkUs, mc);
+  uint8_t ns = findClusters(sSpaces, sSpaceUs, sc);
+
+  IrAnalysis& r = sResult;
+  r.enc = IrEncoding::UNKNOWN;
+  r.zeroMarkUs = r.zeroSpaceUs = r.oneMarkUs = r.oneSpaceUs = 0;
+  if (!nm || !ns) return;
+  r.unitUs = min(mc[0].centerUs, sc[0].centerUs);
+
+  if (nm == 1 && ns == 2) {
+    r.enc = IrEncoding::PULSE_DISTANCE;
+    r.zeroMarkUs = r.oneMarkUs = mc[0].centerUs;
+    r.zeroSpaceUs = sc[0].centerUs;
+    r.oneSpaceUs  = sc[1].centerUs;
+  } else if (nm == 2 && ns == 1) {
+    r.enc = IrEncoding::PULSE_WIDTH;
+    r.zeroMarkUs = mc[0].centerUs;
+    r.oneMarkUs  = mc[1].centerUs;
+    r.zeroSpaceUs = r.oneSpaceUs = sc[0].centerUs;
+  } else if (nm == 2 && ns == 2 && nearRatio(mc[1].centerUs, mc[0].centerUs, 1.6f, 2.4f)
+                                && nearRatio(sc[1].centerUs, sc[0].centerUs, 1.6f, 2.4f)) {
+    // Bi-phase: every edge is T or 2T, for marks and spaces alike
+    r.enc    = IrEncoding::MANCHESTER;
+    r.unitUs = (mc[0].centerUs + sc[0].centerUs) / 2;
+  }
+
+  // Most common payload length → bit count
+  uint8_t mode = 0;
+  for (uint16_t i = 1; i < 256; ++i) if (sLenHist[i] > sLenHist[mode]) mode = (uint8_t)i;
+  switch (r.enc) {
+    case IrEncoding::PULSE_DISTANCE:          // mark/space per bit + stop mark
+      r.hasStop = mode & 1;
+      r.bits    = mode / 2;
+      break;
+    case IrEncoding::PULSE_WIDTH:             // last bit's space merges into the gap
+      r.hasStop = false;
+      r.bits    = (mode + 1) / 2;
+      break;
+    case IrEncoding::MANCHESTER:
+      r.hasStop = false;
+      r.bits    = r.unitUs ? (uint8_t)min<uint32_t>(255, (sLastDataUs + r.unitUs) / (2 * r.unitUs)) : 0;
+      break;
+    default:
+      r.bits = 0;
+      break;
+  }
+}
+
+// ─────────────────────────────────────────────────────────────────────────────
+// Public API
+// ─────────────────────────────────────────────────────────────────────────────
+void irAnalyzerReset() {
+  memset(sMarks, 0, sizeof(sMarks));
+  memset(sSpaces, 0, sizeof(sSpaces));
+  memset(sMarkUs, 0, sizeof(sMarkUs));
+  memset(sSpaceUs, 0, sizeof(sSpaceUs));
+  memset(sLenHist, 0, sizeof(sLenHist));
+  sPeak = 0;
+  sHdrMarkSum = sHdrSpaceSum = 0;
+  sHdrFrames = 0;
+  sLastDataUs = 0;
+  sResult = IrAnalysis();
+}
+
+void irAnalyzerFeed(const uint16_t* ticks, uint16_t len) {
+  if (len < 5) return;                          // repeat codes carry no bits
+
+  // Header: a leading mark far longer than the first data mark
+  uint16_t start = 1;
+  if (ticks[1] >= ticks[3] * 5 / 2) {
+    sHdrMarkSum  += (uint32_t)ticks[1] * kTickUs;
+    sHdrSpaceSum += (uint32_t)ticks[2] * kTickUs;
+    sHdrFrames++;
+    start = 3;
+  }
+
+  bool     saturated = false;
+  uint32_t dataUs = 0;
+  for (uint16_t i = start; i < len; ++i) {
+    uint32_t us  = (uint32_t)ticks[i] * kTickUs;
+    uint32_t bin = us / IR_AN_BIN_US;
+    dataUs += us;
+    if (bin >= IR_AN_BINS) continue;             // inter-frame gaps / trailers
+    bool mark = ((i - start) & 1) == 0;
+    uint16_t& slot = mark ? sMarks[bin] : sSpaces[bin];
+    (mark ? sMarkUs[bin] : sSpaceUs[bin]) += us;
+    if (++slot == 0xFFFF) saturated = true;
+    sPeak = max(sPeak, slot);
+  }
+  if (saturated) {                              // keep shape, halve scale
+    for (uint8_t i = 0; i < IR_AN_BINS; ++i) {
+      sMarks[i] >>= 1;  sSpaces[i] >>= 1;
+      sMarkUs[i] >>= 1; sSpaceUs[i] >>= 1;
+    }
+    sPeak >>= 1;
+  }
+
+  uint16_t dataLen = min<uint16_t>(len - start, 255);
+  if (sLenHist[dataLen] < 255) sLenHist[dataLen]++;
+  sLastDataUs = dataUs;
+
+  sResult.frames++;
+  sResult.hasHeader = sHdrFrames * 2 > sResult.frames;
+  if (sHdrFrames) {
+    sResult.hdrMarkUs  = sHdrMarkSum / sHdrFrames;
+    sResult.hdrSpaceUs = sHdrSpaceSum / sHdrFrames;
+  }
+  classify();
+}
+
+const uint16_t*   irAnalyzerMarkHist()  { return sMarks; }
+const uint16_t*   irAnalyzerSpaceHist() { return sSpaces; }
+uint16_t          irAnalyzerHistPeak()  { return sPeak; }
+const IrAnalysis& irAnalyzerResult()    { return sResult; }
+
+const char* irEncodingName(IrEncoding enc) {
+  switch (enc) {
+    case IrEncoding::PULSE_DISTANCE: return "Pulse distance";
+    case IrEncoding::PULSE_WIDTH:    return "Pulse width";
+    case IrEncoding::MANCHESTER:     return "Manchester";
+    default:                         return "Unknown";
+  }
+}
+
+size_t irAnalyzerTemplate(char* buf, size_t cap) {
+  const IrAnalysis& r = sResult;
+  int n = 0;
+  switch (r.enc) {
+    case IrEncoding::PULSE_DISTANCE:
+    case IrEncoding::PULSE_WIDTH:
+      n = snprintf(buf, cap,
+        "IrSender.sendPulseDistanceWidth(38, %u, %u, %u, %u, %u, %u, data, %u, PROTOCOL_IS_LSB_FIRST, 0, 0);",
+        r.hasHeader ? r.hdrMarkUs : 0, r.hasHeader ? r.hdrSpaceUs : 0,
+        r.oneMarkUs, r.oneSpaceUs, r.zeroMarkUs, r.zeroSpaceUs, r.bits);
+      break;
+    case IrEncoding::MANCHESTER:
+      n = snprintf(buf, cap, "IrSender.sendBiphaseData(%u, data, %u);", r.unitUs, r.bits);
+      break;
+    default:
+      n = snprintf(buf, cap, "// %u frames, unit ~%u us: no template yet", r.frames, r.unitUs);
+      break;
+  }
+  return n > 0 ? min<size_t>((size_t)n, cap - 1) : 0;
+}
@@ -0,0 +1,34 @@
+#pragma once
+#include <Arduino.h>
+
+// Incremental timing analyzer for IR frames the decoders don't recognise.
+// Each frame is folded into mark/space pulse-width histograms in one pass;
+// classification then only looks at the fixed-size histograms, so the cost
+// per frame stays flat no matter how many frames have been seen.
+
+static constexpr uint8_t  IR_AN_BINS   = 64;
+static constexpr uint16_t IR_AN_BIN_US = 100;       // 0 … 6.4 ms
+
+enum class IrEncoding : uint8_t { UNKNOWN, PULSE_DISTANCE, PULSE_WIDTH, MANCHESTER };
+
+struct IrAnalysis {
+  IrEncoding enc        = IrEncoding::UNKNOWN;
+  uint16_t   unitUs     = 0;
+  bool       hasHeader  = false;
+  uint16_t   hdrMarkUs  = 0;
+  uint16_t   hdrSpaceUs = 0;
+  uint16_t   zeroMarkUs = 0, zeroSpaceUs = 0;
+  uint16_t   oneMarkUs  = 0, oneSpaceUs  = 0;
+  bool       hasStop    = false;
+  uint8_t    bits       = 0;      // most common payload length
+  uint16_t   frames     = 0;
+};
+
+void              irAnalyzerReset();
+void              irAnalyzerFeed(const uint16_t* ticks, uint16_t len);   // IRremote raw (50 µs ticks)
+const uint16_t*   irAnalyzerMarkHist();
+const uint16_t*   irAnalyzerSpaceHist();
+uint16_t          irAnalyzerHistPeak();
+const IrAnalysis& irAnalyzerResult();
+const char*       irEncodingName(IrEncoding enc);
+size_t            irAnalyzerTemplate(char* buf, size_t cap);   // IRremote send call
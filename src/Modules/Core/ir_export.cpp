@@ -0,0 +1,221 @@
+#include "ir_export.h"
+#include "ir_library.h"
+#include <stdarg.h>
+
+// ─────────────────────────────────────────────────────────────────────────────
+// Job state
+// ─────────────────────────────────────────────────────────────────────────────
+enum class Stage : uint8_t { HEADER, ENTRY_BEGIN, ENTRY_DATA, ENTRY_END, FOOTER, DONE };
+
+static constexpr uint16_t kLineCap     = 160;
+static constexpr uint16_t kUnpacedBudget = 512;    // bytes per pump for files
+static constexpr uint32_t kProntoLeadOutUs = 40000;
+
+struct ExportJob {
+  Print*         out    = nullptr;
+  IrExportFormat fmt    = IrExportFormat::FLIPPER;
+  bool           paced  = true;
+  bool           active = false;
+  Stage          stage  = Stage::DONE;
+  uint16_t       cur    = 0;       // library index
+  uint16_t       end    = 0;
+  uint16_t       pos    = 0;       // next duration within the entry
+  bool           rawData = false;  // entry has a data block to terminate
+  uint32_t       bytes  = 0;
+  char           line[kLineCap];
+  uint16_t       lineLen = 0;
+  uint16_t       linePos = 0;
+};
+static ExportJob sJob;
+
+// ─────────────────────────────────────────────────────────────────────────────
+// Line builders (append into sJob.line, never past kLineCap)
+// ─────────────────────────────────────────────────────────────────────────────
+static void add(const char* fmt, ...) {
+  if (sJob.lineLen >= kLineCap - 1) return;
+  va_list ap;
+  va_start(ap, fmt);
+  int n = vsnprintf(sJob.line + sJob.lineLen, kLineCap - sJob.lineLen, fmt, ap);
+  va_end(ap);
+  if (n > 0) sJob.lineLen = min<uint16_t>(sJob.lineLen + n, kLineCap - 1);
+}
+
+// LIRC/Flipper want a frame that ends on a mark; Pronto wants whole pairs.
+static uint16_t exportLen(const IrLibEntry& e) {
+  if (sJob.fmt == IrExportFormat::PRONTO) return e.len;
+  return (e.len % 2 == 0 && e.len) ? e.len - 1 : e.len;
+}
+
+static bool flipperParsed(const IrLibEntry& e, const char*& proto) {
+  if (!e.proto) return false;
+  if (strcmp(e.proto, "NEC") == 0 || strcmp(e.proto, "NEC2") == 0) {
+    proto = e.address > 0xFF ? "NECext" : "NEC";
+    return true;
+  }
+  if (strcmp(e.proto, "Samsung") == 0) { proto = "Samsung32"; return true; }
+  if (strcmp(e.proto, "RC5") == 0)     { proto = "RC5"; return true; }
+  if (strcmp(e.proto, "RC6") == 0)     { proto = "RC6"; return true; }
+  return false;
+}
+
+static void buildHeader() {
+  switch (sJob.fmt) {
+    case IrExportFormat::FLIPPER:
+      add("Filetype: IR signals file\nVersion: 1\n");
+      break;
+    case IrExportFormat::LIRC:
+      add("begin remote\n  name  infiltra\n  flags RAW_CODES\n  eps 30\n  aeps 100\n"
+          "  gap 100000\n  begin raw_codes\n");
+      break;
+    case IrExportFormat::PRONTO:
+      break;
+  }
+}
+
+static void buildEntryBegin(const IrLibEntry& e) {
+  const char* proto = nullptr;
+  switch (sJob.fmt) {
+    case IrExportFormat::FLIPPER:
+      add("#\nname: %s\n", e.name);
+      if (flipperParsed(e, proto)) {
+        // Samsung32 carries an 8-bit address that IRremote reports doubled
+        // (0x0707); Flipper rebuilds the repeated byte itself.
+        uint16_t addr = strcmp(proto, "Samsung32") == 0 ? e.address & 0xFF : e.address;
+        add("type: parsed\nprotocol: %s\naddress: %02X %02X 00 00\ncommand: %02X %02X 00 00\n",
+            proto, addr & 0xFF, addr >> 8, e.command & 0xFF, e.command >> 8);
+        sJob.pos = exportLen(e);                   // no raw data block
+        sJob.rawData = false;
+      } else {
+        add("type: raw\nfrequency: %u\nduty_cycle: 0.330000\ndata:", irLibCarrierKhz(e) * 1000u);
+      }
+      break;
+    case IrExportFormat::LIRC:
+      add("\n    name %s\n", e.name);
+      break;
+    case IrExportFormat::PRONTO: {
+      uint16_t khz   = irLibCarrierKhz(e);
+      uint16_t pairs = (exportLen(e) + 1) / 2;
+      add("# %s\n0000 %04X %04X 0000", e.name, (unsigned)((4145146UL / khz + 500) / 1000), pairs);
+      break;
+    }
+  }
+}
+
+static void buildEntryData(const IrLibEntry& e) {
+  const uint16_t n = exportLen(e);
+  uint8_t col = 0;
+  while (sJob.pos < n && sJob.lineLen < kLineCap - 16) {
+    uint32_t us = irLibDurationUs(e, sJob.pos);
+    switch (sJob.fmt) {
+      case IrExportFormat::FLIPPER: add(" %lu", (unsigned long)us); break;
+      case IrExportFormat::LIRC:
+        add(col == 0 ? "     %7lu" : " %7lu", (unsigned long)us);
+        if (++col == 6 || sJob.pos + 1 == n) { add("\n"); col = 0; sJob.pos++; return; }
+        break;
+      case IrExportFormat::PRONTO:
+        add(" %04X", (unsigned)((us * irLibCarrierKhz(e) + 500) / 1000));
+        break;
+    }
+    sJob.pos++;
+  }
+  // Odd-length capture: close the last Pronto pair with a lead-out space
+  if (sJob.fmt == IrExportFormat::PRONTO && sJob.pos == n && (n & 1) && sJob.lineLen < kLineCap - 8) {
+    add(" %04X", (unsigned)((kProntoLeadOutUs * irLibCarrierKhz(e) + 500) / 1000));
+    sJob.pos++;
+  }
+}
+
+static void buildFooter() {
+  if (sJob.fmt == IrExportFormat::LIRC) add("  end raw_codes\nend remote\n");
+}
+
+// Produce the next line; advances the stage machine. False when finished.
+static bool nextLine() {
+  sJob.lineLen = 0;
+  sJob.linePos = 0;
+  while (sJob.lineLen == 0) {
+    const IrLibEntry* e = irLibGet(sJob.cur);
+    switch (sJob.stage) {
+      case Stage::HEADER:
+        buildHeader();
+        sJob.stage = Stage::ENTRY_BEGIN;
+        break;
+      case Stage::ENTRY_BEGIN:
+        if (!e || sJob.cur >= sJob.end) { sJob.stage = Stage::FOOTER; break; }
+        sJob.pos = 0;
+        sJob.rawData = true;
+        buildEntryBegin(*e);
+        sJob.stage = Stage::ENTRY_DATA;
+        break;
+      case Stage::ENTRY_DATA: {
+        uint16_t n = exportLen(*e) + (sJob.fmt == IrExportFormat::PRONTO && (exportLen(*e) & 1));
+        if (sJob.pos >= n) { sJob.stage = Stage::ENTRY_END; break; }
+        buildEntryData(*e);
+        break;
+      }
+      case Stage::ENTRY_END:
+        if (sJob.fmt != IrExportFormat::LIRC && sJob.rawData) add("\n");
+        sJob.cur++;
+        sJob.stage = Stage::ENTRY_BEGIN;
+        break;
+      case Stage::FOOTER:
+        buildFooter();
+        sJob.stage = Stage::DONE;
+        if (sJob.lineLen == 0) return false;
+        break;
+      case Stage::DONE:
+        return false;
+    }
+  }
+  return true;
+}
+
+// ─────────────────────────────────────────────────────────────────────────────
+// Public API
+// ─────────────────────────────────────────────────────────────────────────────
+bool irExportStart(Print& out, IrExportFormat fmt, bool paced, uint16_t first, uint16_t count) {
+  if (sJob.active) return false;
+  uint16_t total = irLibCount();
+  if (first >= total) return false;
+  sJob.out     = &out;
+  sJob.fmt     = fmt;
+  sJob.paced   = paced;
+  sJob.cur     = first;
+  sJob.end     = (count > total - first) ? total : first + count;
+  sJob.stage   = Stage::HEADER;
+  sJob.bytes   = 0;
+  sJob.lineLen = sJob.linePos = 0;
+  sJob.active  = true;
+  return true;
+}
+
+bool irExportPump() {
+  if (!sJob.active) return false;
+  int budget = sJob.paced ? sJob.out->availableForWrite() : kUnpacedBudget;
+  while (budget > 0) {
+    if (sJob.linePos >= sJob.lineLen && !nextLine()) {
+      sJob.active = false;
+      return false;
+    }
+    size_t chunk = min<size_t>(sJob.lineLen - sJob.linePos, (size_t)budget);
+    size_t wrote = sJob.out->write((const uint8_t*)sJob.line + sJob.linePos, chunk);
+    sJob.linePos += wrote;
+    sJob.bytes   += wrote;
+    budget       -= wrote;
+    if (wrote < chunk) break;        // sink is full; resume next loop
+  }
+  return true;
+}
+
+void irExportCancel()     { sJob.active = false; }
+bool irExportActive()     { return sJob.active; }
+uint32_t irExportBytes()  { return sJob.bytes; }
+
+const char* irExportFormatName(IrExportFormat fmt) {
+  switch (fmt) {
+    case IrExportFormat::PRONTO:  return "Pronto";
+    case IrExportFormat::LIRC:    return "LIRC";
+    case IrExportFormat::FLIPPER: return "Flipper";
+  }
+  return "?";
+}
@@ -0,0 +1,20 @@
+#pragma once
+#include <Arduino.h>
+
+// Streams IR library entries as Pronto hex, LIRC raw_codes or Flipper .ir
+// text to any Print (Serial, fs::File, …). Output is produced line by line
+// from one fixed buffer and handed out in small slices from irExportPump(),
+// so a large library never allocates and never blocks the UI loop.
+
+enum class IrExportFormat : uint8_t { PRONTO, LIRC, FLIPPER };
+
+// paced = respect out.availableForWrite() (UARTs); unpaced sinks get a fixed
+// byte budget per pump instead.
+bool irExportStart(Print& out, IrExportFormat fmt, bool paced,
+                   uint16_t first = 0, uint16_t count = 0xFFFF);
+bool irExportPump();                 // call every loop; false once idle
+void irExportCancel();
+bool irExportActive();
+uint32_t irExportBytes();            // bytes written by the current/last job
+
+const char* irExportFormatName(IrExportFormat fmt);
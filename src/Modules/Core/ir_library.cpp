@@ -0,0 +1,280 @@
+#include "ir_library.h"
+
+// ─────────────────────────────────────────────────────────────────────────────
+// Timing units per decoder protocol (µs). Names match IRremote's
+// getProtocolString(); anything not listed derives its unit from the frame.
+// ─────────────────────────────────────────────────────────────────────────────
+static constexpr uint16_t kTickUs = 50;          // IRremote MICROS_PER_TICK
+
+struct ProtoUnit { const char* name; uint16_t unitUs; };
+static const ProtoUnit kUnits[] = {
+  { "NEC", 560 },  { "NEC2", 560 }, { "Onkyo", 560 }, { "Apple", 560 },
+  { "Samsung", 560 }, { "Samsung48", 560 }, { "SamsungLG", 560 },
+  { "Sony", 600 }, { "RC5", 889 }, { "RC6", 444 }, { "JVC", 526 },
+  { "LG", 500 },   { "LG2", 500 }, { "Panasonic", 432 }, { "Kaseikyo", 432 },
+  { "Denon", 260 }, { "Sharp", 260 }, { "Whynter", 750 },
+};
+
+static constexpr uint16_t kIndexSize = 128;      // power of two, ≥ 2× max codes
+
+static IrLibEntry sEntries[IR_LIB_MAX_CODES];
+static uint16_t   sCount    = 0;
+static uint8_t    sPool[IR_LIB_POOL];
+static uint16_t   sPoolUsed = 0;
+static uint8_t    sIndex[kIndexSize];            // 0 = empty, else entry+1
+static int16_t    sLastIdx  = -1;                // target for repeat frames
+static uint16_t   sRawSeq   = 0;                 // numbering for unnamed codes
+
+// ─────────────────────────────────────────────────────────────────────────────
+// Fingerprinting
+// ─────────────────────────────────────────────────────────────────────────────
+static inline uint32_t fnv1a(uint32_t h, uint8_t b) { return (h ^ b) * 16777619u; }
+
+static inline uint32_t mix32(uint32_t x) {
+  x ^= x >> 16; x *= 0x7feb352du;
+  x ^= x >> 15; x *= 0x846ca68bu;
+  return x ^ (x >> 16);
+}
+
+// A raw code's unit is derived per capture and drifts a few percent between
+// presses, which moves a 16-unit header further than any jitter does. Hash
+// everything longer than kLongUnits as one class and leave those durations
+// to the pool check.
+static constexpr uint8_t kLongUnits = 6;
+
+// One raw duration's contribution; terms are summed, so swapping a single
+// quantized value only needs its old term subtracted and the new one added.
+static inline uint32_t rawTerm(uint16_t pos, uint8_t q) {
+  if (q > kLongUnits) q = kLongUnits + 1;
+  return mix32(((uint32_t)pos << 8 | q) + 0x9E3779B9u);
+}
+
+static uint16_t unitFor(const char* proto, bool decoded, const uint16_t* ticks, uint16_t len) {
+  if (decoded && proto) {
+    for (const auto& u : kUnits) if (strcmp(u.name, proto) == 0) return u.unitUs;
+  }
+  // Unknown: the shortest pulse is one unit for every common IR encoding.
+  // Average the whole shortest cluster so one jittery edge can't shift the grid.
+  uint16_t minTicks = 0xFFFF;
+  for (uint16_t i = 1; i < len; ++i) if (ticks[i] && ticks[i] < minTicks) minTicks = ticks[i];
+  if (minTicks == 0xFFFF) return 500;
+  uint32_t sum = 0, n = 0;
+  const uint16_t limit = minTicks + minTicks / 2;
+  for (uint16_t i = 1; i < len; ++i) if (ticks[i] && ticks[i] <= limit) { sum += ticks[i]; ++n; }
+  return (uint16_t)(sum * kTickUs / n);
+}
+
+static inline uint8_t quantize(uint16_t tick, uint16_t unitUs) {
+  uint32_t q = ((uint32_t)tick * kTickUs + unitUs / 2) / unitUs;
+  if (q < 1)   q = 1;
+  if (q > 255) q = 255;
+  return (uint8_t)q;
+}
+
+// A duration that rounded within a quarter unit of the half-unit boundary,
+// and what re-keying it to the other side adds to the hash.
+struct Flip {
+  uint32_t delta;
+  uint16_t dist;             // µs from the rounding boundary
+};
+
+// Sums the raw terms; keeps the IR_LIB_PROBE_FLIPS durations closest to a
+// rounding boundary in flips[], nearest first.
+static uint32_t rawHash(const uint16_t* ticks, uint16_t len, uint16_t unitUs,
+                        Flip* flips, uint8_t& nFlips) {
+  uint32_t h = mix32((uint32_t)(len ? len - 1 : 0) ^ 2166136261u);
+  nFlips = 0;
+  for (uint16_t i = 1; i < len; ++i) {
+    const uint8_t q = quantize(ticks[i], unitUs);
+    h += rawTerm(i - 1, q);
+    if (!flips) continue;
+
+    const uint32_t us  = (uint32_t)ticks[i] * kTickUs;
+    const uint32_t rem = us % unitUs;
+    const uint16_t dist = rem > unitUs / 2 ? rem - unitUs / 2 : unitUs / 2 - rem;
+    if (dist > unitUs / 4) continue;
+    const int16_t to = rem < unitUs / 2 ? q + 1 : q - 1;
+    if (to < 1 || (to > kLongUnits && q > kLongUnits)) continue;   // same hash class
+
+    uint8_t at = nFlips < IR_LIB_PROBE_FLIPS ? nFlips : IR_LIB_PROBE_FLIPS;
+    while (at > 0 && flips[at - 1].dist > dist) {
+      if (at < IR_LIB_PROBE_FLIPS) flips[at] = flips[at - 1];
+      --at;
+    }
+    if (at >= IR_LIB_PROBE_FLIPS) continue;
+    flips[at] = { rawTerm(i - 1, (uint8_t)to) - rawTerm(i - 1, q), dist };
+    if (nFlips < IR_LIB_PROBE_FLIPS) ++nFlips;
+  }
+  return h;
+}
+
+IrFingerprint irFingerprint(const uint16_t* ticks, uint16_t len, const char* proto,
+                            bool decoded, uint16_t addr, uint16_t cmd) {
+  IrFingerprint fp{ 2166136261u, unitFor(proto, decoded, ticks, len), (uint16_t)(len ? len - 1 : 0) };
+  if (decoded) {
+    // Decoded frames key on (protocol, address, command): toggle bits in
+    // RC5/RC6 would otherwise make every other press look like a new code.
+    for (const char* p = proto; p && *p; ++p) fp.hash = fnv1a(fp.hash, (uint8_t)*p);
+    fp.hash = fnv1a(fp.hash, addr & 0xFF); fp.hash = fnv1a(fp.hash, addr >> 8);
+    fp.hash = fnv1a(fp.hash, cmd & 0xFF);  fp.hash = fnv1a(fp.hash, cmd >> 8);
+    return fp;
+  }
+  uint8_t nFlips;
+  fp.hash = rawHash(ticks, len, fp.unitUs, nullptr, nFlips);
+  return fp;
+}
+
+// ─────────────────────────────────────────────────────────────────────────────
+// Index / naming
+// ─────────────────────────────────────────────────────────────────────────────
+struct Capture {
+  const uint16_t* ticks;
+  uint16_t        len;
+  const char*     proto;
+  bool            decoded;
+  uint16_t        addr;
+  uint16_t        cmd;
+};
+
+// Raw codes are compared in µs so captures whose derived unit differs
+// slightly still line up; a duration may be off by IR_LIB_TOL_PCT of the
+// stored value or half a unit, whichever is larger.
+static bool rawClose(const IrLibEntry& e, const uint16_t* ticks) {
+  const uint32_t halfUnit = e.unitUs / 2;
+  for (uint16_t i = 0; i < e.len; ++i) {
+    const uint32_t ref = (uint32_t)sPool[e.poolOff + i] * e.unitUs;
+    const uint32_t got = (uint32_t)ticks[i + 1] * kTickUs;
+    uint32_t tol = ref * IR_LIB_TOL_PCT / 100;
+    if (tol < halfUnit) tol = halfUnit;
+    if ((got > ref ? got - ref : ref - got) > tol) return false;
+  }
+  return true;
+}
+
+static bool sameCode(const IrLibEntry& e, const Capture& c) {
+  if (e.raw == c.decoded) return false;
+  if (c.decoded) {
+    return e.address == c.addr && e.command == c.cmd &&
+           (e.proto == c.proto || (e.proto && c.proto && strcmp(e.proto, c.proto) == 0));
+  }
+  return e.len == c.len - 1 && rawClose(e, c.ticks);
+}
+
+// Walks the probe chain for hash; slotOut is the free slot that ends it
+// (kIndexSize when the table is full).
+static int16_t findHash(uint32_t hash, const Capture& c, uint16_t& slotOut) {
+  uint16_t slot = hash & (kIndexSize - 1);
+  for (uint16_t n = 0; n < kIndexSize; ++n) {
+    uint8_t v = sIndex[slot];
+    if (v == 0) { slotOut = slot; return -1; }
+    const IrLibEntry& e = sEntries[v - 1];
+    if (e.hash == hash && sameCode(e, c)) { slotOut = slot; return v - 1; }
+    slot = (slot + 1) & (kIndexSize - 1);
+  }
+  slotOut = kIndexSize;
+  return -1;
+}
+
+static bool nameTaken(const char* name) {
+  for (uint16_t i = 0; i < sCount; ++i) if (strcmp(sEntries[i].name, name) == 0) return true;
+  return false;
+}
+
+static void autoName(IrLibEntry& e, bool decoded) {
+  char base[IR_LIB_NAME_LEN];
+  if (decoded) snprintf(base, sizeof(base), "%.8s_%X", e.proto ? e.proto : "IR", (unsigned)e.command);
+  else         snprintf(base, sizeof(base), "RAW_%u", (unsigned)++sRawSeq);
+
+  strncpy(e.name, base, sizeof(e.name));
+  e.name[sizeof(e.name) - 1] = '\0';
+  // Same command on another address (or a colliding raw name) → _2, _3, …
+  for (uint8_t n = 2; nameTaken(e.name) && n < 100; ++n) {
+    snprintf(e.name, sizeof(e.name), "%.12s_%u", base, (unsigned)n);
+  }
+}
+
+// ─────────────────────────────────────────────────────────────────────────────
+// Public API
+// ─────────────────────────────────────────────────────────────────────────────
+IrMatchResult irLibAdd(const uint16_t* ticks, uint16_t len, const char* proto,
+                       bool decoded, bool isRepeat, uint16_t addr, uint16_t cmd) {
+  // Protocol repeat frames (e.g. NEC 9 ms/2.25 ms) carry no payload; fold them
+  // into whichever code was seen last.
+  if (isRepeat || len <= 4) {
+    if (sLastIdx >= 0) sEntries[sLastIdx].repeats++;
+    return { IrMatch::REPEAT, sLastIdx };
+  }
+
+  const Capture c{ ticks, len, proto, decoded, addr, cmd };
+  Flip    flips[IR_LIB_PROBE_FLIPS];
+  uint8_t nFlips = 0;
+  IrFingerprint fp;
+  if (decoded) {
+    fp = irFingerprint(ticks, len, proto, decoded, addr, cmd);
+  } else {
+    const uint16_t unit = unitFor(proto, decoded, ticks, len);
+    fp = { rawHash(ticks, len, unit, flips, nFlips), unit, (uint16_t)(len - 1) };
+  }
+
+  uint16_t slot;
+  int16_t idx = findHash(fp.hash, c, slot);
+  // Re-key near-boundary durations to their neighbouring unit, every subset
+  for (uint8_t mask = 1; idx < 0 && mask < (1u << nFlips); ++mask) {
+    uint32_t h = fp.hash;
+    for (uint8_t f = 0; f < nFlips; ++f) if (mask & (1u << f)) h += flips[f].delta;
+    uint16_t unused;
+    idx = findHash(h, c, unused);
+  }
+  if (idx >= 0) {
+    sEntries[idx].hits++;
+    sLastIdx = idx;
+    return { IrMatch::DUPLICATE, idx };
+  }
+
+  if (sCount >= IR_LIB_MAX_CODES || slot >= kIndexSize || sPoolUsed + fp.len > IR_LIB_POOL) {
+    return { IrMatch::FULL, -1 };
+  }
+
+  IrLibEntry& e = sEntries[sCount];
+  e.hash    = fp.hash;
+  e.proto   = proto;
+  e.address = addr;
+  e.command = cmd;
+  e.unitUs  = fp.unitUs;
+  e.poolOff = sPoolUsed;
+  e.len     = fp.len;
+  e.hits    = 1;
+  e.repeats = 0;
+  e.raw     = !decoded;
+  for (uint16_t i = 1; i < len; ++i) sPool[sPoolUsed++] = quantize(ticks[i], fp.unitUs);
+  autoName(e, decoded);
+
+  sIndex[slot] = (uint8_t)(sCount + 1);
+  sLastIdx = (int16_t)sCount;
+  return { IrMatch::NEW, (int16_t)sCount++ };
+}
+
+void irLibClear() {
+  memset(sIndex, 0, sizeof(sIndex));
+  sCount = 0;
+  sPoolUsed = 0;
+  sLastIdx = -1;
+  sRawSeq = 0;
+}
+
+uint16_t irLibCount() { return sCount; }
+
+const IrLibEntry* irLibGet(uint16_t idx) {
+  return idx < sCount ? &sEntries[idx] : nullptr;
+}
+
+uint32_t irLibDurationUs(const IrLibEntry& e, uint16_t i) {
+  return (uint32_t)sPool[e.poolOff + i] * e.unitUs;
+}
+
+uint16_t irLibCarrierKhz(const IrLibEntry& e) {
+  if (!e.proto) return 38;
+  if (strcmp(e.proto, "RC5") == 0 || strcmp(e.proto, "RC6") == 0) return 36;
+  if (strcmp(e.proto, "Sony") == 0) return 40;
+  return 38;
+}
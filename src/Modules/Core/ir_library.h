@@ -0,0 +1,57 @@
+#pragma once
+#include <Arduino.h>
+
+// In-RAM library of learned IR codes.
+// Every capture is quantized to its protocol's timing unit and hashed; the
+// hash indexes an open-addressed table, so an exact repeat costs one pass
+// over its timings plus an O(1) probe. Raw captures hash each duration as an
+// independent term and sum them, so a duration that sits near a rounding
+// boundary can be re-keyed to its neighbouring unit in O(1): a lookup also
+// probes the IR_LIB_PROBE_FLIPS closest such neighbours. Every hit is
+// verified against the stored code, (proto, address, command) for decoded
+// frames and the pooled durations within IR_LIB_TOL_PCT for raw ones.
+
+static constexpr uint16_t IR_LIB_MAX_CODES = 64;
+static constexpr uint16_t IR_LIB_POOL      = 4096;   // quantized durations, all codes
+static constexpr uint8_t  IR_LIB_NAME_LEN  = 16;
+static constexpr uint8_t  IR_LIB_TOL_PCT   = 25;     // raw duration match tolerance
+static constexpr uint8_t  IR_LIB_PROBE_FLIPS = 3;    // raw lookups probe 2^flips hashes
+
+enum class IrMatch : uint8_t { NEW, DUPLICATE, REPEAT, FULL };
+
+struct IrFingerprint {
+  uint32_t hash;
+  uint16_t unitUs;     // quantization step
+  uint16_t len;        // number of durations (leading gap excluded)
+};
+
+struct IrLibEntry {
+  uint32_t    hash;
+  char        name[IR_LIB_NAME_LEN];
+  const char* proto;         // static string from the decoder
+  uint16_t    address;
+  uint16_t    command;
+  uint16_t    unitUs;
+  uint16_t    poolOff;       // quantized durations live in the shared pool
+  uint16_t    len;
+  uint16_t    hits;          // captures that matched (incl. the first)
+  uint16_t    repeats;       // protocol repeat frames grouped onto this code
+  bool        raw;           // keyed on timings, not (proto, address, command)
+};
+
+struct IrMatchResult {
+  IrMatch kind;
+  int16_t index;             // -1 when nothing could be attributed
+};
+
+// ticks: IRremote raw buffer (50 µs ticks, [0] = leading gap)
+IrFingerprint irFingerprint(const uint16_t* ticks, uint16_t len, const char* proto,
+                            bool decoded, uint16_t addr, uint16_t cmd);
+
+IrMatchResult irLibAdd(const uint16_t* ticks, uint16_t len, const char* proto,
+                       bool decoded, bool isRepeat, uint16_t addr, uint16_t cmd);
+void              irLibClear();
+uint16_t          irLibCount();
+const IrLibEntry* irLibGet(uint16_t idx);
+uint32_t          irLibDurationUs(const IrLibEntry& e, uint16_t i);   // i < e.len
+uint16_t          irLibCarrierKhz(const IrLibEntry& e);
@@ -0,0 +1,403 @@
+#include "ir_sequencer.h"
+#include "ir_tx.h"
+#include "ir_library.h"
+#include "profile.h"
+#include <esp_timer.h>
+#include <ctype.h>
+
+static constexpr uint8_t  kFirstSlot     = 8;     // B-Gone owns 0-7
+static constexpr uint8_t  kSlotCount     = IR_TX_SLOTS - kFirstSlot;
+static constexpr uint32_t kDefaultGapMs  = 150;   // profile "ir_gap_ms" overrides
+static constexpr int64_t  kLeadInUs      = 2000;  // first frame after start
+static constexpr uint32_t kBusyRetryUs   = 200;
+
+// ─────────────────────────────────────────────────────────────────────────────
+// Macro storage
+// ─────────────────────────────────────────────────────────────────────────────
+enum class StepKind : uint8_t { SEND, WAIT };
+
+struct Step {
+  StepKind kind;
+  IrProto  proto;                       // RAW → libName
+  char     libName[IR_LIB_NAME_LEN];
+  uint16_t address;
+  uint16_t command;
+  uint16_t count;
+  uint32_t ms;                          // SEND: gap, WAIT: duration
+  uint8_t  slot;                        // assigned at start
+};
+
+struct Macro {
+  char    name[IR_MACRO_NAME_LEN];
+  Step    steps[IR_MACRO_MAX_STEPS];
+  uint8_t stepCount;
+};
+
+static Macro       sMacros[IR_MACRO_MAX];
+static uint8_t     sMacroCount = 0;
+static const char* sError = "";
+
+// ─────────────────────────────────────────────────────────────────────────────
+// Run state (written by the esp_timer task, read by the UI)
+// ─────────────────────────────────────────────────────────────────────────────
+struct RunState {
+  Macro*   macro;
+  uint8_t  step;
+  uint16_t rep;
+  int64_t  startUs;
+  int64_t  deadlineUs;
+  uint16_t framesSent;
+  uint16_t framesTotal;
+  int32_t  lastErrUs;
+  uint32_t maxErrUs;
+  uint64_t sumErrUs;
+  bool     running;
+  bool     failed;
+};
+
+static RunState           sRun;
+static uint32_t           sGen = 0;             // bumped per start; stale ticks compare
+static esp_timer_handle_t sTimer = nullptr;
+static portMUX_TYPE       sMux = portMUX_INITIALIZER_UNLOCKED;
+static uint16_t           sRawUs[256];          // scratch for library → RAW
+
+// ─────────────────────────────────────────────────────────────────────────────
+// Parsing
+// ─────────────────────────────────────────────────────────────────────────────
+static bool parseProto(const char* tok, IrProto& out) {
+  if (!strcasecmp(tok, "nec"))     { out = IrProto::NEC;     return true; }
+  if (!strcasecmp(tok, "samsung")) { out = IrProto::SAMSUNG; return true; }
+  if (!strcasecmp(tok, "sony"))    { out = IrProto::SONY12;  return true; }
+  if (!strcasecmp(tok, "rc5"))     { out = IrProto::RC5;     return true; }
+  return false;
+}
+
+static bool parseLine(char* line, Step& st) {
+  char* save = nullptr;
+  char* tok  = strtok_r(line, " \t", &save);
+  if (!tok) return false;
+
+  memset(&st, 0, sizeof(st));
+  st.count = 1;
+  st.ms    = (uint32_t)profileParam(ProfileParam::IR_GAP_MS, kDefaultGapMs);
+
+  if (!strcasecmp(tok, "wait")) {
+    char* v = strtok_r(nullptr, " \t", &save);
+    if (!v) { sError = "wait needs ms"; return false; }
+    st.kind = StepKind::WAIT;
+    st.ms   = strtoul(v, nullptr, 0);
+    return true;
+  }
+  if (strcasecmp(tok, "send") != 0) { sError = "unknown step"; return false; }
+
+  st.kind = StepKind::SEND;
+  char* what = strtok_r(nullptr, " \t", &save);
+  if (!what) { sError = "send needs a code"; return false; }
+  if (parseProto(what, st.proto)) {
+    char* a = strtok_r(nullptr, " \t", &save);
+    char* c = strtok_r(nullptr, " \t", &save);
+    if (!a || !c) { sError = "send needs ADDR CMD"; return false; }
+    st.address = strtoul(a, nullptr, 0);
+    st.command = strtoul(c, nullptr, 0);
+  } else {
+    st.proto = IrProto::RAW;
+    strncpy(st.libName, what, sizeof(st.libName) - 1);
+  }
+  while ((tok = strtok_r(nullptr, " \t", &save))) {
+    if ((tok[0] == 'x' || tok[0] == 'X') && isdigit((unsigned char)tok[1])) {
+      st.count = max<uint32_t>(1, strtoul(tok + 1, nullptr, 10));
+    } else if (!strcasecmp(tok, "gap")) {
+      char* v = strtok_r(nullptr, " \t", &save);
+      if (!v) { sError = "gap needs ms"; return false; }
+      st.ms = strtoul(v, nullptr, 0);
+    } else {
+      sError = "bad send option";
+      return false;
+    }
+  }
+  return true;
+}
+
+static const char* protoToken(IrProto p) {
+  switch (p) {
+    case IrProto::NEC:     return "nec";
+    case IrProto::SAMSUNG: return "samsung";
+    case IrProto::SONY12:  return "sony";
+    case IrProto::RC5:     return "rc5";
+    default:               return nullptr;
+  }
+}
+
+static bool parseScript(Macro& m, const char* script) {
+  m.stepCount = 0;
+  char line[64];
+  const char* p = script;
+  while (*p) {
+    size_t n = 0;
+    while (*p && *p != '\n' && *p != ';') { if (n < sizeof(line) - 1) line[n++] = *p; ++p; }
+    if (*p) ++p;
+    line[n] = '\0';
+    if (char* hash = strchr(line, '#')) *hash = '\0';
+    bool blank = true;
+    for (char* c = line; *c; ++c) if (!isspace((unsigned char)*c)) { blank = false; break; }
+    if (blank) continue;
+    if (m.stepCount >= IR_MACRO_MAX_STEPS) { sError = "too many steps"; return false; }
+    if (!parseLine(line, m.steps[m.stepCount])) return false;
+    m.stepCount++;
+  }
+  if (!m.stepCount) { sError = "empty macro"; return false; }
+  return true;
+}
+
+bool irMacroAdd(const char* name, const char* script) {
+  static Macro tmp;                     // too big for the caller's stack
+  while (isspace((unsigned char)*name)) ++name;
+  strncpy(tmp.name, name, sizeof(tmp.name) - 1);
+  tmp.name[sizeof(tmp.name) - 1] = '\0';
+  for (size_t n = strlen(tmp.name); n && isspace((unsigned char)tmp.name[n - 1]); --n) tmp.name[n - 1] = '\0';
+  if (!tmp.name[0]) { sError = "macro needs a name"; return false; }
+  if (!parseScript(tmp, script)) return false;
+
+  uint8_t idx = 0;
+  while (idx < sMacroCount && strcmp(sMacros[idx].name, tmp.name) != 0) ++idx;
+  if (idx == sMacroCount && sMacroCount >= IR_MACRO_MAX) { sError = "macro table full"; return false; }
+  if (sRun.running && sRun.macro == &sMacros[idx]) irSeqStop();
+  sMacros[idx] = tmp;
+  if (idx == sMacroCount) sMacroCount++;
+  return true;
+}
+
+bool irMacroLoad(const char* path) {
+  FILE* f = fopen(path, "r");
+  if (!f) return false;
+  static char line[IR_MACRO_MAX_STEPS * 48];
+  uint8_t added = 0;
+  while (fgets(line, sizeof(line), f)) {
+    char* colon = strchr(line, ':');
+    if (!colon || line[0] == '#') continue;
+    *colon = '\0';
+    if (irMacroAdd(line, colon + 1)) ++added;
+    else Serial.printf("[irseq] %s: %s: %s\n", path, line, sError);
+  }
+  fclose(f);
+  return added > 0;
+}
+
+bool irMacroSave(const char* path) {
+  FILE* f = fopen(path, "w");
+  if (!f) { sError = "cannot write macro file"; return false; }
+  for (uint8_t i = 0; i < sMacroCount; ++i) {
+    const Macro& m = sMacros[i];
+    fprintf(f, "%s:", m.name);
+    for (uint8_t k = 0; k < m.stepCount; ++k) {
+      const Step& st = m.steps[k];
+      if (st.kind == StepKind::WAIT) {
+        fprintf(f, " wait %lu;", (unsigned long)st.ms);
+        continue;
+      }
+      if (const char* tok = protoToken(st.proto)) {
+        fprintf(f, " send %s 0x%X 0x%X", tok, (unsigned)st.address, (unsigned)st.command);
+      } else {
+        fprintf(f, " send %s", st.libName);
+      }
+      fprintf(f, " x%u gap %lu;", (unsigned)st.count, (unsigned long)st.ms);
+    }
+    fputc('\n', f);
+  }
+  bool ok = !ferror(f);
+  if (fclose(f) != 0) ok = false;
+  if (!ok) sError = "cannot write macro file";
+  return ok;
+}
+
+uint8_t     irMacroCount()            { return sMacroCount; }
+const char* irMacroName(uint8_t idx)  { return idx < sMacroCount ? sMacros[idx].name : ""; }
+const char* irMacroError()            { return sError; }
+
+// ─────────────────────────────────────────────────────────────────────────────
+// Preparing: every distinct code gets one cached TX slot
+// ─────────────────────────────────────────────────────────────────────────────
+static bool sameCode(const Step& a, const Step& b) {
+  if (a.proto != b.proto) return false;
+  if (a.proto == IrProto::RAW) return strcmp(a.libName, b.libName) == 0;
+  return a.address == b.address && a.command == b.command;
+}
+
+static bool libCode(const char* name, IrCode& code) {
+  for (uint16_t i = 0; i < irLibCount(); ++i) {
+    const IrLibEntry* e = irLibGet(i);
+    if (strcmp(e->name, name) != 0) continue;
+    uint16_t n = min<uint16_t>(e->len, sizeof(sRawUs) / sizeof(sRawUs[0]));
+    for (uint16_t k = 0; k < n; ++k) sRawUs[k] = (uint16_t)min<uint32_t>(irLibDurationUs(*e, k), 0xFFFF);
+    code.proto  = IrProto::RAW;
+    code.raw    = sRawUs;
+    code.rawLen = n;
+    code.khz    = irLibCarrierKhz(*e);
+    return true;
+  }
+  return false;
+}
+
+static bool prepareMacro(Macro& m, uint16_t& framesTotal) {
+  uint8_t used = 0;
+  framesTotal = 0;
+  for (uint8_t i = 0; i < m.stepCount; ++i) {
+    Step& st = m.steps[i];
+    if (st.kind != StepKind::SEND) continue;
+    framesTotal += st.count;
+
+    bool shared = false;
+    for (uint8_t j = 0; j < i && !shared; ++j) {
+      if (m.steps[j].kind == StepKind::SEND && sameCode(m.steps[j], st)) { st.slot = m.steps[j].slot; shared = true; }
+    }
+    if (shared) continue;
+    if (used >= kSlotCount) { sError = "too many distinct codes"; return false; }
+
+    IrCode code;
+    if (st.proto == IrProto::RAW) {
+      if (!libCode(st.libName, code)) { sError = "code not in library"; return false; }
+    } else {
+      code.proto   = st.proto;
+      code.address = st.address;
+      code.command = st.command;
+    }
+    st.slot = kFirstSlot + used++;
+    if (irTxBusy()) { sError = "transmitter busy"; return false; }
+    if (!irTxPrepare(st.slot, code)) { sError = "code too long"; return false; }
+  }
+  return true;
+}
+
+// ─────────────────────────────────────────────────────────────────────────────
+// Scheduler (esp_timer task)
+// ─────────────────────────────────────────────────────────────────────────────
+static void armAt(int64_t deadlineUs) {
+  int64_t delta = deadlineUs - esp_timer_get_time();
+  esp_timer_start_once(sTimer, delta > 1 ? (uint64_t)delta : 1);
+}
+
+// Fold WAIT steps into the deadline; false when the macro is done.
+// Caller holds sMux.
+static bool skipWaits() {
+  Macro& m = *sRun.macro;
+  while (sRun.step < m.stepCount && m.steps[sRun.step].kind == StepKind::WAIT) {
+    sRun.deadlineUs += (int64_t)m.steps[sRun.step].ms * 1000;
+    sRun.step++;
+  }
+  return sRun.step < m.stepCount;
+}
+
+static void finishRun(uint32_t gen, const char* err) {
+  portENTER_CRITICAL(&sMux);
+  if (gen != sGen) { portEXIT_CRITICAL(&sMux); return; }    // restarted meanwhile
+  sRun.running = false;
+  sRun.failed  = err != nullptr;
+  const RunState r = sRun;
+  portEXIT_CRITICAL(&sMux);
+
+  if (err) sError = err;
+  uint32_t avg = r.framesSent ? (uint32_t)(r.sumErrUs / r.framesSent) : 0;
+  Serial.printf("[irseq] %s: %s%u frames in %lu ms, err avg %lu us, max %lu us\n",
+                r.macro->name, err ? "FAILED, " : "", r.framesSent,
+                (unsigned long)((esp_timer_get_time() - r.startUs) / 1000),
+                (unsigned long)avg, (unsigned long)r.maxErrUs);
+}
+
+static void onTick(void*) {
+  portENTER_CRITICAL(&sMux);
+  if (!sRun.running) { portEXIT_CRITICAL(&sMux); return; }
+  const uint32_t gen  = sGen;
+  const Step&    st   = sRun.macro->steps[sRun.step];
+  const uint8_t  slot = st.slot;
+  portEXIT_CRITICAL(&sMux);
+
+  int64_t now = esp_timer_get_time();
+  if (!irTxSend(slot)) {
+    // Only a frame still on air is worth waiting for; anything else (driver
+    // gone, slot invalidated) will not fix itself.
+    if (irTxBusy()) esp_timer_start_once(sTimer, kBusyRetryUs);
+    else            finishRun(gen, "IR transmit failed");
+    return;
+  }
+
+  portENTER_CRITICAL(&sMux);
+  if (!sRun.running || gen != sGen) { portEXIT_CRITICAL(&sMux); return; }
+  int32_t  err    = (int32_t)(now - sRun.deadlineUs);
+  uint32_t absErr = err < 0 ? -err : err;
+  sRun.lastErrUs = err;
+  sRun.maxErrUs  = max(sRun.maxErrUs, absErr);
+  sRun.sumErrUs += absErr;
+  sRun.framesSent++;
+  sRun.deadlineUs += (int64_t)st.ms * 1000;
+  if (++sRun.rep >= st.count) { sRun.rep = 0; sRun.step++; }
+  const bool    more     = skipWaits();
+  const int64_t deadline = sRun.deadlineUs;
+  portEXIT_CRITICAL(&sMux);
+
+  if (!more) { finishRun(gen, nullptr); return; }
+  armAt(deadline);                              // a stop in between just fires a no-op tick
+}
+
+// ─────────────────────────────────────────────────────────────────────────────
+// Public API
+// ─────────────────────────────────────────────────────────────────────────────
+bool irSeqStart(uint8_t macroIdx) {
+  if (macroIdx >= sMacroCount) return false;
+  irSeqStop();
+
+  irTxBegin();
+  if (!sTimer) {
+    esp_timer_create_args_t args = {};
+    args.callback        = onTick;
+    args.dispatch_method = ESP_TIMER_TASK;
+    args.name            = "irseq";
+    if (esp_timer_create(&args, &sTimer) != ESP_OK) { sError = "no timer"; return false; }
+  }
+
+  Macro& m = sMacros[macroIdx];
+  uint16_t total = 0;
+  if (!prepareMacro(m, total)) return false;
+
+  // A tick already dispatched before the stop may still be running; the new
+  // generation makes it drop its result instead of touching this run.
+  esp_timer_stop(sTimer);
+  portENTER_CRITICAL(&sMux);
+  ++sGen;
+  memset(&sRun, 0, sizeof(sRun));
+  sRun.macro       = &m;
+  sRun.framesTotal = total;
+  sRun.startUs     = esp_timer_get_time();
+  sRun.deadlineUs  = sRun.startUs + kLeadInUs;
+  sRun.running     = skipWaits();
+  const bool    any      = sRun.running;
+  const int64_t deadline = sRun.deadlineUs;
+  portEXIT_CRITICAL(&sMux);
+
+  if (!any) return false;                       // nothing to send
+  armAt(deadline);
+  return true;
+}
+
+void irSeqStop() {
+  portENTER_CRITICAL(&sMux);
+  sRun.running = false;                         // an in-flight tick won't re-arm
+  portEXIT_CRITICAL(&sMux);
+  if (sTimer) esp_timer_stop(sTimer);
+}
+
+IrSeqStats irSeqStats() {
+  IrSeqStats s = {};
+  portENTER_CRITICAL(&sMux);
+  s.running     = sRun.running;
+  s.failed      = sRun.failed;
+  s.step        = sRun.step;
+  s.steps       = sRun.macro ? sRun.macro->stepCount : 0;
+  s.framesSent  = sRun.framesSent;
+  s.framesTotal = sRun.framesTotal;
+  s.lastErrUs   = sRun.lastErrUs;
+  s.maxErrUs    = sRun.maxErrUs;
+  s.avgErrUs    = sRun.framesSent ? (uint32_t)(sRun.sumErrUs / sRun.framesSent) : 0;
+  s.elapsedMs   = sRun.macro ? (uint32_t)((esp_timer_get_time() - sRun.startUs) / 1000) : 0;
+  portEXIT_CRITICAL(&sMux);
+  return s;
+}
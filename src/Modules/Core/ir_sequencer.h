@@ -0,0 +1,45 @@
+#pragma once
+#include <Arduino.h>
+
+// Scripted IR sequences ("macros") played through the RMT transmitter.
+//
+// Script: one step per line (or ';'-separated), '#' starts a comment.
+//   send <library-name>                 [xN] [gap MS]
+//   send nec|samsung|sony|rc5 ADDR CMD  [xN] [gap MS]
+//   wait MS
+// gap is the start-to-start period of repeated frames (default 150 ms).
+//
+// Frames are released from esp_timer callbacks against absolute deadlines
+// measured from the start of the run, so errors never accumulate and the
+// UI loop is never blocked.
+//
+// Macro files hold one macro per line in the same form accepted over Serial:
+//   name: step; step; ...
+
+static constexpr uint8_t IR_MACRO_MAX       = 8;
+static constexpr uint8_t IR_MACRO_MAX_STEPS = 24;
+static constexpr uint8_t IR_MACRO_NAME_LEN  = 16;
+
+struct IrSeqStats {
+  bool     running;
+  uint8_t  step;           // current step (0-based)
+  uint8_t  steps;
+  uint16_t framesSent;
+  uint16_t framesTotal;
+  uint32_t elapsedMs;
+  int32_t  lastErrUs;      // actual - deadline of the last frame
+  uint32_t maxErrUs;       // worst |error|
+  uint32_t avgErrUs;       // mean |error|
+  bool     failed;         // stopped early, reason in irMacroError()
+};
+
+bool        irMacroAdd(const char* name, const char* script);   // replaces a same-named macro
+bool        irMacroLoad(const char* path);                       // appends; false if unreadable
+bool        irMacroSave(const char* path);
+uint8_t     irMacroCount();
+const char* irMacroName(uint8_t idx);
+const char* irMacroError();                                      // last parse/prepare error
+
+bool        irSeqStart(uint8_t macroIdx);
+void        irSeqStop();
+IrSeqStats  irSeqStats();
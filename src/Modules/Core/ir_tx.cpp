@@ -0,0 +1,242 @@
+#include "ir_tx.h"
+#include "settings.h"
+#include <driver/rmt.h>
+
+// ─────────────────────────────────────────────────────────────────────────────
+// Pin is configured per-env with -DIR_PIN=<num> (every env in platformio.ini
+// sets it); Settings → Config Pins can override it at runtime.
+// RMT runs at 1 µs/tick (80 MHz APB / 80); the carrier is produced by the
+// peripheral, so the CPU never toggles the LED.
+// ─────────────────────────────────────────────────────────────────────────────
+#ifndef IR_PIN
+  #define IR_PIN 19
+#endif
+
+static constexpr rmt_channel_t kChannel   = RMT_CHANNEL_0;
+static constexpr uint8_t       kClkDiv    = 80;        // 1 tick = 1 µs
+static constexpr uint16_t      kMaxTicks  = 32767;     // 15-bit item duration
+static constexpr uint16_t      kSlotItems = 192;       // ~6 NEC frames or 384 raw edges
+static constexpr uint8_t       kDutyPct   = 33;
+
+struct TxSlot {
+  rmt_item32_t items[kSlotItems];
+  uint16_t     count = 0;
+  uint16_t     khz   = 0;
+  bool         ready = false;
+};
+
+static TxSlot   sSlots[IR_TX_SLOTS];
+static bool     sInstalled = false;
+static int8_t   sPin = -1;
+static uint16_t sCarrierKhz = 0;
+
+// ─────────────────────────────────────────────────────────────────────────────
+// Item writer: merges equal levels, splits long durations, packs halves
+// ─────────────────────────────────────────────────────────────────────────────
+struct ItemWriter {
+  rmt_item32_t* items;
+  uint16_t      cap;
+  uint16_t      n       = 0;
+  bool          half    = false;
+  bool          ok      = true;
+  bool          pLevel  = false;
+  uint32_t      pUs     = 0;     // pending run, not yet packed
+};
+
+static void putHalf(ItemWriter& w, bool level, uint16_t ticks) {
+  if (w.n >= w.cap) { w.ok = false; return; }
+  rmt_item32_t& it = w.items[w.n];
+  if (!w.half) {
+    it.level0 = level; it.duration0 = ticks;
+    it.level1 = 0;     it.duration1 = 0;
+    w.half = true;
+  } else {
+    it.level1 = level; it.duration1 = ticks;
+    w.half = false;
+    ++w.n;
+  }
+}
+
+static void flushRun(ItemWriter& w) {
+  uint32_t us = w.pUs;
+  while (us > 0) {
+    uint16_t chunk = us > kMaxTicks ? kMaxTicks : (uint16_t)us;
+    putHalf(w, w.pLevel, chunk);
+    us -= chunk;
+  }
+  w.pUs = 0;
+}
+
+static void emit(ItemWriter& w, bool mark, uint32_t us) {
+  if (us == 0) return;
+  if (w.pUs && w.pLevel == mark) { w.pUs += us; return; }
+  flushRun(w);
+  w.pLevel = mark;
+  w.pUs    = us;
+}
+
+static uint16_t finish(ItemWriter& w) {
+  if (w.pLevel) flushRun(w);     // trailing space is implied by idle-low
+  w.pUs = 0;
+  if (w.half) ++w.n;             // zero second half doubles as end marker
+  return w.ok ? w.n : 0;
+}
+
+// ─────────────────────────────────────────────────────────────────────────────
+// Protocol encoders
+// ─────────────────────────────────────────────────────────────────────────────
+static void pulseDistanceBits(ItemWriter& w, uint32_t data, uint8_t bits,
+                              uint16_t mark, uint16_t zero, uint16_t one) {
+  for (uint8_t i = 0; i < bits; ++i) {           // LSB first
+    emit(w, true, mark);
+    emit(w, false, (data >> i) & 1 ? one : zero);
+  }
+}
+
+static void encodeNEC(ItemWriter& w, const IrCode& c, uint8_t repeats) {
+  uint32_t addr = c.address > 0xFF ? c.address
+                                   : (uint32_t)(c.address & 0xFF) | ((uint32_t)(~c.address & 0xFF) << 8);
+  uint32_t data = addr | ((uint32_t)(c.command & 0xFF) << 16) | ((uint32_t)(~c.command & 0xFF) << 24);
+  emit(w, true, 9000); emit(w, false, 4500);
+  pulseDistanceBits(w, data, 32, 560, 560, 1690);
+  emit(w, true, 560);
+  // NEC frame period is 108 ms; frame ≈ 67.5 ms, repeat ≈ 11.8 ms
+  uint32_t gap = 108000 - 67500;
+  for (uint8_t r = 0; r < repeats; ++r) {
+    emit(w, false, gap);
+    emit(w, true, 9000); emit(w, false, 2250); emit(w, true, 560);
+    gap = 108000 - 11810;
+  }
+}
+
+static void encodeSamsung(ItemWriter& w, const IrCode& c, uint8_t repeats) {
+  uint32_t data = (uint32_t)(c.address & 0xFF) | ((uint32_t)(c.address & 0xFF) << 8)
+                | ((uint32_t)(c.command & 0xFF) << 16) | ((uint32_t)(~c.command & 0xFF) << 24);
+  for (uint8_t r = 0; r <= repeats; ++r) {
+    if (r) emit(w, false, 108000 - 67500);
+    emit(w, true, 4500); emit(w, false, 4500);
+    pulseDistanceBits(w, data, 32, 560, 560, 1690);
+    emit(w, true, 560);
+  }
+}
+
+static void encodeSony12(ItemWriter& w, const IrCode& c, uint8_t repeats) {
+  uint16_t data = (c.command & 0x7F) | ((c.address & 0x1F) << 7);
+  // SIRC needs at least three frames on a 45 ms period
+  uint8_t frames = repeats < 2 ? 3 : repeats + 1;
+  for (uint8_t r = 0; r < frames; ++r) {
+    uint32_t used = 2400 + 600;
+    emit(w, true, 2400); emit(w, false, 600);
+    for (uint8_t i = 0; i < 12; ++i) {
+      uint16_t m = (data >> i) & 1 ? 1200 : 600;
+      emit(w, true, m); emit(w, false, 600);
+      used += m + 600;
+    }
+    if (r + 1 < frames) emit(w, false, 45000 - used);
+  }
+}
+
+static void encodeRC5(ItemWriter& w, const IrCode& c, uint8_t repeats) {
+  // S1, S2 (inverted cmd bit 6), toggle, 5 address bits, 6 command bits
+  uint16_t data = (1u << 13) | ((~c.command & 0x40) ? (1u << 12) : 0)
+                | ((c.address & 0x1F) << 6) | (c.command & 0x3F);
+  for (uint8_t r = 0; r <= repeats; ++r) {
+    if (r) emit(w, false, 113778 - 24892);
+    for (int8_t i = 13; i >= 0; --i) {
+      bool one = (data >> i) & 1;
+      emit(w, !one, 889);        // 1 = space→mark, 0 = mark→space
+      emit(w, one,  889);
+    }
+  }
+}
+
+static void encodeRaw(ItemWriter& w, const IrCode& c, uint8_t repeats) {
+  for (uint8_t r = 0; r <= repeats; ++r) {
+    if (r) emit(w, false, 40000);
+    for (uint16_t i = 0; i < c.rawLen; ++i) emit(w, (i & 1) == 0, c.raw[i]);
+  }
+}
+
+static uint16_t defaultKhz(IrProto p) {
+  switch (p) {
+    case IrProto::SONY12: return 40;
+    case IrProto::RC5:    return 36;
+    default:              return 38;
+  }
+}
+
+static void applyCarrier(uint16_t khz) {
+  if (khz == sCarrierKhz) return;
+  uint32_t period = 80000000UL / (khz * 1000UL);           // APB cycles
+  uint16_t high   = period * kDutyPct / 100;
+  rmt_set_tx_carrier(kChannel, true, high, period - high, RMT_CARRIER_LEVEL_HIGH);
+  sCarrierKhz = khz;
+}
+
+// ─────────────────────────────────────────────────────────────────────────────
+// Public API
+// ─────────────────────────────────────────────────────────────────────────────
+void irTxBegin() {
+  int8_t pin = settingsGet(Setting::IR_TX_GPIO);
+  if (pin < 0 || !settingsPinValid(Setting::IR_TX_GPIO, pin)) pin = IR_PIN;   // stale NVS value
+  if (sInstalled) {
+    if (pin != sPin && !irTxBusy() && rmt_set_gpio(kChannel, RMT_MODE_TX, (gpio_num_t)pin, false) == ESP_OK) sPin = pin;
+    return;
+  }
+  rmt_config_t cfg = RMT_DEFAULT_CONFIG_TX((gpio_num_t)pin, kChannel);
+  cfg.clk_div                      = kClkDiv;
+  cfg.tx_config.carrier_en         = true;
+  cfg.tx_config.carrier_freq_hz    = 38000;
+  cfg.tx_config.carrier_duty_percent = kDutyPct;
+  cfg.tx_config.carrier_level      = RMT_CARRIER_LEVEL_HIGH;
+  cfg.tx_config.idle_output_en     = true;
+  cfg.tx_config.idle_level         = RMT_IDLE_LEVEL_LOW;
+  if (rmt_config(&cfg) != ESP_OK) return;
+  if (rmt_driver_install(kChannel, 0, 0) != ESP_OK) return;
+  sCarrierKhz = 38;
+  sPin        = pin;
+  sInstalled  = true;
+}
+
+bool irTxPrepare(uint8_t slot, const IrCode& code, uint8_t repeats) {
+  if (slot >= IR_TX_SLOTS) return false;
+  TxSlot& s = sSlots[slot];
+  // The driver streams straight out of the slot buffer; never rewrite it mid-send
+  if (s.ready && irTxBusy()) return false;
+
+  ItemWriter w{ s.items, kSlotItems };
+  switch (code.proto) {
+    case IrProto::NEC:     encodeNEC(w, code, repeats);     break;
+    case IrProto::SAMSUNG: encodeSamsung(w, code, repeats); break;
+    case IrProto::SONY12:  encodeSony12(w, code, repeats);  break;
+    case IrProto::RC5:     encodeRC5(w, code, repeats);     break;
+    case IrProto::RAW:
+      if (!code.raw || !code.rawLen) return false;
+      encodeRaw(w, code, repeats);
+      break;
+  }
+  s.count = finish(w);
+  s.khz   = code.khz ? code.khz : defaultKhz(code.proto);
+  s.ready = s.count > 0;
+  return s.ready;
+}
+
+bool irTxSend(uint8_t slot) {
+  if (!sInstalled || slot >= IR_TX_SLOTS || !sSlots[slot].ready) return false;
+  if (irTxBusy()) return false;
+  applyCarrier(sSlots[slot].khz);
+  return rmt_write_items(kChannel, sSlots[slot].items, sSlots[slot].count, false) == ESP_OK;
+}
+
+bool irTxBusy() {
+  if (!sInstalled) return false;
+  return rmt_wait_tx_done(kChannel, 0) == ESP_ERR_TIMEOUT;
+}
+
+bool irTxIsPrepared(uint8_t slot) {
+  return slot < IR_TX_SLOTS && sSlots[slot].ready;
+}
+
+void irTxInvalidate(uint8_t slot) {
+  if (slot < IR_TX_SLOTS) sSlots[slot].ready = false;
+}
@@ -0,0 +1,26 @@
+#pragma once
+#include <Arduino.h>
+
+// RMT-driven IR transmitter. Codes are encoded once into per-slot RMT item
+// buffers (carrier is generated by the RMT peripheral), so a send is just a
+// hand-off to the hardware and returns immediately.
+
+enum class IrProto : uint8_t { RAW, NEC, SAMSUNG, SONY12, RC5 };
+
+struct IrCode {
+  IrProto         proto   = IrProto::RAW;
+  uint16_t        address = 0;
+  uint16_t        command = 0;
+  uint16_t        khz     = 0;        // 0 → protocol default
+  const uint16_t* raw     = nullptr;  // RAW only: mark/space pairs in µs, mark first
+  uint16_t        rawLen  = 0;
+};
+
+static constexpr uint8_t IR_TX_SLOTS = 16;   // 0-7 B-Gone keys, 8-15 macro sequencer
+
+void irTxBegin();                                           // idempotent
+bool irTxPrepare(uint8_t slot, const IrCode& code, uint8_t repeats = 0);
+bool irTxSend(uint8_t slot);                                // non-blocking
+bool irTxBusy();
+bool irTxIsPrepared(uint8_t slot);
+void irTxInvalidate(uint8_t slot);
@@ -0,0 +1,181 @@
+#include "mic_fft.h"
+
+#if defined(CONFIG_I2S_PDM_RX)
+#include <driver/i2s.h>
+#include <esp_heap_caps.h>
+#include <esp_dsp.h>
+
+#if defined(M5CARDPUTER)
+  #ifndef MIC_CLK_PIN
+    #define MIC_CLK_PIN 43
+  #endif
+  #ifndef MIC_DATA_PIN
+    #define MIC_DATA_PIN 46
+  #endif
+#else
+  #ifndef MIC_CLK_PIN
+    #define MIC_CLK_PIN 0
+  #endif
+  #ifndef MIC_DATA_PIN
+    #define MIC_DATA_PIN 34
+  #endif
+#endif
+
+static constexpr i2s_port_t kPort      = I2S_NUM_0;     // PDM RX is only on I2S0
+static constexpr uint8_t    kDmaBufs   = 2;
+static constexpr uint8_t    kRingLines = 16;            // power of two
+static constexpr uint32_t   kTaskStack = 4096;
+static constexpr uint32_t   kReadMs    = 100;           // how fast micFftStop() is noticed
+
+static float*   sWindow = nullptr;                      // Hann, MIC_FFT_N
+static float*   sSamples = nullptr;                     // MIC_FFT_N
+static float*   sData   = nullptr;                      // MIC_FFT_N complex, interleaved
+static int16_t* sPcm    = nullptr;
+
+static uint8_t           sRing[kRingLines][MIC_BINS];
+static volatile uint32_t sHead = 0, sTail = 0;          // running line counts
+
+static TaskHandle_t      sTask = nullptr;
+static volatile bool     sRun  = false;
+static volatile uint32_t sLines = 0, sDropped = 0, sReadErrors = 0;
+static volatile uint16_t sPeakHz = 0, sFrameUs = 0;
+static volatile uint8_t  sPeakLevel = 0;
+
+// ─────────────────────────────────────────────────────────────────────────────
+// Spectrum
+// ─────────────────────────────────────────────────────────────────────────────
+static void processFrame() {
+  uint32_t t0 = micros();
+  for (uint16_t i = 0; i < MIC_FFT_N; ++i) sSamples[i] = sPcm[i] * (1.0f / 32768);
+  memset(sData, 0, MIC_FFT_N * 2 * sizeof(float));
+  dsps_mul_f32(sSamples, sWindow, sData, MIC_FFT_N, 1, 1, 2);     // real parts only
+  dsps_fft2r_fc32(sData, MIC_FFT_N);
+  dsps_bit_rev_fc32(sData, MIC_FFT_N);
+
+  uint32_t head = sHead;
+  if (head - __atomic_load_n(&sTail, __ATOMIC_ACQUIRE) == kRingLines) { sDropped++; return; }
+  uint8_t* line = sRing[head & (kRingLines - 1)];
+
+  // Full-scale sine → 0 dB: Hann coherent gain 1/2, one-sided bin N/2 → N/4
+  static const float kRefDb = 20.0f * log10f(MIC_FFT_N / 4.0f);
+  uint8_t  peak = 0;
+  uint16_t peakBin = 0;
+  for (uint16_t k = 0; k < MIC_BINS; ++k) {
+    float re = sData[2 * k], im = sData[2 * k + 1];
+    float db = 10.0f * log10f(re * re + im * im + 1e-12f) - kRefDb;
+    float v  = (db - MIC_FLOOR_DB) * (255.0f / MIC_SPAN_DB);
+    uint8_t lv = v <= 0 ? 0 : v >= 255 ? 255 : (uint8_t)v;
+    line[k] = lv;
+    if (k && lv > peak) { peak = lv; peakBin = k; }                 // skip DC
+  }
+  __atomic_store_n(&sHead, head + 1, __ATOMIC_RELEASE);
+  sLines++;
+  sPeakHz    = (uint16_t)(peakBin * MIC_RATE / MIC_FFT_N);
+  sPeakLevel = peak;
+  sFrameUs   = (uint16_t)(micros() - t0);
+}
+
+static void captureTask(void*) {
+  while (sRun) {
+    size_t got = 0;
+    if (i2s_read(kPort, sPcm, MIC_FFT_N * sizeof(int16_t), &got, pdMS_TO_TICKS(kReadMs)) != ESP_OK) {
+      sReadErrors++;
+      continue;
+    }
+    if (got == MIC_FFT_N * sizeof(int16_t)) processFrame();
+  }
+  sTask = nullptr;
+  vTaskDelete(nullptr);
+}
+
+// ─────────────────────────────────────────────────────────────────────────────
+// Public API
+// ─────────────────────────────────────────────────────────────────────────────
+static void freeBuffers() {
+  heap_caps_free(sWindow);  sWindow  = nullptr;
+  heap_caps_free(sSamples); sSamples = nullptr;
+  heap_caps_free(sData);    sData    = nullptr;
+  heap_caps_free(sPcm);     sPcm     = nullptr;
+}
+
+bool micFftStart() {
+  if (sTask) return true;
+  // 16-byte alignment for the S3 SIMD routines
+  sWindow  = (float*)heap_caps_aligned_alloc(16, MIC_FFT_N * sizeof(float), MALLOC_CAP_8BIT);
+  sSamples = (float*)heap_caps_aligned_alloc(16, MIC_FFT_N * sizeof(float), MALLOC_CAP_8BIT);
+  sData    = (float*)heap_caps_aligned_alloc(16, MIC_FFT_N * 2 * sizeof(float), MALLOC_CAP_8BIT);
+  sPcm     = (int16_t*)heap_caps_aligned_alloc(16, MIC_FFT_N * sizeof(int16_t), MALLOC_CAP_8BIT);
+  if (!sWindow || !sSamples || !sData || !sPcm) { freeBuffers(); return false; }
+  if (dsps_fft2r_init_fc32(nullptr, MIC_FFT_N) != ESP_OK) { freeBuffers(); return false; }
+  dsps_wind_hann_f32(sWindow, MIC_FFT_N);
+
+  i2s_config_t cfg = {};
+  cfg.mode                 = (i2s_mode_t)(I2S_MODE_MASTER | I2S_MODE_RX | I2S_MODE_PDM);
+  cfg.sample_rate          = MIC_RATE;
+  cfg.bits_per_sample      = I2S_BITS_PER_SAMPLE_16BIT;
+  cfg.channel_format       = I2S_CHANNEL_FMT_ONLY_RIGHT;
+  cfg.communication_format = I2S_COMM_FORMAT_STAND_I2S;
+  cfg.intr_alloc_flags     = ESP_INTR_FLAG_LEVEL1;
+  cfg.dma_buf_count        = kDmaBufs;                  // double buffered
+  cfg.dma_buf_len          = MIC_FFT_N;                 // one FFT frame per buffer
+  i2s_pin_config_t pins = {};
+  pins.mck_io_num   = I2S_PIN_NO_CHANGE;
+  pins.bck_io_num   = I2S_PIN_NO_CHANGE;
+  pins.ws_io_num    = MIC_CLK_PIN;
+  pins.data_out_num = I2S_PIN_NO_CHANGE;
+  pins.data_in_num  = MIC_DATA_PIN;
+  if (i2s_driver_install(kPort, &cfg, 0, nullptr) != ESP_OK) {
+    dsps_fft2r_deinit_fc32();
+    freeBuffers();
+    return false;
+  }
+  if (i2s_set_pin(kPort, &pins) != ESP_OK) { micFftStop(); return false; }
+
+  sHead = sTail = 0;
+  sLines = sDropped = sReadErrors = 0;
+  sRun = true;
+  if (xTaskCreatePinnedToCore(captureTask, "micfft", kTaskStack, nullptr, 3, &sTask, 0) != pdPASS) {
+    sTask = nullptr;
+    micFftStop();
+    return false;
+  }
+  return true;
+}
+
+void micFftStop() {
+  sRun = false;
+  while (sTask) vTaskDelay(pdMS_TO_TICKS(10));
+  if (!sWindow) return;
+  i2s_driver_uninstall(kPort);
+  dsps_fft2r_deinit_fc32();
+  freeBuffers();
+}
+
+bool micFftPop(uint8_t* line) {
+  uint32_t tail = sTail;
+  if (tail == __atomic_load_n(&sHead, __ATOMIC_ACQUIRE)) return false;
+  memcpy(line, sRing[tail & (kRingLines - 1)], MIC_BINS);
+  __atomic_store_n(&sTail, tail + 1, __ATOMIC_RELEASE);
+  return true;
+}
+
+MicFftStats micFftStats() {
+  MicFftStats s = {};
+  s.running      = sTask != nullptr;
+  s.lines        = sLines;
+  s.droppedLines = sDropped;
+  s.readErrors   = sReadErrors;
+  s.peakHz       = sPeakHz;
+  s.peakLevel    = sPeakLevel;
+  s.frameUs      = sFrameUs;
+  return s;
+}
+
+#else   // no PDM microphone on this board
+
+bool micFftStart() { return false; }
+void micFftStop() {}
+bool micFftPop(uint8_t*) { return false; }
+MicFftStats micFftStats() { return MicFftStats(); }
+
+#endif
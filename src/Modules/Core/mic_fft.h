@@ -0,0 +1,36 @@
+#pragma once
+#include <Arduino.h>
+
+// Microphone spectrum lines. The PDM microphone is read through the I2S
+// driver into two DMA buffers of MIC_FFT_N samples each, so one buffer fills
+// while the other is processed. A task on core 0 takes each buffer, applies a
+// precomputed Hann window and runs the ESP-DSP radix-2 FFT (the macros pick
+// the ESP32 assembly or the ESP32-S3 SIMD variant for the build target), and
+// turns the power spectrum into one line of MIC_BINS 8-bit levels on a dB
+// scale. Lines go through a small lock-free ring; when the UI falls behind
+// the newest lines are dropped and counted.
+//
+// Boards with a PDM microphone build with -DCONFIG_I2S_PDM_RX; pins default
+// to the board's microphone and can be overridden with -DMIC_CLK_PIN /
+// -DMIC_DATA_PIN. Elsewhere micFftStart() returns false.
+
+static constexpr uint32_t MIC_RATE    = 16000;
+static constexpr uint16_t MIC_FFT_N   = 256;            // samples per line: 16 ms, 62.5 Hz bins
+static constexpr uint16_t MIC_BINS    = MIC_FFT_N / 2;
+static constexpr int8_t   MIC_FLOOR_DB = -100;          // level 0
+static constexpr uint8_t  MIC_SPAN_DB  = 80;            // level 255 = floor + span
+
+struct MicFftStats {
+  bool     running;
+  uint32_t lines;
+  uint32_t droppedLines;    // ring full
+  uint32_t readErrors;
+  uint16_t peakHz;          // strongest bin of the last line
+  uint8_t  peakLevel;
+  uint16_t frameUs;         // window + FFT + levels, last line
+};
+
+bool micFftStart();
+void micFftStop();
+bool micFftPop(uint8_t* line);          // MIC_BINS levels, oldest first; false when empty
+MicFftStats micFftStats();
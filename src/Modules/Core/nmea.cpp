@@ -0,0 +1,226 @@
+#include "nmea.h"
+#include <string.h>
+
+static constexpr uint8_t kMaxFields = 24;
+
+// ─────────────────────────────────────────────────────────────────────────────
+// Field decoding (in place, NUL-terminated fields)
+// ─────────────────────────────────────────────────────────────────────────────
+static int hexValue(char c) {
+  if (c >= '0' && c <= '9') return c - '0';
+  if (c >= 'A' && c <= 'F') return c - 'A' + 10;
+  if (c >= 'a' && c <= 'f') return c - 'a' + 10;
+  return -1;
+}
+
+static bool digits(const char* s, uint8_t n, uint32_t& v) {
+  v = 0;
+  for (uint8_t i = 0; i < n; ++i) {
+    if (s[i] < '0' || s[i] > '9') return false;
+    v = v * 10 + (s[i] - '0');
+  }
+  return true;
+}
+
+// "-12.345" with dec = 2 → -1234; extra decimals are truncated, missing ones padded
+static bool fixedPoint(const char* s, uint8_t dec, int64_t& out) {
+  bool neg = *s == '-';
+  if (neg || *s == '+') s++;
+  int64_t v = 0;
+  bool any = false;
+  for (; *s >= '0' && *s <= '9'; ++s, any = true) v = v * 10 + (*s - '0');
+  uint8_t d = 0;
+  if (*s == '.') {
+    for (++s; *s >= '0' && *s <= '9'; ++s, any = true) {
+      if (d < dec) { v = v * 10 + (*s - '0'); d++; }
+    }
+  }
+  if (!any || *s) return false;
+  for (; d < dec; ++d) v *= 10;
+  out = neg ? -v : v;
+  return true;
+}
+
+template <typename T>
+static bool fixedAs(const char* s, uint8_t dec, T& out) {
+  int64_t v;
+  if (!fixedPoint(s, dec, v)) return false;
+  out = (T)v;
+  return true;
+}
+
+// (d)ddmm.mmmmm + hemisphere → degrees × 1e7
+static bool coord(const char* s, const char* hemi, int32_t& e7) {
+  int64_t v;                                          // ddmm × 1e5
+  if (!fixedPoint(s, 5, v) || v < 0) return false;
+  int64_t deg   = v / 10000000;
+  int64_t minE5 = v % 10000000;
+  if (minE5 >= 6000000) return false;                 // minutes ≥ 60
+  int64_t r = deg * 10000000 + minE5 * 5 / 3;         // minutes / 60 × 1e7
+  if (*hemi == 'S' || *hemi == 'W') r = -r;
+  else if (*hemi != 'N' && *hemi != 'E') return false;
+  e7 = (int32_t)r;
+  return true;
+}
+
+// hhmmss[.sss]
+static bool timeOfDay(const char* s, GpsFix& f) {
+  uint32_t h, m, sec;
+  if (!digits(s, 2, h) || !digits(s + 2, 2, m) || !digits(s + 4, 2, sec)) return false;
+  if (h > 23 || m > 59 || sec > 60) return false;
+  uint16_t ms = 0;
+  if (s[6] == '.') {
+    int64_t frac;
+    if (!fixedPoint(s + 6, 3, frac)) return false;    // ".25" → 250
+    ms = (uint16_t)frac;
+  } else if (s[6]) {
+    return false;
+  }
+  f.hour = h; f.minute = m; f.second = sec; f.millis = ms;
+  return true;
+}
+
+// ddmmyy
+static bool date(const char* s, GpsFix& f) {
+  uint32_t d, m, y;
+  if (strlen(s) != 6 || !digits(s, 2, d) || !digits(s + 2, 2, m) || !digits(s + 4, 2, y)) return false;
+  if (!d || d > 31 || !m || m > 12) return false;
+  f.day = d; f.month = m; f.year = 2000 + y;
+  return true;
+}
+
+// ─────────────────────────────────────────────────────────────────────────────
+// Sentences
+// ─────────────────────────────────────────────────────────────────────────────
+// $--GGA,time,lat,N,lon,E,quality,sats,hdop,alt,M,sep,M,age,station
+bool NmeaParser::applyGga(const char* const* f, uint8_t n) {
+  if (n < 10) return false;
+  uint32_t q;
+  if (!digits(f[6], 1, q)) return false;
+  _fix.quality = q;
+  if (*f[1]) timeOfDay(f[1], _fix);
+  if (q) {
+    int32_t lat, lon;
+    if (coord(f[2], f[3], lat) && coord(f[4], f[5], lon)) { _fix.latE7 = lat; _fix.lonE7 = lon; }
+    fixedAs(f[9], 2, _fix.altCm);
+  }
+  uint8_t sats;
+  if (fixedAs(f[7], 0, sats)) _fix.sats = sats;
+  fixedAs(f[8], 2, _fix.hdopX100);
+  _fix.valid = q > 0 || _rmcActive;
+  return true;
+}
+
+// $--RMC,time,status,lat,N,lon,E,knots,course,date,magvar,E[,mode[,navstatus]]
+bool NmeaParser::applyRmc(const char* const* f, uint8_t n) {
+  if (n < 10) return false;
+  _rmcActive = *f[2] == 'A';
+  if (*f[1]) timeOfDay(f[1], _fix);
+  if (*f[9]) date(f[9], _fix);
+  if (_rmcActive) {
+    int32_t lat, lon;
+    if (coord(f[3], f[4], lat) && coord(f[5], f[6], lon)) { _fix.latE7 = lat; _fix.lonE7 = lon; }
+    int64_t knotsX100;
+    if (fixedPoint(f[7], 2, knotsX100)) _fix.speedCmS = (uint32_t)(knotsX100 * 514444 / 1000000);
+    fixedAs(f[8], 2, _fix.courseX100);
+  }
+  _fix.valid = _rmcActive || _fix.quality > 0;
+  return true;
+}
+
+// $--GSA,mode,fix,sv×12,pdop,hdop,vdop[,system]
+bool NmeaParser::applyGsa(const char* const* f, uint8_t n) {
+  if (n < 18) return false;
+  uint32_t mode;
+  if (!digits(f[2], 1, mode)) return false;
+  _fix.mode = mode;
+  fixedAs(f[15], 2, _fix.pdopX100);
+  fixedAs(f[16], 2, _fix.hdopX100);
+  fixedAs(f[17], 2, _fix.vdopX100);
+  return true;
+}
+
+bool NmeaParser::apply() {
+  const char* f[kMaxFields];
+  uint8_t n = 0;
+  f[n++] = _buf;
+  for (uint8_t i = 0; i < _len; ++i) {
+    if (_buf[i] != ',') continue;
+    _buf[i] = '\0';
+    if (n == kMaxFields) break;
+    f[n++] = _buf + i + 1;
+  }
+  _buf[_len] = '\0';
+
+  size_t al = strlen(f[0]);
+  if (al < 5) { _stats.malformed++; return false; }
+  const char* type = f[0] + al - 3;
+  bool ok;
+  if      (!memcmp(type, "GGA", 3)) ok = applyGga(f, n);
+  else if (!memcmp(type, "RMC", 3)) ok = applyRmc(f, n);
+  else if (!memcmp(type, "GSA", 3)) ok = applyGsa(f, n);
+  else { _stats.ignored++; return false; }
+
+  if (!ok) { _stats.malformed++; return false; }
+  _stats.sentences++;
+  return true;
+}
+
+// ─────────────────────────────────────────────────────────────────────────────
+// Byte stream
+// ─────────────────────────────────────────────────────────────────────────────
+bool NmeaParser::feed(char c) {
+  if (c == '$') {                                     // always (re)starts a sentence
+    if (_state != State::IDLE) _stats.malformed++;
+    _state = State::BODY;
+    _len = 0;
+    _sum = 0;
+    return false;
+  }
+  switch (_state) {
+    case State::IDLE:
+      return false;
+
+    case State::BODY:
+      if (c == '*') { _state = State::SUM_HI; return false; }
+      if (c == '\r' || c == '\n' || _len == NMEA_MAX_SENTENCE) {
+        _stats.malformed++;                           // no checksum, or too long
+        _state = State::IDLE;
+        return false;
+      }
+      _buf[_len++] = c;
+      _sum ^= (uint8_t)c;
+      return false;
+
+    case State::SUM_HI: {
+      int v = hexValue(c);
+      if (v < 0) { _stats.malformed++; _state = State::IDLE; return false; }
+      _given = (uint8_t)(v << 4);
+      _state = State::SUM_LO;
+      return false;
+    }
+
+    case State::SUM_LO: {
+      _state = State::IDLE;
+      int v = hexValue(c);
+      if (v < 0)                    { _stats.malformed++;      return false; }
+      if ((_given | v) != _sum)     { _stats.checksumErrors++; return false; }
+      return apply();
+    }
+  }
+  return false;
+}
+
+size_t NmeaParser::feed(const char* data, size_t len) {
+  size_t applied = 0;
+  for (size_t i = 0; i < len; ++i) applied += feed(data[i]);
+  return applied;
+}
+
+void NmeaParser::reset() {
+  _state     = State::IDLE;
+  _len       = 0;
+  _rmcActive = false;
+  _fix       = {};
+  _stats     = {};
+}
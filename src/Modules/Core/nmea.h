@@ -0,0 +1,52 @@
+#pragma once
+#include <stdint.h>
+#include <stddef.h>
+#include "gps_fix.h"
+
+// Streaming NMEA 0183 parser for GGA, RMC and GSA from any talker (GP, GN,
+// GL, …). Bytes go in one at a time; a sentence is buffered only up to the
+// 82-character limit, its XOR checksum is folded in as it arrives and
+// verified at the end, and fields are then decoded in place from that
+// buffer — no allocation, no floats, no sscanf. Sentences without a
+// checksum, with a bad one, or longer than the limit are dropped and
+// counted.
+//
+// Each sentence updates only the fields it carries; fix() always holds the
+// latest value of each. No Arduino dependencies, so it runs on a host too.
+
+static constexpr uint8_t NMEA_MAX_SENTENCE = 82;    // '$' through checksum, per the standard
+
+struct NmeaStats {
+  uint32_t sentences;       // verified and applied
+  uint32_t ignored;         // verified, but a type we don't decode
+  uint32_t checksumErrors;
+  uint32_t malformed;       // no checksum, overlong, or bad fields
+};
+
+class NmeaParser {
+public:
+  // Returns true when a GGA, RMC or GSA sentence was applied to the fix
+  bool feed(char c);
+  size_t feed(const char* data, size_t len);      // number of sentences applied
+
+  const GpsFix&    fix()   const { return _fix; }
+  const NmeaStats& stats() const { return _stats; }
+  void reset();
+
+private:
+  enum class State : uint8_t { IDLE, BODY, SUM_HI, SUM_LO };
+
+  bool apply();
+  bool applyGga(const char* const* f, uint8_t n);
+  bool applyRmc(const char* const* f, uint8_t n);
+  bool applyGsa(const char* const* f, uint8_t n);
+
+  State     _state = State::IDLE;
+  char      _buf[NMEA_MAX_SENTENCE + 1];
+  uint8_t   _len   = 0;
+  uint8_t   _sum   = 0;
+  uint8_t   _given = 0;
+  bool      _rmcActive = false;
+  GpsFix    _fix   = {};
+  NmeaStats _stats = {};
+};
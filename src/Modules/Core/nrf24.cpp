@@ -0,0 +1,118 @@
+#include "nrf24.h"
+#include <SPI.h>
+
+#if defined(LILYGO_CC1101)
+  #include <TFT_eSPI.h>
+  // GPIO43/44 would be the obvious header pins, but they carry the UART0
+  // console on this env
+  #ifndef NRF24_CS_PIN
+    #define NRF24_CS_PIN 17
+  #endif
+  #ifndef NRF24_CE_PIN
+    #define NRF24_CE_PIN 7
+  #endif
+#elif defined(M5CARDPUTER)
+  #include "sdcard.h"
+  #ifndef NRF24_CS_PIN
+    #define NRF24_CS_PIN 1
+  #endif
+  #ifndef NRF24_CE_PIN
+    #define NRF24_CE_PIN 2
+  #endif
+#else
+  #ifndef NRF24_CS_PIN
+    #define NRF24_CS_PIN 33
+  #endif
+  #ifndef NRF24_CE_PIN
+    #define NRF24_CE_PIN 32
+  #endif
+  static constexpr int8_t kSck = 0, kMiso = 36, kMosi = 26;
+  static SPIClass sHspi(HSPI);                   // TFT owns VSPI
+#endif
+
+static constexpr uint32_t kSpiHz  = 8000000;
+static constexpr uint8_t  kWrite  = 0x20;
+static constexpr uint8_t  kPwrUp  = 0x02;
+static constexpr uint8_t  kEnCrc  = 0x08;
+
+static SPIClass* sSpi = nullptr;
+static SPISettings sSettings(kSpiHz, MSBFIRST, SPI_MODE0);
+
+// ─────────────────────────────────────────────────────────────────────────────
+// Bus
+// ─────────────────────────────────────────────────────────────────────────────
+static uint8_t frame(uint8_t cmd, uint8_t value) {
+  uint8_t out[2] = { cmd, value }, in[2];
+  digitalWrite(NRF24_CS_PIN, LOW);
+  sSpi->transferBytes(out, in, 2);
+  digitalWrite(NRF24_CS_PIN, HIGH);
+  return in[1];
+}
+
+void nrf24Lock()   { sSpi->beginTransaction(sSettings); }
+void nrf24Unlock() { sSpi->endTransaction(); }
+
+void    nrf24Write(uint8_t reg, uint8_t value) { frame(kWrite | reg, value); }
+uint8_t nrf24Read(uint8_t reg)                 { return frame(reg, NRF_NOP); }
+void    nrf24Ce(bool high)                     { digitalWrite(NRF24_CE_PIN, high); }
+
+void nrf24Command(uint8_t cmd) {
+  digitalWrite(NRF24_CS_PIN, LOW);
+  sSpi->transfer(cmd);
+  digitalWrite(NRF24_CS_PIN, HIGH);
+}
+
+// ─────────────────────────────────────────────────────────────────────────────
+// Lifecycle
+// ─────────────────────────────────────────────────────────────────────────────
+// UART0 (GPIO43/44) is the console on an S3 unless USB CDC carries it
+static bool consolePin(int pin) {
+#if CONFIG_IDF_TARGET_ESP32S3 && !ARDUINO_USB_CDC_ON_BOOT
+  return pin == 43 || pin == 44;
+#else
+  return false;
+#endif
+}
+
+bool nrf24Begin() {
+  if (consolePin(NRF24_CS_PIN) || consolePin(NRF24_CE_PIN)) {
+    Serial.println("[nrf24] NRF24_CS_PIN/NRF24_CE_PIN overlap the serial console");
+    return false;
+  }
+  pinMode(NRF24_CE_PIN, OUTPUT);
+  digitalWrite(NRF24_CE_PIN, LOW);
+  pinMode(NRF24_CS_PIN, OUTPUT);
+  digitalWrite(NRF24_CS_PIN, HIGH);
+#if defined(LILYGO_CC1101)
+  sSpi = &TFT_eSPI::getSPIinstance();             // shared with the display
+#elif defined(M5CARDPUTER)
+  sSpi = sdSpi();                                 // shared with the microSD slot
+#else
+  sHspi.begin(kSck, kMiso, kMosi, NRF24_CS_PIN);
+  sSpi = &sHspi;
+#endif
+  if (!sSpi) return false;
+  delay(5);                                       // power-on reset
+
+  // No register reads back on an empty header: SETUP_AW and RF_CH must hold
+  // what was written
+  nrf24Lock();
+  nrf24Write(NRF_CONFIG, kEnCrc);                 // powered down
+  nrf24Write(NRF_SETUP_AW, 0x01);
+  nrf24Write(NRF_RF_CH, 0x4C);
+  bool ok = nrf24Read(NRF_SETUP_AW) == 0x01 && nrf24Read(NRF_RF_CH) == 0x4C;
+  nrf24Write(NRF_SETUP_AW, 0x03);
+  nrf24Unlock();
+  if (!ok) sSpi = nullptr;
+  return ok;
+}
+
+void nrf24End() {
+  if (!sSpi) return;
+  nrf24Ce(false);
+  nrf24Lock();
+  uint8_t config = nrf24Read(NRF_CONFIG);
+  nrf24Write(NRF_CONFIG, config & ~kPwrUp);
+  nrf24Unlock();
+  sSpi = nullptr;
+}
@@ -0,0 +1,46 @@
+#pragma once
+#include <Arduino.h>
+
+// Minimal nRF24L01+ access: register I/O, commands and the CE line, for an
+// external module. Every access happens between nrf24Lock() and
+// nrf24Unlock(), which take and release the SPI bus once, so a batch of
+// register frames costs one bus transaction plus a chip-select pulse per
+// frame. Each frame is a single transferBytes() call.
+//
+// The bus is whatever the board already runs there: the display bus on the
+// lilygo-cc1101, the microSD bus on the Cardputer, and HSPI on the hat pins
+// of the M5Sticks. CS and CE default to the Grove / hat pins (GPIO17 / 7 on
+// the lilygo-cc1101, whose GPIO43/44 are the UART0 console) and can be
+// overridden with -DNRF24_CS_PIN / -DNRF24_CE_PIN; nrf24Begin() refuses
+// console pins. On the Sticks and the Cardputer they are the GPS pins, so
+// only one can be wired.
+
+static constexpr uint8_t NRF_CHANNELS = 126;      // 2400 … 2525 MHz
+
+enum : uint8_t {
+  NRF_CONFIG     = 0x00,
+  NRF_EN_AA      = 0x01,
+  NRF_EN_RXADDR  = 0x02,
+  NRF_SETUP_AW   = 0x03,
+  NRF_SETUP_RETR = 0x04,
+  NRF_RF_CH      = 0x05,
+  NRF_RF_SETUP   = 0x06,
+  NRF_STATUS     = 0x07,
+  NRF_RPD        = 0x09,
+  NRF_DYNPD      = 0x1C,
+  NRF_FEATURE    = 0x1D,
+};
+
+enum : uint8_t {
+  NRF_FLUSH_RX   = 0xE2,
+  NRF_NOP        = 0xFF,
+};
+
+bool    nrf24Begin();                   // pins, bus, chip check; leaves the radio powered down
+void    nrf24End();                     // power down
+void    nrf24Lock();
+void    nrf24Unlock();
+void    nrf24Write(uint8_t reg, uint8_t value);
+uint8_t nrf24Read(uint8_t reg);
+void    nrf24Command(uint8_t cmd);
+void    nrf24Ce(bool high);
@@ -0,0 +1,85 @@
+#include "nrf_scan.h"
+
+static constexpr uint32_t kSettleUs  = 130;      // RX settling after CE rises, RPD included
+static constexpr uint8_t  kDecay     = 3;        // level loses 1/8 per sweep
+static constexpr uint16_t kHit       = NRF_SCAN_FULL >> kDecay;
+
+static uint16_t sLevel[NRF_CHANNELS];
+static uint32_t sSweeps = 0, sHits = 0, sLastUs = 0;
+static bool     sUp = false;
+
+// ─────────────────────────────────────────────────────────────────────────────
+// Sweep
+// ─────────────────────────────────────────────────────────────────────────────
+uint32_t nrfScanSweep() {
+  if (!sUp) return 0;
+  uint8_t hit[NRF_CHANNELS];
+  uint32_t t0 = micros();
+  nrf24Lock();
+  for (uint8_t ch = 0; ch < NRF_CHANNELS; ++ch) {
+    nrf24Write(NRF_RF_CH, ch);
+    nrf24Ce(true);
+    delayMicroseconds(kSettleUs);
+    nrf24Ce(false);
+    hit[ch] = nrf24Read(NRF_RPD) & 0x01;
+  }
+  nrf24Unlock();
+  sLastUs = micros() - t0;
+
+  for (uint8_t ch = 0; ch < NRF_CHANNELS; ++ch) {
+    sLevel[ch] -= sLevel[ch] >> kDecay;
+    if (hit[ch]) {
+      sLevel[ch] += kHit;
+      sHits++;
+    }
+  }
+  sSweeps++;
+  return sLastUs;
+}
+
+// ─────────────────────────────────────────────────────────────────────────────
+// Public API
+// ─────────────────────────────────────────────────────────────────────────────
+bool nrfScanBegin() {
+  if (sUp) return true;
+  if (!nrf24Begin()) return false;
+  nrf24Lock();
+  nrf24Write(NRF_EN_AA, 0x00);                    // listen only: no auto-ack
+  nrf24Write(NRF_EN_RXADDR, 0x00);
+  nrf24Write(NRF_SETUP_RETR, 0x00);
+  nrf24Write(NRF_DYNPD, 0x00);
+  nrf24Write(NRF_FEATURE, 0x00);
+  nrf24Write(NRF_RF_SETUP, 0x06);                 // 1 Mbps
+  nrf24Write(NRF_STATUS, 0x70);
+  nrf24Command(NRF_FLUSH_RX);
+  nrf24Write(NRF_CONFIG, 0x0B);                   // CRC on, powered up, PRIM_RX
+  nrf24Unlock();
+  delay(2);                                       // crystal start-up (Tpd2stby 1.5 ms)
+
+  nrfScanClear();
+  sSweeps = sHits = sLastUs = 0;
+  sUp = true;
+  return true;
+}
+
+void nrfScanEnd() {
+  if (!sUp) return;
+  sUp = false;
+  nrf24End();
+}
+
+const uint16_t* nrfScanLevels() { return sLevel; }
+
+void nrfScanClear() { memset(sLevel, 0, sizeof(sLevel)); }
+
+NrfScanStats nrfScanStats() {
+  NrfScanStats s = {};
+  s.running     = sUp;
+  s.sweeps      = sSweeps;
+  s.lastSweepUs = sLastUs;
+  s.hits        = sHits;
+  for (uint8_t ch = 1; ch < NRF_CHANNELS; ++ch) {
+    if (sLevel[ch] > sLevel[s.busiest]) s.busiest = ch;
+  }
+  return s;
+}
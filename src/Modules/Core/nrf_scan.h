@@ -0,0 +1,31 @@
+#pragma once
+#include <Arduino.h>
+#include "nrf24.h"
+
+// Receive-only 2.4 GHz channel activity scan with an nRF24L01+. Each sweep
+// tunes all 126 channels in turn and reads the Received Power Detector bit
+// (carrier above about -64 dBm for 40 µs). Hits feed a decaying per-channel
+// level, so steady interference builds a tall bar and a single burst fades
+// over a few hundred milliseconds.
+//
+// A sweep holds the SPI bus for its whole length and spends two 2-byte
+// frames per channel; its duration is almost entirely the 130 µs the radio
+// needs to settle in RX after each retune. Sweeps run from the caller's
+// task (the UI loop), because the bus may be shared with the display.
+
+static constexpr uint16_t NRF_SCAN_FULL = 4096;   // level of a channel busy on every sweep
+
+struct NrfScanStats {
+  bool     running;
+  uint32_t sweeps;
+  uint32_t lastSweepUs;
+  uint32_t hits;                // all channels, since start
+  uint8_t  busiest;             // channel with the highest level
+};
+
+bool     nrfScanBegin();
+void     nrfScanEnd();
+uint32_t nrfScanSweep();                         // one full sweep; µs taken, 0 when not running
+const uint16_t* nrfScanLevels();                 // NRF_CHANNELS entries, 0 … NRF_SCAN_FULL
+void     nrfScanClear();
+NrfScanStats nrfScanStats();
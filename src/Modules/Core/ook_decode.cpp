@@ -0,0 +1,233 @@
+#include "ook_decode.h"
+#include <string.h>
+#include <stdlib.h>
+
+// ─────────────────────────────────────────────────────────────────────────────
+// Bit rows
+// ─────────────────────────────────────────────────────────────────────────────
+uint32_t OokBits::take(uint8_t row, uint8_t first, uint8_t n) const {
+  uint32_t v = 0;
+  for (uint8_t i = 0; i < n; ++i) v = (v << 1) | bit(row, first + i);
+  return v;
+}
+
+static bool samePrefix(const OokBits& b, uint8_t r1, uint8_t r2, uint8_t n) {
+  uint8_t whole = n >> 3;
+  if (memcmp(b.data[r1], b.data[r2], whole)) return false;
+  if (!(n & 7)) return true;
+  uint8_t mask = 0xFF << (8 - (n & 7));
+  return !((b.data[r1][whole] ^ b.data[r2][whole]) & mask);
+}
+
+int OokBits::repeatedRow(uint8_t len, uint8_t repeats, uint8_t cmp) const {
+  for (uint8_t r = 0; r < rows; ++r) {
+    if (bits[r] != len) continue;
+    uint8_t seen = 1;
+    for (uint8_t k = r + 1; k < rows && seen < repeats; ++k) {
+      if (bits[k] == len && samePrefix(*this, r, k, cmp)) seen++;
+    }
+    if (seen >= repeats) return r;
+  }
+  return -1;
+}
+
+// ─────────────────────────────────────────────────────────────────────────────
+// Slicers
+// ─────────────────────────────────────────────────────────────────────────────
+struct RowWriter {
+  OokBits& b;
+  bool     open = false;
+
+  void bit(bool v) {
+    if (!open) {
+      if (b.rows == OOK_MAX_ROWS) return;
+      b.bits[b.rows] = 0;
+      memset(b.data[b.rows], 0, sizeof(b.data[0]));
+      b.rows++;
+      open = true;
+    }
+    uint8_t r = b.rows - 1;
+    if (b.bits[r] == OOK_ROW_BITS) return;
+    if (v) b.data[r][b.bits[r] >> 3] |= 0x80 >> (b.bits[r] & 7);
+    b.bits[r]++;
+  }
+  void end() { open = false; }
+};
+
+// Widths between half the short and 1.5× the long width are bits; the
+// midpoint splits short from long
+static int classify(uint16_t w, const OokDecoder& d) {
+  if (w < d.shortUs / 2 || w > d.longUs + (d.longUs - d.shortUs) / 2) return -1;
+  return w <= (d.shortUs + d.longUs) / 2 ? 0 : 1;
+}
+
+static void slicePwm(const OokPulses& p, const OokDecoder& d, RowWriter& w) {
+  for (uint16_t i = 0; i < p.count; ++i) {
+    int c = classify(p.pulse[i], d);
+    if (c < 0) w.end();
+    else       w.bit(c == 0);
+    if (p.gap[i] > d.gapUs) w.end();
+  }
+}
+
+static void slicePpm(const OokPulses& p, const OokDecoder& d, RowWriter& w) {
+  for (uint16_t i = 0; i < p.count; ++i) {
+    int c = p.gap[i] > d.gapUs ? -1 : classify(p.gap[i], d);
+    if (c < 0) w.end();
+    else       w.bit(c == 1);
+  }
+}
+
+// rtl_433's zero-bit Manchester: the first rising edge of a row is taken as
+// the middle of a 0 bit. From there an edge more than 1.5 half-bits after
+// the last mid-bit edge is itself mid-bit (falling = 1, rising = 0); nearer
+// ones are bit boundaries. A width outside ½ … 2½ half-bits ends the row.
+static void sliceManchester(const OokPulses& p, const OokDecoder& d, RowWriter& w) {
+  const uint16_t t    = d.shortUs;
+  const uint16_t lo   = t / 2, hi = 2 * t + t / 2;
+  const uint32_t edge = t + t / 2;
+  bool     start = true;
+  uint32_t since = 0;                       // µs since the last mid-bit edge
+  for (uint16_t i = 0; i < p.count; ++i) {
+    if (p.pulse[i] < lo || p.pulse[i] > hi) { w.end(); start = true; continue; }
+    if (start) { w.bit(0); since = 0; start = false; }    // rising edge
+    if (since + p.pulse[i] > edge) { w.bit(1); since = 0; }   // falling edge
+    else                           since += p.pulse[i];
+    if (p.gap[i] > d.gapUs || p.gap[i] < lo || p.gap[i] > hi) { w.end(); start = true; continue; }
+    if (since + p.gap[i] > edge) { w.bit(0); since = 0; }     // next rising edge
+    else                         since += p.gap[i];
+  }
+}
+
+void ookSlice(const OokPulses& p, const OokDecoder& d, OokBits& out) {
+  out.rows = 0;
+  RowWriter w{ out };
+  switch (d.mod) {
+    case OokMod::PWM:        slicePwm(p, d, w);        break;
+    case OokMod::PPM:        slicePpm(p, d, w);        break;
+    case OokMod::MANCHESTER: sliceManchester(p, d, w); break;
+  }
+}
+
+// ─────────────────────────────────────────────────────────────────────────────
+// Decoders
+// ─────────────────────────────────────────────────────────────────────────────
+static uint16_t crc16(const uint8_t* d, size_t n, uint16_t poly, uint16_t init) {
+  uint16_t c = init;
+  for (size_t i = 0; i < n; ++i) {
+    c ^= (uint16_t)d[i] << 8;
+    for (uint8_t k = 0; k < 8; ++k) c = c & 0x8000 ? (c << 1) ^ poly : c << 1;
+  }
+  return c;
+}
+
+// EV1527 / PT2262-style learning-code remotes: 24 bits, 20-bit ID and four
+// key bits, T ≈ 350 µs. A 0 is 1T high 3T low, so bits come out inverted;
+// the 1T sync pulse before the 31T gap lands as a 25th (short) bit.
+static bool decodeEv1527(const OokBits& b, OokReading& r) {
+  int row = b.repeatedRow(25, 2, 25);
+  if (row < 0 || !b.bit(row, 24)) return false;
+  uint32_t code = ~b.take(row, 0, 24) & 0xFFFFFF;
+  if (code == 0 || code == 0xFFFFFF) return false;
+  r.id    = code >> 4;
+  r.state = code & 0x0F;
+  r.flags = OOK_HAS_STATE;
+  return true;
+}
+
+// Nexus / Sencor / Rubicson-style thermo-hygrometers: 36 bits repeated ~10×,
+// 500 µs pulses with 1 ms (0) and 2 ms (1) gaps. ID 8, battery-OK 1, 0,
+// channel 2, temperature 12 (signed, 0.1 °C), 0xF 4, humidity 8.
+static bool decodeNexus(const OokBits& b, OokReading& r) {
+  int row = b.repeatedRow(36, 3, 36);
+  if (row < 0 || b.take(row, 24, 4) != 0xF) return false;
+  int16_t temp = (int16_t)(b.take(row, 12, 12) << 4) >> 4;
+  uint8_t hum  = b.take(row, 28, 8);
+  if (hum > 100 || temp < -500 || temp > 700) return false;
+  r.id       = b.take(row, 0, 8);
+  r.channel  = b.take(row, 10, 2) + 1;
+  r.tempC10  = temp;
+  r.humidity = hum;
+  r.flags    = OOK_HAS_TEMP | OOK_HAS_CHANNEL | (hum ? OOK_HAS_HUMIDITY : 0) | (b.bit(row, 8) ? 0 : OOK_BATTERY_LOW);
+  return true;
+}
+
+// Honeywell 5800 / 2GIG door-window and motion sensors: Manchester with a
+// 156 µs half bit. Preamble 0xFFFE, channel 4, ID 20, event 8 (0x08 =
+// battery low), CRC-16 over the 4 bytes before it; poly 0x8005, or 0x8050
+// on channels 2, 4 and A.
+static bool decodeHoneywell(const OokBits& b, OokReading& r) {
+  for (uint8_t row = 0; row < b.rows; ++row) {
+    if (b.bits[row] < 64) continue;
+    for (uint8_t at = 0; at + 64 <= b.bits[row]; ++at) {
+      if (b.take(row, at, 16) != 0xFFFE) continue;
+      uint8_t  ch    = b.take(row, at + 16, 4);
+      uint32_t id    = b.take(row, at + 20, 20);
+      uint8_t  event = b.take(row, at + 40, 8);
+      uint16_t crc   = b.take(row, at + 48, 16);
+      uint8_t  msg[4] = { (uint8_t)(ch << 4 | id >> 16), (uint8_t)(id >> 8), (uint8_t)id, event };
+      uint16_t poly  = ch == 0x2 || ch == 0x4 || ch == 0xA ? 0x8050 : 0x8005;
+      if (crc16(msg, 4, poly, 0) != crc) continue;
+      r.id      = id;
+      r.channel = ch;
+      r.state   = event;
+      r.flags   = OOK_HAS_CHANNEL | OOK_HAS_STATE | (event & 0x08 ? OOK_BATTERY_LOW : 0);
+      return true;
+    }
+  }
+  return false;
+}
+
+const OokDecoder OOK_DECODERS[] = {
+  { "EV1527",    OokMod::PWM,        350, 1050, 3000, decodeEv1527 },
+  { "Nexus-TH",  OokMod::PPM,        1000, 2000, 3000, decodeNexus },
+  { "Honeywell", OokMod::MANCHESTER, 156,  0,    400,  decodeHoneywell },
+};
+const uint8_t OOK_DECODER_COUNT = sizeof(OOK_DECODERS) / sizeof(OOK_DECODERS[0]);
+
+size_t ookDecode(const OokPulses& p, OokReading* out, size_t max, const OokDecoder* table, uint8_t count) {
+  OokBits bits;
+  size_t n = 0;
+  for (uint8_t i = 0; i < count && n < max; ++i) {
+    ookSlice(p, table[i], bits);
+    if (!bits.rows) continue;
+    OokReading r = {};
+    r.model = table[i].name;
+    if (table[i].decode(bits, r)) out[n++] = r;
+  }
+  return n;
+}
+
+// ─────────────────────────────────────────────────────────────────────────────
+// Pulse files
+// ─────────────────────────────────────────────────────────────────────────────
+static uint16_t clampUs(long v) { return v < 0 ? 0 : v > 0xFFFF ? 0xFFFF : (uint16_t)v; }
+
+bool ookReadPulses(FILE* f, OokPulses& out) {
+  char line[64];
+  out.count = 0;
+  while (fgets(line, sizeof(line), f)) {
+    if (line[0] == ';') {
+      if (!strncmp(line, ";ook", 4)) out.count = 0;
+      else if (!strncmp(line, ";end", 4) && out.count) return true;
+      continue;
+    }
+    char* end;
+    long pulse = strtol(line, &end, 10);
+    if (end == line) continue;
+    long gap = strtol(end, nullptr, 10);
+    if (out.count < OOK_MAX_PULSES) {
+      out.pulse[out.count] = clampUs(pulse);
+      out.gap[out.count]   = clampUs(gap);
+      out.count++;
+    }
+  }
+  return out.count > 0;                    // last train without ";end"
+}
+
+bool ookWritePulses(FILE* f, const OokPulses& p) {
+  if (ftell(f) == 0) fputs(";pulse data\n;version 1\n;timescale 1us\n", f);
+  fprintf(f, ";ook %u pulses\n", p.count);
+  for (uint16_t i = 0; i < p.count; ++i) fprintf(f, "%u %u\n", p.pulse[i], p.gap[i]);
+  return fputs(";end\n", f) >= 0;
+}
@@ -0,0 +1,85 @@
+#pragma once
+#include <stdint.h>
+#include <stddef.h>
+#include <stdio.h>
+
+// OOK/ASK pulse-train decoding for sub-GHz sensors and remotes, table-driven
+// in the style of rtl_433. A train is a list of (pulse, gap) widths in µs.
+// Each decoder names a slicer and its timings:
+//
+//   PWM         the pulse width carries the bit: short = 1, long = 0
+//   PPM         the gap width carries the bit: short = 0, long = 1
+//   MANCHESTER  half-bit shortUs, rtl_433's "zero bit" variant: the first
+//               rising edge is the middle of a 0 bit; later mid-bit edges
+//               are falling = 1, rising = 0
+//
+// A gap longer than gapUs, or a width the slicer can't place, ends the row.
+// The slicer fills an OokBits (rows of up to 128 bits) and the decoder's
+// callback turns that into a reading or rejects it. Adding a protocol is a
+// callback plus a row in OOK_DECODERS (ook_decode.cpp).
+//
+// Pulse files use rtl_433's OOK text format (";ook N pulses", one
+// "pulse gap" pair per line in µs, ";end"), so recordings from rtl_433 -w
+// and from the device can be replayed against the decoders. No Arduino
+// dependencies: tools/ook_bench.cpp builds this file on a host.
+
+static constexpr uint16_t OOK_MAX_PULSES = 1024;
+static constexpr uint8_t  OOK_MAX_ROWS   = 32;
+static constexpr uint8_t  OOK_ROW_BITS   = 128;
+
+struct OokPulses {
+  uint16_t count;
+  uint16_t pulse[OOK_MAX_PULSES];           // µs high
+  uint16_t gap[OOK_MAX_PULSES];             // µs low after the pulse
+};
+
+struct OokBits {
+  uint8_t rows;
+  uint8_t bits[OOK_MAX_ROWS];
+  uint8_t data[OOK_MAX_ROWS][OOK_ROW_BITS / 8];   // MSB first
+
+  bool     bit(uint8_t row, uint8_t i) const { return data[row][i >> 3] & (0x80 >> (i & 7)); }
+  uint32_t take(uint8_t row, uint8_t first, uint8_t n) const;   // n ≤ 32, MSB first
+  // A row of exactly `len` bits whose first `cmp` bits repeat in at least
+  // `repeats` rows of that length; -1 if none
+  int      repeatedRow(uint8_t len, uint8_t repeats, uint8_t cmp) const;
+};
+
+enum class OokMod : uint8_t { PWM, PPM, MANCHESTER };
+
+enum : uint8_t {
+  OOK_HAS_TEMP     = 0x01,
+  OOK_HAS_HUMIDITY = 0x02,
+  OOK_HAS_CHANNEL  = 0x04,
+  OOK_HAS_STATE    = 0x08,
+  OOK_BATTERY_LOW  = 0x10,
+};
+
+struct OokReading {
+  const char* model;
+  uint32_t    id;
+  uint8_t     channel;
+  uint8_t     state;                        // buttons / event bits, per model
+  int16_t     tempC10;
+  uint8_t     humidity;
+  uint8_t     flags;
+};
+
+struct OokDecoder {
+  const char* name;
+  OokMod      mod;
+  uint16_t    shortUs;
+  uint16_t    longUs;                       // unused for MANCHESTER
+  uint16_t    gapUs;
+  bool      (*decode)(const OokBits& bits, OokReading& out);
+};
+
+extern const OokDecoder OOK_DECODERS[];
+extern const uint8_t    OOK_DECODER_COUNT;
+
+void   ookSlice(const OokPulses& p, const OokDecoder& d, OokBits& out);
+size_t ookDecode(const OokPulses& p, OokReading* out, size_t max,
+                 const OokDecoder* table = OOK_DECODERS, uint8_t count = OOK_DECODER_COUNT);
+
+bool   ookReadPulses(FILE* f, OokPulses& out);          // next train; false at end of file
+bool   ookWritePulses(FILE* f, const OokPulses& p);     // file header first if f is empty
@@ -0,0 +1,256 @@
+#include "ook_rx.h"
+#include "cc1101.h"
+
+#if defined(LILYGO_CC1101)
+#include <driver/rmt.h>
+
+static constexpr rmt_channel_t kChannel    = RMT_CHANNEL_4;   // S3: RX channels are 4–7
+static constexpr uint8_t       kClkDiv     = 80;              // 1 tick = 1 µs
+static constexpr uint8_t       kMemBlocks  = 4;               // 4 × 48 items
+static constexpr uint8_t       kFilterApb  = 200;             // glitches under 2.5 µs
+static constexpr uint32_t      kRingBytes  = 8192;
+static constexpr uint32_t      kJoinMs     = 30;
+static constexpr uint32_t      kIdleMs     = 250;             // worker checks sRun at least this often
+static constexpr uint16_t      kMinPulses  = 16;              // shorter receptions are noise
+static constexpr uint32_t      kTaskStack  = 4096;
+static constexpr uint8_t       kMaxReadings = 4;
+
+// Asynchronous serial OOK receive: data straight to GDO0, no packet
+// handling, 203 kHz filter, calibration on every IDLE → RX
+static const uint8_t kConfig[][2] = {
+  { CC_IOCFG0,   0x0D },
+  { CC_PKTCTRL0, 0x32 },
+  { CC_FSCTRL1,  0x06 },
+  { CC_FSCTRL0,  0x00 },
+  { CC_MDMCFG4,  0x87 },
+  { CC_MDMCFG3,  0x32 },
+  { CC_MDMCFG2,  0x30 },
+  { CC_MCSM0,    0x18 },
+  { CC_AGCCTRL2, 0x07 },
+  { CC_AGCCTRL1, 0x00 },
+  { CC_AGCCTRL0, 0x91 },
+  { CC_FREND1,   0x56 },
+  { CC_FREND0,   0x11 },
+  { CC_FSCAL3,   0xE9 },
+  { CC_FSCAL2,   0x2A },
+  { CC_FSCAL1,   0x00 },
+  { CC_FSCAL0,   0x1F },
+  { CC_TEST2,    0x81 },
+  { CC_TEST1,    0x35 },
+  { CC_TEST0,    0x09 },
+};
+
+static RingbufHandle_t   sRing  = nullptr;
+static TaskHandle_t      sTask  = nullptr;
+static volatile bool     sRun   = false;
+static portMUX_TYPE      sLock  = portMUX_INITIALIZER_UNLOCKED;
+
+static OokPulses         sTrain;                  // worker only
+static OokPulses         sLast;                   // under sLock
+static OokRxEntry        sList[OOK_RX_MAX_DEVS];  // under sLock, newest first
+static uint8_t           sCount = 0;
+static volatile uint32_t sGen = 0;
+static volatile uint32_t sReceptions = 0, sNoise = 0, sTrains = 0, sReadings = 0;
+
+// ─────────────────────────────────────────────────────────────────────────────
+// RMT items → pulses
+// ─────────────────────────────────────────────────────────────────────────────
+struct Appender {
+  OokPulses& p;
+  uint32_t   high = 0, low = 0;
+
+  void level(bool hi, uint32_t us) {
+    if (hi) {
+      if (low) flush(low);
+      high += us;
+    } else if (high) {
+      low += us;
+    }
+  }
+  void flush(uint32_t gap) {
+    if (p.count < OOK_MAX_PULSES) {
+      p.pulse[p.count] = min<uint32_t>(high, 0xFFFF);
+      p.gap[p.count]   = min<uint32_t>(gap, 0xFFFF);
+      p.count++;
+    }
+    high = low = 0;
+  }
+};
+
+static void append(const rmt_item32_t* items, size_t n) {
+  uint16_t start = sTrain.count;
+  Appender a{ sTrain };
+  for (size_t i = 0; i < n; ++i) {
+    if (!items[i].duration0) break;
+    a.level(items[i].level0, items[i].duration0);
+    if (!items[i].duration1) break;
+    a.level(items[i].level1, items[i].duration1);
+  }
+  if (a.high) a.flush(OOK_RX_IDLE_US);            // the idle time that ended the reception
+  sReceptions++;
+  if (sTrain.count - start < kMinPulses) {
+    sTrain.count = start;
+    sNoise++;
+  }
+}
+
+// ─────────────────────────────────────────────────────────────────────────────
+// Live list
+// ─────────────────────────────────────────────────────────────────────────────
+static bool sameDevice(const OokReading& a, const OokReading& b) {
+  return a.model == b.model && a.id == b.id && a.channel == b.channel;
+}
+
+static void merge(const OokReading& r, uint32_t now) {
+  uint8_t i = 0;
+  while (i < sCount && !sameDevice(sList[i].reading, r)) ++i;
+  uint16_t seen = 0;
+  if (i == sCount) {                              // new: the oldest falls off a full list
+    if (sCount < OOK_RX_MAX_DEVS) sCount++;
+    i = sCount - 1;
+  } else {
+    seen = sList[i].count;
+  }
+  memmove(&sList[1], &sList[0], i * sizeof(OokRxEntry));
+  sList[0] = { r, now, (uint16_t)(seen + 1) };
+}
+
+static void finishTrain() {
+  OokReading out[kMaxReadings];
+  size_t n = ookDecode(sTrain, out, kMaxReadings);
+  uint32_t now = millis();
+  portENTER_CRITICAL(&sLock);
+  for (size_t i = 0; i < n; ++i) merge(out[i], now);
+  sLast.count = sTrain.count;
+  memcpy(sLast.pulse, sTrain.pulse, sTrain.count * sizeof(uint16_t));
+  memcpy(sLast.gap, sTrain.gap, sTrain.count * sizeof(uint16_t));
+  portEXIT_CRITICAL(&sLock);
+  sReadings += n;
+  sTrains++;
+  sGen++;
+  sTrain.count = 0;
+}
+
+// ─────────────────────────────────────────────────────────────────────────────
+// Worker task
+// ─────────────────────────────────────────────────────────────────────────────
+static void rxTask(void*) {
+  while (sRun) {
+    size_t bytes = 0;
+    TickType_t wait = pdMS_TO_TICKS(sTrain.count ? kJoinMs : kIdleMs);
+    auto* items = (rmt_item32_t*)xRingbufferReceive(sRing, &bytes, wait);
+    if (!items) {
+      if (sTrain.count) finishTrain();
+      continue;
+    }
+    append(items, bytes / sizeof(rmt_item32_t));
+    vRingbufferReturnItem(sRing, items);
+    if (sTrain.count > OOK_MAX_PULSES - kMemBlocks * 48) finishTrain();   // next one might not fit
+  }
+  sTask = nullptr;
+  vTaskDelete(nullptr);
+}
+
+// ─────────────────────────────────────────────────────────────────────────────
+// Public API
+// ─────────────────────────────────────────────────────────────────────────────
+static void tune(uint32_t hz) {
+  uint32_t w = (uint32_t)(((uint64_t)hz << 16) / CC1101_XOSC_HZ);
+  uint8_t freq[3] = { (uint8_t)(w >> 16), (uint8_t)(w >> 8), (uint8_t)w };
+  cc1101Strobe(CC_SIDLE);
+  cc1101WriteBurst(CC_FREQ2, freq, 3);
+  cc1101Antenna(hz);
+  cc1101Strobe(CC_SRX);                           // MCSM0 calibrates on the way
+}
+
+bool ookRxStart(uint32_t hz) {
+  if (sTask) return true;
+  if (!cc1101Begin()) return false;
+  for (const auto& r : kConfig) cc1101Write(r[0], r[1]);
+  tune(hz);
+
+  rmt_config_t cfg = RMT_DEFAULT_CONFIG_RX((gpio_num_t)cc1101Gdo0Pin(), kChannel);
+  cfg.clk_div                       = kClkDiv;
+  cfg.mem_block_num                 = kMemBlocks;
+  cfg.rx_config.filter_en           = true;
+  cfg.rx_config.filter_ticks_thresh = kFilterApb;
+  cfg.rx_config.idle_threshold      = OOK_RX_IDLE_US;
+  if (rmt_config(&cfg) != ESP_OK || rmt_driver_install(kChannel, kRingBytes, 0) != ESP_OK) {
+    cc1101End();
+    return false;
+  }
+  rmt_get_ringbuf_handle(kChannel, &sRing);
+
+  sTrain.count = 0;
+  sReceptions = sNoise = sTrains = sReadings = 0;
+  sRun = true;
+  if (xTaskCreatePinnedToCore(rxTask, "ookrx", kTaskStack, nullptr, 2, &sTask, 0) != pdPASS) {
+    sTask = nullptr;
+    sRun  = false;
+    rmt_driver_uninstall(kChannel);
+    cc1101End();
+    return false;
+  }
+  rmt_rx_start(kChannel, true);
+  return true;
+}
+
+void ookRxStop() {
+  if (!sTask) return;
+  rmt_rx_stop(kChannel);
+  sRun = false;
+  while (sTask) vTaskDelay(pdMS_TO_TICKS(10));
+  rmt_driver_uninstall(kChannel);
+  sRing = nullptr;
+  cc1101End();
+}
+
+uint8_t ookRxList(OokRxEntry* out, uint8_t max) {
+  portENTER_CRITICAL(&sLock);
+  uint8_t n = min(max, sCount);
+  memcpy(out, sList, n * sizeof(OokRxEntry));
+  portEXIT_CRITICAL(&sLock);
+  return n;
+}
+
+bool ookRxLastTrain(OokPulses& out) {
+  portENTER_CRITICAL(&sLock);
+  out.count = sLast.count;
+  memcpy(out.pulse, sLast.pulse, sLast.count * sizeof(uint16_t));
+  memcpy(out.gap, sLast.gap, sLast.count * sizeof(uint16_t));
+  portEXIT_CRITICAL(&sLock);
+  return out.count > 0;
+}
+
+void ookRxClear() {
+  portENTER_CRITICAL(&sLock);
+  sCount = 0;
+  portEXIT_CRITICAL(&sLock);
+  sGen++;
+}
+
+#else   // no CC1101 on this board
+
+static volatile uint32_t sGen = 0;
+static volatile uint32_t sReceptions = 0, sNoise = 0, sTrains = 0, sReadings = 0;
+static void* sTask = nullptr;
+
+bool    ookRxStart(uint32_t) { return false; }
+void    ookRxStop() {}
+uint8_t ookRxList(OokRxEntry*, uint8_t) { return 0; }
+bool    ookRxLastTrain(OokPulses& out) { out.count = 0; return false; }
+void    ookRxClear() {}
+
+#endif
+
+uint32_t ookRxGeneration() { return sGen; }
+
+OokRxStats ookRxStats() {
+  OokRxStats s = {};
+  s.running    = sTask != nullptr;
+  s.receptions = sReceptions;
+  s.noise      = sNoise;
+  s.trains     = sTrains;
+  s.readings   = sReadings;
+  return s;
+}
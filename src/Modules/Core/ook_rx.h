@@ -0,0 +1,42 @@
+#pragma once
+#include <Arduino.h>
+#include "ook_decode.h"
+
+// Sub-GHz OOK receiver: the CC1101 demodulates in asynchronous serial mode
+// and drives the raw data on GDO0, which an RMT RX channel timestamps at
+// 1 µs. A reception ends after OOK_RX_IDLE_US without an edge; receptions
+// less than a join window apart are concatenated into one train (with the
+// idle time as the gap between them) so the repeated rows of a sensor frame
+// reach the decoders together. A worker task decodes each finished train
+// with ookDecode() and folds the readings into a live list keyed by model,
+// ID and channel. Nothing in the worker touches SPI, so the shared bus stays
+// with the UI.
+//
+// Gaps longer than OOK_RX_IDLE_US are reported as that value, so a decoder's
+// row gap (OokDecoder::gapUs) must be below it. Only the lilygo-cc1101 has
+// the radio; elsewhere ookRxStart() returns false.
+
+static constexpr uint16_t OOK_RX_IDLE_US  = 3500;
+static constexpr uint8_t  OOK_RX_MAX_DEVS = 16;
+
+struct OokRxEntry {
+  OokReading reading;
+  uint32_t   lastMs;
+  uint16_t   count;
+};
+
+struct OokRxStats {
+  bool     running;
+  uint32_t receptions;
+  uint32_t noise;           // receptions too short to keep
+  uint32_t trains;
+  uint32_t readings;
+};
+
+bool       ookRxStart(uint32_t hz = 433920000);
+void       ookRxStop();
+uint32_t   ookRxGeneration();                        // bumps with every train
+uint8_t    ookRxList(OokRxEntry* out, uint8_t max);  // newest first
+bool       ookRxLastTrain(OokPulses& out);           // false until the first train
+void       ookRxClear();
+OokRxStats ookRxStats();
@@ -0,0 +1,313 @@
+#include "ota_patch.h"
+#include <esp_ota_ops.h>
+#include <esp_partition.h>
+#include <mbedtls/sha256.h>
+#if CONFIG_IDF_TARGET_ESP32S3
+  #include <esp32s3/rom/miniz.h>
+#else
+  #include <esp32/rom/miniz.h>
+#endif
+
+static constexpr uint8_t  kCodecStored  = 0;
+static constexpr uint8_t  kCodecDeflate = 1;
+static constexpr uint8_t  kFlagDigest   = 0x01;
+static constexpr uint32_t kOldCache     = 4096;
+static constexpr uint32_t kOutBuf       = 4096;     // one flash sector per esp_ota_write
+static constexpr uint8_t  kRecordLen    = 12;
+
+struct __attribute__((packed)) DeltaHeader {
+  char     magic[4];
+  uint8_t  version;
+  uint8_t  codec;
+  uint8_t  flags;
+  uint8_t  reserved0;
+  uint32_t oldSize;
+  uint32_t newSize;
+  uint8_t  oldSha[32];
+  uint8_t  newSha[32];
+  uint8_t  oldHdr[2];        // base bytes [2:4) before esptool rewrote them
+  uint8_t  reserved1[2];
+  uint8_t  oldTail[32];      // base's appended digest, likewise
+};
+static_assert(sizeof(DeltaHeader) == 116, "delta header layout");
+
+enum class Phase : uint8_t { HEADER, RECORD, EXTRA, DIFF, FAILED };
+
+static Phase                  sPhase = Phase::FAILED;
+static bool                   sActive = false;
+static const char*            sError = "";
+static DeltaHeader            sHdr;
+static uint8_t                sHdrLen = 0;
+static const esp_partition_t* sOld = nullptr;
+static const esp_partition_t* sNew = nullptr;
+static esp_ota_handle_t       sOta = 0;
+static bool                   sOtaOpen = false;
+static mbedtls_sha256_context sSha;
+
+// One allocation for all working buffers, released on finish/abort
+static uint8_t*            sWork = nullptr;
+static tinfl_decompressor* sInf = nullptr;
+static uint8_t*            sDict = nullptr;
+static uint32_t            sDictOfs = 0;
+static bool                sStreamEnd = false;
+static uint8_t*            sOldBuf = nullptr;
+static uint32_t            sOldAt = 0, sOldLen = 0;
+static uint8_t*            sOutBuf = nullptr;
+static uint32_t            sOutLen = 0;
+
+static uint8_t  sRec[kRecordLen];
+static uint8_t  sRecLen = 0;
+static uint32_t sExtraLeft = 0, sDiffLeft = 0, sOldOff = 0;
+static uint32_t sIn = 0, sOut = 0;
+
+static bool fail(const char* why) {
+  sError = why;
+  sPhase = Phase::FAILED;
+  Serial.printf("[ota] %s\n", why);
+  return false;
+}
+
+static void release() {
+  if (sOtaOpen) esp_ota_abort(sOta);
+  sOtaOpen = false;
+  free(sWork);
+  sWork = nullptr;
+  sInf = nullptr; sDict = sOldBuf = sOutBuf = nullptr;
+  mbedtls_sha256_free(&sSha);
+  sActive = false;
+}
+
+// ─────────────────────────────────────────────────────────────────────────────
+// Base image (running slot, seen through the header's overlay)
+// ─────────────────────────────────────────────────────────────────────────────
+static bool loadOld(uint32_t at) {
+  sOldAt  = at - at % kOldCache;
+  sOldLen = min<uint32_t>(kOldCache, sHdr.oldSize - sOldAt);
+  if (esp_partition_read(sOld, sOldAt, sOldBuf, sOldLen) != ESP_OK) return fail("flash read failed");
+
+  // esptool patches these on flashing; put back what the delta was built from
+  for (uint32_t i = 2; i < 4; ++i) {
+    if (i >= sOldAt && i < sOldAt + sOldLen) sOldBuf[i - sOldAt] = sHdr.oldHdr[i - 2];
+  }
+  if (sHdr.flags & kFlagDigest) {
+    uint32_t tail = sHdr.oldSize - 32;
+    for (uint32_t i = max(tail, sOldAt); i < sOldAt + sOldLen; ++i) sOldBuf[i - sOldAt] = sHdr.oldTail[i - tail];
+  }
+  return true;
+}
+
+static bool checkBase() {
+  uint8_t sha[32];
+  mbedtls_sha256_context ctx;
+  mbedtls_sha256_init(&ctx);
+  mbedtls_sha256_starts_ret(&ctx, 0);
+  for (uint32_t at = 0; at < sHdr.oldSize; at += kOldCache) {
+    if (!loadOld(at)) { mbedtls_sha256_free(&ctx); return false; }
+    mbedtls_sha256_update_ret(&ctx, sOldBuf, sOldLen);
+  }
+  mbedtls_sha256_finish_ret(&ctx, sha);
+  mbedtls_sha256_free(&ctx);
+  if (memcmp(sha, sHdr.oldSha, 32) != 0) return fail("delta was built for other firmware");
+  return true;
+}
+
+// ─────────────────────────────────────────────────────────────────────────────
+// New image
+// ─────────────────────────────────────────────────────────────────────────────
+static bool flushOut() {
+  if (!sOutLen) return true;
+  if (esp_ota_write(sOta, sOutBuf, sOutLen) != ESP_OK) return fail("flash write failed");
+  mbedtls_sha256_update_ret(&sSha, sOutBuf, sOutLen);
+  sOut += sOutLen;
+  sOutLen = 0;
+  return true;
+}
+
+static bool emit(const uint8_t* p, uint32_t n) {
+  while (n) {
+    uint32_t k = min(n, kOutBuf - sOutLen);
+    memcpy(sOutBuf + sOutLen, p, k);
+    sOutLen += k; p += k; n -= k;
+    if (sOutLen == kOutBuf && !flushOut()) return false;
+  }
+  return true;
+}
+
+// ─────────────────────────────────────────────────────────────────────────────
+// Record stream
+// ─────────────────────────────────────────────────────────────────────────────
+static bool startRecord() {
+  memcpy(&sExtraLeft, sRec,     4);
+  memcpy(&sDiffLeft,  sRec + 4, 4);
+  memcpy(&sOldOff,    sRec + 8, 4);
+  sRecLen = 0;
+  uint32_t produced = sOut + sOutLen;
+  if ((uint64_t)sOldOff + sDiffLeft > sHdr.oldSize ||
+      (uint64_t)produced + sExtraLeft + sDiffLeft > sHdr.newSize) return fail("corrupt delta (record range)");
+  sPhase = sExtraLeft ? Phase::EXTRA : sDiffLeft ? Phase::DIFF : Phase::RECORD;
+  return true;
+}
+
+static bool consume(const uint8_t* p, uint32_t n) {
+  while (n) {
+    switch (sPhase) {
+      case Phase::RECORD: {
+        uint32_t k = min<uint32_t>(n, kRecordLen - sRecLen);
+        memcpy(sRec + sRecLen, p, k);
+        sRecLen += k; p += k; n -= k;
+        if (sRecLen == kRecordLen && !startRecord()) return false;
+        break;
+      }
+      case Phase::EXTRA: {
+        uint32_t k = min(n, sExtraLeft);
+        if (!emit(p, k)) return false;
+        sExtraLeft -= k; p += k; n -= k;
+        if (!sExtraLeft) sPhase = sDiffLeft ? Phase::DIFF : Phase::RECORD;
+        break;
+      }
+      case Phase::DIFF: {
+        // Add in runs bounded by the old-image cache and the output buffer
+        if (sOldOff < sOldAt || sOldOff >= sOldAt + sOldLen) {
+          if (!loadOld(sOldOff)) return false;
+        }
+        uint32_t k = min(min(n, sDiffLeft), min(sOldAt + sOldLen - sOldOff, kOutBuf - sOutLen));
+        const uint8_t* o = sOldBuf + (sOldOff - sOldAt);
+        uint8_t* d = sOutBuf + sOutLen;
+        for (uint32_t i = 0; i < k; ++i) d[i] = o[i] + p[i];
+        sOutLen += k;
+        if (sOutLen == kOutBuf && !flushOut()) return false;
+        sOldOff += k; sDiffLeft -= k; p += k; n -= k;
+        if (!sDiffLeft) sPhase = Phase::RECORD;
+        break;
+      }
+      default:
+        return false;
+    }
+  }
+  return true;
+}
+
+static bool inflateFeed(const uint8_t* in, size_t len) {
+  while (!sStreamEnd) {
+    size_t inBytes = len, outBytes = TINFL_LZ_DICT_SIZE - sDictOfs;
+    tinfl_status st = tinfl_decompress(sInf, in, &inBytes, sDict, sDict + sDictOfs, &outBytes,
+                                       TINFL_FLAG_HAS_MORE_INPUT);
+    in += inBytes; len -= inBytes;
+    if (outBytes && !consume(sDict + sDictOfs, outBytes)) return false;
+    sDictOfs = (sDictOfs + outBytes) & (TINFL_LZ_DICT_SIZE - 1);
+    if (st < TINFL_STATUS_DONE) return fail("corrupt delta (deflate)");
+    if (st == TINFL_STATUS_DONE) sStreamEnd = true;
+    else if (st == TINFL_STATUS_NEEDS_MORE_INPUT && !len) break;   // else: window full, drain again
+  }
+  return true;
+}
+
+// ─────────────────────────────────────────────────────────────────────────────
+// Header
+// ─────────────────────────────────────────────────────────────────────────────
+static bool startBody() {
+  if (memcmp(sHdr.magic, "FTWD", 4) != 0 || sHdr.version != 1) return fail("not a firmware delta");
+  if (sHdr.codec != kCodecStored && sHdr.codec != kCodecDeflate) return fail("unsupported delta codec");
+
+  sOld = esp_ota_get_running_partition();
+  sNew = esp_ota_get_next_update_partition(nullptr);
+  if (!sOld || !sNew) return fail("no spare OTA slot in partition table");
+  if (sHdr.oldSize < 64 || sHdr.oldSize > sOld->size) return fail("delta was built for other firmware");
+  if (sHdr.newSize > sNew->size) return fail("new image larger than OTA slot");
+
+  size_t need = kOldCache + kOutBuf;
+  if (sHdr.codec == kCodecDeflate) need += sizeof(tinfl_decompressor) + TINFL_LZ_DICT_SIZE;
+  sWork = (uint8_t*)malloc(need);
+  if (!sWork) return fail("out of memory");
+  sOldBuf = sWork;
+  sOutBuf = sWork + kOldCache;
+  if (sHdr.codec == kCodecDeflate) {
+    sDict = sOutBuf + kOutBuf;
+    sInf  = (tinfl_decompressor*)(sDict + TINFL_LZ_DICT_SIZE);
+    tinfl_init(sInf);
+  }
+  sDictOfs = 0;
+  sStreamEnd = false;
+  sOldAt = sOldLen = 0;
+  sOutLen = 0;
+
+  if (!checkBase()) return false;
+  sOldLen = 0;                                   // cache holds the tail now; refill lazily
+  if (esp_ota_begin(sNew, OTA_WITH_SEQUENTIAL_WRITES, &sOta) != ESP_OK) return fail("could not open OTA slot");
+  sOtaOpen = true;
+  mbedtls_sha256_starts_ret(&sSha, 0);
+  sPhase = Phase::RECORD;
+  return true;
+}
+
+// ─────────────────────────────────────────────────────────────────────────────
+// Public API
+// ─────────────────────────────────────────────────────────────────────────────
+bool otaPatchBegin() {
+  if (sActive) otaPatchAbort();
+  sActive = true;
+  sError = "";
+  sPhase = Phase::HEADER;
+  sHdrLen = 0;
+  sRecLen = 0;
+  sIn = sOut = 0;
+  memset(&sHdr, 0, sizeof(sHdr));
+  mbedtls_sha256_init(&sSha);
+  return true;
+}
+
+bool otaPatchFeed(const uint8_t* data, size_t len) {
+  if (!sActive || sPhase == Phase::FAILED) return false;
+  sIn += len;
+  if (sPhase == Phase::HEADER) {
+    size_t k = min(len, sizeof(DeltaHeader) - sHdrLen);
+    memcpy((uint8_t*)&sHdr + sHdrLen, data, k);
+    sHdrLen += k; data += k; len -= k;
+    if (sHdrLen < sizeof(DeltaHeader)) return true;
+    if (!startBody()) return false;
+  }
+  return sHdr.codec == kCodecDeflate ? inflateFeed(data, len) : consume(data, len);
+}
+
+bool otaPatchFinish() {
+  if (!sActive || sPhase == Phase::FAILED) return false;
+  if (sPhase != Phase::RECORD || sRecLen) return fail("delta truncated");
+  if (sHdr.codec == kCodecDeflate && !sStreamEnd) return fail("delta truncated");
+  if (!flushOut()) return false;
+  if (sOut != sHdr.newSize) return fail("delta truncated");
+
+  uint8_t sha[32];
+  mbedtls_sha256_finish_ret(&sSha, sha);
+  if (memcmp(sha, sHdr.newSha, 32) != 0) return fail("new image checksum mismatch");
+
+  sOtaOpen = false;
+  if (esp_ota_end(sOta) != ESP_OK) return fail("new image failed validation");
+  if (esp_ota_set_boot_partition(sNew) != ESP_OK) return fail("could not select new slot");
+  Serial.printf("[ota] %lu-byte delta -> %lu-byte image in %s\n",
+                (unsigned long)sIn, (unsigned long)sOut, sNew->label);
+  release();
+  return true;
+}
+
+void otaPatchAbort() {
+  if (!sActive) return;
+  release();
+  sPhase = Phase::FAILED;
+}
+
+const char* otaPatchError() { return sError; }
+
+const char* otaPatchTarget() {
+  const esp_partition_t* p = sNew ? sNew : esp_ota_get_next_update_partition(nullptr);
+  return p ? p->label : "none";
+}
+
+OtaPatchStats otaPatchStats() {
+  OtaPatchStats s;
+  s.active   = sActive;
+  s.inBytes  = sIn;
+  s.outBytes = sOut + sOutLen;
+  s.newSize  = sHdrLen == sizeof(DeltaHeader) ? sHdr.newSize : 0;
+  s.percent  = s.newSize ? (uint8_t)((uint64_t)s.outBytes * 100 / s.newSize) : 0;
+  return s;
+}
@@ -0,0 +1,28 @@
+#pragma once
+#include <Arduino.h>
+
+// Streaming firmware delta applier (format: tools/fwdelta.py).
+//
+// The delta is fed in arbitrary pieces as it arrives (serial, SD, network).
+// The body is inflated into a 32 KB window, diff bytes are added to the
+// running image read back from flash through a 4 KB cache, and the result is
+// written to the next OTA slot as it is produced. RAM use is fixed (~52 KB,
+// ~8 KB for stored deltas) whatever the image size. The base image and the
+// result are both checked against the SHA-256s in the header before the slot
+// is made bootable. After any false return call otaPatchAbort().
+
+struct OtaPatchStats {
+  bool     active;
+  uint32_t inBytes;        // delta bytes fed so far
+  uint32_t outBytes;       // image bytes written
+  uint32_t newSize;        // 0 until the header has been parsed
+  uint8_t  percent;
+};
+
+bool          otaPatchBegin();
+bool          otaPatchFeed(const uint8_t* data, size_t len);   // false → see otaPatchError()
+bool          otaPatchFinish();                                // verify, set boot slot
+void          otaPatchAbort();
+const char*   otaPatchError();
+OtaPatchStats otaPatchStats();
+const char*   otaPatchTarget();                                // label of the slot written
@@ -0,0 +1,218 @@
+#include "pcap_capture.h"
+#include <WiFi.h>
+#include <esp_wifi.h>
+#include <esp_timer.h>
+#include <esp_heap_caps.h>
+#include <sys/time.h>
+
+static constexpr uint32_t kWriterStack = 4096;
+static constexpr uint32_t kIdleMs      = 500;     // writer wakes at least this often
+static constexpr uint32_t kLinkType    = 127;     // LINKTYPE_IEEE802_11_RADIOTAP
+static constexpr uint32_t kMaxFrame    = 2500;
+static constexpr uint32_t kFileHdr     = 24;
+static constexpr uint32_t kRecHdr      = 16;
+static constexpr uint32_t kRadiotap    = 15;      // flags, channel, antenna signal
+
+// Ring: head/tail are running byte counts; used = head - tail
+static uint8_t*          sRing   = nullptr;
+static uint32_t          sSize   = 0;
+static volatile uint32_t sHead   = 0;             // written by the callback only
+static volatile uint32_t sTail   = 0;             // written by the writer only
+static uint32_t          sSnap   = kMaxFrame;
+
+static FILE*             sFile   = nullptr;
+static TaskHandle_t      sTask   = nullptr;
+static volatile bool     sRun    = false;          // cleared by pcapStop: final drain, then exit
+static volatile bool     sAbort  = false;          // stop timed out: skip what's left
+static SemaphoreHandle_t sJoined = nullptr;        // given by the writer just before it exits
+static int64_t           sBaseUs = 0;             // Unix µs at esp_timer 0
+static uint32_t          sStartMs = 0;
+
+static volatile uint32_t sFrames = 0, sDropFrames = 0, sDropBytes = 0, sHighBytes = 0;
+static volatile uint64_t sWritten = 0;
+static volatile uint32_t sWorstMs = 0;
+static volatile bool     sError   = false;
+
+// ─────────────────────────────────────────────────────────────────────────────
+// Producer: promiscuous callback
+// ─────────────────────────────────────────────────────────────────────────────
+static inline void IRAM_ATTR put(uint32_t at, const void* src, uint32_t len) {
+  uint32_t off = at % sSize;
+  uint32_t k   = len < sSize - off ? len : sSize - off;
+  memcpy(sRing + off, src, k);
+  if (k < len) memcpy(sRing, (const uint8_t*)src + k, len - k);
+}
+
+static inline void IRAM_ATTR wr16(uint8_t* p, uint16_t v) { p[0] = v; p[1] = v >> 8; }
+static inline void IRAM_ATTR wr32(uint8_t* p, uint32_t v) { wr16(p, v); wr16(p + 2, v >> 16); }
+
+static void IRAM_ATTR onFrame(void* buf, wifi_promiscuous_pkt_type_t type) {
+  if (type == WIFI_PKT_MISC) return;
+  const wifi_promiscuous_pkt_t* pkt = (const wifi_promiscuous_pkt_t*)buf;
+  uint32_t len  = pkt->rx_ctrl.sig_len;
+  uint32_t cap  = len < sSnap ? len : sSnap;
+  uint32_t need = kRecHdr + kRadiotap + cap;
+  uint32_t head = sHead;
+  uint32_t used = head - sTail;
+  if (sSize - used < need) {
+    sDropFrames++;
+    sDropBytes += need;
+    return;
+  }
+
+  uint64_t ts = (uint64_t)(sBaseUs + esp_timer_get_time());
+  uint8_t h[kRecHdr + kRadiotap];
+  wr32(h,      (uint32_t)(ts / 1000000));
+  wr32(h + 4,  (uint32_t)(ts % 1000000));
+  wr32(h + 8,  kRadiotap + cap);
+  wr32(h + 12, kRadiotap + len);
+  uint8_t* r = h + kRecHdr;                        // radiotap
+  r[0] = 0; r[1] = 0;
+  wr16(r + 2, kRadiotap);
+  wr32(r + 4, (1u << 1) | (1u << 3) | (1u << 5));  // flags, channel, dBm antenna signal
+  r[8] = 0x10;                                     // frame includes FCS
+  r[9] = 0;                                        // pad: channel is 2-byte aligned
+  uint8_t ch = pkt->rx_ctrl.channel;
+  wr16(r + 10, ch == 14 ? 2484 : 2407 + 5 * ch);
+  wr16(r + 12, 0x0080);                            // 2 GHz
+  r[14] = (uint8_t)(int8_t)pkt->rx_ctrl.rssi;
+
+  put(head, h, sizeof(h));
+  put(head + sizeof(h), pkt->payload, cap);
+  __atomic_store_n(&sHead, head + need, __ATOMIC_RELEASE);
+  sFrames++;
+  if (used + need > sHighBytes) sHighBytes = used + need;
+  if (head / PCAP_SLAB != (head + need) / PCAP_SLAB) xTaskNotifyGive(sTask);   // slab filled
+}
+
+// ─────────────────────────────────────────────────────────────────────────────
+// Consumer: writer task
+// ─────────────────────────────────────────────────────────────────────────────
+static void drain(bool all) {
+  uint32_t head  = __atomic_load_n(&sHead, __ATOMIC_ACQUIRE);
+  uint32_t avail = head - sTail;
+  uint32_t n     = all ? avail : avail - avail % PCAP_SLAB;
+  while (n && !sAbort) {
+    uint32_t off = sTail % sSize;
+    uint32_t k   = min(n, sSize - off);              // ring end is slab-aligned too
+    uint32_t t0  = millis();
+    size_t   w   = fwrite(sRing + off, 1, k, sFile);
+    uint32_t dt  = millis() - t0;
+    if (dt > sWorstMs) sWorstMs = dt;
+    if (w != k) sError = true;
+    sWritten += w;
+    __atomic_store_n(&sTail, sTail + k, __ATOMIC_RELEASE);   // free the space even on error
+    n -= k;
+  }
+}
+
+static void writerTask(void*) {
+  while (sRun) {
+    ulTaskNotifyTake(pdTRUE, pdMS_TO_TICKS(kIdleMs));
+    drain(false);
+  }
+  drain(true);                                       // partial last slab
+  xSemaphoreGive(sJoined);
+  vTaskDelete(nullptr);
+}
+
+// ─────────────────────────────────────────────────────────────────────────────
+// Public API
+// ─────────────────────────────────────────────────────────────────────────────
+bool pcapStart(const char* vfsPath, const PcapConfig& cfg) {
+  if (sFile) return false;
+  uint32_t slabs = 2;                                // power of two: % stays right when head wraps
+  while (slabs * 2 <= cfg.slabs) slabs *= 2;
+  sSize = slabs * PCAP_SLAB;
+  sSnap = cfg.snapLen && cfg.snapLen < kMaxFrame ? cfg.snapLen : kMaxFrame;
+  if (!sJoined && !(sJoined = xSemaphoreCreateBinary())) return false;
+  sRing = (uint8_t*)heap_caps_aligned_alloc(4, sSize, MALLOC_CAP_DMA);
+  if (!sRing) return false;
+  sFile = fopen(vfsPath, "wb");
+  if (!sFile) { heap_caps_free(sRing); sRing = nullptr; return false; }
+  setvbuf(sFile, nullptr, _IONBF, 0);               // slabs go straight to FatFs
+
+  sHead = sTail = 0;
+  sFrames = sDropFrames = sDropBytes = sHighBytes = 0;
+  sWritten = 0; sWorstMs = 0; sError = false;
+
+  // File header first, so slab boundaries are file sector boundaries
+  uint8_t g[kFileHdr] = {};
+  wr32(g, 0xA1B2C3D4);
+  wr16(g + 4, 2);
+  wr16(g + 6, 4);
+  wr32(g + 16, kRadiotap + sSnap);
+  wr32(g + 20, kLinkType);
+  memcpy(sRing, g, sizeof(g));
+  sHead = sizeof(g);
+
+  struct timeval tv;
+  gettimeofday(&tv, nullptr);
+  sBaseUs  = (int64_t)tv.tv_sec * 1000000 + tv.tv_usec - esp_timer_get_time();
+  sStartMs = millis();
+
+  sRun   = true;
+  sAbort = false;
+  xTaskCreatePinnedToCore(writerTask, "pcapw", kWriterStack, nullptr, cfg.priority, &sTask, 0);
+
+  WiFi.mode(WIFI_STA);
+  WiFi.disconnect();
+  wifi_promiscuous_filter_t filter = {};
+  filter.filter_mask = WIFI_PROMIS_FILTER_MASK_MGMT | WIFI_PROMIS_FILTER_MASK_CTRL | WIFI_PROMIS_FILTER_MASK_DATA;
+  wifi_promiscuous_filter_t ctrl = {};
+  ctrl.filter_mask = WIFI_PROMIS_CTRL_FILTER_MASK_ALL;
+  esp_wifi_set_promiscuous_filter(&filter);
+  esp_wifi_set_promiscuous_ctrl_filter(&ctrl);
+  esp_wifi_set_promiscuous_rx_cb(onFrame);
+  esp_wifi_set_promiscuous(true);
+  pcapSetChannel(cfg.channel);
+  return true;
+}
+
+bool pcapStop(uint32_t timeoutMs) {
+  if (!sFile) return true;
+  esp_wifi_set_promiscuous(false);                   // no more producers
+  esp_wifi_set_promiscuous_rx_cb(nullptr);
+  WiFi.mode(WIFI_OFF);
+
+  sRun = false;
+  xTaskNotifyGive(sTask);
+  bool drained = xSemaphoreTake(sJoined, pdMS_TO_TICKS(timeoutMs)) == pdTRUE;
+  if (!drained) {
+    // Card too slow: give up on the tail, but the write in progress has to
+    // finish before the file can be closed underneath it.
+    sAbort = true;
+    xSemaphoreTake(sJoined, portMAX_DELAY);
+  }
+  sTask = nullptr;                                   // the writer deleted itself
+
+  PcapStats s = pcapStats();
+  fclose(sFile);
+  sFile = nullptr;
+  heap_caps_free(sRing);
+  sRing = nullptr;
+  Serial.printf("[pcap] %lu frames, %lu dropped (%lu bytes), %llu bytes written, "
+                "worst write %lu ms, ring high %u%%\n",
+                (unsigned long)s.frames, (unsigned long)s.droppedFrames, (unsigned long)s.droppedBytes,
+                (unsigned long long)s.bytesWritten, (unsigned long)s.worstWriteMs, s.ringHighPct);
+  return drained && !s.writeError;
+}
+
+void pcapSetChannel(uint8_t channel) {
+  if (channel < 1 || channel > 13) channel = 1;
+  if (sFile) esp_wifi_set_channel(channel, WIFI_SECOND_CHAN_NONE);
+}
+
+PcapStats pcapStats() {
+  PcapStats s = {};
+  s.active        = sFile != nullptr;
+  s.elapsedMs     = millis() - sStartMs;
+  s.frames        = sFrames;
+  s.droppedFrames = sDropFrames;
+  s.droppedBytes  = sDropBytes;
+  s.bytesWritten  = sWritten;
+  s.worstWriteMs  = sWorstMs;
+  s.ringHighPct   = sSize ? (uint8_t)((uint64_t)sHighBytes * 100 / sSize) : 0;
+  s.writeError    = sError;
+  return s;
+}
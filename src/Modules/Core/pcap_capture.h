@@ -0,0 +1,40 @@
+#pragma once
+#include <Arduino.h>
+
+// 802.11 capture to a standard pcap file (radiotap link type, so Wireshark
+// shows channel, RSSI and FCS).
+//
+// The promiscuous callback copies each frame exactly once, radiotap and
+// record header included, into a preallocated byte ring made of
+// PCAP_SLAB-sized slabs; nothing is allocated per frame. A writer task
+// drains whole slabs (several per fwrite when they are contiguous), so every
+// write is a multiple of PCAP_SLAB at a PCAP_SLAB-aligned file offset — the
+// pcap file header is the first thing in the ring. While the card stalls the
+// callback keeps filling the ring; frames that don't fit are dropped and
+// counted, never waited for.
+
+static constexpr uint32_t PCAP_SLAB = 4096;
+
+struct PcapConfig {
+  uint8_t  channel   = 1;
+  uint16_t snapLen   = 0;           // bytes of 802.11 frame kept; 0 = whole frame
+  uint8_t  slabs     = 8;           // ring size in slabs, rounded down to a power of two ≥ 2
+  uint8_t  priority  = 2;           // writer task
+};
+
+struct PcapStats {
+  bool     active;
+  uint32_t elapsedMs;
+  uint32_t frames;
+  uint32_t droppedFrames;           // ring full
+  uint32_t droppedBytes;
+  uint64_t bytesWritten;
+  uint32_t worstWriteMs;
+  uint8_t  ringHighPct;             // fullest the ring has been
+  bool     writeError;
+};
+
+bool        pcapStart(const char* vfsPath, const PcapConfig& cfg = PcapConfig());
+bool        pcapStop(uint32_t timeoutMs = 3000);   // drains the ring, closes the file
+void        pcapSetChannel(uint8_t channel);
+PcapStats   pcapStats();
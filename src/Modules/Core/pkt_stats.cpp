@@ -0,0 +1,143 @@
+#include "pkt_stats.h"
+#include <WiFi.h>
+#include <esp_wifi.h>
+#include <esp_timer.h>
+
+struct CoreSlot {
+  uint32_t frames[PKT_CHANNELS + 1][PKT_TYPES];
+  uint32_t bytes[PKT_CHANNELS + 1];
+};
+
+static CoreSlot sSlots[portNUM_PROCESSORS];      // DRAM: touched from the IRAM callback
+
+static esp_timer_handle_t sHop      = nullptr;
+static volatile uint8_t   sChannel  = 1;
+static volatile uint8_t   sLocked   = 0;         // 0 = hopping
+static uint32_t           sDwellMs[PKT_CHANNELS + 1];
+static int64_t            sTunedUs  = 0;         // when sChannel was tuned / last accounted
+static uint16_t           sDwell    = PKT_DWELL_MS;
+static portMUX_TYPE       sLock     = portMUX_INITIALIZER_UNLOCKED;   // dwell bookkeeping only
+
+// ─────────────────────────────────────────────────────────────────────────────
+// Receive path
+// ─────────────────────────────────────────────────────────────────────────────
+static void IRAM_ATTR onFrame(void* buf, wifi_promiscuous_pkt_type_t type) {
+  const wifi_promiscuous_pkt_t* pkt = (const wifi_promiscuous_pkt_t*)buf;
+  uint8_t ch = pkt->rx_ctrl.channel;
+  if (ch > PKT_CHANNELS) ch = 0;
+
+  PktType t;
+  switch (type) {
+    case WIFI_PKT_MGMT: {
+      uint8_t subtype = pkt->payload[0] >> 4;            // frame control, first byte
+      t = subtype == 8 ? PktType::BEACON
+        : (subtype == 4 || subtype == 5) ? PktType::PROBE
+        : PktType::MGMT;
+      break;
+    }
+    case WIFI_PKT_CTRL: t = PktType::CTRL; break;
+    case WIFI_PKT_DATA: t = PktType::DATA; break;
+    default:            t = PktType::MISC; break;
+  }
+
+  CoreSlot& s = sSlots[xPortGetCoreID()];
+  s.frames[ch][(uint8_t)t]++;
+  s.bytes[ch] += pkt->rx_ctrl.sig_len;
+}
+
+// ─────────────────────────────────────────────────────────────────────────────
+// Hop scheduler
+// ─────────────────────────────────────────────────────────────────────────────
+static void accountDwell(int64_t now) {
+  sDwellMs[sChannel] += (uint32_t)((now - sTunedUs) / 1000);
+  sTunedUs = now - (now - sTunedUs) % 1000;              // carry the sub-ms remainder
+}
+
+static void tune(uint8_t ch) {
+  esp_wifi_set_channel(ch, WIFI_SECOND_CHAN_NONE);
+  sChannel = ch;
+}
+
+static void onHop(void*) {
+  int64_t now = esp_timer_get_time();
+  portENTER_CRITICAL(&sLock);
+  accountDwell(now);
+  uint8_t next = sLocked ? sLocked : (uint8_t)(sChannel % PKT_CHANNELS + 1);
+  portEXIT_CRITICAL(&sLock);
+  if (next != sChannel) tune(next);
+}
+
+// ─────────────────────────────────────────────────────────────────────────────
+// Public API
+// ─────────────────────────────────────────────────────────────────────────────
+bool pktStatsStart(uint16_t dwellMs) {
+  if (sHop) return true;
+  memset(sSlots, 0, sizeof(sSlots));
+  memset(sDwellMs, 0, sizeof(sDwellMs));
+  sDwell  = dwellMs;
+  sLocked = 0;
+
+  if (!WiFi.mode(WIFI_STA)) return false;
+  WiFi.disconnect();
+
+  wifi_promiscuous_filter_t filter = {};
+  filter.filter_mask = WIFI_PROMIS_FILTER_MASK_MGMT | WIFI_PROMIS_FILTER_MASK_CTRL |
+                       WIFI_PROMIS_FILTER_MASK_DATA | WIFI_PROMIS_FILTER_MASK_MISC;
+  wifi_promiscuous_filter_t ctrl = {};
+  ctrl.filter_mask = WIFI_PROMIS_CTRL_FILTER_MASK_ALL;
+  esp_wifi_set_promiscuous_filter(&filter);
+  esp_wifi_set_promiscuous_ctrl_filter(&ctrl);
+  esp_wifi_set_promiscuous_rx_cb(onFrame);
+
+  tune(1);
+  sTunedUs = esp_timer_get_time();
+  if (esp_wifi_set_promiscuous(true) != ESP_OK) { WiFi.mode(WIFI_OFF); return false; }
+
+  esp_timer_create_args_t args = {};
+  args.callback = onHop;
+  args.name     = "pkthop";
+  if (esp_timer_create(&args, &sHop) != ESP_OK) { pktStatsStop(); return false; }
+  esp_timer_start_periodic(sHop, (uint64_t)sDwell * 1000);
+  return true;
+}
+
+void pktStatsStop() {
+  if (sHop) {
+    esp_timer_stop(sHop);
+    esp_timer_delete(sHop);
+    sHop = nullptr;
+  }
+  esp_wifi_set_promiscuous(false);
+  esp_wifi_set_promiscuous_rx_cb(nullptr);
+  WiFi.mode(WIFI_OFF);
+}
+
+bool pktStatsRunning() { return sHop != nullptr; }
+
+void pktStatsLock(uint8_t channel) {
+  if (channel > PKT_CHANNELS) channel = 0;
+  sLocked = channel;
+  if (channel && channel != sChannel) {
+    portENTER_CRITICAL(&sLock);
+    accountDwell(esp_timer_get_time());
+    portEXIT_CRITICAL(&sLock);
+    tune(channel);
+  }
+}
+
+void pktStatsSnapshot(PktStatsSnapshot& out) {
+  memset(&out, 0, sizeof(out));
+  for (uint8_t c = 0; c < portNUM_PROCESSORS; ++c) {
+    const volatile CoreSlot& s = sSlots[c];
+    for (uint8_t ch = 0; ch <= PKT_CHANNELS; ++ch) {
+      for (uint8_t t = 0; t < PKT_TYPES; ++t) out.ch[ch].frames[t] += s.frames[ch][t];
+      out.ch[ch].bytes += s.bytes[ch];
+    }
+  }
+  portENTER_CRITICAL(&sLock);
+  for (uint8_t ch = 0; ch <= PKT_CHANNELS; ++ch) out.ch[ch].dwellMs = sDwellMs[ch];
+  out.ch[sChannel].dwellMs += (uint32_t)((esp_timer_get_time() - sTunedUs) / 1000);
+  portEXIT_CRITICAL(&sLock);
+  out.channel = sChannel;
+  out.hopping = !sLocked;
+}
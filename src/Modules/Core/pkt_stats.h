@@ -0,0 +1,36 @@
+#pragma once
+#include <Arduino.h>
+
+// 802.11 channel-utilization counters from promiscuous mode.
+//
+// The receive callback runs in IRAM and only bumps a frame counter and a
+// byte counter for (channel, frame type); no payload is copied or queued.
+// Counters live in one slot per core, each written only by code on its own
+// core, so there are no locks or atomics on the hot path; snapshots sum the
+// slots. A hop timer walks channels 1-13 with a fixed dwell (or stays on a
+// locked channel) and accumulates the time spent on each, so rates are
+// frames per second of observation rather than of wall time.
+
+static constexpr uint8_t  PKT_CHANNELS  = 13;
+static constexpr uint16_t PKT_DWELL_MS  = 250;
+
+enum class PktType : uint8_t { BEACON, PROBE, MGMT, CTRL, DATA, MISC, COUNT };
+static constexpr uint8_t PKT_TYPES = (uint8_t)PktType::COUNT;
+
+struct PktChannelStats {
+  uint32_t frames[PKT_TYPES];
+  uint32_t bytes;
+  uint32_t dwellMs;         // time spent listening on this channel
+};
+
+struct PktStatsSnapshot {
+  PktChannelStats ch[PKT_CHANNELS + 1];   // [1..13]; [0] = frames on other channels
+  uint8_t  channel;                       // tuned now
+  bool     hopping;
+};
+
+bool pktStatsStart(uint16_t dwellMs = PKT_DWELL_MS);
+void pktStatsStop();
+bool pktStatsRunning();
+void pktStatsLock(uint8_t channel);       // stay on channel; 0 resumes hopping
+void pktStatsSnapshot(PktStatsSnapshot& out);
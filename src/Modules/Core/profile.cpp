@@ -0,0 +1,304 @@
+#include "profile.h"
+#include "storage.h"
+#include <ArduinoJson.h>
+#include <errno.h>
+#include <nvs.h>
+#include <sys/stat.h>
+
+#if defined(M5CARDPUTER)
+  static constexpr const char* kBoard = "cardputer";
+#elif defined(M5STICK_C_PLUS_1_1)
+  static constexpr const char* kBoard = "m5stick-c-plus-1-1";
+#elif defined(LILYGO_CC1101)
+  static constexpr const char* kBoard = "lilygo-cc1101";
+#else
+  static constexpr const char* kBoard = "m5stick-c-plus-2";
+#endif
+
+static constexpr const char* kPath      = "/littlefs/profile.json";
+static constexpr const char* kNamespace = "profile";
+static constexpr const char* kBlobKey   = "blob";
+static constexpr uint16_t    kVersion   = 1;
+static constexpr uint8_t     kSettings  = (uint8_t)Setting::COUNT;
+static constexpr uint8_t     kParams    = (uint8_t)ProfileParam::COUNT;
+static constexpr uint8_t     kNesting   = 6;
+
+// Main menus in ring order; MenuState of entry i is 2 * i
+static const char* const kMenuNames[] = {
+  "wifi", "bluetooth", "ir", "rf", "nrf", "radio", "gps",
+  "rpi", "badusb", "settings", "extras", "files", "rfid", "nfc",
+};
+static constexpr uint8_t kMenus = sizeof(kMenuNames) / sizeof(kMenuNames[0]);
+
+// Order must match enum ProfileParam
+static const char* const kParamKeys[kParams] = { "web_port", "ir_gap_ms", "pcap_snap", "gps_baud" };
+
+struct Blob {
+  uint16_t version;
+  uint16_t size;              // sizeof(Blob): layout changes invalidate the cache
+  uint32_t board;             // FNV-1a of kBoard
+  uint32_t fileSize;
+  uint32_t fileMtime;
+  uint32_t settingsMask;      // bit per Setting present in the profile
+  uint16_t hiddenMask;        // bit per kMenuNames entry
+  uint16_t paramsMask;        // bit per ProfileParam
+  int32_t  settings[kSettings];
+  int32_t  params[kParams];
+};
+
+static Blob sBlob;
+static bool sHave = false;
+
+static uint32_t fnv1a(const char* s) {
+  uint32_t h = 0x811C9DC5;
+  while (*s) h = (h ^ (uint8_t)*s++) * 0x01000193;
+  return h;
+}
+
+// ─────────────────────────────────────────────────────────────────────────────
+// JSON
+// ─────────────────────────────────────────────────────────────────────────────
+
+// ArduinoJson reads through this one or a few bytes at a time; stdio
+// buffering is turned off so the file is only buffered once.
+class FileReader {
+ public:
+  explicit FileReader(FILE* f) : _f(f) { setvbuf(f, nullptr, _IONBF, 0); }
+
+  int read() {
+    if (_pos == _len && !fill()) return -1;
+    return (uint8_t)_buf[_pos++];
+  }
+
+  size_t readBytes(char* dst, size_t n) {
+    size_t got = 0;
+    while (got < n) {
+      if (_pos == _len && !fill()) break;
+      size_t k = min(n - got, _len - _pos);
+      memcpy(dst + got, _buf + _pos, k);
+      _pos += k;
+      got  += k;
+    }
+    return got;
+  }
+
+ private:
+  bool fill() {
+    _len = fread(_buf, 1, sizeof(_buf), _f);
+    _pos = 0;
+    return _len > 0;
+  }
+
+  FILE*  _f;
+  char   _buf[128];
+  size_t _pos = 0, _len = 0;
+};
+
+// Heap allocator with a hard ceiling: a profile that needs more than the
+// budget fails with NoMemory instead of growing without bound.
+class BudgetAllocator : public ArduinoJson::Allocator {
+ public:
+  void* allocate(size_t n) override {
+    if (_used + n + sizeof(size_t) > PROFILE_JSON_BUDGET) return nullptr;
+    size_t* p = (size_t*)malloc(n + sizeof(size_t));
+    if (!p) return nullptr;
+    *p = n;
+    _used += n + sizeof(size_t);
+    return p + 1;
+  }
+
+  void deallocate(void* ptr) override {
+    if (!ptr) return;
+    size_t* p = (size_t*)ptr - 1;
+    _used -= *p + sizeof(size_t);
+    free(p);
+  }
+
+  void* reallocate(void* ptr, size_t n) override {
+    if (!ptr) return allocate(n);
+    size_t* p = (size_t*)ptr - 1;
+    size_t old = *p;
+    if (n > old && _used + (n - old) > PROFILE_JSON_BUDGET) return nullptr;
+    size_t* q = (size_t*)realloc(p, n + sizeof(size_t));
+    if (!q) return nullptr;
+    _used = _used - old + n;
+    *q = n;
+    return q + 1;
+  }
+
+ private:
+  size_t _used = 0;
+};
+
+static void buildSectionFilter(JsonObject f) {
+  JsonObject s = f["settings"].to<JsonObject>();
+  for (uint8_t i = 0; i < kSettings; ++i) s[settingsDef((Setting)i).key] = true;
+  f["hide"] = true;
+  JsonObject p = f["params"].to<JsonObject>();
+  for (uint8_t i = 0; i < kParams; ++i) p[kParamKeys[i]] = true;
+}
+
+static bool settingValue(const SettingDef& d, JsonVariantConst v, int32_t& out) {
+  if (v.is<bool>())    { out = v.as<bool>() ? 1 : 0; return true; }
+  if (v.is<int32_t>()) { out = v.as<int32_t>();      return true; }
+  if (d.type == SettingType::ENUM && v.is<const char*>()) {
+    const char* name = v.as<const char*>();
+    for (int32_t k = d.min; k <= d.max; ++k) {
+      if (!strcasecmp(name, d.names[k - d.min])) { out = k; return true; }
+    }
+  }
+  return false;
+}
+
+// Later sections override earlier ones key by key
+static void applySection(Blob& b, JsonObjectConst sec) {
+  if (sec.isNull()) return;
+
+  JsonObjectConst st = sec["settings"].as<JsonObjectConst>();
+  for (uint8_t i = 0; i < kSettings; ++i) {
+    const SettingDef& d = settingsDef((Setting)i);
+    int32_t v;
+    if (!settingValue(d, st[d.key], v)) continue;
+    b.settings[i] = v < d.min ? d.min : v > d.max ? d.max : v;
+    b.settingsMask |= 1u << i;
+  }
+
+  JsonArrayConst hide = sec["hide"].as<JsonArrayConst>();
+  if (!hide.isNull()) {
+    b.hiddenMask = 0;
+    for (JsonVariantConst name : hide) {
+      if (!name.is<const char*>()) continue;
+      for (uint8_t m = 1; m < kMenus; ++m) {          // 0 (Wi-Fi) stays visible
+        if (!strcasecmp(name.as<const char*>(), kMenuNames[m])) b.hiddenMask |= 1u << m;
+      }
+    }
+  }
+
+  JsonObjectConst pr = sec["params"].as<JsonObjectConst>();
+  for (uint8_t i = 0; i < kParams; ++i) {
+    JsonVariantConst v = pr[kParamKeys[i]];
+    if (!v.is<int32_t>()) continue;
+    b.params[i] = v.as<int32_t>();
+    b.paramsMask |= 1u << i;
+  }
+}
+
+static bool parseFile(Blob& b) {
+  FILE* f = fopen(kPath, "rb");
+  if (!f) return false;
+
+  BudgetAllocator alloc;
+  JsonDocument filter(&alloc);
+  buildSectionFilter(filter["common"].to<JsonObject>());
+  buildSectionFilter(filter["boards"][kBoard].to<JsonObject>());
+
+  JsonDocument doc(&alloc);
+  FileReader reader(f);
+  DeserializationError err = deserializeJson(doc, reader,
+                                             DeserializationOption::Filter(filter),
+                                             DeserializationOption::NestingLimit(kNesting));
+  fclose(f);
+  if (err) {
+    Serial.printf("[profile] %s: %s\n", kPath, err.c_str());
+    return false;
+  }
+  applySection(b, doc["common"].as<JsonObjectConst>());
+  applySection(b, doc["boards"][kBoard].as<JsonObjectConst>());
+  return true;
+}
+
+// ─────────────────────────────────────────────────────────────────────────────
+// NVS cache
+// ─────────────────────────────────────────────────────────────────────────────
+static void clearBlob(Blob& b) {
+  memset(&b, 0, sizeof(b));
+  b.version = kVersion;
+  b.size    = sizeof(Blob);
+  b.board   = fnv1a(kBoard);
+}
+
+static void storeBlob(const Blob* b) {
+  nvs_handle h;
+  if (nvs_open(kNamespace, NVS_READWRITE, &h) != ESP_OK) return;
+  if (b) nvs_set_blob(h, kBlobKey, b, sizeof(*b));
+  else   nvs_erase_key(h, kBlobKey);
+  nvs_commit(h);
+  nvs_close(h);
+}
+
+// Everything but the file stamp
+static bool sameValues(const Blob& a, const Blob& b) {
+  return a.settingsMask == b.settingsMask && a.hiddenMask == b.hiddenMask &&
+         a.paramsMask == b.paramsMask &&
+         !memcmp(a.settings, b.settings, sizeof(a.settings)) &&
+         !memcmp(a.params, b.params, sizeof(a.params));
+}
+
+// ─────────────────────────────────────────────────────────────────────────────
+// Public API
+// ─────────────────────────────────────────────────────────────────────────────
+void profileBegin() {
+  clearBlob(sBlob);
+  sHave = false;
+
+  nvs_handle h;
+  if (nvs_open(kNamespace, NVS_READONLY, &h) != ESP_OK) return;
+  Blob b;
+  size_t len = sizeof(b);
+  if (nvs_get_blob(h, kBlobKey, &b, &len) == ESP_OK && len == sizeof(b) &&
+      b.version == kVersion && b.size == sizeof(Blob) && b.board == fnv1a(kBoard)) {
+    sBlob = b;
+    sHave = true;
+  }
+  nvs_close(h);
+}
+
+bool profileRefresh() {
+  struct stat st;
+  if (stat(kPath, &st) != 0) {
+    // Only a mounted FS saying "no such file" means the profile was deleted;
+    // a failed mount must not wipe the cached copy.
+    const int err = errno;
+    if (!sHave || !storageMounted() || err != ENOENT) return false;
+    bool changed = !sameValues(sBlob, Blob{});
+    clearBlob(sBlob);
+    sHave = false;
+    storeBlob(nullptr);
+    return changed;
+  }
+  if (sHave && sBlob.fileSize == (uint32_t)st.st_size && sBlob.fileMtime == (uint32_t)st.st_mtime) {
+    return false;
+  }
+
+  Blob b;
+  clearBlob(b);
+  if (!parseFile(b)) return false;      // keep the last good profile
+  b.fileSize  = (uint32_t)st.st_size;
+  b.fileMtime = (uint32_t)st.st_mtime;
+
+  bool changed = !sameValues(sBlob, b);
+  sBlob = b;
+  sHave = true;
+  storeBlob(&b);
+  Serial.printf("[profile] %s: %u settings, %u hidden menus\n", kBoard,
+                (unsigned)__builtin_popcount(b.settingsMask),
+                (unsigned)__builtin_popcount(b.hiddenMask));
+  return changed;
+}
+
+bool profileSetting(Setting s, int32_t& value) {
+  uint8_t i = (uint8_t)s;
+  if (!(sBlob.settingsMask & (1u << i))) return false;
+  value = sBlob.settings[i];
+  return true;
+}
+
+bool profileMenuHidden(MenuState m) {
+  uint8_t i = (uint8_t)m / 2;
+  return (m & 1) == 0 && i < kMenus && (sBlob.hiddenMask & (1u << i));
+}
+
+int32_t profileParam(ProfileParam p, int32_t def) {
+  uint8_t i = (uint8_t)p;
+  return (sBlob.paramsMask & (1u << i)) ? sBlob.params[i] : def;
+}
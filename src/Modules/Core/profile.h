@@ -0,0 +1,40 @@
+#pragma once
+#include <Arduino.h>
+#include "settings.h"
+#include "../../UserInterface/menus/menu_enums.h"
+
+// Device profiles from /littlefs/profile.json: setting defaults (including
+// the IR pin overrides), hidden main menus and default app parameters.
+//
+//   { "common": { "settings": { "bright": 60, "theme": "Amber" },
+//                 "hide":     [ "rfid", "nfc" ],
+//                 "params":   { "ir_gap_ms": 200 } },
+//     "boards": { "m5stick-c-plus-2": { "settings": { "irtxpin": 26 } },
+//                 "cardputer":        { "params": { "web_port": 8080 } } } }
+//
+// One file can serve every board; values under boards.<this board> override
+// "common". The file is streamed through an ArduinoJson filter, so only the
+// known keys of those two sections are ever materialized and parsing stays
+// within PROFILE_JSON_BUDGET bytes however large the file is. The result is
+// cached as a binary blob in NVS (namespace "profile") stamped with the file's
+// size and mtime: boots only re-parse when the file changed, and the cached
+// values are usable before LittleFS is mounted. The Wi-Fi menu is the boot
+// screen and cannot be hidden.
+
+#ifndef PROFILE_JSON_BUDGET
+  #define PROFILE_JSON_BUDGET 6144
+#endif
+
+enum class ProfileParam : uint8_t {
+  WEB_PORT,          // "web_port":  Web Files HTTP port
+  IR_GAP_MS,         // "ir_gap_ms": IR macro default gap between sends
+  PCAP_SNAP,         // "pcap_snap": Raw Sniffer snap length, 0 = whole frames
+  GPS_BAUD,          // "gps_baud":  GPS receiver UART rate
+  COUNT
+};
+
+void    profileBegin();                       // early in setup(): load the NVS blob
+bool    profileRefresh();                     // after storageBegin(); true if values changed
+bool    profileSetting(Setting s, int32_t& value);   // false → no profile default
+bool    profileMenuHidden(MenuState m);
+int32_t profileParam(ProfileParam p, int32_t def);
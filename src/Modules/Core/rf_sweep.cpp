@@ -0,0 +1,256 @@
+#include "rf_sweep.h"
+#include "cc1101.h"
+
+static constexpr uint8_t  kMaxBands  = 4;
+static constexpr int8_t   kHotDb     = 8;         // above the band floor → long dwell
+static constexpr uint8_t  kHotReads  = 4;         // extra RSSI reads on a hot channel
+static constexpr uint32_t kCalUs     = 2000;      // SCAL normally takes ~720 µs
+static constexpr int8_t   kNoLevel   = -128;
+
+// Sweep setup: ASK/OOK receiver, 203 kHz channel filter, no sync word, and
+// MCSM0.FS_AUTOCAL = 0 so entering RX never recalibrates
+static const uint8_t kConfig[][2] = {
+  { CC_IOCFG0,   0x2E },  // GDO0 high impedance
+  { CC_FSCTRL1,  0x06 },
+  { CC_FSCTRL0,  0x00 },
+  { CC_MDMCFG4,  0x87 },  // CHANBW_E = 2, CHANBW_M = 0
+  { CC_MDMCFG3,  0x32 },
+  { CC_MDMCFG2,  0x30 },  // ASK/OOK, no preamble/sync
+  { CC_MCSM0,    0x08 },
+  { CC_AGCCTRL2, 0x07 },
+  { CC_AGCCTRL1, 0x00 },
+  { CC_AGCCTRL0, 0x91 },
+  { CC_FREND1,   0x56 },
+  { CC_FREND0,   0x11 },
+  { CC_FSCAL0,   0x1F },
+  { CC_TEST2,    0x81 },
+  { CC_TEST1,    0x35 },
+  { CC_TEST0,    0x09 },
+};
+
+struct ChRegs {
+  uint8_t freq[3];        // FREQ2, FREQ1, FREQ0
+  uint8_t fscal[3];       // FSCAL3, FSCAL2, FSCAL1
+};
+
+struct BandState {
+  RfBand   cfg;
+  uint16_t first, count;
+  int16_t  floorQ4;       // EMA of the band's mean level, 1/16 dB
+  int32_t  passSum;
+};
+
+static ChRegs*   sRegs   = nullptr;
+static uint8_t*  sBandOf = nullptr;
+static int8_t*   sLevels = nullptr;
+static int8_t*   sPeaks  = nullptr;
+static BandState sBands[kMaxBands];
+static uint8_t   sBandCount = 0;
+static uint16_t  sChannels  = 0;
+
+static uint16_t  sNext     = 0;           // next channel to measure
+static uint8_t   sChip[6];                // FREQ2..0, FSCAL3..1 as last written
+static int8_t    sAntennaBand = -1;
+static bool      sUp       = false;
+
+static uint32_t  sSweeps = 0, sHops = 0, sRegBytes = 0, sHot = 0, sHotPass = 0;
+static uint64_t  sBusyUs = 0;
+static uint32_t  sBusyCh = 0;
+static uint32_t  sSweepStartMs = 0, sLastSweepMs = 0;
+static uint32_t  sWallStartMs = 0, sWallCh = 0;
+
+// ─────────────────────────────────────────────────────────────────────────────
+// Register tables
+// ─────────────────────────────────────────────────────────────────────────────
+static void freqWord(uint32_t hz, uint8_t out[3]) {
+  uint32_t w = (uint32_t)(((uint64_t)hz << 16) / CC1101_XOSC_HZ);
+  out[0] = w >> 16;
+  out[1] = w >> 8;
+  out[2] = w;
+}
+
+// Writes only the changed span of a 3-register group
+static void writeChanged(uint8_t reg, const uint8_t* want, uint8_t* have) {
+  int8_t lo = -1, hi = -1;
+  for (int8_t i = 0; i < 3; ++i) {
+    if (want[i] == have[i]) continue;
+    if (lo < 0) lo = i;
+    hi = i;
+  }
+  if (lo < 0) return;
+  uint8_t n = hi - lo + 1;
+  cc1101WriteBurst(reg + lo, want + lo, n);
+  memcpy(have + lo, want + lo, n);
+  sRegBytes += n;
+}
+
+static bool calibrate() {
+  for (uint16_t ch = 0; ch < sChannels; ++ch) {
+    const BandState& b = sBands[sBandOf[ch]];
+    ChRegs& r = sRegs[ch];
+    freqWord(b.cfg.startHz + (uint32_t)(ch - b.first) * b.cfg.stepHz, r.freq);
+    cc1101Strobe(CC_SIDLE);
+    cc1101WriteBurst(CC_FREQ2, r.freq, 3);
+    cc1101Strobe(CC_SCAL);
+    uint32_t t0 = micros();
+    while (cc1101Status(CC_MARCSTATE) != CC_MARC_IDLE) {
+      if (micros() - t0 > kCalUs) return false;
+    }
+    cc1101ReadBurst(CC_FSCAL3, r.fscal, 3);
+  }
+  memcpy(sChip, sRegs[sChannels - 1].freq, 3);
+  memcpy(sChip + 3, sRegs[sChannels - 1].fscal, 3);
+  return true;
+}
+
+// ─────────────────────────────────────────────────────────────────────────────
+// Sweep
+// ─────────────────────────────────────────────────────────────────────────────
+static void hop(uint16_t ch) {
+  uint8_t band = sBandOf[ch];
+  cc1101Strobe(CC_SIDLE);
+  if (band != sAntennaBand) {
+    cc1101Antenna(sBands[band].cfg.startHz);
+    sAntennaBand = band;
+  }
+  writeChanged(CC_FREQ2, sRegs[ch].freq, sChip);
+  writeChanged(CC_FSCAL3, sRegs[ch].fscal, sChip + 3);
+  cc1101Strobe(CC_SRX);
+  sHops++;
+}
+
+static int8_t measure(uint16_t ch) {
+  BandState& b = sBands[sBandOf[ch]];
+  delayMicroseconds(b.cfg.dwellUs);
+  int8_t level = cc1101RssiDbm();
+  if (sLevels[ch] != kNoLevel && sLevels[ch] * 16 > b.floorQ4 + kHotDb * 16) {
+    for (uint8_t i = 0; i < kHotReads; ++i) {           // was busy: look longer, keep the max
+      delayMicroseconds(b.cfg.dwellUs / 2);
+      level = max(level, cc1101RssiDbm());
+    }
+    sHotPass++;
+  }
+  return level;
+}
+
+static void endOfBand(BandState& b) {
+  int16_t mean = (int16_t)(b.passSum * 16 / b.count);
+  b.floorQ4 = b.floorQ4 == kNoLevel * 16 ? mean : (int16_t)(b.floorQ4 + (mean - b.floorQ4) / 4);
+  b.passSum = 0;
+}
+
+uint16_t rfSweepRun(uint32_t budgetUs) {
+  if (!sUp) return 0;
+  uint32_t t0 = micros();
+  uint16_t n = 0;
+  do {
+    uint16_t ch = sNext;
+    hop(ch);
+    int8_t level = measure(ch);
+    sLevels[ch] = level;
+    if (level > sPeaks[ch]) sPeaks[ch] = level;
+    BandState& b = sBands[sBandOf[ch]];
+    b.passSum += level;
+    if (ch == b.first + b.count - 1) endOfBand(b);
+    n++;
+
+    if (++sNext == sChannels) {
+      sNext = 0;
+      sSweeps++;
+      uint32_t now = millis();
+      sLastSweepMs  = now - sSweepStartMs;
+      sSweepStartMs = now;
+      sHot = sHotPass;
+      sHotPass = 0;
+    }
+  } while (micros() - t0 < budgetUs);
+  sBusyUs += micros() - t0;
+  sBusyCh += n;
+  sWallCh += n;
+  return n;
+}
+
+// ─────────────────────────────────────────────────────────────────────────────
+// Public API
+// ─────────────────────────────────────────────────────────────────────────────
+static void freeTables() {
+  free(sRegs);   sRegs   = nullptr;
+  free(sBandOf); sBandOf = nullptr;
+  free(sLevels); sLevels = nullptr;
+  free(sPeaks);  sPeaks  = nullptr;
+}
+
+bool rfSweepBegin(const RfBand* bands, uint8_t count) {
+  rfSweepEnd();
+  sBandCount = min<uint8_t>(count, kMaxBands);
+  sChannels  = 0;
+  for (uint8_t i = 0; i < sBandCount; ++i) {
+    BandState& b = sBands[i];
+    b.cfg     = bands[i];
+    b.first   = sChannels;
+    b.count   = min<uint32_t>((b.cfg.stopHz - b.cfg.startHz) / b.cfg.stepHz + 1, RF_SWEEP_MAX_CH - sChannels);
+    b.floorQ4 = kNoLevel * 16;
+    b.passSum = 0;
+    sChannels += b.count;
+  }
+  if (!sChannels) return false;
+
+  sRegs   = (ChRegs*)malloc(sChannels * sizeof(ChRegs));
+  sBandOf = (uint8_t*)malloc(sChannels);
+  sLevels = (int8_t*)malloc(sChannels);
+  sPeaks  = (int8_t*)malloc(sChannels);
+  if (!sRegs || !sBandOf || !sLevels || !sPeaks) { freeTables(); return false; }
+  for (uint8_t i = 0; i < sBandCount; ++i) memset(sBandOf + sBands[i].first, i, sBands[i].count);
+  memset(sLevels, kNoLevel, sChannels);
+  memset(sPeaks, kNoLevel, sChannels);
+
+  if (!cc1101Begin()) { freeTables(); return false; }
+  for (const auto& r : kConfig) cc1101Write(r[0], r[1]);
+  if (!calibrate()) { cc1101End(); freeTables(); return false; }
+
+  sNext = 0;
+  sAntennaBand = -1;
+  sSweeps = sHops = sRegBytes = sHot = sHotPass = 0;
+  sBusyUs = 0;
+  sBusyCh = sWallCh = 0;
+  sSweepStartMs = sWallStartMs = millis();
+  sLastSweepMs = 0;
+  sUp = true;
+  return true;
+}
+
+void rfSweepEnd() {
+  if (!sUp) return;
+  sUp = false;
+  cc1101End();
+  freeTables();
+}
+
+uint16_t      rfSweepChannels()   { return sChannels; }
+const int8_t* rfSweepLevels()     { return sLevels; }
+const int8_t* rfSweepPeaks()      { return sPeaks; }
+uint32_t      rfSweepGeneration() { return sSweeps; }
+
+uint32_t rfSweepFreqHz(uint16_t ch) {
+  if (ch >= sChannels) return 0;
+  const BandState& b = sBands[sBandOf[ch]];
+  return b.cfg.startHz + (uint32_t)(ch - b.first) * b.cfg.stepHz;
+}
+
+void rfSweepClearPeaks() {
+  if (sPeaks) memcpy(sPeaks, sLevels, sChannels);
+}
+
+RfSweepStats rfSweepStats() {
+  RfSweepStats s = {};
+  uint32_t wallMs = millis() - sWallStartMs;
+  s.running      = sUp;
+  s.channels     = sChannels;
+  s.sweeps       = sSweeps;
+  s.chPerSec     = sBusyUs ? (uint32_t)((uint64_t)sBusyCh * 1000000 / sBusyUs) : 0;
+  s.wallChPerSec = wallMs ? (uint32_t)((uint64_t)sWallCh * 1000 / wallMs) : 0;
+  s.lastSweepMs  = sLastSweepMs;
+  s.regBytesX100 = sHops ? (uint16_t)((uint64_t)sRegBytes * 100 / sHops) : 0;
+  s.hotChannels  = sHot;
+  return s;
+}
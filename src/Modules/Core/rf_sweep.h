@@ -0,0 +1,51 @@
+#pragma once
+#include <Arduino.h>
+
+// Receive-only CC1101 RSSI sweep over one or more frequency bands.
+//
+// rfSweepBegin() calibrates the synthesizer once per channel and keeps the
+// resulting FREQ2..0 and FSCAL3..1 values in a table. The radio then runs
+// with auto-calibration off, so a hop is IDLE, a burst write of only the
+// table bytes that differ from the previous channel (usually just FREQ0, or
+// FREQ1..0), and RX — the precomputed-calibration hopping scheme from the
+// CC1101 datasheet, well under a tenth of the time of a calibrating hop.
+//
+// Dwell adapts: each band has its own floor (an average over its channels),
+// and channels that were above it on the last pass get a longer dwell and
+// several RSSI reads whose maximum is kept, so short bursts are caught while
+// quiet spectrum is crossed at the band's minimum dwell.
+//
+// The sweep advances only inside rfSweepRun(budgetUs), called from the UI
+// loop: the radio shares the display's SPI bus. Stats report channels per
+// second of radio time, the number to benchmark sweep changes against.
+
+static constexpr uint16_t RF_SWEEP_MAX_CH = 1536;
+
+struct RfBand {
+  uint32_t startHz;
+  uint32_t stopHz;
+  uint32_t stepHz;
+  uint16_t dwellUs;         // minimum; RSSI settling for the 203 kHz filter
+};
+
+struct RfSweepStats {
+  bool     running;
+  uint16_t channels;
+  uint32_t sweeps;
+  uint32_t chPerSec;        // radio time only: channels / time inside rfSweepRun()
+  uint32_t wallChPerSec;    // including the time between calls
+  uint32_t lastSweepMs;     // wall time of the last full sweep
+  uint16_t regBytesX100;    // register bytes written per hop, × 100
+  uint16_t hotChannels;     // got the long dwell on the last sweep
+};
+
+bool     rfSweepBegin(const RfBand* bands, uint8_t count);   // radio setup + calibration
+void     rfSweepEnd();
+uint16_t rfSweepRun(uint32_t budgetUs);                       // channels measured
+uint16_t rfSweepChannels();
+uint32_t rfSweepFreqHz(uint16_t ch);
+const int8_t* rfSweepLevels();                                // dBm, latest per channel
+const int8_t* rfSweepPeaks();                                 // dBm, peak hold
+void     rfSweepClearPeaks();
+uint32_t rfSweepGeneration();                                 // completed sweeps
+RfSweepStats rfSweepStats();
@@ -0,0 +1,167 @@
+#include "sd_logger.h"
+#include <esp_heap_caps.h>
+
+static constexpr uint32_t kWriterStack = 4096;
+static constexpr int8_t   kStop        = -1;     // sentinel on the full queue
+
+// ─────────────────────────────────────────────────────────────────────────────
+// Producer side
+// ─────────────────────────────────────────────────────────────────────────────
+bool SdLogger::begin(const char* vfsPath, const SdLogConfig& cfg) {
+  if (_file) return false;
+  _cfg = cfg;
+  _cfg.bufCount   = max<uint8_t>(2, _cfg.bufCount);
+  _cfg.bufSectors = max<uint16_t>(1, _cfg.bufSectors);
+  _bufBytes = (uint32_t)_cfg.bufSectors * SD_SECTOR;
+
+  _bufs = (uint8_t**)calloc(_cfg.bufCount, sizeof(uint8_t*));
+  _used = (uint32_t*)calloc(_cfg.bufCount, sizeof(uint32_t));
+  if (!_bufs || !_used) { stop(0); return false; }
+  for (uint8_t i = 0; i < _cfg.bufCount; ++i) {
+    _bufs[i] = (uint8_t*)heap_caps_aligned_alloc(SD_SECTOR, _bufBytes, MALLOC_CAP_DMA);
+    if (!_bufs[i]) { stop(0); return false; }
+  }
+
+  _file = fopen(vfsPath, "ab");
+  if (!_file) { stop(0); return false; }
+  setvbuf(_file, nullptr, _IONBF, 0);           // our buffers go straight to FatFs
+  fseek(_file, 0, SEEK_END);
+  long size = ftell(_file);
+  _skew = size > 0 && size % SD_SECTOR ? SD_SECTOR - size % SD_SECTOR : 0;
+
+  // One extra slot so the stop sentinel fits even with every buffer queued
+  _full = xQueueCreate(_cfg.bufCount + 1, sizeof(int8_t));
+  _free = xQueueCreate(_cfg.bufCount, sizeof(int8_t));
+  _done = xSemaphoreCreateBinary();
+  if (!_full || !_free || !_done) { stop(0); return false; }
+  for (int8_t i = 0; i < _cfg.bufCount; ++i) xQueueSend(_free, &i, 0);
+
+  _cur = -1;
+  _written = 0; _worstMs = 0; _error = false; _abort = false;
+  _records = _dropRecords = _dropBytes = 0;
+  _high = 0;
+  _startMs = millis();
+  if (xTaskCreatePinnedToCore(writerTask, "sdlog", kWriterStack, this, _cfg.priority, &_task, 0) != pdPASS) {
+    _task = nullptr;
+    stop(0);
+    return false;
+  }
+  return true;
+}
+
+bool SdLogger::takeBuffer() {
+  if (xQueueReceive(_free, &_cur, 0) != pdTRUE) { _cur = -1; return false; }
+  _used[_cur] = 0;
+  _curCap = _bufBytes - _skew;                   // only the first buffer is short
+  _skew = 0;
+  return true;
+}
+
+void SdLogger::sealBuffer() {
+  if (_cur < 0) return;
+  xQueueSend(_full, &_cur, 0);                   // queue holds every buffer
+  _high = max<uint8_t>(_high, uxQueueMessagesWaiting(_full));
+  _cur = -1;
+}
+
+bool SdLogger::write(const void* data, size_t len) {
+  if (!_file || !len) return false;
+
+  // Accept the whole record only if it fits in what's free right now
+  size_t room = uxQueueMessagesWaiting(_free) * _bufBytes;
+  room = _cur >= 0 ? room + _curCap - _used[_cur] : room - _skew;
+  if (len > room) {
+    _dropRecords++;
+    _dropBytes += len;
+    return false;
+  }
+
+  const uint8_t* src = (const uint8_t*)data;
+  while (len) {
+    if (_cur < 0 && !takeBuffer()) break;        // can't happen after the room check
+    size_t n = min<size_t>(len, _curCap - _used[_cur]);
+    memcpy(_bufs[_cur] + _used[_cur], src, n);
+    _used[_cur] += n;
+    src += n;
+    len -= n;
+    if (_used[_cur] == _curCap) sealBuffer();
+  }
+  _records++;
+  return true;
+}
+
+bool SdLogger::stop(uint32_t timeoutMs) {
+  bool drained = true;
+  if (_task) {
+    sealBuffer();                                // final, possibly partial, buffer
+    xQueueSend(_full, &kStop, portMAX_DELAY);    // queued behind every full buffer
+    if (xSemaphoreTake(_done, pdMS_TO_TICKS(timeoutMs)) != pdTRUE) {
+      // Card is too slow: drop what is still queued, but let the write in
+      // progress finish before the file is closed underneath it.
+      drained = false;
+      _abort  = true;
+      xSemaphoreTake(_done, portMAX_DELAY);
+    }
+    _task = nullptr;                             // the writer deleted itself
+  }
+  if (_file) {
+    fclose(_file);
+    _file = nullptr;
+    SdLogStats s = stats();
+    Serial.printf("[sdlog] %llu bytes in %lu ms, %lu KB/s, worst write %lu ms, "
+                  "%lu records, %lu dropped (%lu bytes), pool high %u/%u\n",
+                  (unsigned long long)s.bytesWritten, (unsigned long)s.elapsedMs,
+                  (unsigned long)s.kbPerSec, (unsigned long)s.worstWriteMs,
+                  (unsigned long)s.records, (unsigned long)s.droppedRecords,
+                  (unsigned long)s.droppedBytes, s.buffersHigh, _cfg.bufCount);
+  }
+  if (_full) { vQueueDelete(_full); _full = nullptr; }
+  if (_free) { vQueueDelete(_free); _free = nullptr; }
+  if (_done) { vSemaphoreDelete(_done); _done = nullptr; }
+  if (_bufs) {
+    for (uint8_t i = 0; i < _cfg.bufCount; ++i) heap_caps_free(_bufs[i]);
+    free(_bufs);
+    _bufs = nullptr;
+  }
+  free(_used);
+  _used = nullptr;
+  return drained;
+}
+
+SdLogStats SdLogger::stats() const {
+  SdLogStats s = {};
+  s.active         = _file != nullptr;
+  s.elapsedMs      = millis() - _startMs;
+  s.bytesWritten   = _written;
+  s.kbPerSec       = s.elapsedMs ? (uint32_t)(s.bytesWritten * 1000 / s.elapsedMs / 1024) : 0;
+  s.worstWriteMs   = _worstMs;
+  s.records        = _records;
+  s.droppedRecords = _dropRecords;
+  s.droppedBytes   = _dropBytes;
+  s.buffersHigh    = _high;
+  s.writeError     = _error;
+  return s;
+}
+
+// ─────────────────────────────────────────────────────────────────────────────
+// Writer task
+// ─────────────────────────────────────────────────────────────────────────────
+void SdLogger::writerTask(void* arg) { static_cast<SdLogger*>(arg)->writerLoop(); }
+
+void SdLogger::writerLoop() {
+  int8_t idx;
+  for (;;) {
+    if (xQueueReceive(_full, &idx, portMAX_DELAY) != pdTRUE) continue;
+    if (idx == kStop) break;
+    if (_abort) { _dropBytes += _used[idx]; xQueueSend(_free, &idx, 0); continue; }
+    uint32_t t0 = millis();
+    size_t n = fwrite(_bufs[idx], 1, _used[idx], _file);
+    uint32_t dt = millis() - t0;
+    if (dt > _worstMs) _worstMs = dt;
+    if (n != _used[idx]) _error = true;
+    _written += n;
+    xQueueSend(_free, &idx, 0);
+  }
+  xSemaphoreGive(_done);
+  vTaskDelete(nullptr);
+}
@@ -0,0 +1,73 @@
+#pragma once
+#include <Arduino.h>
+#include <stdio.h>
+
+// Sustained record logging to microSD.
+//
+// Records are copied into a pool of RAM buffers whose size is a multiple of
+// the 512-byte sector. Full buffers go to a writer task that writes them
+// with one unbuffered fwrite each. When appending to a file whose length is
+// not a sector multiple, the first buffer is shortened to fill the last
+// partial sector, so every later write starts sector-aligned and FatFs
+// writes multi-sector runs straight from the buffer. While the card stalls
+// (FAT updates, wear levelling) the producer keeps filling the other buffers;
+// only when the whole pool is full are records dropped (and counted), never
+// blocked on.
+
+static constexpr uint16_t SD_SECTOR = 512;
+
+struct SdLogConfig {
+  uint16_t bufSectors = 32;     // 16 KB per buffer
+  uint8_t  bufCount   = 4;      // pool depth, ≥ 2
+  uint8_t  priority   = 2;      // writer task
+};
+
+struct SdLogStats {
+  bool     active;
+  uint32_t elapsedMs;
+  uint64_t bytesWritten;
+  uint32_t kbPerSec;            // sustained, since start
+  uint32_t worstWriteMs;        // slowest single buffer write
+  uint32_t records;
+  uint32_t droppedRecords;
+  uint32_t droppedBytes;
+  uint8_t  buffersHigh;         // most buffers queued at once
+  bool     writeError;
+};
+
+class SdLogger {
+public:
+  bool begin(const char* vfsPath, const SdLogConfig& cfg = SdLogConfig());
+  bool write(const void* data, size_t len);       // whole record or nothing
+  bool stop(uint32_t timeoutMs = 2000);           // drains, closes, prints stats;
+                                                  // false if buffers had to be dropped
+  bool active() const { return _file != nullptr; }
+  SdLogStats stats() const;
+
+private:
+  static void writerTask(void* arg);
+  void  writerLoop();
+  bool  takeBuffer();
+  void  sealBuffer();
+
+  SdLogConfig   _cfg;
+  FILE*         _file  = nullptr;
+  uint8_t**     _bufs  = nullptr;
+  uint32_t*     _used  = nullptr;
+  QueueHandle_t _full  = nullptr;       // buffer indices → writer, -1 = stop
+  QueueHandle_t _free  = nullptr;       // buffer indices ← writer
+  SemaphoreHandle_t _done = nullptr;    // given by the writer just before it exits
+  TaskHandle_t  _task  = nullptr;
+  int8_t        _cur   = -1;
+  uint32_t      _curCap   = 0;          // capacity of the current buffer
+  uint32_t      _bufBytes = 0;
+  uint32_t      _skew     = 0;          // bytes to the next sector boundary on open
+
+  uint32_t          _startMs = 0;
+  volatile uint64_t _written = 0;
+  volatile uint32_t _worstMs = 0;
+  volatile bool     _error   = false;
+  volatile bool     _abort   = false;   // stop timed out: writer discards the rest
+  uint32_t          _records = 0, _dropRecords = 0, _dropBytes = 0;
+  uint8_t           _high = 0;
+};
@@ -0,0 +1,33 @@
+#include "sdcard.h"
+#include <SD.h>
+#include <SPI.h>
+
+#if defined(M5CARDPUTER)
+  static constexpr int8_t kSck = 40, kMiso = 39, kMosi = 14, kCs = 12;
+  static constexpr uint32_t kFreqHz = 25000000;
+  static SPIClass sSpi(FSPI);                    // TFT owns HSPI
+#endif
+
+static bool sMounted = false;
+
+bool sdBegin() {
+  if (sMounted) return true;
+#if defined(M5CARDPUTER)
+  sSpi.begin(kSck, kMiso, kMosi, kCs);
+  sMounted = SD.begin(kCs, sSpi, kFreqHz, SD_MOUNT);
+  if (!sMounted) Serial.println("[sd] no card");
+#endif
+  return sMounted;
+}
+
+SPIClass* sdSpi() {
+#if defined(M5CARDPUTER)
+  sSpi.begin(kSck, kMiso, kMosi, kCs);           // no-op once started
+  return &sSpi;
+#else
+  return nullptr;
+#endif
+}
+
+bool    sdMounted() { return sMounted; }
+fs::FS& sdFs()      { return SD; }
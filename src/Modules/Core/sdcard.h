@@ -0,0 +1,14 @@
+#pragma once
+#include <Arduino.h>
+#include <FS.h>
+#include <SPI.h>
+
+// microSD slot (Cardputer). Mounted on first use at SD_MOUNT so both the
+// Arduino FS API and plain VFS calls (opendir, fopen) can reach it.
+
+static constexpr const char* SD_MOUNT = "/sd";
+
+bool    sdBegin();          // idempotent; false when there is no slot or no card
+bool    sdMounted();
+fs::FS& sdFs();
+SPIClass* sdSpi();          // the slot's bus, started, for other devices on it; nullptr without a slot
@@ -0,0 +1,136 @@
+#include "settings.h"
+#include "profile.h"
+#include <nvs.h>
+#include <driver/gpio.h>
+
+static constexpr const char* kNamespace = "settings";
+static constexpr uint8_t     kCount     = (uint8_t)Setting::COUNT;
+
+static const char* const kThemeNames[]    = { "Mono", "Amber", "Cyan", "Green" };
+static const char* const kBatSaverNames[] = { "Off", "30 s", "1 min", "2 min", "5 min" };
+
+// Order must match enum Setting
+static const SettingDef kDefs[kCount] = {
+  { "theme",    "Theme",      SettingType::ENUM,   0,   0,   3, 1, kThemeNames,    nullptr },
+  { "bright",   "Brightness", SettingType::INT,  100,  10, 100, 5, nullptr,        "%"     },
+  { "audio",    "Audio",      SettingType::BOOL,   1,   0,   1, 1, nullptr,        nullptr },
+  { "volume",   "Volume",     SettingType::INT,   50,   0, 100, 5, nullptr,        "%"     },
+  { "utcoff",   "UTC offset", SettingType::INT,    0, -12,  14, 1, nullptr,        "h"     },
+  { "batsaver", "Bat Saver",  SettingType::ENUM,   0,   0,   4, 1, kBatSaverNames, nullptr },
+  { "irtxpin",  "IR TX pin",  SettingType::INT,   -1,  -1,  48, 1, nullptr,        nullptr },
+  { "irrxpin",  "IR RX pin",  SettingType::INT,   -1,  -1,  48, 1, nullptr,        nullptr },
+};
+
+static int32_t    sValues[kCount];
+static uint32_t   sLoaded = 0;         // bit per setting
+static uint32_t   sDirty  = 0;
+static uint32_t   sLastChangeMs = 0;
+static nvs_handle sNvs = 0;
+static bool       sNvsOpen = false;
+
+// ─────────────────────────────────────────────────────────────────────────────
+// NVS
+// ─────────────────────────────────────────────────────────────────────────────
+static bool openNvs() {
+  if (!sNvsOpen) sNvsOpen = nvs_open(kNamespace, NVS_READWRITE, &sNvs) == ESP_OK;
+  return sNvsOpen;
+}
+
+static int32_t clampTo(const SettingDef& d, int32_t v) {
+  return v < d.min ? d.min : v > d.max ? d.max : v;
+}
+
+static void load(uint8_t i) {
+  int32_t v;
+  if (!profileSetting((Setting)i, v)) v = kDefs[i].def;
+  if (openNvs()) nvs_get_i32(sNvs, kDefs[i].key, &v);   // missing key keeps the default
+  sValues[i] = clampTo(kDefs[i], v);
+  sLoaded |= 1u << i;
+}
+
+// GPIOs that exist on the target but are wired to flash/PSRAM on these boards.
+// The StickC Plus 1.1's PICO-D4 keeps 9 and 10 free (its IR LED is on 9).
+static bool pinReserved(int32_t pin) {
+#if defined(CONFIG_IDF_TARGET_ESP32S3)
+  return pin >= 26 && pin <= 32;
+#elif defined(M5STICK_C_PLUS_1_1)
+  return (pin >= 6 && pin <= 8) || pin == 11 || pin == 16 || pin == 17;
+#else
+  return pin >= 6 && pin <= 11;
+#endif
+}
+
+// ─────────────────────────────────────────────────────────────────────────────
+// Public API
+// ─────────────────────────────────────────────────────────────────────────────
+const SettingDef& settingsDef(Setting s) { return kDefs[(uint8_t)s]; }
+
+int32_t settingsGet(Setting s) {
+  uint8_t i = (uint8_t)s;
+  if (!(sLoaded & (1u << i))) load(i);
+  return sValues[i];
+}
+
+bool settingsGetBool(Setting s) { return settingsGet(s) != 0; }
+
+void settingsSet(Setting s, int32_t value) {
+  uint8_t i = (uint8_t)s;
+  value = clampTo(kDefs[i], value);
+  if (settingsGet(s) == value) return;
+  sValues[i] = value;
+  sDirty |= 1u << i;
+  sLastChangeMs = millis();
+}
+
+bool settingsPinValid(Setting s, int32_t pin) {
+  if (s != Setting::IR_TX_GPIO && s != Setting::IR_RX_GPIO) return true;
+  if (pin < 0) return true;                              // build default
+  if (pin > settingsDef(s).max || pinReserved(pin)) return false;
+  // Output-capable excludes the input-only 34-39 on the ESP32
+  return s == Setting::IR_TX_GPIO ? GPIO_IS_VALID_OUTPUT_GPIO(pin) : GPIO_IS_VALID_GPIO(pin);
+}
+
+void settingsStep(Setting s, int dir) {
+  const SettingDef& d = settingsDef(s);
+  int32_t v = settingsGet(s);
+  for (int32_t n = d.max - d.min + 1; n > 0; --n) {     // pins skip unusable GPIOs
+    v += dir * d.step;
+    if (v > d.max) v = d.min;
+    if (v < d.min) v = d.max;
+    if (settingsPinValid(s, v)) break;
+  }
+  settingsSet(s, v);
+}
+
+size_t settingsFormat(Setting s, char* buf, size_t cap) {
+  const SettingDef& d = settingsDef(s);
+  int32_t v = settingsGet(s);
+  int n;
+  switch (d.type) {
+    case SettingType::BOOL: n = snprintf(buf, cap, "%s", v ? "On" : "Off"); break;
+    case SettingType::ENUM: n = snprintf(buf, cap, "%s", d.names[v - d.min]); break;
+    default:
+      if (v < 0 && d.min < 0 && d.def < 0) n = snprintf(buf, cap, "Default");   // pins: build default
+      else n = snprintf(buf, cap, "%ld%s", (long)v, d.unit ? d.unit : "");
+      break;
+  }
+  return n > 0 ? min<size_t>((size_t)n, cap - 1) : 0;
+}
+
+bool settingsCommitNow() {
+  if (!sDirty) return true;
+  if (!openNvs()) return false;
+  for (uint8_t i = 0; i < kCount; ++i) {
+    if (sDirty & (1u << i)) nvs_set_i32(sNvs, kDefs[i].key, sValues[i]);
+  }
+  sDirty = 0;
+  return nvs_commit(sNvs) == ESP_OK;
+}
+
+void settingsReloadDefaults() {
+  sLoaded &= sDirty;                                     // pending edits stay as they are
+}
+
+void settingsPoll() {
+  if (sDirty && millis() - sLastChangeMs >= SETTINGS_COMMIT_DELAY_MS) settingsCommitNow();
+}
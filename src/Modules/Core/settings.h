@@ -0,0 +1,49 @@
+#pragma once
+#include <Arduino.h>
+
+// Typed settings registry persisted in NVS (namespace "settings").
+//
+// Nothing is read at boot: each value is fetched from NVS the first time it
+// is asked for and cached in RAM from then on. settingsSet() only touches the
+// cache; dirty keys are committed together by settingsPoll() once no change
+// has happened for SETTINGS_COMMIT_DELAY_MS, so scrubbing a slider costs one
+// flash write instead of one per step. Keys never saved fall back to the
+// device profile (profile.h), then to the built-in default.
+
+static constexpr uint16_t SETTINGS_COMMIT_DELAY_MS = 300;
+
+enum class Setting : uint8_t {
+  THEME,
+  BRIGHTNESS,
+  AUDIO,
+  VOLUME,
+  UTC_OFFSET,
+  BAT_SAVER,
+  IR_TX_GPIO,
+  IR_RX_GPIO,
+  COUNT
+};
+
+enum class SettingType : uint8_t { BOOL, INT, ENUM };
+
+struct SettingDef {
+  const char*        key;       // NVS key, max 15 chars
+  const char*        label;
+  SettingType        type;
+  int16_t            def, min, max, step;
+  const char* const* names;     // ENUM only, (max - min + 1) entries
+  const char*        unit;
+};
+
+const SettingDef& settingsDef(Setting s);
+
+int32_t settingsGet(Setting s);
+bool    settingsGetBool(Setting s);
+void    settingsSet(Setting s, int32_t value);   // clamped; RAM only until the commit
+void    settingsStep(Setting s, int dir);        // ±step, wraps at the ends
+bool    settingsPinValid(Setting s, int32_t pin); // IR pins: usable GPIO or -1; others true
+size_t  settingsFormat(Setting s, char* buf, size_t cap);
+
+void    settingsPoll();                          // call from loop(): coalesced commit
+bool    settingsCommitNow();                     // flush dirty keys immediately
+void    settingsReloadDefaults();                // re-read unsaved keys after a profile change
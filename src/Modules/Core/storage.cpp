@@ -0,0 +1,271 @@
+#include "storage.h"
+#include <LittleFS.h>
+#include <stdarg.h>
+
+static constexpr uint8_t  kJobDepth      = STORAGE_CACHE_PAGES + 2 * STORAGE_MAX_STREAMS;
+static constexpr uint32_t kIdlePollMs    = 250;
+static constexpr uint32_t kFlushStack    = 4096;
+static constexpr UBaseType_t kFlushPrio  = tskIDLE_PRIORITY + 1;
+
+// ─────────────────────────────────────────────────────────────────────────────
+// State
+// ─────────────────────────────────────────────────────────────────────────────
+enum class Op : uint8_t { WRITE, SYNC, CLOSE };
+struct Job { Op op; int8_t stream; int8_t page; };
+
+struct AppendStream {
+  char     path[STORAGE_PATH_LEN];
+  bool     used;
+  bool     truncate;       // first open with "w"
+  bool     closing;
+  int8_t   fill;           // page being filled, -1 none
+  uint32_t lastAppendMs;
+  File     file;           // flush task only
+};
+
+struct PageMeta { uint16_t used; int8_t stream; };
+
+static uint8_t  sPages[STORAGE_CACHE_PAGES][STORAGE_PAGE_SIZE] __attribute__((aligned(4)));
+static PageMeta sMeta[STORAGE_CACHE_PAGES];
+static int8_t   sFree[STORAGE_CACHE_PAGES];
+static uint8_t  sFreeCount = 0;
+static AppendStream sStreams[STORAGE_MAX_STREAMS];
+
+static SemaphoreHandle_t sLock  = nullptr;   // held for copies only, never across flash I/O
+static QueueHandle_t     sJobs  = nullptr;
+static TaskHandle_t      sTask  = nullptr;
+static volatile bool     sBusy  = false;
+static bool              sMounted = false;
+
+static uint32_t sCached = 0, sWritten = 0, sDropped = 0, sWorstMs = 0;
+
+// ─────────────────────────────────────────────────────────────────────────────
+// Helpers (caller holds sLock)
+// ─────────────────────────────────────────────────────────────────────────────
+static bool validHandle(int8_t h) {
+  return h >= 0 && h < STORAGE_MAX_STREAMS && sStreams[h].used && !sStreams[h].closing;
+}
+
+// The queue keeps room for every page plus one CLOSE per stream; SYNCs only
+// use what is left, so a page or a close can never be lost to a full queue.
+static void pushJob(Op op, int8_t stream, int8_t page) {
+  if (op == Op::SYNC && uxQueueSpacesAvailable(sJobs) <= STORAGE_CACHE_PAGES + STORAGE_MAX_STREAMS) return;
+  Job j = { op, stream, page };
+  xQueueSend(sJobs, &j, 0);
+}
+
+static void sealLocked(int8_t h) {
+  AppendStream& s = sStreams[h];
+  if (s.fill < 0) return;
+  if (sMeta[s.fill].used) {
+    pushJob(Op::WRITE, h, s.fill);
+  } else {
+    sFree[sFreeCount++] = s.fill;
+  }
+  s.fill = -1;
+}
+
+// ─────────────────────────────────────────────────────────────────────────────
+// Flush task
+// ─────────────────────────────────────────────────────────────────────────────
+static void makeParents(const char* path) {
+  char dir[STORAGE_PATH_LEN];
+  for (const char* p = strchr(path + 1, '/'); p; p = strchr(p + 1, '/')) {
+    size_t n = p - path;
+    memcpy(dir, path, n);
+    dir[n] = '\0';
+    if (!LittleFS.exists(dir)) LittleFS.mkdir(dir);
+  }
+}
+
+static bool ensureOpen(AppendStream& s) {
+  if (s.file) return true;
+  makeParents(s.path);
+  s.file = LittleFS.open(s.path, s.truncate ? FILE_WRITE : FILE_APPEND);
+  s.truncate = false;
+  return (bool)s.file;
+}
+
+static void releasePage(int8_t page, uint16_t written) {
+  xSemaphoreTake(sLock, portMAX_DELAY);
+  sCached  -= sMeta[page].used;
+  sWritten += written;
+  sDropped += sMeta[page].used - written;
+  sFree[sFreeCount++] = page;
+  xSemaphoreGive(sLock);
+}
+
+static void sealIdle() {
+  uint32_t now = millis();
+  xSemaphoreTake(sLock, portMAX_DELAY);
+  for (int8_t h = 0; h < STORAGE_MAX_STREAMS; ++h) {
+    AppendStream& s = sStreams[h];
+    if (!s.used || s.closing || s.fill < 0 || !sMeta[s.fill].used) continue;
+    if (now - s.lastAppendMs < STORAGE_IDLE_MS) continue;
+    sealLocked(h);
+    pushJob(Op::SYNC, h, -1);
+  }
+  xSemaphoreGive(sLock);
+}
+
+static void flushTask(void*) {
+  Job j;
+  for (;;) {
+    if (xQueueReceive(sJobs, &j, pdMS_TO_TICKS(kIdlePollMs)) != pdTRUE) {
+      sealIdle();
+      continue;
+    }
+    sBusy = true;
+    AppendStream& s = sStreams[j.stream];
+    switch (j.op) {
+      case Op::WRITE: {
+        uint32_t t0 = millis();
+        uint16_t n  = ensureOpen(s) ? s.file.write(sPages[j.page], sMeta[j.page].used) : 0;
+        sWorstMs = max<uint32_t>(sWorstMs, millis() - t0);
+        releasePage(j.page, n);
+        break;
+      }
+      case Op::SYNC:
+        if (s.file) s.file.flush();
+        break;
+      case Op::CLOSE:
+        if (s.file) s.file.close();
+        xSemaphoreTake(sLock, portMAX_DELAY);
+        s.used = false;
+        xSemaphoreGive(sLock);
+        break;
+    }
+    sBusy = false;
+  }
+}
+
+// ─────────────────────────────────────────────────────────────────────────────
+// Public API
+// ─────────────────────────────────────────────────────────────────────────────
+bool storageBegin() {
+  if (sMounted) return true;
+  // First boot after the switch from SPIFFS formats the partition once.
+  if (!LittleFS.begin(true)) {
+    Serial.println("[storage] LittleFS mount failed");
+    return false;
+  }
+  sLock = xSemaphoreCreateMutex();
+  sJobs = xQueueCreate(kJobDepth, sizeof(Job));
+  for (uint8_t i = 0; i < STORAGE_CACHE_PAGES; ++i) sFree[i] = i;
+  sFreeCount = STORAGE_CACHE_PAGES;
+  for (AppendStream& s : sStreams) s.fill = -1;
+  xTaskCreatePinnedToCore(flushTask, "storage", kFlushStack, nullptr, kFlushPrio, &sTask, 0);
+  sMounted = true;
+  return true;
+}
+
+bool    storageMounted() { return sMounted; }
+fs::FS& storageFs()      { return LittleFS; }
+
+int8_t storageOpen(const char* path, bool truncate) {
+  if (!sMounted) return -1;
+  int8_t h = -1;
+  xSemaphoreTake(sLock, portMAX_DELAY);
+  for (int8_t i = 0; i < STORAGE_MAX_STREAMS; ++i) {
+    if (sStreams[i].used) continue;
+    AppendStream& s = sStreams[i];
+    strncpy(s.path, path, sizeof(s.path) - 1);
+    s.path[sizeof(s.path) - 1] = '\0';
+    s.used = true;
+    s.truncate = truncate;
+    s.closing = false;
+    s.fill = -1;
+    s.lastAppendMs = millis();
+    h = i;
+    break;
+  }
+  xSemaphoreGive(sLock);
+  return h;
+}
+
+size_t storageAppend(int8_t h, const void* data, size_t len) {
+  if (!sMounted) return 0;
+  const uint8_t* src = (const uint8_t*)data;
+  size_t taken = 0;
+
+  xSemaphoreTake(sLock, portMAX_DELAY);
+  if (validHandle(h)) {
+    AppendStream& s = sStreams[h];
+    while (taken < len) {
+      if (s.fill < 0) {
+        if (!sFreeCount) break;                 // pool exhausted: drop, don't wait
+        s.fill = sFree[--sFreeCount];
+        sMeta[s.fill] = { 0, h };
+      }
+      PageMeta& m = sMeta[s.fill];
+      size_t n = min(len - taken, (size_t)(STORAGE_PAGE_SIZE - m.used));
+      memcpy(sPages[s.fill] + m.used, src + taken, n);
+      m.used += n;
+      taken  += n;
+      if (m.used == STORAGE_PAGE_SIZE) sealLocked(h);
+    }
+    s.lastAppendMs = millis();
+  }
+  sCached  += taken;
+  sDropped += len - taken;
+  xSemaphoreGive(sLock);
+  return taken;
+}
+
+size_t storagePrintf(int8_t h, const char* fmt, ...) {
+  char buf[160];
+  va_list ap;
+  va_start(ap, fmt);
+  int n = vsnprintf(buf, sizeof(buf), fmt, ap);
+  va_end(ap);
+  if (n <= 0) return 0;
+  return storageAppend(h, buf, min<size_t>((size_t)n, sizeof(buf) - 1));
+}
+
+void storageSync(int8_t h) {
+  if (!sMounted) return;
+  xSemaphoreTake(sLock, portMAX_DELAY);
+  if (validHandle(h)) {
+    sealLocked(h);
+    pushJob(Op::SYNC, h, -1);
+  }
+  xSemaphoreGive(sLock);
+}
+
+void storageClose(int8_t h) {
+  if (!sMounted) return;
+  xSemaphoreTake(sLock, portMAX_DELAY);
+  if (validHandle(h)) {
+    sealLocked(h);
+    sStreams[h].closing = true;
+    pushJob(Op::CLOSE, h, -1);
+  }
+  xSemaphoreGive(sLock);
+}
+
+bool storageFlushAll(uint32_t timeoutMs) {
+  if (!sMounted) return false;
+  for (int8_t h = 0; h < STORAGE_MAX_STREAMS; ++h) storageSync(h);
+  uint32_t t0 = millis();
+  while (uxQueueMessagesWaiting(sJobs) || sBusy || sFreeCount < STORAGE_CACHE_PAGES) {
+    if (millis() - t0 > timeoutMs) return false;
+    vTaskDelay(pdMS_TO_TICKS(5));
+  }
+  return true;
+}
+
+StorageStats storageStats() {
+  StorageStats st = {};
+  st.mounted = sMounted;
+  if (!sMounted) return st;
+  st.totalBytes = LittleFS.totalBytes();
+  st.usedBytes  = LittleFS.usedBytes();
+  xSemaphoreTake(sLock, portMAX_DELAY);
+  st.cachedBytes  = sCached;
+  st.writtenBytes = sWritten;
+  st.droppedBytes = sDropped;
+  st.freePages    = sFreeCount;
+  st.worstWriteMs = sWorstMs;
+  xSemaphoreGive(sLock);
+  return st;
+}
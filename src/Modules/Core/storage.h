@@ -0,0 +1,44 @@
+#pragma once
+#include <Arduino.h>
+#include <FS.h>
+
+// On-device storage on the data partition (LittleFS).
+//
+// Appends never touch flash from the caller: bytes are copied into a pool of
+// page-sized RAM buffers, and full (or idle) pages are handed to a low-priority
+// flush task that does the actual writes. A full pool drops bytes and counts
+// them rather than blocking the caller. Reads go straight through storageFs().
+
+#ifndef STORAGE_PAGE_SIZE
+  #define STORAGE_PAGE_SIZE 4096          // LittleFS block size on ESP32
+#endif
+#ifndef STORAGE_CACHE_PAGES
+  #define STORAGE_CACHE_PAGES 6
+#endif
+static constexpr uint8_t  STORAGE_MAX_STREAMS = 4;
+static constexpr uint8_t  STORAGE_PATH_LEN    = 48;
+static constexpr uint16_t STORAGE_IDLE_MS     = 1000;   // partial page → flash
+
+struct StorageStats {
+  bool     mounted;
+  size_t   totalBytes;
+  size_t   usedBytes;
+  uint32_t cachedBytes;       // accepted, not yet on flash
+  uint32_t writtenBytes;
+  uint32_t droppedBytes;      // pool exhausted
+  uint8_t  freePages;
+  uint32_t worstWriteMs;      // slowest single page write (erase included)
+};
+
+bool  storageBegin();                                     // mount + start flush task
+bool  storageMounted();
+fs::FS& storageFs();
+
+int8_t storageOpen(const char* path, bool truncate = false);   // -1 if no stream free
+size_t storageAppend(int8_t h, const void* data, size_t len);   // never blocks; returns bytes taken
+size_t storagePrintf(int8_t h, const char* fmt, ...);
+void   storageSync(int8_t h);                               // push partial page + fsync
+void   storageClose(int8_t h);                              // flushed in the background
+
+bool   storageFlushAll(uint32_t timeoutMs);                 // blocking, for shutdown paths
+StorageStats storageStats();
@@ -0,0 +1,180 @@
+#include "telemetry.h"
+#include "storage.h"
+#include <esp_system.h>
+#include <esp_attr.h>
+#include <stdarg.h>
+
+static constexpr uint32_t kMagic        = 0x54454C31;   // "TEL1"
+static constexpr uint16_t kHeapEveryMs  = 250;
+static constexpr uint16_t kSummaryLen   = 768;
+static constexpr uint8_t  kTrail        = 8;            // transitions shown in the summary
+static constexpr uint32_t kLogMax       = 16 * 1024;
+static constexpr const char* kLogPath   = "/telemetry.log";
+
+struct Entry {
+  uint32_t ms;              // uptime when the screen was entered
+  uint8_t  menu;
+  uint8_t  mode;
+  int8_t   arg;             // app row for TelemetryMode::APP
+  uint8_t  reserved;
+  uint16_t loopMaxMs;       // worst loop while on this screen
+  uint16_t heapKB;          // free heap on entry
+};
+
+struct RtcState {
+  uint32_t magic;
+  uint32_t boots;
+  uint8_t  head;            // newest entry
+  uint8_t  count;
+  uint16_t heapLowKB;       // lowest free heap seen this run
+  uint32_t aliveMs;         // uptime at the last loop
+  uint16_t worstLoopMs;
+  uint8_t  worstEntry;      // ring index of the screen it happened on
+  uint8_t  reserved;
+  Entry    ring[TELEMETRY_RING];
+};
+
+RTC_NOINIT_ATTR static RtcState rtc;
+
+static uint32_t sLastUs = 0;
+static uint32_t sHeapMs = 0;
+static char     sSummary[kSummaryLen];
+static uint16_t sSummaryLen = 0;
+
+static const char* const kMenuNames[] = {
+  "WIFI", "WIFI_SUB", "BT", "BT_SUB", "IR", "IR_SUB", "RF", "RF_SUB",
+  "NRF", "NRF_SUB", "RADIO", "RADIO_SUB", "GPS", "GPS_SUB", "RPI", "RPI_SUB",
+  "BADUSB", "BADUSB_SUB", "SETTINGS", "SETTINGS_SUB", "EXTRAS", "EXTRAS_SUB",
+  "FILES", "FILES_SUB", "RFID", "RFID_SUB", "NFC", "NFC_SUB",
+};
+static_assert(sizeof(kMenuNames) / sizeof(kMenuNames[0]) == NFC_SUBMENU + 1, "menu names out of sync");
+
+static const char* const kModeNames[] = { "", " options", " stopwatch", " b-gone", " ir-read", " app" };
+
+static const char* resetName(esp_reset_reason_t r) {
+  switch (r) {
+    case ESP_RST_POWERON:   return "power-on";
+    case ESP_RST_EXT:       return "external";
+    case ESP_RST_SW:        return "software";
+    case ESP_RST_PANIC:     return "PANIC";
+    case ESP_RST_INT_WDT:   return "INT WDT";
+    case ESP_RST_TASK_WDT:  return "TASK WDT";
+    case ESP_RST_WDT:       return "WDT";
+    case ESP_RST_DEEPSLEEP: return "deep sleep";
+    case ESP_RST_BROWNOUT:  return "BROWNOUT";
+    default:                return "unknown";
+  }
+}
+
+static uint16_t heapKB(uint32_t bytes) { return (uint16_t)min<uint32_t>(bytes / 1024, 0xFFFF); }
+
+// ─────────────────────────────────────────────────────────────────────────────
+// Summary of the previous run
+// ─────────────────────────────────────────────────────────────────────────────
+static bool valid() {
+  if (rtc.magic != kMagic || rtc.head >= TELEMETRY_RING || rtc.count > TELEMETRY_RING) return false;
+  for (uint8_t i = 0; i < rtc.count; ++i) {
+    if (rtc.ring[i].menu > NFC_SUBMENU || rtc.ring[i].mode > (uint8_t)TelemetryMode::APP) return false;
+  }
+  return true;
+}
+
+static void add(const char* fmt, ...) {
+  if (sSummaryLen >= kSummaryLen - 1) return;
+  va_list ap;
+  va_start(ap, fmt);
+  int n = vsnprintf(sSummary + sSummaryLen, kSummaryLen - sSummaryLen, fmt, ap);
+  va_end(ap);
+  if (n > 0) sSummaryLen = min<uint16_t>(kSummaryLen - 1, sSummaryLen + n);
+}
+
+static void addScreen(const Entry& e) {
+  add("%s%s", kMenuNames[e.menu], kModeNames[e.mode]);
+  if (e.mode == (uint8_t)TelemetryMode::APP && e.arg >= 0) add(" %d", e.arg);
+}
+
+static void summarise(esp_reset_reason_t reason) {
+  sSummaryLen = 0;
+  add("[telemetry] boot %lu: previous run ended by %s after %lu.%lu s\n", (unsigned long)rtc.boots + 1,
+      resetName(reason), (unsigned long)(rtc.aliveMs / 1000), (unsigned long)(rtc.aliveMs % 1000 / 100));
+  if (!rtc.count) return;
+
+  const Entry& last = rtc.ring[rtc.head];
+  add("[telemetry] last screen: ");
+  addScreen(last);
+  add(" for %lu ms, worst loop %u ms\n", (unsigned long)(rtc.aliveMs - last.ms), last.loopMaxMs);
+
+  add("[telemetry] run: worst loop %u ms on ", rtc.worstLoopMs);
+  addScreen(rtc.ring[rtc.worstEntry]);
+  add(", heap low %u KB\n[telemetry] trail:", rtc.heapLowKB);
+
+  uint8_t n = min<uint8_t>(rtc.count, kTrail);
+  for (uint8_t k = n; k-- > 0; ) {
+    const Entry& e = rtc.ring[(rtc.head + TELEMETRY_RING - k) % TELEMETRY_RING];
+    add(" %lu.%lu ", (unsigned long)(e.ms / 1000), (unsigned long)(e.ms % 1000 / 100));
+    addScreen(e);
+    add(" (%u ms, %u KB)%s", e.loopMaxMs, e.heapKB, k ? " >" : "\n");
+  }
+}
+
+// ─────────────────────────────────────────────────────────────────────────────
+// Public API
+// ─────────────────────────────────────────────────────────────────────────────
+void telemetryBegin() {
+  esp_reset_reason_t reason = esp_reset_reason();
+  uint32_t boots = 0;
+  if (reason != ESP_RST_POWERON && valid()) {
+    summarise(reason);
+    Serial.print(sSummary);
+    boots = rtc.boots + 1;
+  }
+  memset(&rtc, 0, sizeof(rtc));
+  rtc.boots     = boots;
+  rtc.heapLowKB = heapKB(esp_get_minimum_free_heap_size());
+  rtc.magic     = kMagic;
+  rtc.head      = TELEMETRY_RING - 1;
+  sLastUs = micros();
+}
+
+void telemetryLoop(MenuState menu, TelemetryMode mode, int8_t arg) {
+  uint32_t nowUs = micros();
+  uint32_t nowMs = millis();
+  uint16_t loopMs = (uint16_t)min<uint32_t>((nowUs - sLastUs) / 1000, 0xFFFF);
+  sLastUs = nowUs;
+
+  Entry* cur = rtc.count ? &rtc.ring[rtc.head] : nullptr;
+  if (!cur) loopMs = 0;                                     // first call: that was setup()
+  if (!cur || cur->menu != menu || cur->mode != (uint8_t)mode || cur->arg != arg) {
+    rtc.head = (rtc.head + 1) % TELEMETRY_RING;
+    if (rtc.count < TELEMETRY_RING) rtc.count++;
+    if (rtc.worstEntry == rtc.head) rtc.worstLoopMs = 0;     // its screen just got overwritten
+    cur = &rtc.ring[rtc.head];
+    // The loop that just ended opened this screen, so its time counts here
+    *cur = { nowMs, (uint8_t)menu, (uint8_t)mode, arg, 0, 0, heapKB(esp_get_free_heap_size()) };
+  }
+  if (loopMs > cur->loopMaxMs) {
+    cur->loopMaxMs = loopMs;
+    if (loopMs > rtc.worstLoopMs) {
+      rtc.worstLoopMs = loopMs;
+      rtc.worstEntry  = rtc.head;
+    }
+  }
+  rtc.aliveMs = nowMs;
+
+  if (nowMs - sHeapMs >= kHeapEveryMs) {
+    sHeapMs = nowMs;
+    rtc.heapLowKB = heapKB(esp_get_minimum_free_heap_size());
+  }
+}
+
+void telemetryFlush() {
+  if (!sSummaryLen || !storageMounted()) return;
+  File f = storageFs().open(kLogPath, "r");
+  bool rotate = f && f.size() > kLogMax;
+  if (f) f.close();
+  int8_t h = storageOpen(kLogPath, rotate);
+  if (h < 0) return;
+  storageAppend(h, sSummary, sSummaryLen);
+  storageClose(h);
+  sSummaryLen = 0;
+}
@@ -0,0 +1,18 @@
+#pragma once
+#include <Arduino.h>
+#include "../../UserInterface/menus/menu_enums.h"
+
+// Boot/crash telemetry kept in RTC slow memory, which survives software
+// resets, panics and watchdog resets (not power loss). Each screen change
+// appends one entry to a small ring; the entry for the current screen keeps
+// its worst loop time up to date in place. On the next boot the ring is
+// summarised to Serial and /telemetry.log, so a freeze or crash can be tied
+// to the screen that was up. Per-loop cost is a few word writes.
+
+static constexpr uint8_t TELEMETRY_RING = 32;
+
+enum class TelemetryMode : uint8_t { MENU, OPTIONS, STOPWATCH, BGONE, IR_READ, APP };
+
+void telemetryBegin();                        // early in setup(), after Serial.begin()
+void telemetryLoop(MenuState menu, TelemetryMode mode, int8_t arg = -1);   // once per loop()
+void telemetryFlush();                        // after storageBegin(): log the last summary
@@ -0,0 +1,207 @@
+#include "wardrive.h"
+#include "wifi_scan.h"
+#include "sd_logger.h"
+
+#if defined(M5CARDPUTER)
+  static constexpr const char* kBoard = "cardputer";
+#elif defined(M5STICK_C_PLUS_1_1)
+  static constexpr const char* kBoard = "m5stick-c-plus-1-1";
+#elif defined(LILYGO_CC1101)
+  static constexpr const char* kBoard = "lilygo-cc1101";
+#else
+  static constexpr const char* kBoard = "m5stick-c-plus-2";
+#endif
+
+static constexpr int32_t  kCellE7    = 5000;          // 0.0005° ≈ 55 m of latitude
+static constexpr uint32_t kBloomBits = 1u << 17;      // 16 KB
+static constexpr uint8_t  kBloomK    = 4;
+static constexpr uint32_t kBloomCap  = 16384;         // keys before reset; ≈ 2.4 % false positives at cap
+static constexpr uint32_t kCacheSize = 1024;          // exact keys, direct mapped, 8 KB
+static constexpr uint16_t kLineMax   = 256;
+
+// WiGLE AuthMode strings, indexed by wifi_auth_mode_t
+static const char* const kAuth[] = {
+  "[ESS]", "[WEP][ESS]", "[WPA-PSK-CCMP+TKIP][ESS]", "[WPA2-PSK-CCMP][ESS]",
+  "[WPA-PSK-CCMP+TKIP][WPA2-PSK-CCMP+TKIP][ESS]", "[WPA2-EAP-CCMP][ESS]",
+  "[WPA3-SAE-CCMP][ESS]", "[WPA2-PSK-CCMP][WPA3-SAE-CCMP][ESS]", "[WAPI-PSK][ESS]",
+};
+static constexpr uint8_t kAuthCount = sizeof(kAuth) / sizeof(kAuth[0]);
+
+static SdLogger     sLog;
+static uint32_t*    sBloom = nullptr;
+static uint64_t*    sCache = nullptr;
+static uint32_t     sBloomKeys = 0;
+static GpsFix       sFix   = {};
+static portMUX_TYPE sFixLock = portMUX_INITIALIZER_UNLOCKED;
+
+static volatile uint32_t sSightings = 0, sLogged = 0, sDupCache = 0, sDupBloom = 0,
+                         sNoFix = 0, sBloomResets = 0;
+
+// ─────────────────────────────────────────────────────────────────────────────
+// Dedup: (BSSID, location cell) keys
+// ─────────────────────────────────────────────────────────────────────────────
+static uint64_t mix64(uint64_t z) {                   // splitmix64 finaliser
+  z += 0x9E3779B97F4A7C15ull;
+  z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ull;
+  z = (z ^ (z >> 27)) * 0x94D049BB133111EBull;
+  return z ^ (z >> 31);
+}
+
+static int32_t cellOf(int32_t e7) { return (e7 >= 0 ? e7 : e7 - (kCellE7 - 1)) / kCellE7; }
+
+static uint64_t keyOf(const uint8_t* bssid, const GpsFix& f) {
+  uint64_t mac = 0;
+  for (uint8_t k = 0; k < 6; ++k) mac = mac << 8 | bssid[k];
+  uint64_t cell = (uint64_t)(uint32_t)cellOf(f.latE7) << 32 | (uint32_t)cellOf(f.lonE7);
+  return mix64(mac ^ mix64(cell));
+}
+
+// Sets the key's bits; true if they were all set already
+static bool bloomTestSet(uint64_t key) {
+  uint32_t h1 = (uint32_t)key, h2 = (uint32_t)(key >> 32) | 1;
+  bool all = true;
+  for (uint8_t i = 0; i < kBloomK; ++i) {
+    uint32_t b = (h1 + i * h2) & (kBloomBits - 1);
+    uint32_t m = 1u << (b & 31);
+    if (!(sBloom[b >> 5] & m)) { all = false; sBloom[b >> 5] |= m; }
+  }
+  return all;
+}
+
+// Exact cache first (certain, recent), then the Bloom filter (long memory)
+static bool seenBefore(uint64_t key) {
+  uint64_t& slot = sCache[(key >> 40) & (kCacheSize - 1)];
+  if (slot == key) { sDupCache++; return true; }
+  slot = key;
+  if (bloomTestSet(key)) { sDupBloom++; return true; }
+  if (++sBloomKeys > kBloomCap) {                     // saturating: start over, the cache bridges
+    memset(sBloom, 0, kBloomBits / 8);
+    bloomTestSet(key);
+    sBloomKeys = 1;
+    sBloomResets++;
+  }
+  return false;
+}
+
+// ─────────────────────────────────────────────────────────────────────────────
+// WiGLE CSV
+// ─────────────────────────────────────────────────────────────────────────────
+// SSID as a CSV field: quoted when it holds a separator, control characters blanked
+static int putSsid(char* out, const char* s) {
+  bool quote = strpbrk(s, ",\"") != nullptr;
+  int n = 0;
+  if (quote) out[n++] = '"';
+  for (; *s; ++s) {
+    char c = (uint8_t)*s < 0x20 ? ' ' : *s;
+    if (c == '"') out[n++] = '"';
+    out[n++] = c;
+  }
+  if (quote) out[n++] = '"';
+  return n;
+}
+
+static int putE7(char* out, int cap, int32_t v) {
+  uint32_t a = v < 0 ? (uint32_t)-(int64_t)v : (uint32_t)v;
+  return snprintf(out, cap, "%s%lu.%07lu", v < 0 ? "-" : "", (unsigned long)(a / 10000000),
+                  (unsigned long)(a % 10000000));
+}
+
+static void writeHeader() {
+  char line[kLineMax];
+  int n = snprintf(line, sizeof(line),
+                   "WigleWifi-1.4,appRelease=1,model=%s,release=1,device=%s,display=,board=%s,brand=M5Stack\n"
+                   "MAC,SSID,AuthMode,FirstSeen,Channel,RSSI,CurrentLatitude,CurrentLongitude,"
+                   "AltitudeMeters,AccuracyMeters,Type\n", kBoard, kBoard, kBoard);
+  sLog.write(line, n);
+}
+
+static void writeRow(const WifiAp& ap, const GpsFix& f) {
+  char line[kLineMax];
+  const uint8_t* b = ap.bssid;
+  int n = snprintf(line, sizeof(line), "%02x:%02x:%02x:%02x:%02x:%02x,", b[0], b[1], b[2], b[3], b[4], b[5]);
+  n += putSsid(line + n, ap.ssid);                    // ≤ 66 bytes
+  int32_t alt = f.altCm < 0 ? -f.altCm : f.altCm;
+  n += snprintf(line + n, sizeof(line) - n, ",%s,%04u-%02u-%02u %02u:%02u:%02u,%u,%d,",
+                ap.auth < kAuthCount ? kAuth[ap.auth] : "[ESS]",
+                f.year, f.month, f.day, f.hour, f.minute, f.second, ap.channel, ap.rssi);
+  n += putE7(line + n, sizeof(line) - n, f.latE7);
+  line[n++] = ',';
+  n += putE7(line + n, sizeof(line) - n, f.lonE7);
+  n += snprintf(line + n, sizeof(line) - n, ",%s%ld.%02ld,%u.%u,WIFI\n", f.altCm < 0 ? "-" : "",
+                (long)(alt / 100), (long)(alt % 100),
+                f.hdopX100 * 5 / 100, f.hdopX100 * 5 / 10 % 10);   // ≈ HDOP × 5 m
+  if (sLog.write(line, n)) sLogged++;
+}
+
+// Scanner task: one call per AP per scan result
+static void onSighting(const WifiAp& ap) {
+  sSightings++;
+  GpsFix f;
+  portENTER_CRITICAL(&sFixLock);
+  f = sFix;
+  portEXIT_CRITICAL(&sFixLock);
+  if (!f.valid || millis() - f.stampMs > WARDRIVE_FIX_MAX_AGE_MS) { sNoFix++; return; }
+  if (seenBefore(keyOf(ap.bssid, f))) return;
+  writeRow(ap, f);
+}
+
+// ─────────────────────────────────────────────────────────────────────────────
+// Public API
+// ─────────────────────────────────────────────────────────────────────────────
+static void freeTables() {
+  free(sBloom);
+  free(sCache);
+  sBloom = nullptr;
+  sCache = nullptr;
+}
+
+bool wardriveStart(const char* vfsPath) {
+  if (sLog.active()) return false;
+  sBloom = (uint32_t*)calloc(kBloomBits / 32, sizeof(uint32_t));
+  sCache = (uint64_t*)calloc(kCacheSize, sizeof(uint64_t));
+  if (!sBloom || !sCache) { freeTables(); return false; }
+  sBloomKeys = 0;
+  sSightings = sLogged = sDupCache = sDupBloom = sNoFix = sBloomResets = 0;
+
+  SdLogConfig cfg;
+  cfg.bufSectors = 8;                                 // 4 KB blocks; rows arrive a scan at a time
+  cfg.bufCount   = 3;
+  if (!sLog.begin(vfsPath, cfg)) { freeTables(); return false; }
+  writeHeader();
+
+  wifiScanSetSink(onSighting);
+  if (!wifiScanStart()) { wardriveStop(); return false; }
+  return true;
+}
+
+void wardriveStop() {
+  wifiScanSetSink(nullptr);
+  wifiScanStop();                                     // scanner task gone: no sink in flight
+  if (sLog.active()) sLog.stop();
+  freeTables();
+}
+
+void wardriveUpdateFix(const GpsFix& fix) {
+  portENTER_CRITICAL(&sFixLock);
+  sFix = fix;
+  portEXIT_CRITICAL(&sFixLock);
+}
+
+WardriveStats wardriveStats() {
+  WardriveStats s = {};
+  SdLogStats l = sLog.stats();
+  portENTER_CRITICAL(&sFixLock);
+  s.fix = sFix.valid && millis() - sFix.stampMs <= WARDRIVE_FIX_MAX_AGE_MS;
+  portEXIT_CRITICAL(&sFixLock);
+  s.active       = l.active;
+  s.sightings    = sSightings;
+  s.logged       = sLogged;
+  s.dupCache     = sDupCache;
+  s.dupBloom     = sDupBloom;
+  s.noFix        = sNoFix;
+  s.bloomResets  = sBloomResets;
+  s.bytesWritten = l.bytesWritten;
+  s.droppedRows  = l.droppedRecords;
+  s.writeError   = l.writeError;
+  return s;
+}
@@ -0,0 +1,36 @@
+#pragma once
+#include <Arduino.h>
+#include "gps_fix.h"
+
+// Wardrive logger: every AP sighting from the background Wi-Fi scanner
+// (Core/wifi_scan raw feed) is tagged with the latest GPS fix and written as
+// a WiGLE CSV row (WigleWifi-1.4).
+//
+// A BSSID is logged once per location cell (~50 m grid). Recent
+// (BSSID, cell) keys sit in a small direct-mapped exact cache; older ones are
+// remembered by a Bloom filter, which is cleared once it has taken its rated
+// number of keys so the false-positive rate stays bounded. Rows are formatted
+// into a fixed line buffer and handed to an SdLogger, which writes whole
+// sector-aligned blocks. All memory is allocated in wardriveStart(), so use
+// stays flat however long the session runs.
+
+static constexpr uint32_t WARDRIVE_FIX_MAX_AGE_MS = 5000;    // older fixes don't tag rows
+
+struct WardriveStats {
+  bool     active;
+  bool     fix;                // a fresh, valid fix is present
+  uint32_t sightings;          // raw AP reports seen
+  uint32_t logged;             // rows written
+  uint32_t dupCache;           // suppressed by the exact cache
+  uint32_t dupBloom;           // suppressed by the Bloom filter
+  uint32_t noFix;              // sightings without a usable fix
+  uint32_t bloomResets;
+  uint64_t bytesWritten;
+  uint32_t droppedRows;        // logger buffers full
+  bool     writeError;
+};
+
+bool wardriveStart(const char* vfsPath);    // opens the CSV and starts the Wi-Fi scanner
+void wardriveStop();
+void wardriveUpdateFix(const GpsFix& fix);  // any task; latest fix wins
+WardriveStats wardriveStats();
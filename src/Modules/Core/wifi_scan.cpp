@@ -0,0 +1,200 @@
+#include "wifi_scan.h"
+#include <WiFi.h>
+#include <esp_wifi.h>
+
+static constexpr uint8_t  kSlots     = 128;     // hash slots, power of two, load ≤ 50 %
+static constexpr uint8_t  kSlotBits  = 7;
+static constexpr uint8_t  kChannels  = 13;
+static constexpr uint16_t kDwellMs   = 100;     // active scan time per channel
+static constexpr uint8_t  kEmaDiv    = 4;       // alpha = 1/4
+static constexpr uint32_t kTaskStack = 4096;
+
+static WifiAp   sAps[WIFI_SCAN_MAX_APS];        // first-seen order
+static int16_t  sRssiQ4[WIFI_SCAN_MAX_APS];     // EMA in 1/16 dBm
+static int8_t   sHash[kSlots];                  // index into sAps, -1 = empty
+static uint16_t sCount = 0;
+static volatile uint32_t sGen = 0;
+static portMUX_TYPE sLock = portMUX_INITIALIZER_UNLOCKED;
+
+static TaskHandle_t     sTask    = nullptr;
+static volatile bool    sRun     = false;
+static volatile uint8_t sChannel = 0;
+static uint32_t         sSweeps  = 0;
+static uint32_t         sDropped = 0;
+static volatile WifiScanSink sSink = nullptr;
+
+// ─────────────────────────────────────────────────────────────────────────────
+// Table (callers hold sLock)
+// ─────────────────────────────────────────────────────────────────────────────
+static uint8_t slotOf(const uint8_t* b) {
+  uint32_t h = ((uint32_t)b[2] << 24 | (uint32_t)b[3] << 16 | (uint32_t)b[4] << 8 | b[5]) ^
+               ((uint32_t)b[0] << 8 | b[1]);
+  return (uint8_t)((h * 2654435761u) >> (32 - kSlotBits));
+}
+
+static int find(const uint8_t* bssid) {
+  for (uint8_t s = slotOf(bssid);; s = (s + 1) & (kSlots - 1)) {
+    int8_t i = sHash[s];
+    if (i < 0) return -1;
+    if (!memcmp(sAps[i].bssid, bssid, 6)) return i;
+  }
+}
+
+static void link(uint8_t i) {
+  uint8_t s = slotOf(sAps[i].bssid);
+  while (sHash[s] >= 0) s = (s + 1) & (kSlots - 1);
+  sHash[s] = (int8_t)i;
+}
+
+static int8_t toDbm(int16_t q4) { return (int8_t)((q4 + (q4 < 0 ? -8 : 8)) / 16); }
+
+static void merge(const wifi_ap_record_t& r, uint32_t now) {
+  int i = find(r.bssid);
+  if (i < 0) {
+    if (sCount == WIFI_SCAN_MAX_APS) { sDropped++; return; }
+    i = sCount++;
+    WifiAp& ap = sAps[i];
+    memcpy(ap.bssid, r.bssid, 6);
+    strlcpy(ap.ssid, (const char*)r.ssid, sizeof(ap.ssid));
+    sRssiQ4[i]    = (int16_t)(r.rssi * 16);
+    ap.rssi       = r.rssi;
+    ap.channel    = r.primary;
+    ap.auth       = (uint8_t)r.authmode;
+    ap.lastSeenMs = now;
+    ap.gen        = ++sGen;
+    link((uint8_t)i);
+    return;
+  }
+
+  WifiAp& ap = sAps[i];
+  sRssiQ4[i] += (int16_t)((r.rssi * 16 - sRssiQ4[i]) / kEmaDiv);
+  ap.lastSeenMs = now;
+  int8_t dbm = toDbm(sRssiQ4[i]);
+  if (dbm == ap.rssi && r.primary == ap.channel && (uint8_t)r.authmode == ap.auth &&
+      !strncmp(ap.ssid, (const char*)r.ssid, sizeof(ap.ssid))) return;
+  ap.rssi    = dbm;
+  ap.channel = r.primary;
+  ap.auth    = (uint8_t)r.authmode;
+  strlcpy(ap.ssid, (const char*)r.ssid, sizeof(ap.ssid));
+  ap.gen     = ++sGen;
+}
+
+// Drops stale APs; rows below a removed one move up, so they get new gens
+static void age(uint32_t now) {
+  uint16_t n = 0;
+  for (uint16_t i = 0; i < sCount; ++i) {
+    if (now - sAps[i].lastSeenMs > WIFI_SCAN_AGE_MS) continue;
+    if (n != i) {
+      sAps[n]     = sAps[i];
+      sRssiQ4[n]  = sRssiQ4[i];
+      sAps[n].gen = ++sGen;
+    }
+    n++;
+  }
+  if (n == sCount) return;
+  sCount = n;
+  sGen++;
+  memset(sHash, -1, sizeof(sHash));
+  for (uint8_t i = 0; i < sCount; ++i) link(i);
+}
+
+// ─────────────────────────────────────────────────────────────────────────────
+// Scanner task
+// ─────────────────────────────────────────────────────────────────────────────
+static void emit(WifiScanSink sink, const wifi_ap_record_t& r, uint32_t now) {
+  WifiAp seen = {};
+  memcpy(seen.bssid, r.bssid, 6);
+  strlcpy(seen.ssid, (const char*)r.ssid, sizeof(seen.ssid));
+  seen.rssi       = r.rssi;
+  seen.channel    = r.primary;
+  seen.auth       = (uint8_t)r.authmode;
+  seen.lastSeenMs = now;
+  sink(seen);
+}
+
+static void scanTask(void*) {
+  uint8_t ch = 1;
+  while (sRun) {
+    sChannel = ch;
+    if (WiFi.scanNetworks(true, true, false, kDwellMs, ch) == WIFI_SCAN_FAILED) {
+      vTaskDelay(pdMS_TO_TICKS(100));
+      continue;
+    }
+    int16_t n;
+    while ((n = WiFi.scanComplete()) == WIFI_SCAN_RUNNING && sRun) vTaskDelay(pdMS_TO_TICKS(10));
+
+    uint32_t now = millis();
+    for (int16_t i = 0; i < n; ++i) {
+      const wifi_ap_record_t* r = (const wifi_ap_record_t*)WiFi.getScanInfoByIndex(i);
+      if (!r) continue;
+      portENTER_CRITICAL(&sLock);
+      merge(*r, now);
+      portEXIT_CRITICAL(&sLock);
+      if (WifiScanSink sink = sSink) emit(sink, *r, now);
+    }
+    WiFi.scanDelete();
+
+    if (++ch > kChannels) {
+      ch = 1;
+      sSweeps++;
+      portENTER_CRITICAL(&sLock);
+      age(now);
+      portEXIT_CRITICAL(&sLock);
+    }
+  }
+  sTask = nullptr;
+  vTaskDelete(nullptr);
+}
+
+// ─────────────────────────────────────────────────────────────────────────────
+// Public API
+// ─────────────────────────────────────────────────────────────────────────────
+bool wifiScanStart() {
+  if (sTask) return true;
+  portENTER_CRITICAL(&sLock);
+  sCount = 0;
+  memset(sHash, -1, sizeof(sHash));
+  portEXIT_CRITICAL(&sLock);
+  sSweeps = sDropped = 0;
+  sGen++;
+
+  if (!WiFi.mode(WIFI_STA)) return false;
+  WiFi.disconnect();
+  sRun = true;
+  if (xTaskCreatePinnedToCore(scanTask, "wifiscan", kTaskStack, nullptr, 1, &sTask, 0) != pdPASS) {
+    sRun  = false;
+    sTask = nullptr;
+    return false;
+  }
+  return true;
+}
+
+void wifiScanStop() {
+  sRun = false;
+  while (sTask) vTaskDelay(pdMS_TO_TICKS(10));
+  esp_wifi_scan_stop();
+  WiFi.scanDelete();
+  WiFi.mode(WIFI_OFF);
+}
+
+uint32_t wifiScanGeneration() { return sGen; }
+
+uint16_t wifiScanRows(uint16_t first, WifiAp* out, uint16_t max) {
+  portENTER_CRITICAL(&sLock);
+  uint16_t n = first < sCount ? min<uint16_t>(max, sCount - first) : 0;
+  memcpy(out, sAps + first, n * sizeof(WifiAp));
+  portEXIT_CRITICAL(&sLock);
+  return n;
+}
+
+WifiScanStats wifiScanStats() {
+  WifiScanStats s = {};
+  s.running = sTask != nullptr;
+  s.channel = sChannel;
+  s.aps     = sCount;
+  s.sweeps  = sSweeps;
+  s.dropped = sDropped;
+  return s;
+}
+
+void wifiScanSetSink(WifiScanSink sink) { sSink = sink; }
@@ -0,0 +1,46 @@
+#pragma once
+#include <Arduino.h>
+
+// Background access-point survey. A scanner task on core 0 runs one async
+// active scan per channel (1-13, round robin) and folds the results into a
+// fixed table: BSSIDs are deduplicated through an open-addressing hash,
+// RSSI is smoothed with an exponential moving average, and APs not heard for
+// WIFI_SCAN_AGE_MS drop out. The table keeps first-seen order, so rows stay
+// put while values update.
+//
+// Every change that is visible at display precision (dBm, SSID, channel,
+// auth) stamps the AP with a new generation number. The UI polls
+// wifiScanGeneration() and copies rows only when it moved, and redraws only
+// the rows whose generation differs from what it last drew.
+
+static constexpr uint8_t  WIFI_SCAN_MAX_APS = 64;
+static constexpr uint32_t WIFI_SCAN_AGE_MS  = 60000;
+
+struct WifiAp {
+  uint8_t  bssid[6];
+  char     ssid[33];        // empty for hidden networks
+  int8_t   rssi;            // smoothed, dBm
+  uint8_t  channel;
+  uint8_t  auth;            // wifi_auth_mode_t
+  uint32_t lastSeenMs;
+  uint32_t gen;             // generation of the last visible change
+};
+
+struct WifiScanStats {
+  bool     running;
+  uint8_t  channel;         // being scanned now
+  uint16_t aps;
+  uint32_t sweeps;          // full passes over all channels
+  uint32_t dropped;         // new APs ignored because the table was full
+};
+
+// Optional raw feed: called on the scanner task for every AP in every scan
+// result, with that sighting's RSSI (not the smoothed one) and gen = 0.
+typedef void (*WifiScanSink)(const WifiAp& seen);
+
+bool     wifiScanStart();                          // STA mode + scanner task
+void     wifiScanStop();                           // waits for the running scan
+uint32_t wifiScanGeneration();
+uint16_t wifiScanRows(uint16_t first, WifiAp* out, uint16_t max);   // copies, in table order
+WifiScanStats wifiScanStats();
+void     wifiScanSetSink(WifiScanSink sink);        // nullptr to detach
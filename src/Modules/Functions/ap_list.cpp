@@ -0,0 +1,146 @@
+#include "ap_list.h"
+#include "../../UserInterface/menus/menu_submenus.h"
+#include "../Core/wifi_scan.h"
+
+#if defined(M5CARDPUTER)
+  static constexpr uint8_t ROT_TOP = 4;
+#else
+  static constexpr uint8_t ROT_TOP = 2;
+#endif
+static constexpr uint8_t ROT_ALT = (ROT_TOP + 1) & 0x3;
+
+static constexpr uint8_t  kRows     = 7;
+static constexpr int      kListY    = 46;
+static constexpr int      kRowH     = 11;
+static constexpr uint16_t kStatusMs = 250;
+static constexpr uint32_t kNoGen    = 0xFFFFFFFF;
+
+static bool     sDirty  = true;        // full redraw
+static bool     sUp     = false;
+static bool     sHold   = false;
+static uint16_t sSel    = 0;
+static uint16_t sTop    = 0;
+static uint32_t sShownGen = kNoGen;
+static uint32_t sRowGen[kRows];        // what each row last showed
+static bool     sRowSel[kRows];
+static uint32_t sStatusMs = 0;
+
+// ─────────────────────────────────────────────────────────────────────────────
+// Drawing
+// ─────────────────────────────────────────────────────────────────────────────
+static void drawStatus(TFT_eSPI& tft) {
+  WifiScanStats s = wifiScanStats();
+  tft.fillRect(130, 28, 94, 12, TFT_BLACK);
+  tft.setTextSize(1);
+  tft.setTextColor(sHold ? TFT_YELLOW : TFT_SILVER, TFT_BLACK);
+  tft.setCursor(130, 30);
+  if (sHold) tft.printf("HOLD  %u APs", s.aps);
+  else       tft.printf("ch%-2u  %u APs", s.channel, s.aps);
+}
+
+static void drawRow(TFT_eSPI& tft, uint8_t r, const WifiAp* ap, bool sel) {
+  const int y = kListY + r * kRowH;
+  const uint16_t bg = sel ? TFT_DARKGREY : TFT_BLACK;
+  tft.fillRect(16, y, 208, kRowH, bg);
+  if (!ap) return;
+
+  tft.setTextSize(1);
+  tft.setCursor(18, y + 2);
+  if (ap->ssid[0]) {
+    tft.setTextColor(TFT_WHITE, bg);
+    tft.printf("%.20s", ap->ssid);
+  } else {
+    tft.setTextColor(TFT_SILVER, bg);
+    tft.printf("%02X:%02X:%02X:%02X:%02X:%02X", ap->bssid[0], ap->bssid[1], ap->bssid[2],
+               ap->bssid[3], ap->bssid[4], ap->bssid[5]);
+  }
+  tft.setTextColor(ap->auth ? TFT_SILVER : TFT_GREEN, bg);   // open networks in green
+  tft.setCursor(146, y + 2);
+  tft.printf("%2u", ap->channel);
+  tft.setTextColor(TFT_WHITE, bg);
+  tft.setCursor(162, y + 2);
+  tft.printf("%4d", ap->rssi);
+
+  int bar = (ap->rssi + 95) * 28 / 60;                       // -95..-35 dBm
+  bar = bar < 1 ? 1 : bar > 28 ? 28 : bar;
+  tft.fillRect(192, y + 3, bar, kRowH - 6, ap->rssi > -60 ? TFT_GREEN : ap->rssi > -75 ? TFT_YELLOW : TFT_RED);
+}
+
+void apListDraw(TFT_eSPI& tft) {
+  if (sDirty) {
+    sDirty = false;
+    tft.setRotation(ROT_TOP);
+    drawOptionsLayerBackground(tft);
+    tft.setRotation(ROT_ALT);
+    tft.setTextSize(2);
+    tft.setTextColor(TFT_WHITE, TFT_BLACK);
+    tft.setCursor(16, 26);
+    tft.print("APs");
+    if (!sUp) {
+      tft.setTextSize(1);
+      tft.setTextColor(TFT_RED, TFT_BLACK);
+      tft.setCursor(16, 50);
+      tft.print("Could not start the scanner");
+      return;
+    }
+    for (uint8_t r = 0; r < kRows; ++r) sRowGen[r] = kNoGen;
+    sShownGen = kNoGen;
+    sStatusMs = 0;
+  }
+  if (!sUp) return;
+
+  tft.setRotation(ROT_ALT);
+  if (millis() - sStatusMs >= kStatusMs) {
+    sStatusMs = millis();
+    drawStatus(tft);
+  }
+  if (sHold) return;
+
+  uint32_t gen = wifiScanGeneration();
+  if (gen == sShownGen) return;
+  sShownGen = gen;
+
+  WifiAp rows[kRows];
+  uint16_t n = wifiScanRows(sTop, rows, kRows);
+  for (uint8_t r = 0; r < kRows; ++r) {
+    uint32_t g  = r < n ? rows[r].gen : 0;
+    bool     sl = sTop + r == sSel && r < n;
+    if (g == sRowGen[r] && sl == sRowSel[r]) continue;
+    drawRow(tft, r, r < n ? &rows[r] : nullptr, sl);
+    sRowGen[r] = g;
+    sRowSel[r] = sl;
+  }
+}
+
+// ─────────────────────────────────────────────────────────────────────────────
+// Lifecycle
+// ─────────────────────────────────────────────────────────────────────────────
+void apListOpen() {
+  sUp   = wifiScanStart();
+  sHold = false;
+  sSel  = sTop = 0;
+  sDirty = true;
+}
+
+void apListInput(bool a, bool b, bool c, bool& requestExit) {
+  if (c) {
+    wifiScanStop();
+    sUp = false;
+    requestExit = true;
+    return;
+  }
+  if (!sUp) return;
+  if (a) {
+    sHold = !sHold;
+    sStatusMs = 0;
+    sShownGen = kNoGen;
+  }
+  if (b) {
+    uint16_t count = wifiScanStats().aps;
+    sSel = sSel + 1 < count ? sSel + 1 : 0;
+    if (sSel < sTop) sTop = sSel;
+    if (sSel >= sTop + kRows) sTop = sSel - kRows + 1;
+    sShownGen = kNoGen;                 // selection moved even if no AP changed
+    if (sHold) { sHold = false; sStatusMs = 0; }
+  }
+}
@@ -0,0 +1,11 @@
+#pragma once
+#include <Arduino.h>
+#include <TFT_eSPI.h>
+
+// Wi-Fi → Scan Hosts: live access-point list fed by the background scanner
+// (Core/wifi_scan). Only rows whose AP changed are redrawn.
+// A = hold / resume the list, B = next row, C = stop and exit.
+
+void apListOpen();
+void apListDraw(TFT_eSPI& tft);
+void apListInput(bool a, bool b, bool c, bool& requestExit);
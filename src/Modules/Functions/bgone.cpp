@@ -1,5 +1,6 @@
 #include "bgone.h"
 #include "../../UserInterface/menus/menu_submenus.h"
+#include "../Core/ir_tx.h"
 #include <Arduino.h>
 
 #if defined(M5CARDPUTER)
@@ -144,6 +145,32 @@ enum TVIdx {
 };
 static int tvSel = TV_POWER;
 
+// Our own TVs speak Samsung (address 0x07). Each key owns a TX slot whose
+// RMT buffer is built once, so pressing A only kicks the peripheral.
+static const uint8_t kTvSamsungCmd[TV_COUNT] = {
+  0x02, // Power
+  0x0F, // Mute
+  0x07, // Vol+
+  0x0B, // Vol-
+  0x12, // Ch+
+  0x10  // Ch-
+};
+static bool tvCodesReady = false;
+
+static void prepareTVCodes(){
+  if (tvCodesReady) return;
+  irTxBegin();
+  bool ok = true;
+  for (int i = 0; i < TV_COUNT; ++i) {
+    IrCode code;
+    code.proto   = IrProto::SAMSUNG;
+    code.address = 0x07;
+    code.command = kTvSamsungCmd[i];
+    ok &= irTxPrepare(i, code);
+  }
+  tvCodesReady = ok;
+}
+
 static void drawTVRemote(TFT_eSPI& tft){
   // Outer background (boundary)
   tft.setRotation(ROT_TOP);
@@ -228,7 +255,7 @@ void bgoneHandleInput(bool aPressed,bool bPressed,bool cPressed,bool& exitReques
     if (cPressed){ if (selected==0){exitRequested=true;return;} selected=(selected-1+kCount)%kCount; ensureMenuSelectionVisible(); dirty=true; }
     if (aPressed){
       if (selected==0){ exitRequested = true; return; }
-      if (selected==2){ mode = BGoneMode::TV_REMOTE; tvSel = TV_POWER; dirty = true; return; }
+      if (selected==2){ prepareTVCodes(); mode = BGoneMode::TV_REMOTE; tvSel = TV_POWER; dirty = true; return; }
       // TODO: wire Add / Proj / LEDs / AC / Fan if needed
     }
     return;
@@ -239,7 +266,7 @@ void bgoneHandleInput(bool aPressed,bool bPressed,bool cPressed,bool& exitReques
     if (bPressed){ tvSel = (tvSel + 1) % TV_COUNT; dirty = true; }
     if (cPressed){ mode = BGoneMode::MENU; dirty = true; return; } // exit with Btn C
     if (aPressed){
-      // TODO: Send IR based on tvSel (Power, Mute, Vol+/-, Ch+/-)
+      irTxSend(tvSel);   // slot index == TVIdx
     }
   }
 }
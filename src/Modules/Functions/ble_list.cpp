@@ -0,0 +1,150 @@
+#include "ble_list.h"
+#include "../../UserInterface/menus/menu_submenus.h"
+#include "../Core/ble_scan.h"
+
+#if defined(M5CARDPUTER)
+  static constexpr uint8_t ROT_TOP = 4;
+#else
+  static constexpr uint8_t ROT_TOP = 2;
+#endif
+static constexpr uint8_t ROT_ALT = (ROT_TOP + 1) & 0x3;
+
+static constexpr uint8_t  kRows     = 7;
+static constexpr int      kListY    = 46;
+static constexpr int      kRowH     = 11;
+static constexpr uint16_t kStatusMs = 250;
+static constexpr uint16_t kRowsMs   = 200;      // list refresh cap; reports arrive far faster
+static constexpr uint32_t kNoGen    = 0xFFFFFFFF;
+
+static bool     sDirty  = true;        // full redraw
+static bool     sUp     = false;
+static bool     sHold   = false;
+static uint16_t sSel    = 0;
+static uint16_t sTop    = 0;
+static uint32_t sShownGen = kNoGen;
+static uint32_t sRowGen[kRows];        // what each row last showed
+static bool     sRowSel[kRows];
+static uint32_t sStatusMs = 0;
+static uint32_t sRowsMs   = 0;
+
+// ─────────────────────────────────────────────────────────────────────────────
+// Drawing
+// ─────────────────────────────────────────────────────────────────────────────
+static void drawStatus(TFT_eSPI& tft) {
+  BleScanStats s = bleScanStats();
+  tft.fillRect(100, 28, 124, 12, TFT_BLACK);
+  tft.setTextSize(1);
+  tft.setTextColor(sHold ? TFT_YELLOW : TFT_SILVER, TFT_BLACK);
+  tft.setCursor(100, 30);
+  tft.printf("%s %u devs", sHold ? "HOLD" : "scan", s.devices);
+  if (s.dropped) tft.print(" full");
+}
+
+static void drawRow(TFT_eSPI& tft, uint8_t r, const BleDev* d, bool sel) {
+  const int y = kListY + r * kRowH;
+  const uint16_t bg = sel ? TFT_DARKGREY : TFT_BLACK;
+  tft.fillRect(16, y, 208, kRowH, bg);
+  if (!d) return;
+
+  tft.setTextSize(1);
+  tft.setCursor(18, y + 2);
+  if (d->name[0]) {
+    tft.setTextColor(TFT_WHITE, bg);
+    tft.printf("%.20s", d->name);
+  } else {
+    tft.setTextColor(TFT_SILVER, bg);
+    tft.printf("%02X:%02X:%02X:%02X:%02X:%02X", d->addr[0], d->addr[1], d->addr[2],
+               d->addr[3], d->addr[4], d->addr[5]);
+  }
+  tft.setTextColor(d->connectable ? TFT_GREEN : TFT_DARKGREY, bg);  // connectable in green
+  tft.setCursor(146, y + 2);
+  tft.print(d->connectable ? "C" : "-");
+  tft.setTextColor(TFT_WHITE, bg);
+  tft.setCursor(162, y + 2);
+  tft.printf("%4d", d->rssi);
+
+  int bar = (d->rssi + 100) * 28 / 60;                       // -100..-40 dBm
+  bar = bar < 1 ? 1 : bar > 28 ? 28 : bar;
+  tft.fillRect(192, y + 3, bar, kRowH - 6, d->rssi > -65 ? TFT_GREEN : d->rssi > -80 ? TFT_YELLOW : TFT_RED);
+}
+
+void bleListDraw(TFT_eSPI& tft) {
+  if (sDirty) {
+    sDirty = false;
+    tft.setRotation(ROT_TOP);
+    drawOptionsLayerBackground(tft);
+    tft.setRotation(ROT_ALT);
+    tft.setTextSize(2);
+    tft.setTextColor(TFT_WHITE, TFT_BLACK);
+    tft.setCursor(16, 26);
+    tft.print("BLE");
+    if (!sUp) {
+      tft.setTextSize(1);
+      tft.setTextColor(TFT_RED, TFT_BLACK);
+      tft.setCursor(16, 50);
+      tft.print("Could not start the scanner");
+      return;
+    }
+    for (uint8_t r = 0; r < kRows; ++r) sRowGen[r] = kNoGen;
+    sShownGen = kNoGen;
+    sStatusMs = sRowsMs = 0;
+  }
+  if (!sUp) return;
+
+  tft.setRotation(ROT_ALT);
+  if (millis() - sStatusMs >= kStatusMs) {
+    sStatusMs = millis();
+    drawStatus(tft);
+  }
+  if (sHold || millis() - sRowsMs < kRowsMs) return;
+
+  uint32_t gen = bleScanGeneration();
+  if (gen == sShownGen) return;
+  sShownGen = gen;
+  sRowsMs   = millis();
+
+  BleDev rows[kRows];
+  uint16_t n = bleScanRows(sTop, rows, kRows);
+  for (uint8_t r = 0; r < kRows; ++r) {
+    uint32_t g  = r < n ? rows[r].gen : 0;
+    bool     sl = sTop + r == sSel && r < n;
+    if (g == sRowGen[r] && sl == sRowSel[r]) continue;
+    drawRow(tft, r, r < n ? &rows[r] : nullptr, sl);
+    sRowGen[r] = g;
+    sRowSel[r] = sl;
+  }
+}
+
+// ─────────────────────────────────────────────────────────────────────────────
+// Lifecycle
+// ─────────────────────────────────────────────────────────────────────────────
+void bleListOpen() {
+  sUp   = bleScanStart();
+  sHold = false;
+  sSel  = sTop = 0;
+  sDirty = true;
+}
+
+void bleListInput(bool a, bool b, bool c, bool& requestExit) {
+  if (c) {
+    bleScanStop();
+    sUp = false;
+    requestExit = true;
+    return;
+  }
+  if (!sUp) return;
+  if (a) {
+    sHold = !sHold;
+    sStatusMs = 0;
+    sShownGen = kNoGen;
+  }
+  if (b) {
+    uint16_t count = bleScanStats().devices;
+    sSel = sSel + 1 < count ? sSel + 1 : 0;
+    if (sSel < sTop) sTop = sSel;
+    if (sSel >= sTop + kRows) sTop = sSel - kRows + 1;
+    sShownGen = kNoGen;                 // selection moved even if no device changed
+    sRowsMs   = 0;
+    if (sHold) { sHold = false; sStatusMs = 0; }
+  }
+}
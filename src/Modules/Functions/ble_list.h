@@ -0,0 +1,12 @@
+#pragma once
+#include <Arduino.h>
+#include <TFT_eSPI.h>
+
+// Bluetooth → Scan Dev: live BLE device list, strongest first, fed by the
+// passive background scanner (Core/ble_scan). Only rows whose device changed
+// are redrawn.
+// A = hold / resume the list, B = next row, C = stop and exit.
+
+void bleListOpen();
+void bleListDraw(TFT_eSPI& tft);
+void bleListInput(bool a, bool b, bool c, bool& requestExit);
@@ -0,0 +1,237 @@
+#include "file_browser.h"
+#include "../../UserInterface/menus/menu_submenus.h"
+#include "../../UserInterface/menus/submenu_options.h"
+#include "../Core/dir_pager.h"
+#include "../Core/sdcard.h"
+#include <sys/stat.h>
+#include <stdio.h>
+
+#if defined(M5CARDPUTER)
+  static constexpr uint8_t ROT_TOP = 4;
+#else
+  static constexpr uint8_t ROT_TOP = 2;
+#endif
+static constexpr uint8_t ROT_ALT = (ROT_TOP + 1) & 0x3;
+
+static constexpr uint8_t  kPathLen      = 160;
+static constexpr uint8_t  kListChars    = 16;     // bubble width, in characters
+static constexpr uint16_t kCountBudget  = 64;     // directory entries counted per tick
+static constexpr uint16_t kCountRedrawMs = 250;   // scrollbar refresh while counting
+static constexpr uint16_t kDumpChunk    = 512;
+
+enum class FbView : uint8_t { LIST, INFO, ERROR };
+
+static char     sRoot[16];
+static char     sPath[kPathLen];      // VFS path of the open directory
+static FbView   sView  = FbView::LIST;
+static uint32_t sSel   = 0;           // 0 = "<- Back", n = entry n-1
+static uint32_t sShownCount = 0;
+static uint32_t sCountDrawMs = 0;
+static uint32_t sOpenUs = 0;          // first-screen timing
+static bool     sDirty = true;
+static bool     sListDirty = false;   // list widget only
+
+// File info / dump
+static char     sFileName[DIR_NAME_LEN];
+static long     sFileSize = 0;
+static FILE*    sDump = nullptr;
+static uint32_t sDumped = 0;
+
+// ─────────────────────────────────────────────────────────────────────────────
+// Directory handling
+// ─────────────────────────────────────────────────────────────────────────────
+static void openDir() {
+  sOpenUs = micros();
+  sSel = 0;
+  sShownCount = 0;
+  sView = dirPagerOpen(sPath) ? FbView::LIST : FbView::ERROR;
+  sDirty = true;
+}
+
+static void goUp(bool& requestExit) {
+  size_t rootLen = strlen(sRoot);
+  size_t len = strlen(sPath);
+  if (len <= rootLen) { requestExit = true; return; }
+  char* slash = strrchr(sPath, '/');
+  if (slash && slash > sPath + rootLen - 1) *slash = '\0';
+  if (strlen(sPath) < rootLen) strcpy(sPath, sRoot);
+  openDir();
+}
+
+static void enter(const DirEntry& e) {
+  size_t len = strlen(sPath);
+  size_t nameLen = strlen(e.name) - 1;            // drop trailing '/'
+  if (len + 1 + nameLen >= sizeof(sPath)) return;
+  sPath[len] = '/';
+  memcpy(sPath + len + 1, e.name, nameLen);
+  sPath[len + 1 + nameLen] = '\0';
+  openDir();
+}
+
+static bool filePath(char* out, size_t cap) {
+  return snprintf(out, cap, "%s/%s", sPath, sFileName) < (int)cap;
+}
+
+static void showInfo(const DirEntry& e) {
+  strlcpy(sFileName, e.name, sizeof(sFileName));
+  char full[kPathLen + DIR_NAME_LEN];
+  struct stat st;
+  sFileSize = filePath(full, sizeof(full)) && stat(full, &st) == 0 ? (long)st.st_size : -1;
+  sView = FbView::INFO;
+  sDirty = true;
+}
+
+static void startDump() {
+  char full[kPathLen + DIR_NAME_LEN];
+  if (sDump || !filePath(full, sizeof(full))) return;
+  sDump = fopen(full, "rb");
+  sDumped = 0;
+  sDirty = true;
+}
+
+static void stopDump() {
+  if (sDump) fclose(sDump);
+  sDump = nullptr;
+}
+
+static void pumpDump() {
+  if (!sDump) return;
+  uint8_t buf[kDumpChunk];
+  size_t room = Serial.availableForWrite();
+  size_t n = fread(buf, 1, min<size_t>(sizeof(buf), room ? room : 64), sDump);
+  if (n) { Serial.write(buf, n); sDumped += n; }
+  if (n == 0 || feof(sDump)) { stopDump(); sDirty = true; }
+}
+
+// ─────────────────────────────────────────────────────────────────────────────
+// Drawing
+// ─────────────────────────────────────────────────────────────────────────────
+static const char* rowLabel(int idx) {
+  if (idx == 0) return "<- Back";
+  const DirEntry* e = dirPagerGet(idx - 1);
+  return e ? e->name : "";
+}
+
+static uint32_t rowCount() { return dirPagerCount() + 1; }
+
+static void drawList(TFT_eSPI& tft) {
+  sShownCount = dirPagerCount();
+  drawOptionList(rowLabel, rowCount(), sSel, kListChars, false);
+}
+
+static void drawInfo(TFT_eSPI& tft) {
+  tft.setRotation(ROT_TOP);
+  drawOptionsLayerBackground(tft);
+  tft.setRotation(ROT_ALT);
+  tft.setTextSize(2);
+  tft.setTextColor(TFT_WHITE, TFT_BLACK);
+  tft.setCursor(16, 28);
+  tft.print(sFileName);
+
+  tft.setTextSize(1);
+  tft.setTextColor(TFT_SILVER, TFT_BLACK);
+  tft.setCursor(16, 54);
+  if (sFileSize >= 0) tft.printf("%ld bytes", sFileSize);
+  else                tft.print("unreadable");
+  tft.setCursor(16, 68);
+  tft.print(sPath);
+  tft.setCursor(16, 110);
+  if (sDump) tft.printf("Dumping to Serial... %lu", (unsigned long)sDumped);
+  else       tft.print("A: dump to Serial   C: back");
+}
+
+void fileBrowserDraw(TFT_eSPI& tft) {
+  if (sDirty) {
+    sDirty = sListDirty = false;
+    tft.setRotation(ROT_TOP);
+    tft.fillScreen(TFT_BLACK);
+    switch (sView) {
+      case FbView::LIST:
+        drawList(tft);
+        drawFilesFrame();
+        if (sOpenUs) {
+          Serial.printf("[files] %s: first screen in %lu ms\n", sPath, (micros() - sOpenUs) / 1000);
+          sOpenUs = 0;
+        }
+        break;
+      case FbView::INFO:
+        drawInfo(tft);
+        break;
+      case FbView::ERROR:
+        drawOptionsLayerBackground(tft);
+        tft.setRotation(ROT_ALT);
+        tft.setTextSize(2);
+        tft.setTextColor(TFT_RED, TFT_BLACK);
+        tft.setCursor(16, 56);
+        tft.print(strcmp(sRoot, SD_MOUNT) == 0 ? "No SD card" : "Can't open");
+        break;
+    }
+    return;
+  }
+  if (sListDirty && sView == FbView::LIST) {
+    sListDirty = false;
+    tft.setRotation(ROT_TOP);
+    drawList(tft);
+  }
+}
+
+// ─────────────────────────────────────────────────────────────────────────────
+// Lifecycle
+// ─────────────────────────────────────────────────────────────────────────────
+static void openRoot(const char* root) {
+  stopDump();
+  strlcpy(sRoot, root, sizeof(sRoot));
+  strlcpy(sPath, root, sizeof(sPath));
+  openDir();
+}
+
+void fileBrowserOpenSd() {
+  if (!sdBegin()) {
+    strlcpy(sRoot, SD_MOUNT, sizeof(sRoot));
+    sView = FbView::ERROR;
+    sDirty = true;
+    return;
+  }
+  openRoot(SD_MOUNT);
+}
+
+void fileBrowserOpenFlash() { openRoot("/littlefs"); }
+
+void fileBrowserInput(bool a, bool b, bool c, bool& requestExit) {
+  switch (sView) {
+    case FbView::ERROR:
+      if (a || c) { dirPagerClose(); requestExit = true; }
+      return;
+
+    case FbView::INFO:
+      pumpDump();
+      if (a) startDump();
+      if (c) { stopDump(); sView = FbView::LIST; sDirty = true; }
+      if (sDump && millis() - sCountDrawMs > kCountRedrawMs) { sCountDrawMs = millis(); sDirty = true; }
+      return;
+
+    case FbView::LIST:
+      break;
+  }
+
+  dirPagerStep(kCountBudget);
+  if (dirPagerCount() != sShownCount && millis() - sCountDrawMs > kCountRedrawMs) {
+    sCountDrawMs = millis();
+    sListDirty = true;
+  }
+
+  if (b) {
+    sSel = (sSel + 1 < rowCount()) ? sSel + 1 : 0;
+    sListDirty = true;
+  }
+  if (c) {
+    goUp(requestExit);
+  } else if (a) {
+    if (sSel == 0) { goUp(requestExit); }
+    else if (const DirEntry* e = dirPagerGet(sSel - 1)) {
+      if (e->dir) enter(*e);
+      else        showInfo(*e);
+    }
+  }
+  if (requestExit) dirPagerClose();
+}
@@ -0,0 +1,13 @@
+#pragma once
+#include <Arduino.h>
+#include <TFT_eSPI.h>
+
+// Files → Micro Sd / Integrated. Pages through directories with dir_pager and
+// draws them with the submenu list widget.
+// A = open (folder / file info; A again dumps the file to Serial),
+// B = next, C = up / exit.
+
+void fileBrowserOpenSd();
+void fileBrowserOpenFlash();
+void fileBrowserDraw(TFT_eSPI& tft);
+void fileBrowserInput(bool a, bool b, bool c, bool& requestExit);
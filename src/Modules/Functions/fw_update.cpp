@@ -0,0 +1,192 @@
+#include "fw_update.h"
+#include "../../UserInterface/menus/menu_submenus.h"
+#include "../Core/ota_patch.h"
+#include "../Core/sdcard.h"
+#include <stdio.h>
+#include <sys/stat.h>
+
+#if defined(M5CARDPUTER)
+  static constexpr uint8_t ROT_TOP = 4;
+#else
+  static constexpr uint8_t ROT_TOP = 2;
+#endif
+static constexpr uint8_t ROT_ALT = (ROT_TOP + 1) & 0x3;
+
+static constexpr uint16_t kBlock       = 1024;    // serial: one ack per block
+static constexpr uint32_t kBlockWaitMs = 5000;
+
+enum class State : uint8_t { IDLE, APPLY_FILE, DONE, FAILED };
+
+static State    sState = State::IDLE;
+static char     sFile[40];
+static bool     sHaveFile = false;
+static bool     sDirty = true;
+static char     sLine[24];
+static uint8_t  sLineLen = 0;
+static uint8_t  sShownPct = 255;
+static uint8_t  sBlock[kBlock];
+
+// ─────────────────────────────────────────────────────────────────────────────
+// Drawing
+// ─────────────────────────────────────────────────────────────────────────────
+static void drawStatus(TFT_eSPI& tft, const char* msg, uint16_t color) {
+  tft.fillRect(16, 84, 208, 10, TFT_BLACK);
+  tft.setTextSize(1);
+  tft.setTextColor(color, TFT_BLACK);
+  tft.setCursor(16, 84);
+  tft.print(msg);
+}
+
+static void drawProgress(TFT_eSPI& tft) {
+  OtaPatchStats s = otaPatchStats();
+  if (s.percent == sShownPct) return;
+  const int x = 16, y = 100, w = 208, h = 10;
+  if (sShownPct == 255) tft.fillRect(x, y, w, h, TFT_BLACK);   // new run
+  sShownPct = s.percent;
+  tft.drawRect(x, y, w, h, TFT_DARKGREY);
+  tft.fillRect(x + 1, y + 1, (w - 2) * s.percent / 100, h - 2, TFT_WHITE);
+  tft.fillRect(x, y + 14, w, 8, TFT_BLACK);
+  tft.setTextColor(TFT_SILVER, TFT_BLACK);
+  tft.setCursor(x, y + 14);
+  tft.printf("%lu KB in  %lu / %lu KB out", (unsigned long)(s.inBytes / 1024),
+             (unsigned long)(s.outBytes / 1024), (unsigned long)(s.newSize / 1024));
+}
+
+static void drawScreen(TFT_eSPI& tft) {
+  tft.setRotation(ROT_TOP);
+  drawOptionsLayerBackground(tft);
+  tft.setRotation(ROT_ALT);
+  tft.setTextSize(2);
+  tft.setTextColor(TFT_WHITE, TFT_BLACK);
+  tft.setCursor(16, 26);
+  tft.print("Fw Update");
+
+  tft.setTextSize(1);
+  tft.setTextColor(TFT_SILVER, TFT_BLACK);
+  tft.setCursor(16, 48);
+  tft.printf("Writes slot: %s", otaPatchTarget());
+  tft.setCursor(16, 60);
+  if (sHaveFile) tft.printf("A: apply %s", sFile);
+  else           tft.print("No update.delta on SD / flash");
+  tft.setCursor(16, 72);
+  tft.print("Serial: fwdelta.py send <delta> <port>");
+
+  switch (sState) {
+    case State::DONE:   drawStatus(tft, "Done. B reboots into the new firmware", TFT_GREEN); break;
+    case State::FAILED: drawStatus(tft, otaPatchError(), TFT_RED); break;
+    default: break;
+  }
+}
+
+// ─────────────────────────────────────────────────────────────────────────────
+// Sources
+// ─────────────────────────────────────────────────────────────────────────────
+static void finish(TFT_eSPI& tft, bool ok) {
+  ok = ok && otaPatchFinish();
+  if (!ok) otaPatchAbort();
+  sState = ok ? State::DONE : State::FAILED;
+  drawStatus(tft, ok ? "Done. B reboots into the new firmware" : otaPatchError(), ok ? TFT_GREEN : TFT_RED);
+}
+
+static void applyFile(TFT_eSPI& tft) {
+  FILE* f = fopen(sFile, "rb");
+  if (!f) { sState = State::FAILED; drawStatus(tft, "Cannot open update file", TFT_RED); return; }
+  setvbuf(f, nullptr, _IONBF, 0);
+  drawStatus(tft, "Applying...", TFT_WHITE);
+  sShownPct = 255;
+  otaPatchBegin();
+  bool ok = true;
+  size_t n;
+  while (ok && (n = fread(sBlock, 1, kBlock, f)) > 0) {
+    ok = otaPatchFeed(sBlock, n);
+    drawProgress(tft);
+  }
+  fclose(f);
+  finish(tft, ok);
+}
+
+// "delta <size>\n", then <size> bytes in kBlock pieces, each acked with '.'
+static void receiveSerial(TFT_eSPI& tft, uint32_t size) {
+  Serial.println("ok");
+  drawStatus(tft, "Receiving over Serial...", TFT_WHITE);
+  sShownPct = 255;
+  otaPatchBegin();
+  bool ok = true;
+  for (uint32_t got = 0; ok && got < size; ) {
+    uint16_t want = (uint16_t)min<uint32_t>(kBlock, size - got);
+    uint16_t have = 0;
+    uint32_t t0 = millis();
+    while (have < want && millis() - t0 < kBlockWaitMs) {
+      int avail = Serial.available();
+      if (avail > 0) have += Serial.readBytes(sBlock + have, min<int>(avail, want - have));
+      else           delay(1);
+    }
+    if (have < want)                          { ok = false; Serial.println("error: timeout"); break; }
+    if (!(ok = otaPatchFeed(sBlock, have)))   { Serial.printf("error: %s\n", otaPatchError()); break; }
+    got += have;
+    Serial.write('.');
+    drawProgress(tft);
+  }
+  finish(tft, ok);
+  if (sState == State::DONE) Serial.println("done, reboot to run it");
+  else if (ok)               Serial.printf("error: %s\n", otaPatchError());
+}
+
+static void pollSerial(TFT_eSPI& tft) {
+  while (Serial.available()) {
+    char c = (char)Serial.read();
+    if (c != '\n') {
+      if (c != '\r' && sLineLen < sizeof(sLine) - 1) sLine[sLineLen++] = c;
+      continue;
+    }
+    sLine[sLineLen] = '\0';
+    sLineLen = 0;
+    unsigned long size = 0;
+    if (sscanf(sLine, "delta %lu", &size) == 1 && size) {
+      receiveSerial(tft, size);
+      return;
+    }
+  }
+}
+
+// ─────────────────────────────────────────────────────────────────────────────
+// App
+// ─────────────────────────────────────────────────────────────────────────────
+static bool exists(const char* path) {
+  struct stat st;
+  return stat(path, &st) == 0 && S_ISREG(st.st_mode);
+}
+
+void fwUpdateOpen() {
+  sHaveFile = false;
+  if (sdBegin()) {
+    snprintf(sFile, sizeof(sFile), "%s/update.delta", SD_MOUNT);
+    sHaveFile = exists(sFile);
+  }
+  if (!sHaveFile) {
+    strlcpy(sFile, "/littlefs/update.delta", sizeof(sFile));
+    sHaveFile = exists(sFile);
+  }
+  sState = State::IDLE;
+  sLineLen = 0;
+  sDirty = true;
+}
+
+void fwUpdateDraw(TFT_eSPI& tft) {
+  if (sDirty) {
+    sDirty = false;
+    drawScreen(tft);
+  }
+  tft.setRotation(ROT_ALT);
+  if (sState == State::APPLY_FILE) applyFile(tft);
+  else if (sState != State::DONE)  pollSerial(tft);
+}
+
+void fwUpdateInput(bool a, bool b, bool c, bool& requestExit) {
+  if (c) {
+    requestExit = true;
+    return;
+  }
+  if (a && sHaveFile && sState != State::DONE) sState = State::APPLY_FILE;
+  if (b && sState == State::DONE) ESP.restart();
+}
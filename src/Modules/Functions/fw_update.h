@@ -0,0 +1,11 @@
+#pragma once
+#include <Arduino.h>
+#include <TFT_eSPI.h>
+
+// Settings → Fw Update. Applies a firmware delta (tools/fwdelta.py) from
+// /sd/update.delta or /littlefs/update.delta, or streamed over Serial with
+// `fwdelta.py send`. A = apply file / retry, B = reboot when done, C = exit.
+
+void fwUpdateOpen();
+void fwUpdateDraw(TFT_eSPI& tft);
+void fwUpdateInput(bool a, bool b, bool c, bool& requestExit);
@@ -0,0 +1,141 @@
+#include "gps_view.h"
+#include "../../UserInterface/menus/menu_submenus.h"
+#include "../Core/gps.h"
+
+#if defined(M5CARDPUTER)
+  static constexpr uint8_t ROT_TOP = 4;
+#else
+  static constexpr uint8_t ROT_TOP = 2;
+#endif
+static constexpr uint8_t ROT_ALT = (ROT_TOP + 1) & 0x3;
+
+static constexpr uint16_t kRefreshMs = 500;
+static constexpr uint32_t kSilentMs  = 3000;    // no bytes this long → wiring hint
+
+static bool     sDirty  = true;
+static bool     sUp     = false;
+static uint32_t sDrawMs = 0;
+static uint32_t sOpenMs = 0;
+static uint32_t sShown  = 0;        // gpsSnapshot() count on screen
+static bool     sCoords = false;    // Lat/Long: position only, large type
+
+static void printE7(TFT_eSPI& tft, int32_t v) {
+  uint32_t a = v < 0 ? (uint32_t)-(int64_t)v : (uint32_t)v;
+  tft.printf("%s%lu.%07lu", v < 0 ? "-" : "", (unsigned long)(a / 10000000), (unsigned long)(a % 10000000));
+}
+
+// Hemisphere letter and five decimals (about 1 m), rounded
+static void printDeg(TFT_eSPI& tft, int32_t v, char pos, char neg) {
+  uint32_t a = v < 0 ? (uint32_t)-(int64_t)v : (uint32_t)v;
+  a = (a + 50) / 100;
+  tft.printf("%c %lu.%05lu", v < 0 ? neg : pos, (unsigned long)(a / 100000), (unsigned long)(a % 100000));
+}
+
+// ─────────────────────────────────────────────────────────────────────────────
+// Drawing
+// ─────────────────────────────────────────────────────────────────────────────
+static void drawCoords(TFT_eSPI& tft, const GpsFix& f) {
+  tft.fillRect(16, 46, 208, 60, TFT_BLACK);
+  tft.setTextSize(1);
+  tft.setTextColor(f.valid ? TFT_GREEN : TFT_YELLOW, TFT_BLACK);
+  tft.setCursor(16, 48);
+  tft.printf("%s  %u sats", f.valid ? (f.mode == 3 ? "3D fix" : "2D fix") : "no fix", f.sats);
+  tft.setTextSize(2);
+  tft.setTextColor(f.valid ? TFT_WHITE : TFT_DARKGREY, TFT_BLACK);
+  tft.setCursor(16, 64);
+  printDeg(tft, f.latE7, 'N', 'S');
+  tft.setCursor(16, 86);
+  printDeg(tft, f.lonE7, 'E', 'W');
+}
+
+static void drawFix(TFT_eSPI& tft, const GpsFix& f) {
+  tft.fillRect(16, 46, 208, 68, TFT_BLACK);
+  tft.setTextSize(1);
+  tft.setTextColor(f.valid ? TFT_GREEN : TFT_YELLOW, TFT_BLACK);
+  tft.setCursor(16, 48);
+  tft.printf("%s  %u sats  HDOP %u.%02u", f.valid ? (f.mode == 3 ? "3D fix" : "2D fix") : "no fix",
+             f.sats, f.hdopX100 / 100, f.hdopX100 % 100);
+  tft.setTextColor(TFT_WHITE, TFT_BLACK);
+  tft.setCursor(16, 60);
+  tft.print("Lat  ");
+  printE7(tft, f.latE7);
+  tft.setCursor(16, 72);
+  tft.print("Lon  ");
+  printE7(tft, f.lonE7);
+  tft.setCursor(16, 84);
+  tft.printf("Alt  %ld m   %lu km/h", (long)(f.altCm / 100), (unsigned long)(f.speedCmS * 36 / 1000));
+  tft.setTextColor(TFT_SILVER, TFT_BLACK);
+  tft.setCursor(16, 96);
+  if (f.year) tft.printf("%04u-%02u-%02u %02u:%02u:%02u UTC", f.year, f.month, f.day, f.hour, f.minute, f.second);
+}
+
+static void drawCounters(TFT_eSPI& tft, const GpsStats& s) {
+  tft.fillRect(16, 114, 208, 12, TFT_BLACK);
+  tft.setTextSize(1);
+  tft.setTextColor(s.checksumErrors || s.overruns ? TFT_YELLOW : TFT_DARKGREY, TFT_BLACK);
+  tft.setCursor(16, 116);
+  tft.printf("%lu B  %lu ok  %lu cksum  %lu ovf", (unsigned long)s.bytes, (unsigned long)s.sentences,
+             (unsigned long)s.checksumErrors, (unsigned long)s.overruns);
+}
+
+void gpsViewDraw(TFT_eSPI& tft) {
+  if (sDirty) {
+    sDirty = false;
+    tft.setRotation(ROT_TOP);
+    drawOptionsLayerBackground(tft);
+    tft.setRotation(ROT_ALT);
+    tft.setTextSize(2);
+    tft.setTextColor(TFT_WHITE, TFT_BLACK);
+    tft.setCursor(16, 26);
+    tft.print(sCoords ? "Lat/Long" : "Location");
+    if (!sUp) {
+      tft.setTextSize(1);
+      tft.setTextColor(TFT_RED, TFT_BLACK);
+      tft.setCursor(16, 50);
+      tft.print("Could not start the GPS UART");
+      return;
+    }
+    sShown  = 0;
+    sDrawMs = 0;
+  }
+  if (!sUp || millis() - sDrawMs < kRefreshMs) return;
+  sDrawMs = millis();
+  tft.setRotation(ROT_ALT);
+
+  GpsStats s = gpsStats();
+  GpsFix f;
+  uint32_t n = gpsSnapshot(f);
+  if (n != sShown) {
+    sShown = n;
+    if (sCoords) drawCoords(tft, f);
+    else         drawFix(tft, f);
+  } else if (!s.bytes && millis() - sOpenMs > kSilentMs) {
+    tft.setTextSize(1);
+    tft.setTextColor(TFT_YELLOW, TFT_BLACK);
+    tft.setCursor(16, 48);
+    tft.print("No data from the receiver");
+  }
+  if (!sCoords) drawCounters(tft, s);
+}
+
+// ─────────────────────────────────────────────────────────────────────────────
+// Lifecycle
+// ─────────────────────────────────────────────────────────────────────────────
+void gpsViewOpen() {
+  sCoords = false;
+  sUp     = gpsBegin();
+  sOpenMs = millis();
+  sDirty  = true;
+}
+
+void gpsCoordsOpen() {
+  gpsViewOpen();
+  sCoords = true;
+}
+
+void gpsViewInput(bool a, bool b, bool c, bool& requestExit) {
+  if (!c) return;
+  gpsEnd();
+  sUp = false;
+  requestExit = true;
+}
@@ -0,0 +1,13 @@
+#pragma once
+#include <Arduino.h>
+#include <TFT_eSPI.h>
+
+// GPS → Location: live fix from the Core/gps receiver service (position,
+// altitude, satellites, DOP, UTC time, speed) plus parser counters.
+// GPS → Lat/Long: the same service, showing only the position in large type.
+// C = stop the receiver and exit.
+
+void gpsViewOpen();
+void gpsCoordsOpen();                 // Lat/Long; draw/input are shared
+void gpsViewDraw(TFT_eSPI& tft);
+void gpsViewInput(bool a, bool b, bool c, bool& requestExit);
@@ -0,0 +1,176 @@
+#include "ir_macro.h"
+#include "../../UserInterface/menus/menu_submenus.h"
+#include "../Core/ir_sequencer.h"
+#include "../Core/storage.h"
+#include <sys/stat.h>
+
+#if defined(M5CARDPUTER)
+  static constexpr uint8_t ROT_TOP = 4;
+#else
+  static constexpr uint8_t ROT_TOP = 2;
+#endif
+static constexpr uint8_t ROT_ALT = (ROT_TOP + 1) & 0x3;
+
+// Built-in macro for our Samsung TVs (same codes as B-Gone → TV)
+static const char kTvSetup[] =
+  "send samsung 0x07 0x02        # power\n"
+  "wait 2500\n"
+  "send samsung 0x07 0x01 x3     # input\n"
+  "send samsung 0x07 0x0B x10 gap 120   # vol-\n";
+
+// Macros live on flash next to the IR capture log (/ir on LittleFS)
+static constexpr const char* kMacroDir  = "/littlefs/ir";
+static constexpr const char* kMacroFile = "/littlefs/ir/macros.txt";
+
+static uint8_t  sSel       = 0;
+static bool     sDirty     = true;
+static bool     sWasRunning = false;
+static uint16_t sLastFrames = 0xFFFF;
+static char     sStatus[40] = "";
+static char     sLine[160];
+static uint8_t  sLineLen   = 0;
+
+// ─────────────────────────────────────────────────────────────────────────────
+// Serial: "name: send ...; wait ...; ..."
+// ─────────────────────────────────────────────────────────────────────────────
+static void pollSerial() {
+  while (Serial.available()) {
+    char c = (char)Serial.read();
+    if (c != '\n' && c != '\r') {
+      if (sLineLen < sizeof(sLine) - 1) sLine[sLineLen++] = c;
+      continue;
+    }
+    if (!sLineLen) continue;
+    sLine[sLineLen] = '\0';
+    sLineLen = 0;
+
+    char* colon = strchr(sLine, ':');
+    if (!colon) { Serial.println("[irseq] expected name: steps"); continue; }
+    *colon = '\0';
+    if (irMacroAdd(sLine, colon + 1)) {
+      sSel = irMacroCount() - 1;
+      if (!storageMounted() || !irMacroSave(kMacroFile)) {
+        snprintf(sStatus, sizeof(sStatus), "Added %s (not saved)", irMacroName(sSel));
+      } else {
+        snprintf(sStatus, sizeof(sStatus), "Saved %s", irMacroName(sSel));
+      }
+    } else {
+      snprintf(sStatus, sizeof(sStatus), "Err: %s", irMacroError());
+    }
+    Serial.printf("[irseq] %s\n", sStatus);
+    sDirty = true;
+  }
+}
+
+// ─────────────────────────────────────────────────────────────────────────────
+// Drawing
+// ─────────────────────────────────────────────────────────────────────────────
+static void drawProgress(TFT_eSPI& tft) {
+  const IrSeqStats s = irSeqStats();
+  const int x = 16, y = 84, w = 208;
+
+  tft.fillRect(x, y, w, 40, TFT_BLACK);
+  tft.drawRect(x, y, w, 8, TFT_DARKGREY);
+  if (s.framesTotal) {
+    int fill = (w - 2) * s.framesSent / s.framesTotal;
+    tft.fillRect(x + 1, y + 1, fill, 6, s.running ? TFT_GREEN : TFT_DARKGREEN);
+  }
+
+  char buf[48];
+  tft.setTextSize(1);
+  tft.setTextColor(TFT_WHITE, TFT_BLACK);
+  snprintf(buf, sizeof(buf), "Frame %u/%u  step %u/%u  %lus",
+           s.framesSent, s.framesTotal, min<uint8_t>(s.step + 1, s.steps), s.steps,
+           (unsigned long)(s.elapsedMs / 1000));
+  tft.setCursor(x, y + 12); tft.print(buf);
+  snprintf(buf, sizeof(buf), "Err last %ldus avg %luus max %luus",
+           (long)s.lastErrUs, (unsigned long)s.avgErrUs, (unsigned long)s.maxErrUs);
+  tft.setCursor(x, y + 22); tft.print(buf);
+  tft.setTextColor(TFT_SILVER, TFT_BLACK);
+  tft.setCursor(x, y + 32); tft.print(sStatus);
+}
+
+void irMacroDrawScreen(TFT_eSPI& tft) {
+  const IrSeqStats s = irSeqStats();
+  if (s.running != sWasRunning) {
+    sWasRunning = s.running;
+    if (!s.running && s.failed) snprintf(sStatus, sizeof(sStatus), "Err: %s", irMacroError());
+    sDirty = true;
+  }
+
+  if (!sDirty) {
+    if (s.framesSent != sLastFrames) {       // only the progress panel moves
+      sLastFrames = s.framesSent;
+      tft.setRotation(ROT_ALT);
+      drawProgress(tft);
+    }
+    return;
+  }
+  sDirty = false;
+  sLastFrames = s.framesSent;
+
+  tft.setRotation(ROT_TOP);
+  drawOptionsLayerBackground(tft);
+  tft.setRotation(ROT_ALT);
+
+  tft.setTextSize(2);
+  tft.setTextColor(TFT_WHITE, TFT_BLACK);
+  tft.setCursor(16, 26);
+  tft.print("IR Macros");
+
+  tft.setTextSize(1);
+  const uint8_t n = irMacroCount();
+  const uint8_t first = sSel >= 4 ? sSel - 3 : 0;
+  for (uint8_t i = 0; i < 4 && first + i < n; ++i) {
+    uint8_t idx = first + i;
+    bool sel = idx == sSel;
+    tft.setTextColor(sel ? TFT_BLACK : TFT_SILVER, sel ? TFT_WHITE : TFT_BLACK);
+    tft.setCursor(16, 46 + i * 9);
+    tft.printf("%c %-16s", sel ? '>' : ' ', irMacroName(idx));
+  }
+  tft.setTextColor(s.running ? TFT_GREEN : TFT_DARKGREY, TFT_BLACK);
+  tft.setCursor(170, 46);
+  tft.print(s.running ? "RUNNING" : "A: run");
+
+  drawProgress(tft);
+}
+
+// ─────────────────────────────────────────────────────────────────────────────
+// Lifecycle
+// ─────────────────────────────────────────────────────────────────────────────
+void irMacroReset() {
+  if (!irMacroCount()) {
+    if (storageBegin()) mkdir(kMacroDir, 0777);
+    if (!irMacroLoad(kMacroFile)) irMacroAdd("TV setup", kTvSetup);
+  }
+  sSel = 0;
+  sStatus[0] = '\0';
+  sLineLen = 0;
+  sWasRunning = false;
+  sDirty = true;
+}
+
+void irMacroHandleInput(bool a, bool b, bool c, bool& requestExit) {
+  pollSerial();
+
+  if (c) {
+    irSeqStop();
+    requestExit = true;
+    return;
+  }
+  if (b && irMacroCount()) {
+    sSel = (sSel + 1) % irMacroCount();
+    sDirty = true;
+  }
+  if (a && irMacroCount()) {
+    if (irSeqStats().running) {
+      irSeqStop();
+      snprintf(sStatus, sizeof(sStatus), "Stopped");
+    } else if (irSeqStart(sSel)) {
+      snprintf(sStatus, sizeof(sStatus), "%s", irMacroName(sSel));
+    } else {
+      snprintf(sStatus, sizeof(sStatus), "Err: %s", irMacroError());
+    }
+    sDirty = true;
+  }
+}
@@ -0,0 +1,12 @@
+#pragma once
+#include <Arduino.h>
+#include <TFT_eSPI.h>
+
+// IR → Custom: list of IR macros played by the sequencer.
+// A = run/stop, B = next macro, C = exit.
+// New macros can be pasted over Serial as "name: step; step; ..."; they are
+// saved to /littlefs/ir/macros.txt and loaded on first open.
+
+void irMacroReset();
+void irMacroDrawScreen(TFT_eSPI& tft);      // dirty-aware
+void irMacroHandleInput(bool a, bool b, bool c, bool& requestExit);
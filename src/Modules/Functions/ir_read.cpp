@@ -1,5 +1,13 @@
 #include "ir_read.h"
 #include "../../UserInterface/menus/menu_submenus.h"
+#include "../Core/ir_library.h"
+#include "../Core/ir_export.h"
+#include "../Core/ir_analyzer.h"
+#include "../Core/storage.h"
+#include "../Core/settings.h"
+#include "../Core/sdcard.h"
+#include "../Core/sd_logger.h"
+#include <sys/stat.h>
 #include <Arduino.h>
 #include <TFT_eSPI.h>
 
@@ -32,13 +40,16 @@ static constexpr uint8_t ROT_ALT = (ROT_TOP + 1) & 0x3;
 // State
 // ─────────────────────────────────────────────────────────────────────────────
 enum class IRState : uint8_t { WAITING, RECEIVED };
+enum class IRView  : uint8_t { LIVE, ANALYZER };
 static IRState  sState   = IRState::WAITING;
+static IRView   sView    = IRView::LIVE;
+static bool     sAnDirty = false;    // analyzer: new frame, partial redraw
 static bool     sDirty   = true;
 static bool     sPaused  = false;    // toggle via B
 static uint32_t sLastMs  = 0;
 
 // Decoded fields (display)
-static String   sProto = "-";
+static const char* sProto = "-";  // static decoder string, never owned
 static uint32_t sAddr  = 0;
 static uint32_t sCmd   = 0;
 static uint64_t sValue = 0;          // some protocols carry >32 bits
@@ -47,6 +58,30 @@ static uint64_t sValue = 0;          // some protocols carry >32 bits
 static uint16_t sRawBuf[256];
 static uint16_t sRawLen = 0;
 
+// Library match for the last frame (see ir_library)
+static IrMatchResult sMatch = { IrMatch::NEW, -1 };
+static bool          sHaveMatch = false;
+
+// Every new library code is echoed to Serial in this format. A batch export
+// of the whole library is requested by sending 'p' (Pronto), 'l' (LIRC) or
+// 'f' (Flipper) over the serial monitor.
+static IrExportFormat sLiveFormat = IrExportFormat::FLIPPER;
+static uint16_t       sLiveSent   = 0;     // library entries already streamed
+
+// Every received frame is appended to the capture log as one line:
+//   <ms> <proto> <addr> <cmd> <n>: <durations in µs, mark first>
+// Long sessions go to microSD when a card is present, otherwise to flash.
+static constexpr const char* kCaptureLog   = "/ir/captures.log";
+static constexpr const char* kSdCaptureDir = "/sd/ir";
+static constexpr const char* kSdCaptureLog = "/sd/ir/captures.log";
+static int8_t   sLog = -1;
+static SdLogger sSdLog;
+
+// Analyzer view: last drawn bar heights, so a frame only repaints changed bars
+static uint8_t    sBarH[2][IR_AN_BINS];
+static IrEncoding sLastEnc  = IrEncoding::UNKNOWN;
+static uint8_t    sLastBits = 0;
+
 // ─────────────────────────────────────────────────────────────────────────────
 // IRremote helpers (version-compat)
 // ─────────────────────────────────────────────────────────────────────────────
@@ -60,7 +95,7 @@ static void snapshotFromDecoder() {
 #if defined(IRremote_HPP) || __has_include(<IRremote.hpp>)
   // Newer IRremote
   auto &d = IrReceiver.decodedIRData;
-  sProto = String(getProtocolString(d.protocol));
+  sProto = getProtocolString(d.protocol);
   sAddr  = d.address;
   sCmd   = d.command;
   sValue = (uint64_t)d.decodedRawData;
@@ -69,39 +104,130 @@ static void snapshotFromDecoder() {
     sRawLen = min<uint16_t>(d.rawDataPtr->rawlen, (uint16_t)(sizeof(sRawBuf)/sizeof(sRawBuf[0])));
     for (uint16_t i=0; i<sRawLen; ++i) sRawBuf[i] = d.rawDataPtr->rawbuf[i];
   }
+  sMatch = irLibAdd(sRawBuf, sRawLen, getProtocolString(d.protocol), d.protocol != UNKNOWN,
+                    (d.flags & IRDATA_FLAGS_IS_REPEAT) != 0, d.address, d.command);
+  sHaveMatch = true;
 #else
   // Legacy IRremote
   decode_results r;
   if (IrReceiver.decode(&r)) {
+    const char* name;
     switch (r.decode_type) {
-      case NEC:  sProto = "NEC"; break;
-      case SONY: sProto = "SONY"; break;
-      case RC5:  sProto = "RC5"; break;
-      case RC6:  sProto = "RC6"; break;
-      default:   sProto = "UNK"; break;
+      case NEC:  name = "NEC"; break;
+      case SONY: name = "Sony"; break;
+      case RC5:  name = "RC5"; break;
+      case RC6:  name = "RC6"; break;
+      default:   name = "UNK"; break;
     }
+    sProto = name;
     sAddr  = 0;
     sCmd   = 0;
     sValue = r.value;
 
     sRawLen = min<uint16_t>(r.rawlen, (uint16_t)(sizeof(sRawBuf)/sizeof(sRawBuf[0])));
     for (uint16_t i=0; i<sRawLen; ++i) sRawBuf[i] = r.rawbuf[i];
+    sMatch = irLibAdd(sRawBuf, sRawLen, name, r.decode_type != UNKNOWN,
+                      false, 0, (uint16_t)r.value);
+    sHaveMatch = true;
 
     IrReceiver.resume();
   }
 #endif
 }
 
+// ─────────────────────────────────────────────────────────────────────────────
+// Capture log (SD logger or storage write-back cache; never waits on media)
+// ─────────────────────────────────────────────────────────────────────────────
+static void logWrite(const char* buf, int n) {
+  if (sSdLog.active()) sSdLog.write(buf, n);
+  else                 storageAppend(sLog, buf, n);
+}
+
+static void logOpen() {
+  if (sdBegin()) {
+    mkdir(kSdCaptureDir, 0777);
+    if (sSdLog.begin(kSdCaptureLog)) return;
+  }
+  if (sLog < 0) sLog = storageOpen(kCaptureLog);
+}
+
+static void logClose() {
+  if (sSdLog.active()) sSdLog.stop();
+  storageClose(sLog);
+  sLog = -1;
+}
+
+static void logFrame() {
+  if ((sLog < 0 && !sSdLog.active()) || sRawLen < 2) return;
+  static char line[64 + 256 * 9];                     // one record per frame
+  int n = snprintf(line, sizeof(line), "%lu %s 0x%lX 0x%lX %u:", (unsigned long)millis(), sProto,
+                   (unsigned long)sAddr, (unsigned long)sCmd, sRawLen - 1);
+  for (uint16_t i = 1; i < sRawLen; ++i) {            // [0] is the leading gap
+    n += snprintf(line + n, sizeof(line) - n, " %lu", (unsigned long)sRawBuf[i] * 50);
+  }
+  line[n++] = '\n';
+  logWrite(line, n);
+}
+
+// ─────────────────────────────────────────────────────────────────────────────
+// Export (Serial)
+// ─────────────────────────────────────────────────────────────────────────────
+static void pollExport() {
+  while (Serial.available() > 0) {
+    int c = Serial.read();
+    IrExportFormat fmt;
+    if      (c == 'p') fmt = IrExportFormat::PRONTO;
+    else if (c == 'l') fmt = IrExportFormat::LIRC;
+    else if (c == 'f') fmt = IrExportFormat::FLIPPER;
+    else continue;
+    if (irExportStart(Serial, fmt, true)) {
+      sLiveFormat = fmt;
+      sLiveSent   = irLibCount();            // batch already covers them
+    }
+  }
+  uint16_t count = irLibCount();
+  if (count > sLiveSent && irExportStart(Serial, sLiveFormat, true, sLiveSent, count - sLiveSent)) {
+    sLiveSent = count;
+  }
+  irExportPump();
+}
+
 // ─────────────────────────────────────────────────────────────────────────────
 // Drawing helpers
 // ─────────────────────────────────────────────────────────────────────────────
-static void printLine(TFT_eSPI& tft, int x, int& y, const String& s, uint16_t col=TFT_WHITE) {
+static void printLine(TFT_eSPI& tft, int x, int& y, const char* s, uint16_t col=TFT_WHITE) {
   tft.setTextColor(col, TFT_BLACK);
   tft.setCursor(x, y);
   tft.print(s);
   y += 14;
 }
 
+static void drawMatch(TFT_eSPI& tft, int x, int y) {
+  if (!sHaveMatch) return;
+  const IrLibEntry* e = sMatch.index >= 0 ? irLibGet(sMatch.index) : nullptr;
+  char line[48];
+  uint16_t col = TFT_SILVER;
+  switch (sMatch.kind) {
+    case IrMatch::NEW:
+      snprintf(line, sizeof(line), "NEW  %s  (%u in lib)", e ? e->name : "?", (unsigned)irLibCount());
+      col = TFT_WHITE;
+      break;
+    case IrMatch::DUPLICATE:
+      snprintf(line, sizeof(line), "DUP  %s  x%u", e ? e->name : "?", e ? (unsigned)e->hits : 0u);
+      break;
+    case IrMatch::REPEAT:
+      snprintf(line, sizeof(line), "RPT  %s  +%u", e ? e->name : "-", e ? (unsigned)e->repeats : 0u);
+      break;
+    case IrMatch::FULL:
+      snprintf(line, sizeof(line), "Library full");
+      break;
+  }
+  tft.setTextSize(1);
+  tft.setTextColor(col, TFT_BLACK);
+  tft.setCursor(x, y);
+  tft.print(line);
+}
+
 static void drawWave(TFT_eSPI& tft, int x, int y, int w, int h) {
   tft.drawRect(x, y, w, h, TFT_DARKGREY);
   if (sRawLen < 2) return;
@@ -129,6 +255,80 @@ static void drawWave(TFT_eSPI& tft, int x, int y, int w, int h) {
   }
 }
 
+// ─────────────────────────────────────────────────────────────────────────────
+// Analyzer view
+// ─────────────────────────────────────────────────────────────────────────────
+static constexpr int AN_X = 24, AN_BAR_W = 3, AN_H = 30;
+static constexpr int AN_MARK_Y = 32, AN_SPACE_Y = 72, AN_TEXT_Y = 108;
+
+static void drawBars(TFT_eSPI& tft, const uint16_t* hist, uint8_t* lastH, int top, uint16_t col, bool force) {
+  uint16_t peak = max<uint16_t>(1, irAnalyzerHistPeak());
+  for (uint8_t i = 0; i < IR_AN_BINS; ++i) {
+    uint8_t h = (uint8_t)((uint32_t)hist[i] * AN_H / peak);
+    if (hist[i] && !h) h = 1;
+    if (!force && h == lastH[i]) continue;
+    int x = AN_X + i * AN_BAR_W;
+    tft.fillRect(x, top, AN_BAR_W - 1, AN_H - h, TFT_BLACK);
+    if (h) tft.fillRect(x, top + AN_H - h, AN_BAR_W - 1, h, col);
+    lastH[i] = h;
+  }
+}
+
+static void drawAnalyzerText(TFT_eSPI& tft) {
+  const IrAnalysis& r = irAnalyzerResult();
+  char line[48];
+  tft.fillRect(AN_X - 10, AN_TEXT_Y, 212, 20, TFT_BLACK);
+  tft.setTextSize(1);
+  tft.setTextColor(r.enc == IrEncoding::UNKNOWN ? TFT_SILVER : TFT_WHITE, TFT_BLACK);
+  snprintf(line, sizeof(line), "%s  T=%uus  %ub  n=%u", irEncodingName(r.enc),
+           r.unitUs, r.bits, r.frames);
+  tft.setCursor(AN_X - 10, AN_TEXT_Y);
+  tft.print(line);
+  if (r.enc == IrEncoding::MANCHESTER) {
+    snprintf(line, sizeof(line), "half-bit %u us", r.unitUs);
+  } else {
+    snprintf(line, sizeof(line), "H %u/%u 0=%u/%u 1=%u/%u",
+             r.hasHeader ? r.hdrMarkUs : 0, r.hasHeader ? r.hdrSpaceUs : 0,
+             r.zeroMarkUs, r.zeroSpaceUs, r.oneMarkUs, r.oneSpaceUs);
+  }
+  tft.setCursor(AN_X - 10, AN_TEXT_Y + 10);
+  tft.print(line);
+}
+
+static void drawAnalyzerUpdate(TFT_eSPI& tft, bool force) {
+  tft.setRotation(ROT_ALT);
+  drawBars(tft, irAnalyzerMarkHist(),  sBarH[0], AN_MARK_Y,  TFT_WHITE,  force);
+  drawBars(tft, irAnalyzerSpaceHist(), sBarH[1], AN_SPACE_Y, TFT_SILVER, force);
+  drawAnalyzerText(tft);
+}
+
+static void drawAnalyzer(TFT_eSPI& tft) {
+  tft.setRotation(ROT_TOP);
+  drawOptionsLayerBackground(tft);
+  tft.setRotation(ROT_ALT);
+
+  tft.setTextSize(1);
+  tft.setTextColor(TFT_DARKGREY, TFT_BLACK);
+  tft.setCursor(AN_X - 10, AN_MARK_Y - 8);          tft.print("mark");
+  tft.setCursor(AN_X - 10, AN_SPACE_Y - 8);         tft.print("space");
+  tft.setCursor(AN_X + IR_AN_BINS * AN_BAR_W - 30, AN_SPACE_Y + AN_H + 1);
+  tft.print("6.4ms");
+  tft.drawFastHLine(AN_X, AN_MARK_Y + AN_H,  IR_AN_BINS * AN_BAR_W, TFT_DARKGREY);
+  tft.drawFastHLine(AN_X, AN_SPACE_Y + AN_H, IR_AN_BINS * AN_BAR_W, TFT_DARKGREY);
+  drawAnalyzerUpdate(tft, true);
+}
+
+// Template goes to Serial whenever the guess changes
+static void reportAnalysis() {
+  const IrAnalysis& r = irAnalyzerResult();
+  if (r.enc == sLastEnc && r.bits == sLastBits) return;
+  sLastEnc  = r.enc;
+  sLastBits = r.bits;
+  char tpl[160];
+  irAnalyzerTemplate(tpl, sizeof(tpl));
+  Serial.println(tpl);
+}
+
 static void drawUI(TFT_eSPI& tft) {
   tft.setRotation(ROT_TOP);
   drawOptionsLayerBackground(tft);
@@ -142,24 +342,26 @@ static void drawUI(TFT_eSPI& tft) {
   const int panelX = L + 4;
   const int panelY = T + 20;
   const int panelW = W - 8;
-  const int panelH = 54;
+  const int panelH = 66;
   tft.drawRoundRect(panelX, panelY, panelW, panelH, 6, TFT_DARKGREY);
 
   int y = panelY + 8;
   tft.setTextSize(2);
-  printLine(tft, panelX + 8, y, "Proto: " + sProto);
-  tft.setTextSize(1);
   char line[64];
+  snprintf(line, sizeof(line), "Proto: %s", sProto);
+  printLine(tft, panelX + 8, y, line);
+  tft.setTextSize(1);
   snprintf(line, sizeof(line), "Addr: 0x%X   Cmd: 0x%X", (unsigned)sAddr, (unsigned)sCmd);
-  printLine(tft, panelX + 8, y, String(line));
+  printLine(tft, panelX + 8, y, line);
   snprintf(line, sizeof(line), "Value: 0x%llX", (unsigned long long)sValue);
-  printLine(tft, panelX + 8, y, String(line));
+  printLine(tft, panelX + 8, y, line);
+  drawMatch(tft, panelX + 8, y);
 
   // Waveform
   const int waveX = L + 4;
   const int waveY = panelY + panelH + 8;
   const int waveW = W - 8;
-  const int waveH = 46;
+  const int waveH = 30;
   drawWave(tft, waveX, waveY, waveW, waveH);
 }
 
@@ -167,19 +369,41 @@ static void drawUI(TFT_eSPI& tft) {
 // Public API
 // ─────────────────────────────────────────────────────────────────────────────
 void irReadReset() {
+  int8_t rxPin = settingsGet(Setting::IR_RX_GPIO);     // Settings → Config Pins
+  if (rxPin < 0 || !settingsPinValid(Setting::IR_RX_GPIO, rxPin)) rxPin = IR_RX_PIN;
 #if defined(IRremote_HPP) || __has_include(<IRremote.hpp>)
-  IrReceiver.begin(IR_RX_PIN, ENABLE_LED_FEEDBACK);
+  IrReceiver.begin(rxPin, ENABLE_LED_FEEDBACK);
 #else
-  IrReceiver.begin(IR_RX_PIN, ENABLE_LED_FEEDBACK);
+  IrReceiver.begin(rxPin, ENABLE_LED_FEEDBACK);
 #endif
   sState  = IRState::WAITING;
   sPaused = false;
   sDirty  = true;
   sLastMs = millis();
   sProto  = "-"; sAddr=0; sCmd=0; sValue=0; sRawLen=0;
+  sHaveMatch = false;
+  sView   = IRView::LIVE;
+  if (sLog < 0 && !sSdLog.active()) logOpen();
+}
+
+void irReadSetAnalyzer(bool on) {
+  sView = on ? IRView::ANALYZER : IRView::LIVE;
+  if (on) {
+    irAnalyzerReset();
+    memset(sBarH, 0, sizeof(sBarH));
+    sLastEnc  = IrEncoding::UNKNOWN;
+    sLastBits = 0;
+  }
+  sDirty = true;
 }
 
 void irReadDrawScreen(TFT_eSPI& tft) {
+  if (sView == IRView::ANALYZER) {
+    if (sDirty)        drawAnalyzer(tft);
+    else if (sAnDirty) drawAnalyzerUpdate(tft, false);
+    sDirty = sAnDirty = false;
+    return;
+  }
   if (!sDirty) return;
   drawUI(tft);
   sDirty = false;
@@ -190,7 +414,9 @@ void irReadHandleInput(bool a, bool b, bool c, bool& requestExit) {
   // A → clear
   if (a) {
     sProto="-"; sAddr=0; sCmd=0; sValue=0; sRawLen=0;
+    sHaveMatch = false;
     sState = IRState::WAITING;
+    if (sView == IRView::ANALYZER) irReadSetAnalyzer(true);
     sDirty = true;
   }
   // B → pause
@@ -200,6 +426,7 @@ void irReadHandleInput(bool a, bool b, bool c, bool& requestExit) {
   }
   // C → exit
   if (c) {
+    logClose();
     requestExit = true;
     return;
   }
@@ -210,7 +437,10 @@ void irReadHandleInput(bool a, bool b, bool c, bool& requestExit) {
       snapshotFromDecoder();
       IrReceiver.resume();
       sState = IRState::RECEIVED;
-      sDirty = true;
+      irAnalyzerFeed(sRawBuf, sRawLen);
+      logFrame();
+      if (sView == IRView::ANALYZER) { sAnDirty = true; reportAnalysis(); }
+      else                           sDirty = true;
     }
 #else
     decode_results r;
@@ -218,10 +448,14 @@ void irReadHandleInput(bool a, bool b, bool c, bool& requestExit) {
       snapshotFromDecoder();
       IrReceiver.resume();
       sState = IRState::RECEIVED;
-      sDirty = true;
+      irAnalyzerFeed(sRawBuf, sRawLen);
+      logFrame();
+      if (sView == IRView::ANALYZER) { sAnDirty = true; reportAnalysis(); }
+      else                           sDirty = true;
     }
 #endif
   }
+  pollExport();
 
   // Redraw throttled
   uint32_t now = millis();
@@ -7,3 +7,4 @@ void irReadReset();                         // init receiver, clear state
 void irReadDrawScreen(TFT_eSPI& tft);       // full redraw (dirty-aware internally)
 void irReadHandleInput(bool a, bool b, bool c, bool& requestExit);
                                             // A = clear, B = pause/resume, C = exit
+void irReadSetAnalyzer(bool on);            // pulse-width histogram view (call after reset)
@@ -0,0 +1,197 @@
+#include "mic_spect.h"
+#include "../../UserInterface/menus/menu_submenus.h"
+#include "../Core/mic_fft.h"
+
+extern TFT_eSPI tft;                    // the scroll area must be undone on exit
+
+#if defined(M5CARDPUTER)
+  static constexpr uint8_t ROT_TOP = 4;
+#else
+  static constexpr uint8_t ROT_TOP = 2;
+#endif
+static constexpr uint8_t ROT_ALT = (ROT_TOP + 1) & 0x3;
+
+// Panel geometry. Lines are pushed in rotation 0, where ST7789 memory rows
+// run down the screen; the 240-row panel sits in the middle of the 320-row
+// frame memory.
+static constexpr int      kPanelW    = TFT_WIDTH;                 // 135
+static constexpr int      kPanelH    = TFT_HEIGHT;                // 240
+static constexpr uint16_t kMemRows   = 320;
+static constexpr uint16_t kRowStart  = (kMemRows - kPanelH) / 2;
+
+// Landscape layout: label strip on the left, waterfall on the rest
+static constexpr int      kStripW    = 40;
+static constexpr int      kWfRows    = kPanelH - kStripW;         // lines of history
+static constexpr int      kBandTop   = 8;                         // landscape y of the highest bin
+static constexpr int      kBandH     = 120;
+static constexpr uint16_t kLabelMs   = 250;
+static constexpr uint8_t  kMaxLinesPerDraw = 8;
+
+// Rotation-0 row of the waterfall's first line, and landscape → rotation-0
+// column. ROT_ALT 1 has landscape x = row, ROT_ALT 3 runs it backwards.
+static constexpr int kWfRow0 = ROT_ALT == 1 ? kStripW : 0;
+static constexpr int colOf(int y) { return ROT_ALT == 1 ? kPanelW - 1 - y : y; }
+
+static bool     sDirty  = true;
+static bool     sUp     = false;
+static bool     sPaused = false;
+static bool     sScroll = false;        // scroll area defined on the panel
+static uint16_t sOffset = 0;            // next waterfall row to write, 0..kWfRows-1
+static uint32_t sLabelMs = 0;
+static uint16_t sPalette[256];
+static uint16_t sColumn[kPanelW];
+
+// ─────────────────────────────────────────────────────────────────────────────
+// ST7789 vertical scroll
+// ─────────────────────────────────────────────────────────────────────────────
+static void writeWords(TFT_eSPI& tft, uint8_t cmd, const uint16_t* v, uint8_t n) {
+  tft.writecommand(cmd);
+  for (uint8_t i = 0; i < n; ++i) {
+    tft.writedata(v[i] >> 8);
+    tft.writedata(v[i] & 0xFF);
+  }
+}
+
+static void scrollArea(TFT_eSPI& tft, uint16_t top, uint16_t rows) {
+  const uint16_t v[3] = { top, rows, (uint16_t)(kMemRows - top - rows) };
+  writeWords(tft, 0x33, v, 3);                                    // VSCRDEF
+}
+
+static void scrollStart(TFT_eSPI& tft, uint16_t row) {
+  writeWords(tft, 0x37, &row, 1);                                 // VSCSAD
+}
+
+static void scrollReset(TFT_eSPI& tft) {
+  if (!sScroll) return;
+  scrollArea(tft, 0, kMemRows);
+  scrollStart(tft, 0);
+  sScroll = false;
+}
+
+// ─────────────────────────────────────────────────────────────────────────────
+// Drawing
+// ─────────────────────────────────────────────────────────────────────────────
+// black → blue → magenta → orange → yellow → white
+static void buildPalette() {
+  static const uint8_t kStops[][3] = {
+    { 0, 0, 0 }, { 0, 0, 160 }, { 160, 0, 160 }, { 255, 96, 0 }, { 255, 255, 0 }, { 255, 255, 255 },
+  };
+  constexpr int kSegs = sizeof(kStops) / sizeof(kStops[0]) - 1;
+  for (int i = 0; i < 256; ++i) {
+    int s = i * kSegs / 256, f = i * kSegs % 256;                 // segment, position in it / 256
+    uint8_t c[3];
+    for (int k = 0; k < 3; ++k) c[k] = kStops[s][k] + (kStops[s + 1][k] - kStops[s][k]) * f / 256;
+    sPalette[i] = ((c[0] & 0xF8) << 8) | ((c[1] & 0xFC) << 3) | (c[2] >> 3);
+  }
+}
+
+// One spectrum line → one panel row; low frequencies at the bottom of the band
+static void pushLine(TFT_eSPI& tft, const uint8_t* line) {
+  memset(sColumn, 0, sizeof(sColumn));
+  for (int i = 0; i < kBandH; ++i) {
+    int bin = 1 + (kBandH - 1 - i) * (MIC_BINS - 1) / kBandH;     // skip DC
+    sColumn[colOf(kBandTop + i)] = sPalette[line[bin]];
+  }
+  tft.pushImage(0, kWfRow0 + sOffset, kPanelW, 1, sColumn);
+  sOffset = (sOffset + 1) % kWfRows;
+  scrollStart(tft, kRowStart + kWfRow0 + sOffset);                // oldest row shows first
+}
+
+static void drawLabels(TFT_eSPI& tft) {
+  MicFftStats s = micFftStats();
+  tft.fillRect(0, 0, kStripW, 24, TFT_BLACK);
+  tft.setTextSize(1);
+  tft.setTextColor(sPaused ? TFT_YELLOW : TFT_WHITE, TFT_BLACK);
+  tft.setCursor(2, 2);
+  tft.print(sPaused ? "PAUSE" : "Mic");
+  tft.setTextColor(TFT_SILVER, TFT_BLACK);
+  tft.setCursor(2, 14);
+  tft.printf("%4u", s.peakHz);
+  if (s.droppedLines) tft.drawPixel(kStripW - 2, 2, TFT_RED);
+}
+
+static void drawScale(TFT_eSPI& tft) {
+  const uint32_t top = (uint32_t)(MIC_BINS - 1) * MIC_RATE / MIC_FFT_N;
+  tft.setTextSize(1);
+  tft.setTextColor(TFT_DARKGREY, TFT_BLACK);
+  for (uint8_t q = 0; q <= 2; ++q) {                              // top, middle, bottom of the band
+    int y = kBandTop + q * (kBandH - 8) / 2;
+    tft.setCursor(2, y);
+    tft.printf("%2luk", (unsigned long)((top - top * q / 2) / 1000));
+    tft.drawFastHLine(kStripW - 6, y + 3, 4, TFT_DARKGREY);
+  }
+}
+
+void micSpectDraw(TFT_eSPI& tft) {
+  if (sDirty) {
+    sDirty = false;
+    scrollReset(tft);
+    tft.setRotation(ROT_ALT);
+    tft.fillScreen(TFT_BLACK);                                    // the waterfall owns the screen
+    if (!sUp) {
+      tft.setTextSize(2);
+      tft.setTextColor(TFT_WHITE, TFT_BLACK);
+      tft.setCursor(16, 26);
+      tft.print("Mic Spect");
+      tft.setTextSize(1);
+      tft.setTextColor(TFT_RED, TFT_BLACK);
+      tft.setCursor(16, 50);
+      tft.print("Could not start the microphone");
+      return;
+    }
+    drawScale(tft);
+    scrollArea(tft, kRowStart + kWfRow0, kWfRows);
+    sScroll  = true;
+    sOffset  = 0;
+    scrollStart(tft, kRowStart + kWfRow0);
+    sLabelMs = 0;
+  }
+  if (!sUp) return;
+
+  uint8_t line[MIC_BINS];
+  if (!sPaused) {
+    bool any = false, swap = tft.getSwapBytes();
+    for (uint8_t n = 0; n < kMaxLinesPerDraw && micFftPop(line); ++n) {
+      if (!any) {
+        any = true;
+        tft.setRotation(0);
+        tft.setSwapBytes(true);
+      }
+      pushLine(tft, line);
+    }
+    if (any) {
+      tft.setSwapBytes(swap);
+      tft.setRotation(ROT_ALT);
+    }
+  } else {
+    while (micFftPop(line)) {}                                    // keep the ring drained
+  }
+  if (millis() - sLabelMs >= kLabelMs) {
+    sLabelMs = millis();
+    drawLabels(tft);
+  }
+}
+
+// ─────────────────────────────────────────────────────────────────────────────
+// Lifecycle
+// ─────────────────────────────────────────────────────────────────────────────
+void micSpectOpen() {
+  buildPalette();
+  sUp     = micFftStart();
+  sPaused = false;
+  sDirty  = true;
+}
+
+void micSpectInput(bool a, bool b, bool c, bool& requestExit) {
+  if (c) {
+    micFftStop();
+    scrollReset(tft);
+    sUp = false;
+    requestExit = true;
+    return;
+  }
+  if (a && sUp) {
+    sPaused = !sPaused;
+    sLabelMs = 0;
+  }
+}
@@ -0,0 +1,13 @@
+#pragma once
+#include <Arduino.h>
+#include <TFT_eSPI.h>
+
+// Extras → Mic Spect: microphone spectrogram as a scrolling waterfall fed by
+// Core/mic_fft. The waterfall uses the ST7789 hardware vertical scroll: the
+// panel's scroll axis is the landscape x axis, so each new spectrum line is
+// written as one 135-pixel panel row and the scroll start moves by one,
+// instead of redrawing the image. A = pause / resume, C = exit.
+
+void micSpectOpen();
+void micSpectDraw(TFT_eSPI& tft);
+void micSpectInput(bool a, bool b, bool c, bool& requestExit);
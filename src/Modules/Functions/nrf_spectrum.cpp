@@ -0,0 +1,130 @@
+#include "nrf_spectrum.h"
+#include "../../UserInterface/menus/menu_submenus.h"
+#include "../Core/nrf_scan.h"
+
+#if defined(M5CARDPUTER)
+  static constexpr uint8_t ROT_TOP = 4;
+#else
+  static constexpr uint8_t ROT_TOP = 2;
+#endif
+static constexpr uint8_t ROT_ALT = (ROT_TOP + 1) & 0x3;
+
+static constexpr uint8_t  kSweepsPerDraw = 2;
+static constexpr uint16_t kStatusMs  = 500;
+static constexpr int      kX         = 16;
+static constexpr int      kW         = 208;
+static constexpr int      kTop       = 46;
+static constexpr int      kH         = 66;
+static constexpr int      kAxisY     = kTop + kH + 2;
+
+// RF channel = MHz above 2400
+static const uint8_t kWifi[] = { 12, 37, 62 };           // Wi-Fi 1, 6, 11 centres
+static const uint8_t kBle[]  = { 2, 26, 80 };            // BLE advertising 37, 38, 39
+
+static bool     sDirty = true;
+static bool     sUp    = false;
+static uint8_t  sDrawn[NRF_CHANNELS];                     // bar heights on screen; 0xFF = not drawn
+static uint32_t sStatusMs = 0;
+static uint32_t sRateSweeps = 0, sRateMs = 0, sSweepsPerSec = 0;
+
+static int colX(int ch) { return kX + ch * kW / NRF_CHANNELS; }
+
+// ─────────────────────────────────────────────────────────────────────────────
+// Drawing
+// ─────────────────────────────────────────────────────────────────────────────
+static void drawAxis(TFT_eSPI& tft) {
+  tft.drawFastHLine(kX, kAxisY, kW, TFT_DARKGREY);
+  for (uint8_t ch : kWifi) tft.drawFastVLine(colX(ch), kAxisY, 4, TFT_BLUE);
+  for (uint8_t ch : kBle)  tft.drawFastVLine(colX(ch), kAxisY, 4, TFT_CYAN);
+  tft.setTextSize(1);
+  tft.setTextColor(TFT_DARKGREY, TFT_BLACK);
+  tft.setCursor(kX, kAxisY + 6);
+  tft.print("2400");
+  tft.setCursor(colX(37) - 5, kAxisY + 6);
+  tft.print("wifi6");
+  tft.setCursor(kX + kW - 24, kAxisY + 6);
+  tft.print("2525");
+}
+
+static void drawBars(TFT_eSPI& tft) {
+  const uint16_t* lv = nrfScanLevels();
+  for (uint8_t ch = 0; ch < NRF_CHANNELS; ++ch) {
+    uint8_t h = min<uint32_t>(kH, (uint32_t)lv[ch] * kH / NRF_SCAN_FULL);
+    if (!h && lv[ch]) h = 1;                              // keep a single hit visible
+    if (h == sDrawn[ch]) continue;
+    int x = colX(ch), w = colX(ch + 1) - x;
+    tft.fillRect(x, kTop, w, kH - h, TFT_BLACK);
+    tft.fillRect(x, kTop + kH - h, w, h, h > kH * 3 / 4 ? TFT_RED : h > kH / 3 ? TFT_YELLOW : TFT_GREEN);
+    sDrawn[ch] = h;
+  }
+}
+
+static void drawStatus(TFT_eSPI& tft) {
+  NrfScanStats s = nrfScanStats();
+  uint32_t now = millis();
+  if (now - sRateMs >= 1000) {
+    sSweepsPerSec = (s.sweeps - sRateSweeps) * 1000 / (now - sRateMs);
+    sRateSweeps = s.sweeps;
+    sRateMs     = now;
+  }
+  tft.fillRect(120, 28, 104, 16, TFT_BLACK);
+  tft.setTextSize(1);
+  tft.setTextColor(TFT_SILVER, TFT_BLACK);
+  tft.setCursor(120, 28);
+  tft.printf("%lu.%lums  %lu/s", (unsigned long)(s.lastSweepUs / 1000),
+             (unsigned long)(s.lastSweepUs / 100 % 10), (unsigned long)sSweepsPerSec);
+  tft.setCursor(120, 37);
+  tft.printf("busiest %u MHz", 2400 + s.busiest);
+}
+
+void nrfSpectrumDraw(TFT_eSPI& tft) {
+  if (sDirty) {
+    sDirty = false;
+    tft.setRotation(ROT_TOP);
+    drawOptionsLayerBackground(tft);
+    tft.setRotation(ROT_ALT);
+    tft.setTextSize(2);
+    tft.setTextColor(TFT_WHITE, TFT_BLACK);
+    tft.setCursor(16, 26);
+    tft.print("2.4 GHz");
+    if (!sUp) {
+      tft.setTextSize(1);
+      tft.setTextColor(TFT_RED, TFT_BLACK);
+      tft.setCursor(16, 50);
+      tft.print("No nRF24 module found");
+      return;
+    }
+    memset(sDrawn, 0xFF, sizeof(sDrawn));
+    drawAxis(tft);
+    sStatusMs = 0;
+  }
+  if (!sUp) return;
+
+  for (uint8_t i = 0; i < kSweepsPerDraw; ++i) nrfScanSweep();
+  tft.setRotation(ROT_ALT);
+  drawBars(tft);
+  if (millis() - sStatusMs >= kStatusMs) {
+    sStatusMs = millis();
+    drawStatus(tft);
+  }
+}
+
+// ─────────────────────────────────────────────────────────────────────────────
+// Lifecycle
+// ─────────────────────────────────────────────────────────────────────────────
+void nrfSpectrumOpen() {
+  sUp = nrfScanBegin();
+  sRateSweeps = 0;
+  sRateMs     = millis();
+  sDirty = true;
+}
+
+void nrfSpectrumInput(bool a, bool b, bool c, bool& requestExit) {
+  if (c) {
+    nrfScanEnd();
+    sUp = false;
+    requestExit = true;
+    return;
+  }
+  if (a && sUp) nrfScanClear();
+}
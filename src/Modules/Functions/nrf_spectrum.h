@@ -0,0 +1,12 @@
+#pragma once
+#include <Arduino.h>
+#include <TFT_eSPI.h>
+
+// NRF → Spectrogram: 2.4 GHz channel activity bars from the Core/nrf_scan
+// decaying histogram, with Wi-Fi channel 1 / 6 / 11 and BLE advertising
+// channel markers for spotting what a link is competing with. Only bars
+// whose height changed are redrawn. A = clear, C = stop and exit.
+
+void nrfSpectrumOpen();
+void nrfSpectrumDraw(TFT_eSPI& tft);
+void nrfSpectrumInput(bool a, bool b, bool c, bool& requestExit);
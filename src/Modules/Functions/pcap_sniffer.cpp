@@ -0,0 +1,154 @@
+#include "pcap_sniffer.h"
+#include "../../UserInterface/menus/menu_submenus.h"
+#include "../Core/pcap_capture.h"
+#include "../Core/profile.h"
+#include "../Core/sdcard.h"
+#include <sys/stat.h>
+
+#if defined(M5CARDPUTER)
+  static constexpr uint8_t ROT_TOP = 4;
+#else
+  static constexpr uint8_t ROT_TOP = 2;
+#endif
+static constexpr uint8_t ROT_ALT = (ROT_TOP + 1) & 0x3;
+
+static constexpr const char* kDir       = "/sd/pcap";
+static constexpr uint16_t    kRefreshMs = 500;
+static constexpr uint16_t    kMaxFiles  = 1000;
+
+static bool        sDirty   = true;
+static bool        sRunning = false;
+static uint8_t     sChannel = 1;
+static char        sPath[32];
+static const char* sError   = nullptr;
+static uint32_t    sDrawMs  = 0;
+static uint64_t    sPrevBytes = 0;
+static uint32_t    sPrevMs    = 0;
+
+static bool nextPath() {
+  struct stat st;
+  for (uint16_t i = 0; i < kMaxFiles; ++i) {
+    snprintf(sPath, sizeof(sPath), "%s/cap%03u.pcap", kDir, i);
+    if (stat(sPath, &st) != 0) return true;
+  }
+  return false;
+}
+
+static void start() {
+  sError = nullptr;
+  if (!sdBegin())      { sError = "No SD card"; return; }
+  mkdir(kDir, 0777);
+  if (!nextPath())     { sError = "No free capNNN.pcap name"; return; }
+
+  PcapConfig cfg;
+  cfg.channel = sChannel;
+  cfg.snapLen = (uint16_t)constrain(profileParam(ProfileParam::PCAP_SNAP, 0), 0, 0xFFFF);
+  if (!pcapStart(sPath, cfg)) { sError = "Could not start the capture"; return; }
+  sRunning   = true;
+  sPrevBytes = 0;
+  sPrevMs    = millis();
+}
+
+static void stop() {
+  if (!sRunning) return;
+  if (!pcapStop()) sError = "Write error, capture may be short";
+  sRunning = false;
+}
+
+// ─────────────────────────────────────────────────────────────────────────────
+// Drawing
+// ─────────────────────────────────────────────────────────────────────────────
+static void drawIdle(TFT_eSPI& tft) {
+  tft.setTextSize(1);
+  tft.setTextColor(TFT_WHITE, TFT_BLACK);
+  tft.setCursor(16, 50);
+  tft.printf("Channel %-2u", sChannel);
+  tft.setTextColor(TFT_SILVER, TFT_BLACK);
+  tft.setCursor(16, 66);
+  tft.print("A start  B channel  C exit");
+  if (sPath[0]) {
+    tft.setCursor(16, 82);
+    tft.printf("Last: %s", sPath + strlen(SD_MOUNT));
+  }
+  if (sError) {
+    tft.setTextColor(TFT_RED, TFT_BLACK);
+    tft.setCursor(16, 98);
+    tft.print(sError);
+  }
+}
+
+static void drawRunning(TFT_eSPI& tft) {
+  PcapStats s = pcapStats();
+  uint32_t now = millis();
+  uint32_t dt  = now - sPrevMs;
+  uint32_t kbs = dt ? (uint32_t)((s.bytesWritten - sPrevBytes) * 1000 / 1024 / dt) : 0;
+  sPrevBytes = s.bytesWritten;
+  sPrevMs    = now;
+
+  tft.fillRect(16, 46, 208, 80, TFT_BLACK);
+  tft.setTextSize(1);
+  tft.setTextColor(TFT_WHITE, TFT_BLACK);
+  tft.setCursor(16, 48);
+  tft.printf("%s  ch%u  %lus", sPath + strlen(SD_MOUNT), sChannel, (unsigned long)(s.elapsedMs / 1000));
+  tft.setCursor(16, 62);
+  tft.printf("Frames  %lu", (unsigned long)s.frames);
+  tft.setTextColor(s.droppedFrames ? TFT_YELLOW : TFT_WHITE, TFT_BLACK);
+  tft.setCursor(16, 74);
+  tft.printf("Dropped %lu (%lu KB)", (unsigned long)s.droppedFrames, (unsigned long)(s.droppedBytes / 1024));
+  tft.setTextColor(TFT_WHITE, TFT_BLACK);
+  tft.setCursor(16, 86);
+  tft.printf("Written %lu KB  %lu KB/s", (unsigned long)(s.bytesWritten / 1024), (unsigned long)kbs);
+  tft.setTextColor(s.ringHighPct > 75 ? TFT_YELLOW : TFT_SILVER, TFT_BLACK);
+  tft.setCursor(16, 98);
+  tft.printf("Ring high %u%%  worst write %lu ms", s.ringHighPct, (unsigned long)s.worstWriteMs);
+  if (s.writeError) {
+    tft.setTextColor(TFT_RED, TFT_BLACK);
+    tft.setCursor(16, 112);
+    tft.print("Write error");
+  }
+}
+
+void pcapSnifferDraw(TFT_eSPI& tft) {
+  if (sDirty) {
+    sDirty = false;
+    tft.setRotation(ROT_TOP);
+    drawOptionsLayerBackground(tft);
+    tft.setRotation(ROT_ALT);
+    tft.setTextSize(2);
+    tft.setTextColor(TFT_WHITE, TFT_BLACK);
+    tft.setCursor(16, 26);
+    tft.print("Sniffer");
+    if (!sRunning) { drawIdle(tft); return; }
+    sDrawMs = 0;
+  }
+  if (!sRunning || millis() - sDrawMs < kRefreshMs) return;
+  sDrawMs = millis();
+  tft.setRotation(ROT_ALT);
+  drawRunning(tft);
+}
+
+// ─────────────────────────────────────────────────────────────────────────────
+// Lifecycle
+// ─────────────────────────────────────────────────────────────────────────────
+void pcapSnifferOpen() {
+  sRunning = false;
+  sError   = nullptr;
+  sPath[0] = '\0';
+  sDirty   = true;
+}
+
+void pcapSnifferInput(bool a, bool b, bool c, bool& requestExit) {
+  if (c) {
+    stop();
+    requestExit = true;
+    return;
+  }
+  if (a) {
+    if (sRunning) stop();
+    else          start();
+    sDirty = true;
+  } else if (b && !sRunning) {
+    sChannel = sChannel % 13 + 1;
+    sDirty = true;
+  }
+}
@@ -0,0 +1,11 @@
+#pragma once
+#include <Arduino.h>
+#include <TFT_eSPI.h>
+
+// Wi-Fi → Raw Sniffer: captures one channel to /sd/pcap/capNNN.pcap through
+// Core/pcap_capture and shows frames, drops and write throughput.
+// Idle: A = start, B = next channel. Running: A = stop. C = stop and exit.
+
+void pcapSnifferOpen();
+void pcapSnifferDraw(TFT_eSPI& tft);
+void pcapSnifferInput(bool a, bool b, bool c, bool& requestExit);
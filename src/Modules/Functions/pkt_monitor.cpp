@@ -0,0 +1,176 @@
+#include "pkt_monitor.h"
+#include "../../UserInterface/menus/menu_submenus.h"
+#include "../Core/pkt_stats.h"
+
+#if defined(M5CARDPUTER)
+  static constexpr uint8_t ROT_TOP = 4;
+#else
+  static constexpr uint8_t ROT_TOP = 2;
+#endif
+static constexpr uint8_t ROT_ALT = (ROT_TOP + 1) & 0x3;
+
+static constexpr uint16_t kRefreshMs = 250;
+static constexpr uint16_t kMinDwell  = 200;     // ms of new listening before a rate is trusted
+static constexpr int      kChartX    = 18;
+static constexpr int      kChartTop  = 44;
+static constexpr int      kChartH    = 72;
+static constexpr int      kPitch     = 16;
+static constexpr int      kBarW      = 12;
+static constexpr uint8_t  kGroups    = 5;
+static constexpr uint32_t kMinScale  = 20;      // frames/s at full height
+
+// Stacked bottom to top; MISC is folded into other management
+static const uint16_t kGroupColor[kGroups] = { TFT_BLUE, TFT_CYAN, TFT_MAGENTA, TFT_YELLOW, TFT_GREEN };
+
+static bool     sDirty = true;
+static bool     sUp    = false;
+static uint32_t sDrawMs = 0;
+static uint32_t sPrevFrames[PKT_CHANNELS + 1][kGroups];
+static uint32_t sPrevDwell[PKT_CHANNELS + 1];
+static uint32_t sRate[PKT_CHANNELS + 1][kGroups];      // frames/s over the last dwell
+static uint8_t  sDrawn[PKT_CHANNELS + 1][kGroups];     // segment heights on screen
+static uint32_t sScale = kMinScale;
+static uint8_t  sShownChannel = 0;
+
+static void groupFrames(const PktChannelStats& c, uint32_t out[kGroups]) {
+  out[0] = c.frames[(uint8_t)PktType::BEACON];
+  out[1] = c.frames[(uint8_t)PktType::PROBE];
+  out[2] = c.frames[(uint8_t)PktType::MGMT] + c.frames[(uint8_t)PktType::MISC];
+  out[3] = c.frames[(uint8_t)PktType::CTRL];
+  out[4] = c.frames[(uint8_t)PktType::DATA];
+}
+
+// ─────────────────────────────────────────────────────────────────────────────
+// Drawing
+// ─────────────────────────────────────────────────────────────────────────────
+static void drawBar(TFT_eSPI& tft, uint8_t ch, const uint8_t h[kGroups]) {
+  const int x = kChartX + (ch - 1) * kPitch;
+  int y = kChartTop + kChartH;
+  int total = 0;
+  for (uint8_t g = 0; g < kGroups; ++g) total += h[g];
+  tft.fillRect(x, kChartTop, kBarW, kChartH - total, TFT_BLACK);
+  for (uint8_t g = 0; g < kGroups; ++g) {
+    if (!h[g]) continue;
+    y -= h[g];
+    tft.fillRect(x, y, kBarW, h[g], kGroupColor[g]);
+  }
+}
+
+static void drawLabels(TFT_eSPI& tft, uint8_t tuned) {
+  tft.setTextSize(1);
+  for (uint8_t ch = 1; ch <= PKT_CHANNELS; ++ch) {
+    tft.setTextColor(ch == tuned ? TFT_WHITE : TFT_DARKGREY, TFT_BLACK);
+    tft.setCursor(kChartX + (ch - 1) * kPitch + (ch < 10 ? 3 : 0), kChartTop + kChartH + 3);
+    tft.print(ch);
+  }
+}
+
+static void drawStatus(TFT_eSPI& tft, const PktStatsSnapshot& s) {
+  uint32_t fps = 0;
+  for (uint8_t g = 0; g < kGroups; ++g) fps += sRate[s.channel][g];
+  tft.fillRect(84, 28, 140, 12, TFT_BLACK);
+  tft.setTextSize(1);
+  tft.setTextColor(s.hopping ? TFT_SILVER : TFT_YELLOW, TFT_BLACK);
+  tft.setCursor(84, 30);
+  tft.printf("ch%-2u %s %lu/s  max %lu", s.channel, s.hopping ? "hop " : "LOCK",
+             (unsigned long)fps, (unsigned long)sScale);
+}
+
+void pktMonitorDraw(TFT_eSPI& tft) {
+  if (sDirty) {
+    sDirty = false;
+    tft.setRotation(ROT_TOP);
+    drawOptionsLayerBackground(tft);
+    tft.setRotation(ROT_ALT);
+    tft.setTextSize(2);
+    tft.setTextColor(TFT_WHITE, TFT_BLACK);
+    tft.setCursor(16, 26);
+    tft.print("Pkts");
+    if (!sUp) {
+      tft.setTextSize(1);
+      tft.setTextColor(TFT_RED, TFT_BLACK);
+      tft.setCursor(16, 50);
+      tft.print("Could not start promiscuous mode");
+      return;
+    }
+    memset(sDrawn, 0xFF, sizeof(sDrawn));     // force every bar
+    sShownChannel = 0;
+    sDrawMs = 0;
+  }
+  if (!sUp || millis() - sDrawMs < kRefreshMs) return;
+  sDrawMs = millis();
+
+  PktStatsSnapshot s;
+  pktStatsSnapshot(s);
+
+  uint32_t peak = 0;
+  for (uint8_t ch = 1; ch <= PKT_CHANNELS; ++ch) {
+    const PktChannelStats& c = s.ch[ch];
+    uint32_t dwell = c.dwellMs - sPrevDwell[ch];
+    if (dwell >= kMinDwell) {
+      uint32_t f[kGroups];
+      groupFrames(c, f);
+      for (uint8_t g = 0; g < kGroups; ++g) {
+        sRate[ch][g] = (f[g] - sPrevFrames[ch][g]) * 1000 / dwell;
+        sPrevFrames[ch][g] = f[g];
+      }
+      sPrevDwell[ch] = c.dwellMs;
+    }
+    uint32_t sum = 0;
+    for (uint8_t g = 0; g < kGroups; ++g) sum += sRate[ch][g];
+    peak = max(peak, sum);
+  }
+
+  // Grow at once, shrink slowly so bars don't jump every sweep
+  if (peak > sScale)          sScale = peak + peak / 4;
+  else if (peak < sScale / 2) sScale = max(kMinScale, sScale - sScale / 16);
+
+  tft.setRotation(ROT_ALT);
+  for (uint8_t ch = 1; ch <= PKT_CHANNELS; ++ch) {
+    uint8_t h[kGroups];
+    bool same = true;
+    uint32_t acc = 0, prevTop = 0;
+    for (uint8_t g = 0; g < kGroups; ++g) {                 // cumulative, so rounding never overflows
+      acc += sRate[ch][g];
+      uint32_t top = min<uint32_t>(kChartH, acc * kChartH / sScale);
+      h[g] = (uint8_t)(top - prevTop);
+      prevTop = top;
+      same &= h[g] == sDrawn[ch][g];
+    }
+    if (same) continue;
+    drawBar(tft, ch, h);
+    memcpy(sDrawn[ch], h, sizeof(h));
+  }
+  if (s.channel != sShownChannel) {
+    sShownChannel = s.channel;
+    drawLabels(tft, s.channel);
+  }
+  drawStatus(tft, s);
+}
+
+// ─────────────────────────────────────────────────────────────────────────────
+// Lifecycle
+// ─────────────────────────────────────────────────────────────────────────────
+void pktMonitorOpen() {
+  memset(sPrevFrames, 0, sizeof(sPrevFrames));
+  memset(sPrevDwell, 0, sizeof(sPrevDwell));
+  memset(sRate, 0, sizeof(sRate));
+  sScale = kMinScale;
+  sUp    = pktStatsStart();
+  sDirty = true;
+}
+
+void pktMonitorInput(bool a, bool b, bool c, bool& requestExit) {
+  if (c) {
+    pktStatsStop();
+    sUp = false;
+    requestExit = true;
+    return;
+  }
+  if (!sUp) return;
+  PktStatsSnapshot s;
+  if (a || b) pktStatsSnapshot(s);
+  if (a) pktStatsLock(s.hopping ? s.channel : 0);
+  else if (b && !s.hopping) pktStatsLock(s.channel % PKT_CHANNELS + 1);
+  if (a || b) sDrawMs = 0;
+}
@@ -0,0 +1,12 @@
+#pragma once
+#include <Arduino.h>
+#include <TFT_eSPI.h>
+
+// Wi-Fi → Packet Scan: per-channel frame rate bars (beacon / probe / other
+// management / control / data stacked) from Core/pkt_stats snapshots.
+// A = lock / unlock the current channel, B = next channel while locked,
+// C = stop and exit.
+
+void pktMonitorOpen();
+void pktMonitorDraw(TFT_eSPI& tft);
+void pktMonitorInput(bool a, bool b, bool c, bool& requestExit);
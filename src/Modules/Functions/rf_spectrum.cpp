@@ -0,0 +1,243 @@
+#include "rf_spectrum.h"
+#include "../../UserInterface/menus/menu_submenus.h"
+#include "../Core/rf_sweep.h"
+
+#if defined(M5CARDPUTER)
+  static constexpr uint8_t ROT_TOP = 4;
+#else
+  static constexpr uint8_t ROT_TOP = 2;
+#endif
+static constexpr uint8_t ROT_ALT = (ROT_TOP + 1) & 0x3;
+
+static constexpr uint32_t kSliceUs   = 15000;   // radio time per draw call
+static constexpr uint16_t kStatusMs  = 500;
+static constexpr int      kX         = 16;
+static constexpr int      kCols      = 208;
+static constexpr int      kWfTop     = 88;
+static constexpr int      kWfRows    = 128 - kWfTop;
+static constexpr int8_t   kMinDb     = -110;
+static constexpr int8_t   kMaxDb     = -30;
+
+// Default dwell is the RSSI settling time for the 203 kHz filter plus margin
+static constexpr RfBand kBand315 = { 300000000, 348000000, 200000, 300 };
+static constexpr RfBand kBand433 = { 387000000, 464000000, 200000, 300 };
+static constexpr RfBand kBand868 = { 779000000, 928000000, 200000, 300 };
+
+struct BandPreset {
+  const char* name;
+  RfBand      bands[3];
+  uint8_t     count;
+};
+
+static const BandPreset kPresets[] = {
+  { "433", { kBand433 }, 1 },
+  { "315", { kBand315 }, 1 },
+  { "868/915", { kBand868 }, 1 },
+  { "All", { kBand315, kBand433, kBand868 }, 3 },
+};
+static constexpr uint8_t kPresetCount = sizeof(kPresets) / sizeof(kPresets[0]);
+
+enum class View : uint8_t { FIND, SPECTRUM };
+
+static View     sView    = View::SPECTRUM;
+static uint8_t  sPreset  = 0;
+static bool     sDirty   = true;
+static bool     sStart   = false;          // (re)start the sweep on the next draw
+static bool     sUp      = false;
+static uint32_t sShownGen = 0;
+static uint32_t sStatusMs = 0;
+static uint8_t  sBar[kCols], sPeak[kCols];          // on screen; 0xFF = not drawn
+static int      sWfRow   = 0;
+static uint16_t sPalette[64];
+static uint16_t sLine[kCols];
+
+// ─────────────────────────────────────────────────────────────────────────────
+// Helpers
+// ─────────────────────────────────────────────────────────────────────────────
+static int barTop() { return sView == View::FIND ? 100 : 46; }
+static int barH()   { return sView == View::FIND ? 28 : 40; }
+
+static int scaled(int8_t dbm, int full) {
+  int v = ((int)dbm - kMinDb) * full / (kMaxDb - kMinDb);
+  return constrain(v, 0, full);
+}
+
+// Max over the channels that fall into a screen column
+static int8_t columnMax(const int8_t* dbm, int col) {
+  uint16_t n  = rfSweepChannels();
+  uint16_t lo = (uint32_t)col * n / kCols;
+  uint16_t hi = max<uint16_t>(lo + 1, (uint32_t)(col + 1) * n / kCols);
+  int8_t m = dbm[lo];
+  for (uint16_t ch = lo + 1; ch < hi; ++ch) m = max(m, dbm[ch]);
+  return m;
+}
+
+static uint16_t strongest(const int8_t* dbm) {
+  uint16_t best = 0;
+  for (uint16_t ch = 1; ch < rfSweepChannels(); ++ch) {
+    if (dbm[ch] > dbm[best]) best = ch;
+  }
+  return best;
+}
+
+// dark blue → cyan → yellow → red
+static void buildPalette() {
+  static const uint8_t kStops[][3] = { { 0, 0, 48 }, { 0, 160, 200 }, { 255, 230, 0 }, { 255, 0, 0 } };
+  constexpr int kSegs = sizeof(kStops) / sizeof(kStops[0]) - 1;
+  for (int i = 0; i < 64; ++i) {
+    int s = i * kSegs / 64, f = i * kSegs % 64;
+    uint8_t c[3];
+    for (int k = 0; k < 3; ++k) c[k] = kStops[s][k] + (kStops[s + 1][k] - kStops[s][k]) * f / 64;
+    sPalette[i] = ((c[0] & 0xF8) << 8) | ((c[1] & 0xFC) << 3) | (c[2] >> 3);
+  }
+}
+
+// ─────────────────────────────────────────────────────────────────────────────
+// Drawing
+// ─────────────────────────────────────────────────────────────────────────────
+// Only columns whose bar or peak dot moved are touched
+static void drawBars(TFT_eSPI& tft) {
+  const int8_t* lv = rfSweepLevels();
+  const int8_t* pk = rfSweepPeaks();
+  const int top = barTop(), h = barH();
+  for (int c = 0; c < kCols; ++c) {
+    uint8_t bar  = scaled(columnMax(lv, c), h);
+    uint8_t peak = scaled(columnMax(pk, c), h - 1);
+    if (bar == sBar[c] && peak == sPeak[c]) continue;
+    int x = kX + c;
+    tft.drawFastVLine(x, top, h - bar, TFT_BLACK);
+    tft.drawFastVLine(x, top + h - bar, bar, TFT_DARKGREEN);
+    if (peak >= bar) tft.drawPixel(x, top + h - 1 - peak, TFT_YELLOW);
+    sBar[c]  = bar;
+    sPeak[c] = peak;
+  }
+}
+
+// One row per sweep at a rolling position, with a marker on the next row
+static void drawWaterfallRow(TFT_eSPI& tft) {
+  const int8_t* lv = rfSweepLevels();
+  for (int c = 0; c < kCols; ++c) sLine[c] = sPalette[scaled(columnMax(lv, c), 63)];
+  bool swap = tft.getSwapBytes();
+  tft.setSwapBytes(true);
+  tft.pushImage(kX, kWfTop + sWfRow, kCols, 1, sLine);
+  tft.setSwapBytes(swap);
+  sWfRow = (sWfRow + 1) % kWfRows;
+  tft.drawFastHLine(kX, kWfTop + sWfRow, kCols, TFT_WHITE);
+}
+
+static void drawFind(TFT_eSPI& tft) {
+  const int8_t* lv = rfSweepLevels();
+  const int8_t* pk = rfSweepPeaks();
+  uint16_t now = strongest(lv), held = strongest(pk);
+  uint32_t hz = rfSweepFreqHz(now);
+  tft.setTextSize(3);
+  tft.setTextColor(TFT_WHITE, TFT_BLACK);
+  tft.setCursor(kX, 50);
+  tft.printf("%3lu.%02lu", (unsigned long)(hz / 1000000), (unsigned long)(hz / 10000 % 100));
+  tft.setTextSize(1);
+  tft.setCursor(kX + 112, 50);
+  tft.print("MHz");
+  tft.setTextColor(lv[now] > -70 ? TFT_GREEN : TFT_SILVER, TFT_BLACK);
+  tft.setCursor(kX + 112, 64);
+  tft.printf("%4d dBm", lv[now]);
+  hz = rfSweepFreqHz(held);
+  tft.setTextColor(TFT_YELLOW, TFT_BLACK);
+  tft.setCursor(kX, 82);
+  tft.printf("max %3lu.%02lu MHz %4d dBm  ", (unsigned long)(hz / 1000000),
+             (unsigned long)(hz / 10000 % 100), pk[held]);
+}
+
+static void drawStatus(TFT_eSPI& tft) {
+  RfSweepStats s = rfSweepStats();
+  tft.fillRect(120, 28, 104, 16, TFT_BLACK);
+  tft.setTextSize(1);
+  tft.setTextColor(TFT_SILVER, TFT_BLACK);
+  tft.setCursor(120, 28);
+  tft.printf("%s %luch/s", kPresets[sPreset].name, (unsigned long)s.chPerSec);
+  tft.setCursor(120, 37);
+  tft.printf("%lums %u.%02uB/hop", (unsigned long)s.lastSweepMs,
+             s.regBytesX100 / 100, s.regBytesX100 % 100);
+}
+
+void rfSpectrumDraw(TFT_eSPI& tft) {
+  if (sDirty) {
+    sDirty = false;
+    tft.setRotation(ROT_TOP);
+    drawOptionsLayerBackground(tft);
+    tft.setRotation(ROT_ALT);
+    tft.setTextSize(2);
+    tft.setTextColor(TFT_WHITE, TFT_BLACK);
+    tft.setCursor(16, 26);
+    tft.print(sView == View::FIND ? "Find Fq" : "Spectrum");
+    if (sStart) {
+      tft.setTextSize(1);
+      tft.setTextColor(TFT_SILVER, TFT_BLACK);
+      tft.setCursor(16, 50);
+      tft.print("Calibrating...");
+      const BandPreset& p = kPresets[sPreset];
+      sUp = rfSweepBegin(p.bands, p.count);
+      sStart = false;
+      tft.fillRect(16, 50, 208, 8, TFT_BLACK);
+    }
+    if (!sUp) {
+      tft.setTextSize(1);
+      tft.setTextColor(TFT_RED, TFT_BLACK);
+      tft.setCursor(16, 50);
+      tft.print("Could not start the CC1101");
+      return;
+    }
+    memset(sBar, 0xFF, sizeof(sBar));
+    memset(sPeak, 0xFF, sizeof(sPeak));
+    sWfRow    = 0;
+    sShownGen = rfSweepGeneration();
+    sStatusMs = 0;
+  }
+  if (!sUp) return;
+
+  rfSweepRun(kSliceUs);
+  tft.setRotation(ROT_ALT);
+  drawBars(tft);
+  uint32_t gen = rfSweepGeneration();
+  if (gen != sShownGen) {
+    sShownGen = gen;
+    if (sView == View::SPECTRUM) drawWaterfallRow(tft);
+    else drawFind(tft);
+  }
+  if (millis() - sStatusMs >= kStatusMs) {
+    sStatusMs = millis();
+    drawStatus(tft);
+  }
+}
+
+// ─────────────────────────────────────────────────────────────────────────────
+// Lifecycle
+// ─────────────────────────────────────────────────────────────────────────────
+static void open(View v) {
+  buildPalette();
+  sView  = v;
+  sUp    = false;
+  sStart = true;
+  sDirty = true;
+}
+
+void rfSpectrumOpenFindFq()     { open(View::FIND); }
+void rfSpectrumOpenSpectogram() { open(View::SPECTRUM); }
+
+void rfSpectrumInput(bool a, bool b, bool c, bool& requestExit) {
+  if (c) {
+    rfSweepEnd();
+    sUp = false;
+    requestExit = true;
+    return;
+  }
+  if (!sUp) return;
+  if (a) {
+    rfSweepClearPeaks();
+    sShownGen = 0;                      // redraw the readout now
+  }
+  if (b) {
+    sPreset = (sPreset + 1) % kPresetCount;
+    sStart  = true;
+    sDirty  = true;
+  }
+}
@@ -0,0 +1,16 @@
+#pragma once
+#include <Arduino.h>
+#include <TFT_eSPI.h>
+
+// RF → Find Fq and RF → Spectogram, both driven by the Core/rf_sweep CC1101
+// RSSI sweep. Spectogram shows bars with peak-hold dots over a rolling
+// waterfall (one row per completed sweep); Find Fq shows the strongest
+// channel of the last sweep and the strongest peak held since the last reset.
+// The sweep runs in slices from the draw loop, since the radio and the
+// display share one SPI bus.
+// A = reset peak hold, B = next band, C = stop and exit.
+
+void rfSpectrumOpenFindFq();
+void rfSpectrumOpenSpectogram();
+void rfSpectrumDraw(TFT_eSPI& tft);
+void rfSpectrumInput(bool a, bool b, bool c, bool& requestExit);
@@ -0,0 +1,191 @@
+#include "rf_visualizer.h"
+#include "../../UserInterface/menus/menu_submenus.h"
+#include "../Core/ook_rx.h"
+#include "../Core/sdcard.h"
+#include "../Core/storage.h"
+#include <sys/stat.h>
+
+#if defined(M5CARDPUTER)
+  static constexpr uint8_t ROT_TOP = 4;
+#else
+  static constexpr uint8_t ROT_TOP = 2;
+#endif
+static constexpr uint8_t ROT_ALT = (ROT_TOP + 1) & 0x3;
+
+static constexpr uint16_t kRefreshMs = 1000;      // ages tick even without traffic
+static constexpr uint16_t kNoteMs    = 3000;
+static constexpr int      kX         = 16;
+static constexpr int      kW         = 208;
+static constexpr int      kWaveTop   = 48;
+static constexpr int      kWaveH     = 12;
+static constexpr int      kListTop   = 66;
+static constexpr uint8_t  kRows      = 7;
+
+static const uint32_t kFreqs[] = { 433920000, 315000000, 868350000, 915000000 };
+static constexpr uint8_t kFreqCount = sizeof(kFreqs) / sizeof(kFreqs[0]);
+
+static bool        sDirty   = true;
+static bool        sUp      = false;
+static uint8_t     sFreq    = 0;
+static uint32_t    sShownGen = 0;
+static uint32_t    sDrawMs  = 0;
+static const char* sNote    = nullptr;
+static uint32_t    sNoteMs  = 0;
+static OokPulses   sTrain;                         // 4 KB: keep it off the UI stack
+
+// ─────────────────────────────────────────────────────────────────────────────
+// Saving
+// ─────────────────────────────────────────────────────────────────────────────
+static void note(const char* text) {
+  sNote   = text;
+  sNoteMs = millis();
+}
+
+static void saveTrain() {
+  if (!ookRxLastTrain(sTrain)) { note("Nothing received yet"); return; }
+  const char* root = sdBegin() ? SD_MOUNT : storageBegin() ? "/littlefs" : nullptr;
+  if (!root) { note("No storage"); return; }
+  char dir[24], path[40];
+  snprintf(dir, sizeof(dir), "%s/ook", root);
+  mkdir(dir, 0777);
+  snprintf(path, sizeof(path), "%s/train.ook", dir);
+  FILE* f = fopen(path, "a");
+  if (!f) { note("Could not open train.ook"); return; }
+  fseek(f, 0, SEEK_END);                           // header only for a new file
+  bool ok = ookWritePulses(f, sTrain);
+  ok &= fclose(f) == 0;
+  note(ok ? "Train saved" : "Write error");
+}
+
+// ─────────────────────────────────────────────────────────────────────────────
+// Drawing
+// ─────────────────────────────────────────────────────────────────────────────
+// Whole train scaled to the strip width; every pulse gets at least a pixel
+static void drawWave(TFT_eSPI& tft) {
+  tft.fillRect(kX, kWaveTop, kW, kWaveH, TFT_BLACK);
+  if (!ookRxLastTrain(sTrain)) {
+    tft.drawFastHLine(kX, kWaveTop + kWaveH - 1, kW, TFT_DARKGREY);
+    return;
+  }
+  uint32_t total = 0;
+  for (uint16_t i = 0; i < sTrain.count; ++i) total += sTrain.pulse[i] + sTrain.gap[i];
+  tft.drawFastHLine(kX, kWaveTop + kWaveH - 1, kW, TFT_DARKGREEN);
+  uint32_t t = 0;
+  for (uint16_t i = 0; i < sTrain.count; ++i) {
+    int x0 = kX + (uint64_t)t * kW / total;
+    int x1 = kX + (uint64_t)(t + sTrain.pulse[i]) * kW / total;
+    tft.fillRect(x0, kWaveTop, max(1, x1 - x0), kWaveH - 1, TFT_GREEN);
+    t += sTrain.pulse[i] + sTrain.gap[i];
+  }
+}
+
+static void drawRow(TFT_eSPI& tft, int y, const OokRxEntry& e, uint32_t now) {
+  const OokReading& r = e.reading;
+  tft.setCursor(kX, y);
+  tft.setTextColor(TFT_WHITE, TFT_BLACK);
+  tft.printf("%s %lX", r.model, (unsigned long)r.id);
+  tft.setTextColor(TFT_SILVER, TFT_BLACK);
+  if (r.flags & OOK_HAS_CHANNEL) tft.printf(" c%u", r.channel);
+  if (r.flags & OOK_HAS_TEMP)    tft.printf(" %d.%uC", r.tempC10 / 10, abs(r.tempC10) % 10);
+  if (r.flags & OOK_HAS_HUMIDITY) tft.printf(" %u%%", r.humidity);
+  else if (r.flags & OOK_HAS_STATE) tft.printf(" %02X", r.state);
+  if (r.flags & OOK_BATTERY_LOW) {
+    tft.setTextColor(TFT_RED, TFT_BLACK);
+    tft.print(" bat");
+  }
+  tft.setTextColor(TFT_DARKGREY, TFT_BLACK);
+  tft.setCursor(kX + kW - 30, y);
+  tft.printf("%4lus", (unsigned long)min<uint32_t>(9999, (now - e.lastMs) / 1000));
+}
+
+static void drawList(TFT_eSPI& tft) {
+  OokRxEntry rows[kRows];
+  uint8_t n = ookRxList(rows, kRows);
+  uint32_t now = millis();
+  tft.fillRect(kX, kListTop, kW, kRows * 9, TFT_BLACK);
+  tft.setTextSize(1);
+  if (!n) {
+    tft.setTextColor(TFT_DARKGREY, TFT_BLACK);
+    tft.setCursor(kX, kListTop);
+    tft.print("Listening...");
+    return;
+  }
+  for (uint8_t i = 0; i < n; ++i) drawRow(tft, kListTop + i * 9, rows[i], now);
+}
+
+static void drawStatus(TFT_eSPI& tft) {
+  OokRxStats s = ookRxStats();
+  tft.fillRect(120, 28, 104, 16, TFT_BLACK);
+  tft.setTextSize(1);
+  tft.setTextColor(TFT_SILVER, TFT_BLACK);
+  tft.setCursor(120, 28);
+  tft.printf("%lu.%02lu MHz", (unsigned long)(kFreqs[sFreq] / 1000000),
+             (unsigned long)(kFreqs[sFreq] / 10000 % 100));
+  tft.setCursor(120, 37);
+  if (sNote && millis() - sNoteMs >= kNoteMs) sNote = nullptr;
+  tft.setTextColor(sNote ? TFT_YELLOW : TFT_SILVER, TFT_BLACK);
+  if (sNote) tft.print(sNote);
+  else       tft.printf("%lu trn %lu dec", (unsigned long)s.trains, (unsigned long)s.readings);
+}
+
+void rfVisualizerDraw(TFT_eSPI& tft) {
+  if (sDirty) {
+    sDirty = false;
+    tft.setRotation(ROT_TOP);
+    drawOptionsLayerBackground(tft);
+    tft.setRotation(ROT_ALT);
+    tft.setTextSize(2);
+    tft.setTextColor(TFT_WHITE, TFT_BLACK);
+    tft.setCursor(16, 26);
+    tft.print("OOK RX");
+    if (!sUp) {
+      tft.setTextSize(1);
+      tft.setTextColor(TFT_RED, TFT_BLACK);
+      tft.setCursor(16, 50);
+      tft.print("Could not start the CC1101");
+      return;
+    }
+    sShownGen = ookRxGeneration() - 1;            // draw everything once
+    sDrawMs = 0;
+  }
+  if (!sUp) return;
+
+  uint32_t gen = ookRxGeneration();
+  bool fresh = gen != sShownGen;
+  if (!fresh && millis() - sDrawMs < kRefreshMs) return;
+  sShownGen = gen;
+  sDrawMs = millis();
+  tft.setRotation(ROT_ALT);
+  if (fresh) drawWave(tft);
+  drawList(tft);
+  drawStatus(tft);
+}
+
+// ─────────────────────────────────────────────────────────────────────────────
+// Lifecycle
+// ─────────────────────────────────────────────────────────────────────────────
+void rfVisualizerOpen() {
+  sNote  = nullptr;
+  sUp    = ookRxStart(kFreqs[sFreq]);
+  sDirty = true;
+}
+
+void rfVisualizerInput(bool a, bool b, bool c, bool& requestExit) {
+  if (c) {
+    ookRxStop();
+    sUp = false;
+    requestExit = true;
+    return;
+  }
+  if (!sUp) return;
+  if (a) {
+    sFreq = (sFreq + 1) % kFreqCount;
+    ookRxStop();
+    ookRxClear();
+    rfVisualizerOpen();
+  }
+  if (b) {
+    saveTrain();
+    sDrawMs = 0;
+  }
+}
@@ -0,0 +1,13 @@
+#pragma once
+#include <Arduino.h>
+#include <TFT_eSPI.h>
+
+// RF → RF Visualizer: the last OOK pulse train received by Core/ook_rx as a
+// waveform strip, and the live list of decoded sensors and remotes (newest
+// first, with repeat count and age). A = next frequency (433.92 / 315 /
+// 868.35 / 915 MHz), B = append the last train to ook/train.ook on SD, or on
+// LittleFS without a card, for replay with tools/ook_bench, C = exit.
+
+void rfVisualizerOpen();
+void rfVisualizerDraw(TFT_eSPI& tft);
+void rfVisualizerInput(bool a, bool b, bool c, bool& requestExit);
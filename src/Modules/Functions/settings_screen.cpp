@@ -0,0 +1,133 @@
+#include "settings_screen.h"
+#include "../../UserInterface/menus/menu_submenus.h"
+#include "../Core/backlight.h"
+#include <time.h>
+
+#if defined(M5CARDPUTER)
+  #include <M5Cardputer.h>
+  static constexpr uint8_t ROT_TOP = 4;
+  #define SPEAKER M5Cardputer.Speaker
+#else
+  #include <M5StickCPlus2.h>
+  static constexpr uint8_t ROT_TOP = 2;
+  #define SPEAKER M5.Speaker
+#endif
+static constexpr uint8_t ROT_ALT = (ROT_TOP + 1) & 0x3;
+
+static constexpr uint8_t kMaxFields = 4;
+
+static Setting sFields[kMaxFields];
+static uint8_t sFieldCount = 0;
+static uint8_t sField      = 0;
+static bool    sDirty      = true;   // full redraw
+static bool    sValueDirty = false;  // value + bar only
+
+// ─────────────────────────────────────────────────────────────────────────────
+// Applying values
+// ─────────────────────────────────────────────────────────────────────────────
+static void applyTimeZone() {
+  // POSIX TZ sign is inverted: UTC+2 is "UTC-2"
+  char tz[12];
+  snprintf(tz, sizeof(tz), "UTC%+ld", -(long)settingsGet(Setting::UTC_OFFSET));
+  setenv("TZ", tz, 1);
+  tzset();
+}
+
+static void applyAudio() {
+  uint8_t vol = settingsGetBool(Setting::AUDIO) ? settingsGet(Setting::VOLUME) : 0;
+  SPEAKER.setVolume((uint16_t)vol * 255 / 100);
+}
+
+static void apply(Setting s) {
+  switch (s) {
+    case Setting::BRIGHTNESS: backlightApply(); break;
+    case Setting::AUDIO:
+    case Setting::VOLUME:     applyAudio(); break;
+    case Setting::UTC_OFFSET: applyTimeZone(); break;
+    default: break;           // theme/bat saver/pins are read where they're used
+  }
+}
+
+void settingsApplyAfterBoot() {
+  applyTimeZone();
+  applyAudio();
+}
+
+// ─────────────────────────────────────────────────────────────────────────────
+// Drawing
+// ─────────────────────────────────────────────────────────────────────────────
+static void drawValue(TFT_eSPI& tft) {
+  const Setting     s = sFields[sField];
+  const SettingDef& d = settingsDef(s);
+
+  char buf[16];
+  settingsFormat(s, buf, sizeof(buf));
+  tft.fillRect(16, 52, 208, 48, TFT_BLACK);
+  tft.setTextSize(3);
+  tft.setTextColor(TFT_WHITE, TFT_BLACK);
+  tft.setCursor(120 - tft.textWidth(buf) / 2, 56);
+  tft.print(buf);
+
+  if (d.type == SettingType::INT) {
+    const int x = 24, y = 88, w = 192, h = 8;
+    int fill = (w - 2) * (settingsGet(s) - d.min) / (d.max - d.min);
+    tft.drawRoundRect(x, y, w, h, 3, TFT_DARKGREY);
+    tft.fillRect(x + 1, y + 1, fill, h - 2, TFT_WHITE);
+  }
+}
+
+void settingsScreenDraw(TFT_eSPI& tft) {
+  if (sDirty) {
+    tft.setRotation(ROT_TOP);
+    drawOptionsLayerBackground(tft);
+    tft.setRotation(ROT_ALT);
+
+    tft.setTextSize(2);
+    tft.setTextColor(TFT_WHITE, TFT_BLACK);
+    tft.setCursor(16, 26);
+    tft.print(settingsDef(sFields[sField]).label);
+    if (sFieldCount > 1) {
+      tft.setTextSize(1);
+      tft.setTextColor(TFT_DARKGREY, TFT_BLACK);
+      tft.setCursor(200, 30);
+      tft.printf("%u/%u", sField + 1, sFieldCount);
+    }
+
+    tft.setTextSize(1);
+    tft.setTextColor(TFT_SILVER, TFT_BLACK);
+    tft.setCursor(16, 110);
+    tft.print(sField + 1 < sFieldCount ? "A -   B +   C next" : "A -   B +   C done");
+    sDirty = false;
+    sValueDirty = true;
+  }
+  if (sValueDirty) {
+    tft.setRotation(ROT_ALT);
+    drawValue(tft);
+    sValueDirty = false;
+  }
+}
+
+// ─────────────────────────────────────────────────────────────────────────────
+// Lifecycle
+// ─────────────────────────────────────────────────────────────────────────────
+void settingsScreenOpen(const Setting* fields, uint8_t count) {
+  sFieldCount = min(count, kMaxFields);
+  memcpy(sFields, fields, sFieldCount * sizeof(Setting));
+  sField = 0;
+  sDirty = true;
+}
+
+void settingsScreenInput(bool a, bool b, bool c, bool& requestExit) {
+  if (c) {
+    if (++sField >= sFieldCount) { requestExit = true; return; }
+    sDirty = true;
+    return;
+  }
+  if (!a && !b) return;
+
+  const Setting s = sFields[sField];
+  settingsStep(s, b ? 1 : -1);
+  apply(s);
+  if (settingsGetBool(Setting::AUDIO)) SPEAKER.tone(4000, 15);
+  sValueDirty = true;
+}
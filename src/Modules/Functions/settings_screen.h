@@ -0,0 +1,14 @@
+#pragma once
+#include <Arduino.h>
+#include <TFT_eSPI.h>
+#include "../Core/settings.h"
+
+// Settings → value editor. A = previous value, B = next value,
+// C = next field / exit after the last one. Changes apply live; the
+// registry commits them to NVS once the value stops moving.
+
+void settingsScreenOpen(const Setting* fields, uint8_t count);
+void settingsScreenDraw(TFT_eSPI& tft);
+void settingsScreenInput(bool a, bool b, bool c, bool& requestExit);
+
+void settingsApplyAfterBoot();     // keys not needed for the first frame
@@ -0,0 +1,152 @@
+#include "wardriver.h"
+#include "../../UserInterface/menus/menu_submenus.h"
+#include "../Core/wardrive.h"
+#include "../Core/gps.h"
+#include "../Core/sdcard.h"
+#include <sys/stat.h>
+
+#if defined(M5CARDPUTER)
+  static constexpr uint8_t ROT_TOP = 4;
+#else
+  static constexpr uint8_t ROT_TOP = 2;
+#endif
+static constexpr uint8_t ROT_ALT = (ROT_TOP + 1) & 0x3;
+
+static constexpr const char* kDir       = "/sd/wardrive";
+static constexpr uint16_t    kRefreshMs = 500;
+static constexpr uint16_t    kMaxFiles  = 1000;
+
+static bool        sDirty   = true;
+static bool        sRunning = false;
+static char        sPath[32];
+static const char* sError   = nullptr;
+static uint32_t    sDrawMs  = 0;
+static uint32_t    sFixes   = 0;        // gpsSnapshot() count last handed on
+
+static bool nextPath() {
+  struct stat st;
+  for (uint16_t i = 0; i < kMaxFiles; ++i) {
+    snprintf(sPath, sizeof(sPath), "%s/wd%03u.csv", kDir, i);
+    if (stat(sPath, &st) != 0) return true;
+  }
+  return false;
+}
+
+static void start() {
+  sError = nullptr;
+  if (!sdBegin())            { sError = "No SD card"; return; }
+  mkdir(kDir, 0777);
+  if (!nextPath())           { sError = "No free wdNNN.csv name"; return; }
+  if (!gpsBegin())           { sError = "Could not start GPS"; return; }
+  if (!wardriveStart(sPath)) { sError = "Could not start the logger"; gpsEnd(); return; }
+  sFixes   = 0;
+  sRunning = true;
+}
+
+static void stop() {
+  if (!sRunning) return;
+  wardriveStop();
+  gpsEnd();
+  sRunning = false;
+}
+
+// Hands each newly published fix to the logger
+static void pumpFix() {
+  GpsFix f;
+  uint32_t n = gpsSnapshot(f);
+  if (n == sFixes) return;
+  sFixes = n;
+  wardriveUpdateFix(f);
+}
+
+// ─────────────────────────────────────────────────────────────────────────────
+// Drawing
+// ─────────────────────────────────────────────────────────────────────────────
+static void drawIdle(TFT_eSPI& tft) {
+  tft.setTextSize(1);
+  tft.setTextColor(TFT_SILVER, TFT_BLACK);
+  tft.setCursor(16, 50);
+  tft.print("A start  C exit");
+  if (sPath[0]) {
+    tft.setCursor(16, 66);
+    tft.printf("Last: %s", sPath + strlen(SD_MOUNT));
+  }
+  if (sError) {
+    tft.setTextColor(TFT_RED, TFT_BLACK);
+    tft.setCursor(16, 82);
+    tft.print(sError);
+  }
+}
+
+static void drawRunning(TFT_eSPI& tft) {
+  WardriveStats s = wardriveStats();
+  tft.fillRect(16, 46, 208, 80, TFT_BLACK);
+  tft.setTextSize(1);
+  tft.setTextColor(TFT_WHITE, TFT_BLACK);
+  tft.setCursor(16, 48);
+  tft.print(sPath + strlen(SD_MOUNT));
+  tft.setTextColor(s.fix ? TFT_GREEN : TFT_YELLOW, TFT_BLACK);
+  tft.setCursor(160, 48);
+  tft.print(s.fix ? "GPS fix" : "no fix");
+  tft.setTextColor(TFT_WHITE, TFT_BLACK);
+  tft.setCursor(16, 62);
+  tft.printf("Logged  %lu of %lu seen", (unsigned long)s.logged, (unsigned long)s.sightings);
+  tft.setTextColor(TFT_SILVER, TFT_BLACK);
+  tft.setCursor(16, 74);
+  tft.printf("Dupes   %lu exact  %lu bloom", (unsigned long)s.dupCache, (unsigned long)s.dupBloom);
+  tft.setCursor(16, 86);
+  tft.printf("No fix  %lu", (unsigned long)s.noFix);
+  tft.setTextColor(TFT_WHITE, TFT_BLACK);
+  tft.setCursor(16, 98);
+  tft.printf("Written %lu KB", (unsigned long)(s.bytesWritten / 1024));
+  if (s.droppedRows || s.writeError) {
+    tft.setTextColor(TFT_RED, TFT_BLACK);
+    tft.setCursor(16, 112);
+    if (s.writeError) tft.print("Write error");
+    else              tft.printf("Dropped %lu rows", (unsigned long)s.droppedRows);
+  }
+}
+
+void wardriverDraw(TFT_eSPI& tft) {
+  if (sDirty) {
+    sDirty = false;
+    tft.setRotation(ROT_TOP);
+    drawOptionsLayerBackground(tft);
+    tft.setRotation(ROT_ALT);
+    tft.setTextSize(2);
+    tft.setTextColor(TFT_WHITE, TFT_BLACK);
+    tft.setCursor(16, 26);
+    tft.print("Wardrive");
+    if (!sRunning) { drawIdle(tft); return; }
+    sDrawMs = 0;
+  }
+  if (!sRunning) return;
+  pumpFix();
+  if (millis() - sDrawMs < kRefreshMs) return;
+  sDrawMs = millis();
+  tft.setRotation(ROT_ALT);
+  drawRunning(tft);
+}
+
+// ─────────────────────────────────────────────────────────────────────────────
+// Lifecycle
+// ─────────────────────────────────────────────────────────────────────────────
+void wardriverOpen() {
+  sRunning = false;
+  sError   = nullptr;
+  sPath[0] = '\0';
+  sDirty   = true;
+}
+
+void wardriverInput(bool a, bool b, bool c, bool& requestExit) {
+  if (c) {
+    stop();
+    requestExit = true;
+    return;
+  }
+  if (a) {
+    if (sRunning) stop();
+    else          start();
+    sDirty = true;
+  }
+}
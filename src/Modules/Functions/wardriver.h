@@ -0,0 +1,12 @@
+#pragma once
+#include <Arduino.h>
+#include <TFT_eSPI.h>
+
+// GPS → Wardrive: logs Wi-Fi sightings tagged with the GPS fix to
+// /sd/wardrive/wdNNN.csv (WiGLE CSV) through Core/wardrive; fixes come from
+// the Core/gps receiver service.
+// A = start / stop logging, C = stop and exit.
+
+void wardriverOpen();
+void wardriverDraw(TFT_eSPI& tft);
+void wardriverInput(bool a, bool b, bool c, bool& requestExit);
@@ -0,0 +1,147 @@
+#include "web_files.h"
+#include "../../UserInterface/menus/menu_submenus.h"
+#include "../Core/http_files.h"
+#include "../Core/storage.h"
+#include "../Core/sdcard.h"
+#include "../Core/profile.h"
+#include <WiFi.h>
+
+#if defined(M5CARDPUTER)
+  static constexpr uint8_t ROT_TOP = 4;
+#else
+  static constexpr uint8_t ROT_TOP = 2;
+#endif
+static constexpr uint8_t ROT_ALT = (ROT_TOP + 1) & 0x3;
+
+static constexpr uint16_t kPort        = 80;       // profile "web_port" overrides
+static constexpr uint32_t kServerStack = 8192;     // listing builds a few path buffers
+static constexpr uint16_t kStatsMs     = 500;
+
+static char          sSsid[24];
+static char          sPass[12];
+static uint16_t      sPort = kPort;
+static bool          sUp = false;
+static TaskHandle_t  sTask = nullptr;
+static volatile bool sRun = false;
+static bool          sDirty = true;
+static uint32_t      sStatsMs = 0;
+static uint64_t      sLastBytes = 0;
+static uint32_t      sRateKBs = 0;
+
+// ─────────────────────────────────────────────────────────────────────────────
+// Server
+// ─────────────────────────────────────────────────────────────────────────────
+static void serverTask(void*) {
+  while (sRun) httpFilesPoll(50);
+  httpFilesStop();
+  sTask = nullptr;
+  vTaskDelete(nullptr);
+}
+
+static void newPassword() {
+  snprintf(sPass, sizeof(sPass), "%08lu", (unsigned long)(esp_random() % 100000000UL));
+}
+
+static bool bringUp() {
+  uint8_t mac[6];
+  WiFi.mode(WIFI_AP);
+  WiFi.softAPmacAddress(mac);
+  snprintf(sSsid, sizeof(sSsid), "FTW-Files-%02X%02X", mac[4], mac[5]);
+  if (!WiFi.softAP(sSsid, sPass)) return false;
+
+  HttpRoot roots[2];
+  uint8_t n = 0;
+  if (storageMounted()) roots[n++] = { "/flash", "/littlefs" };
+  if (sdBegin())        roots[n++] = { "/sd", SD_MOUNT };
+  sPort = (uint16_t)profileParam(ProfileParam::WEB_PORT, kPort);
+  if (!httpFilesStart(sPort, roots, n)) return false;
+
+  sRun = true;
+  xTaskCreatePinnedToCore(serverTask, "webfiles", kServerStack, nullptr, 1, &sTask, 0);
+  return true;
+}
+
+static void tearDown() {
+  sRun = false;
+  while (sTask) vTaskDelay(pdMS_TO_TICKS(10));
+  WiFi.softAPdisconnect(true);
+  WiFi.mode(WIFI_OFF);
+  sUp = false;
+}
+
+// ─────────────────────────────────────────────────────────────────────────────
+// Drawing
+// ─────────────────────────────────────────────────────────────────────────────
+static void drawStats(TFT_eSPI& tft) {
+  HttpFilesStats s = httpFilesStats();
+  tft.fillRect(16, 92, 208, 30, TFT_BLACK);
+  tft.setTextSize(1);
+  tft.setTextColor(TFT_WHITE, TFT_BLACK);
+  tft.setCursor(16, 94);
+  tft.printf("Clients %u  Requests %lu", s.clients, (unsigned long)s.requests);
+  tft.setCursor(16, 106);
+  tft.printf("Sent %lu KB  %lu KB/s", (unsigned long)(s.bytesSent / 1024), (unsigned long)sRateKBs);
+}
+
+void webFilesDraw(TFT_eSPI& tft) {
+  if (sDirty) {
+    sDirty = false;
+    tft.setRotation(ROT_TOP);
+    drawOptionsLayerBackground(tft);
+    tft.setRotation(ROT_ALT);
+    tft.setTextSize(2);
+    tft.setTextColor(TFT_WHITE, TFT_BLACK);
+    tft.setCursor(16, 26);
+    tft.print("Web Files");
+
+    tft.setTextSize(1);
+    if (!sUp) {
+      tft.setTextColor(TFT_RED, TFT_BLACK);
+      tft.setCursor(16, 50);
+      tft.print("Could not start the access point");
+      return;
+    }
+    tft.setTextColor(TFT_SILVER, TFT_BLACK);
+    tft.setCursor(16, 48); tft.printf("SSID  %s", sSsid);
+    tft.setCursor(16, 60); tft.printf("Pass  %s", sPass);
+    tft.setCursor(16, 72);
+    if (sPort == 80) tft.printf("http://%s/", WiFi.softAPIP().toString().c_str());
+    else             tft.printf("http://%s:%u/", WiFi.softAPIP().toString().c_str(), sPort);
+    drawStats(tft);
+    return;
+  }
+  if (sUp && millis() - sStatsMs >= kStatsMs) {
+    HttpFilesStats s = httpFilesStats();
+    uint32_t dt = millis() - sStatsMs;
+    sRateKBs   = (uint32_t)((s.bytesSent - sLastBytes) * 1000 / dt / 1024);
+    sLastBytes = s.bytesSent;
+    sStatsMs   = millis();
+    tft.setRotation(ROT_ALT);
+    drawStats(tft);
+  }
+}
+
+// ─────────────────────────────────────────────────────────────────────────────
+// Lifecycle
+// ─────────────────────────────────────────────────────────────────────────────
+void webFilesStart() {
+  newPassword();
+  sUp = bringUp();
+  if (!sUp) tearDown();
+  sLastBytes = 0;
+  sRateKBs = 0;
+  sStatsMs = millis();
+  sDirty = true;
+}
+
+void webFilesInput(bool a, bool b, bool c, bool& requestExit) {
+  if (c) {
+    tearDown();
+    requestExit = true;
+    return;
+  }
+  if (a) {                                   // rotate the password, kicking everyone off
+    tearDown();
+    webFilesStart();
+  }
+}
@@ -0,0 +1,10 @@
+#pragma once
+#include <Arduino.h>
+#include <TFT_eSPI.h>
+
+// Files → Web Files: softAP + HTTP file server for flash (/flash) and
+// microSD (/sd). A = new password, C = stop and exit.
+
+void webFilesStart();
+void webFilesDraw(TFT_eSPI& tft);
+void webFilesInput(bool a, bool b, bool c, bool& requestExit);
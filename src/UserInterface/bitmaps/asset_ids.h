@@ -0,0 +1,217 @@
+#pragma once
+#include <Arduino.h>
+
+// Generated by tools/assetpack.py from assets/ui_bitmaps.c. Do not edit.
+
+enum class AssetId : uint16_t {
+  WIFI_LAYER_10,
+  WIFI_LAYER_11,
+  WIFI_LAYER_13,
+  LAYER_18,
+  LAYER_20,
+  WIFI_LAYER_21,
+  LAYER_22,
+  BT_LAYER_2,
+  BT_LAYER_3,
+  BT_LAYER_6,
+  BT_LAYER_7,
+  BT_LAYER_8,
+  BT_LAYER_9,
+  BT_LAYER_10,
+  IR_LAYER_2,
+  IR_LAYER_3,
+  IR_LAYER_6,
+  IR_LAYER_8,
+  IR_LAYER_9,
+  IR_LAYER_10,
+  IR_LAYER_11,
+  RF_LAYER_7,
+  RF_LAYER_9,
+  LAYER_12,
+  LAYER_13,
+  LAYER_14,
+  LAYER_15,
+  NRF_4,
+  NRF_LAYER_7,
+  NRF_LAYER_9,
+  NRF_LAYER_13,
+  NRF_LAYER_14,
+  IMG_5TI7RMT_RADIORADIO,
+  NRF_1,
+  NRF_LAYER_17,
+  RADIO_LAYER_2,
+  RADIO_LAYER_3,
+  RADIO_LAYER_6,
+  RADIO_LAYER_7,
+  RADIO_LAYER_8,
+  RADIO_MAP_PIN,
+  GPS_LAYER_2,
+  GPS_LAYER_3,
+  GPS_LAYER_6,
+  GPS_LAYER_7,
+  GPS_LAYER_8,
+  GPS_LAYER_9,
+  GPS_LAYER_10,
+  RPI_LAYER_2,
+  RPI_LAYER_3,
+  RPI_LAYER_6,
+  RPI_LAYER_7,
+  RPI_LAYER_8,
+  RPI_LAYER_9,
+  RPI_MAP_PIN,
+  RPI_LAYER_10,
+  BADUSB_LAYER_2,
+  BADUSB_LAYER_3,
+  RSPI_1,
+  USB_KILLER,
+  BADUSB_LAYER_9,
+  BADUSB_LAYER_10,
+  EQU2Z4C_SETTINGSSETTINGS,
+  SETTINGS_LAYER_2,
+  SETTINGS_LAYER_3,
+  SETTINGS_LAYER_7,
+  SETTINGS_LAYER_8,
+  G87A5ZI_USB_KILLERUSB_KILLER,
+  SETTINGS_LAYER_9,
+  EXTRA_1,
+  OJP6UHU_USB_KILLERUSB_KILLER,
+  EXTRAS_LAYER_2,
+  EXTRAS_LAYER_3,
+  EXTRAS_LAYER_7,
+  EXTRAS_LAYER_8,
+  OT3P4L1_FILESFILES,
+  EXTRAS_LAYER_11,
+  FILES_LAYER_2,
+  FILES_LAYER_3,
+  MI1BYSE_EXTRAEXTRA_BITSFIL,
+  FILES_LAYER_8,
+  FILES_LAYER_10,
+  RFID_LAYER_2,
+  RFID_LAYER_3,
+  FILESRFID_LAYER_6,
+  RFID_LAYER_6,
+  RFID_LAYER_8,
+  RFID_LAYER_9,
+  RFID_LAYER_10,
+  FILES_LAYER_6,
+  MI1BYSE_EXTRAEXTRA,
+  YHJ24XZ_RFIDRFID,
+  NFC_LAYER_2,
+  NFC_LAYER_3,
+  NFC_LAYER_6,
+  NFC_LAYER_7,
+  NFC_LAYER_8,
+  NFC_LAYER_9,
+  NFC_LAYER_10,
+  OPTIONSLAYER_7,
+  OPTIONSLAYER_9,
+  IMG_16,
+  BATTERY_EMPTY,
+  LAYER_9,
+  PASSPORT_LEFT,
+  BLELAYER_2,
+  BLELAYER_3,
+  BLELAYER_6,
+  BLELAYER_8,
+  IRLAYER_2,
+  IRLAYER_3,
+  IRLAYER_6,
+  IRLAYER_8,
+  RFLAYER_13_1,
+  RFLAYER_13,
+  RFLAYER_7,
+  RFLAYER_8,
+  NRFIMAGE_2,
+  NRFLAYER_14,
+  NRFLAYER_15,
+  NRFLAYER_7,
+  NRFLAYER_9,
+  RADIOLAYER_2,
+  RADIOLAYER_3,
+  RADIOLAYER_6,
+  RADIOLAYER_8,
+  GPSLAYER_6,
+  GPSLAYER_2,
+  GPSLAYER_3,
+  GPSLAYER_8,
+  RPILAYER_2,
+  RPILAYER_3,
+  RPILAYER_6,
+  RPILAYER_8_1,
+  RPILAYER_9,
+  BADLAYER_2,
+  BADLAYER_3,
+  BADLAYER_8,
+  BADLAYER_6,
+  SETLAYER_11,
+  SETLAYER_12,
+  SETLAYER_6,
+  SETLAYER_7,
+  EXLAYER_2,
+  EXLAYER_3,
+  EXLAYER_7,
+  EXLAYER_8_1,
+  EXLAYER_8,
+  FILELAYER_6,
+  FILELAYER_2,
+  FILELAYER_3,
+  FILELAYER_7,
+  RFIDLAYER_2,
+  RFIDLAYER_3,
+  RFIDLAYER_6,
+  RFIDLAYER_8,
+  NFCLAYER_2,
+  NFCLAYER_3,
+  NFCLAYER_6,
+  NFCLAYER_8,
+  COUNT
+};
+
+static constexpr uint16_t ASSET_MAX_SIZE = 750;
+
+// Pack lookup key and expected size, indexed by AssetId
+static constexpr uint32_t ASSET_KEYS[] = {
+  0xF6206E4A, 0xF7206FDD, 0xF5206CB7, 0x2FE5C262, 0x31E386F1, 0xEF1E24AE,
+  0x2FE383CB, 0xB6F76058, 0xB7F761EB, 0xBAF766A4, 0xBBF76837, 0xB0F756E6,
+  0xB1F75879, 0xE17432F3, 0xEEC381E5, 0xEDC38052, 0xEAC37B99, 0xF4C38B57,
+  0xF3C389C4, 0x40BDF314, 0x41BDF4A7, 0xC1C01045, 0xC3C0136B, 0x35E5CBD4,
+  0x36E5CD67, 0x33E5C8AE, 0x34E5CA41, 0xDF31D526, 0x964C0001, 0x904BF68F,
+  0xD3A8D87C, 0xD2A8D6E9, 0xF2D296BA, 0xE431DD05, 0xCFA8D230, 0x5EAC7067,
+  0x5DAC6ED4, 0x5AAC6A1B, 0x59AC6888, 0x58AC66F5, 0x90EB73BD, 0x6EC8CE98,
+  0x6FC8D02B, 0x72C8D4E4, 0x73C8D677, 0x68C8C526, 0x69C8C6B9, 0x8024C1B3,
+  0xABC114E5, 0xAAC11352, 0xA7C10E99, 0xA6C10D06, 0xB1C11E57, 0xB0C11CC4,
+  0x5AA55687, 0xC3EC5C14, 0xBF84244D, 0xBE8422BA, 0xE0E3CD15, 0x4B241759,
+  0xB48412FC, 0x67FDCF2C, 0x16FF5038, 0x966B642B, 0x956B6298, 0x996B68E4,
+  0x906B5AB9, 0x9A54D229, 0x8F6B5926, 0x8DD964E9, 0xAA105BE7, 0x697FD101,
+  0x687FCF6E, 0x6C7FD5BA, 0x5F7FC143, 0xF4D34D1B, 0xD42EE27B, 0x1C0AE753,
+  0x1B0AE5C0, 0x7ED1FF88, 0x260AF711, 0x8E2C88E2, 0x3020A75F, 0x2F20A5CC,
+  0x1A98FC9E, 0x2C20A113, 0x3A20B71D, 0x3920B58A, 0x1869A966, 0x200AED9F,
+  0x0344D380, 0x04A4A0BB, 0x3EE3B7A5, 0x3DE3B612, 0x3AE3B159, 0x39E3AFC6,
+  0x44E3C117, 0x43E3BF84, 0x23729054, 0x0053F194, 0xF653E1D6, 0x133E55F2,
+  0xF829B630, 0xBD76ACD6, 0xBAE129F5, 0xF71E01AE, 0xF81E0341, 0xFB1E07FA,
+  0xED1DF1F0, 0xECF18906, 0xEDF18A99, 0xF0F18F52, 0xF2F19278, 0xBFF78EAF,
+  0xCF668BF3, 0x61573EA0, 0x7057563D, 0xB5A502DF, 0x572ACBE6, 0x582ACD79,
+  0x053A8F9C, 0x0B3A990E, 0xD6FEF998, 0xD7FEFB2B, 0xDAFEFFE4, 0xD0FEF026,
+  0xEC4464ED, 0xE8445EA1, 0xE7445D0E, 0xDE444EE3, 0x49858A06, 0x4A858B99,
+  0x4D859052, 0x2537D63C, 0x5085950B, 0x9D4A514C, 0x9E4A52DF, 0xA74A610A,
+  0x994A4B00, 0xBAB11D3B, 0xBBB11ECE, 0x22F4698D, 0x21F467FA, 0xFEE05D9C,
+  0xFFE05F2F, 0xFBE058E3, 0x3F0B30AA, 0x08E06D5A, 0xF4CBF42D, 0xF0CBEDE1,
+  0xEFCBEC4E, 0xF3CBF29A, 0xE4EFC7F0, 0xE5EFC983, 0xE8EFCE3C, 0xEEEFD7AE,
+  0x63EEB0C6, 0x64EEB259, 0x67EEB712, 0x69EEBA38,
+};
+static constexpr uint16_t ASSET_SIZES[] = {
+   198,  184,   48,   44,  612,  194,  168,   48,  184,  225,  212,  194,
+    84,  124,  184,   48,  194,  270,   40,  102,   72,  184,   48,   44,
+   194,  252,   69,   72,  184,   48,  194,   72,   81,  210,   68,   48,
+   184,  324,  194,  116,   48,   48,  184,   81,  194,  192,   76,   68,
+    48,  184,  266,  194,   80,   64,   96,  164,   48,  184,   76,  240,
+   194,  164,  108,   48,  184,  378,  194,  750,  188,  100,   80,   48,
+   184,  108,  194,   84,  116,   48,  184,  104,  194,  116,  184,   48,
+    81,  255,   96,   92,  194,  330,  364,   78,  184,   48,  343,   68,
+    84,   78,  194,  184,   48,   28,   48,   22,  184,   48,  184,   69,
+    53,  184,   48,   42,   10,   11,   54,  184,   48,   57,   17,    1,
+   184,   48,   48,  184,   81,   29,   24,   48,  184,   17,   48,  184,
+    57,   16,   41,   48,  184,   41,   60,   28,   47,   48,  184,   48,
+   184,   26,   29,  750,   40,   48,  184,   29,  184,   48,   78,   23,
+   184,   48,   26,   17,
+};
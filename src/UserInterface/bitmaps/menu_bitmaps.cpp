@@ -1,427 +1,9 @@
 #include "menu_bitmaps.h"
+#include "../../Modules/Core/assets.h"
 #include <TFT_eSPI.h>
 
 extern TFT_eSPI tft;
 
-// WiFi menu bitmap data
-const unsigned char PROGMEM image_wifi_Layer_10_bits[] = {
-    0x1f,0xff,0xf8,0x1f,0xff,0xf8,0x1f,0xff,0xf8,0xe0,0x00,0x00,0xe0,0x00,0x00,0xe0,0x00,0x00,0x1f,0xf0,0x00,0x1f,0xf0,0x00,0x1f,0xf0,0x00,0xe0,0x00,0x00,0xe0,0x00,0x00,0xe0,0x00,0x00,0x1f,0xff,0xf8,0x1f,0xff,0xf8,0x1f,0xff,0xf8,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xe0,0x00,0x38,0xe0,0x00,0x38,0xe0,0x00,0x38,0xff,0xff,0xf8,0xff,0xff,0xf8,0xff,0xff,0xf8,0xe0,0x00,0x38,0xe0,0x00,0x38,0xe0,0x00,0x38,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xff,0xff,0xf8,0xff,0xff,0xf8,0xff,0xff,0xf8,0x00,0x70,0x38,0x00,0x70,0x38,0x00,0x70,0x38,0x00,0x70,0x38,0x00,0x70,0x38,0x00,0x70,0x38,0x00,0x70,0x38,0x00,0x70,0x38,0x00,0x70,0x38,0x00,0x00,0x38,0x00,0x00,0x38,0x00,0x00,0x38,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xe0,0x00,0x38,0xe0,0x00,0x38,0xe0,0x00,0x38,0xff,0xff,0xf8,0xff,0xff,0xf8,0xff,0xff,0xf8,0xe0,0x00,0x38,0xe0,0x00,0x38,0xe0,0x00,0x38
-};
-
-const unsigned char PROGMEM image_wifi_Layer_11_bits[] = {
-    0x0f,0xf0,0x0f,0xf0,0x30,0x00,0x30,0x00,0xc3,0xc0,0xc3,0xc0,0xcc,0x30,0xcc,0x30,0xcc,0x30,0xcc,0x30,0xc3,0xc0,0xc3,0xc0,0xc0,0x00,0xc0,0x00,0xc0,0x00,0xc0,0x00,0xcc,0x00,0xcc,0x00,0xc3,0x00,0xc3,0x00,0xc0,0xc0,0xc0,0xc0,0xcc,0x30,0xcc,0x30,0xc3,0x00,0xc3,0x00,0xc0,0xc0,0xc0,0xc0,0xcc,0x30,0xcc,0x30,0xc3,0x00,0xc3,0x00,0xc0,0xc0,0xc0,0xc0,0xcc,0x30,0xcc,0x30,0xc3,0x00,0xc3,0x00,0xc0,0xc0,0xc0,0xc0,0xcc,0x30,0xcc,0x30,0xc3,0x00,0xc3,0x00,0xc0,0xc0,0xc0,0xc0,0xcc,0x30,0xcc,0x30,0xc3,0x00,0xc3,0x00,0xc0,0xc0,0xc0,0xc0,0xc0,0x30,0xc0,0x30,0xc0,0x00,0xc0,0x00,0x30,0x00,0x30,0x00,0x3c,0x00,0x3c,0x00,0x3f,0x00,0x3f,0x00,0x3f,0xc0,0x3f,0xc0,0x3f,0xf0,0x3f,0xf0,0x33,0xf0,0x33,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0
-};
-
-const unsigned char PROGMEM image_wifi_Layer_13_bits[] = {
-    0x3f,0xf8,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x38,0x38,0x08,0x20,0x08,0x20,0x07,0xc0
-};
-
-const unsigned char PROGMEM image_Layer_18_bits[] = {
-    0x04,0x20,0x00,0x00,0x06,0x60,0x00,0x00,0x00,0x00,0x00,0x00,0x18,0x18,0x0c,0x30,0x04,0x20,0x02,0x40,0x01,0x80,0xff,0xff,0x63,0xc6,0x36,0x6c,0x1c,0x38,0x08,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x06,0x60,0x08,0x10,0x06,0x20
-};
-
-const unsigned char PROGMEM image_Layer_20_bits[] = {
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0xf8,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x07,0xfe,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x07,0xfe,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0x3c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x38,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x70,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xe0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0xc0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x07,0x82,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0f,0x0f,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x07,0xfe,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0xfc,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x60,0x00,0x60,0x00,0x00,0x00,0x00,0x00,0x00,0x70,0x00,0xe0,0x00,0x00,0x00,0x00,0x00,0x00,0x7c,0x03,0xe0,0x00,0x00,0x00,0x00,0x00,0x00,0x3f,0xff,0xc0,0x00,0x00,0x00,0x00,0x00,0x02,0x0f,0xff,0x04,0x00,0x00,0x00,0x00,0x00,0x07,0x00,0xf0,0x0e,0x00,0x00,0x00,0x00,0x00,0x07,0xc0,0x00,0x3e,0x00,0x00,0x00,0x00,0x00,0x01,0xf0,0x00,0xf8,0x00,0x00,0x00,0x00,0x00,0x00,0xff,0xff,0xf0,0x00,0x00,0x00,0x00,0x00,0x00,0x3f,0xff,0xc0,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0xfc,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00
-};
-
-const unsigned char PROGMEM image_wifi_Layer_21_bits[] = {
-    0x0f,0x00,0x10,0xc0,0x20,0x20,0x20,0x30,0x20,0x10,0x20,0x10,0x20,0x10,0x10,0x20,0x00,0x70,0x00,0x00,0x00,0x00,0x1e,0x10,0x31,0xf0,0x20,0x10,0x20,0x10,0x20,0x00,0x30,0x00,0x10,0x00,0x0f,0x10,0x01,0xf0,0x00,0x10,0x20,0x00,0x30,0x00,0x3f,0x90,0x22,0x70,0x02,0x10,0x02,0x10,0x02,0x10,0x0e,0x10,0x11,0x30,0x20,0xe0,0x00,0x00,0x20,0x00,0x30,0x00,0x3f,0x90,0x22,0x70,0x02,0x10,0x02,0x10,0x02,0x10,0x0e,0x10,0x11,0x30,0x20,0xe0,0x80,0x00,0x80,0x00,0x80,0x00,0x80,0x00,0x80,0x00,0x80,0x00,0x80,0x00,0x80,0x00,0x80,0x00,0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x30,0x20,0x10,0x38,0x10,0x2f,0xd0,0x20,0x30,0x20,0x10,0x00,0x10,0x00,0x10,0x00,0x30,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x10,0x38,0x10,0x27,0xd0,0x20,0x30,0x20,0x10,0x00,0x10,0x00,0x10,0x20,0x00,0x20,0x00,0x3f,0x10,0x20,0xf0,0x00,0x30,0x07,0xc0,0x06,0x00,0x21,0x00,0x20,0xc0,0x3c,0x20,0x27,0xf0,0x00,0x10,0x20,0x10,0x30,0x00,0x3f,0x90,0x21,0x70,0x21,0x10,0x21,0x10,0x23,0x90,0x20,0x10,0x38,0x10,0x00,0x30
-};
-
-const unsigned char PROGMEM image_Layer_22_bits[] = {
-0x00,0x00,0x08,0x00,0x00,0x00,0x1c,0x00,0x00,0x00,0x3e,0x00,0x00,0x00,0x7f,0x00,0x00,0x00,0x7f,0x00,0x00,0x00,0x3f,0x80,0x00,0x00,0x1f,0xc0,0x00,0x00,0x0f,0xc0,0x00,0x0c,0x0f,0xe0,0x00,0x1e,0x07,0xe0,0x00,0x3e,0x03,0xe0,0x00,0x7f,0x03,0xf0,0x00,0x3f,0x83,0xf0,0x00,0x1f,0x81,0xf0,0x00,0x1f,0x81,0xf8,0x04,0x0f,0xc1,0xf8,0x0c,0x0f,0xc0,0xf8,0x1e,0x07,0xc0,0xf8,0x3e,0x07,0xc0,0xf8,0x7f,0x07,0xc0,0xf8,0xff,0x07,0xe0,0xf8,0xff,0x07,0xe0,0xf8,0x7f,0x07,0xc0,0xf8,0x3e,0x07,0xc0,0xf8,0x1e,0x07,0xc0,0xf8,0x0c,0x0f,0xc0,0xf8,0x04,0x0f,0xc1,0xf8,0x00,0x1f,0x81,0xf8,0x00,0x1f,0x81,0xf0,0x00,0x3f,0x83,0xf0,0x00,0x7f,0x03,0xf0,0x00,0x3e,0x03,0xe0,0x00,0x1e,0x07,0xe0,0x00,0x0c,0x0f,0xe0,0x00,0x00,0x0f,0xc0,0x00,0x00,0x1f,0xc0,0x00,0x00,0x3f,0x80,0x00,0x00,0x7f,0x00,0x00,0x00,0x7f,0x00,0x00,0x00,0x3e,0x00,0x00,0x00,0x1c,0x00,0x00,0x00,0x08,0x00
-};
-
-// Bluetooth menu bitmap data
-const unsigned char PROGMEM image_bt_Layer_2_bits[] = {
-    0x3f,0xf8,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x38,0x38,0x08,0x20,0x08,0x20,0x07,0xc0
-};
-
-const unsigned char PROGMEM image_bt_Layer_3_bits[] = {
-    0x0f,0xf0,0x0f,0xf0,0x30,0x00,0x30,0x00,0xc3,0xc0,0xc3,0xc0,0xcc,0x30,0xcc,0x30,0xcc,0x30,0xcc,0x30,0xc3,0xc0,0xc3,0xc0,0xc0,0x00,0xc0,0x00,0xc0,0x00,0xc0,0x00,0xcc,0x00,0xcc,0x00,0xc3,0x00,0xc3,0x00,0xc0,0xc0,0xc0,0xc0,0xcc,0x30,0xcc,0x30,0xc3,0x00,0xc3,0x00,0xc0,0xc0,0xc0,0xc0,0xcc,0x30,0xcc,0x30,0xc3,0x00,0xc3,0x00,0xc0,0xc0,0xc0,0xc0,0xcc,0x30,0xcc,0x30,0xc3,0x00,0xc3,0x00,0xc0,0xc0,0xc0,0xc0,0xcc,0x30,0xcc,0x30,0xc3,0x00,0xc3,0x00,0xc0,0xc0,0xc0,0xc0,0xcc,0x30,0xcc,0x30,0xc3,0x00,0xc3,0x00,0xc0,0xc0,0xc0,0xc0,0xc0,0x30,0xc0,0x30,0xc0,0x00,0xc0,0x00,0x30,0x00,0x30,0x00,0x3c,0x00,0x3c,0x00,0x3f,0x00,0x3f,0x00,0x3f,0xc0,0x3f,0xc0,0x3f,0xf0,0x3f,0xf0,0x33,0xf0,0x33,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0
-};
-
-const unsigned char PROGMEM image_bt_Layer_6_bits[] = {
-    0x00,0x0f,0xf8,0x00,0x00,0x00,0x38,0x0e,0x00,0x00,0x00,0x60,0x03,0x00,0x00,0x00,0x80,0x00,0x80,0x00,0x00,0x07,0xf0,0x00,0x00,0x00,0x1c,0x1c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0xe0,0x00,0x00,0x00,0x02,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x80,0x00,0x00,0x00,0x80,0xc0,0xc0,0x00,0x01,0xc0,0x01,0xc0,0x00,0x00,0xe0,0x03,0x80,0x00,0x00,0x70,0x07,0x80,0x00,0x00,0x70,0x07,0x00,0x00,0x00,0x38,0x0e,0x00,0x00,0x00,0x1c,0x1c,0x00,0x00,0x00,0x0e,0x38,0x00,0x00,0x00,0x0f,0x78,0x00,0x00,0x00,0x03,0xe0,0x00,0x00,0xff,0xff,0xff,0xff,0x80,0x7f,0xff,0xff,0xff,0x00,0x38,0x03,0xe0,0x0e,0x00,0x1c,0x07,0x78,0x1c,0x00,0x0e,0x0e,0x38,0x38,0x00,0x07,0x1c,0x1c,0x78,0x00,0x03,0xb8,0x0e,0xf0,0x00,0x03,0xf0,0x07,0xe0,0x00,0x01,0xe0,0x03,0xc0,0x00,0x00,0xc0,0x01,0x80,0x00,0x00,0x00,0xc0,0x00,0x00,0x00,0x00,0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0x20,0x00,0x00,0x00,0x03,0xe0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x04,0x00,0x00,0x00,0x1c,0x1c,0x00,0x00,0x00,0x07,0xf0,0x00,0x00,0x00,0xc0,0x01,0x80,0x00,0x00,0x60,0x03,0x00,0x00,0x00,0x3c,0x0e,0x00,0x00,0x00,0x0f,0xf8,0x00,0x00
-};
-
-const unsigned char PROGMEM image_bt_Layer_7_bits[] = {
-    0xff,0xfc,0xff,0xfc,0xc3,0x0c,0xc3,0x0c,0xc3,0x0c,0xc3,0x0c,0xc3,0x0c,0xc3,0x0c,0x3c,0xf0,0x3c,0xf0,0x00,0x00,0x00,0x00,0xff,0xfc,0xff,0xfc,0xc0,0x00,0xc0,0x00,0xc0,0x00,0xc0,0x00,0xc0,0x00,0xc0,0x00,0xc0,0x00,0xc0,0x00,0x00,0x00,0x00,0x00,0x3f,0xfc,0x3f,0xfc,0xc0,0x00,0xc0,0x00,0xc0,0x00,0xc0,0x00,0xc0,0x00,0xc0,0x00,0x3f,0xfc,0x3f,0xfc,0x00,0x00,0x00,0x00,0xff,0xfc,0xff,0xfc,0xc3,0x0c,0xc3,0x0c,0xc3,0x0c,0xc3,0x0c,0xc3,0x0c,0xc3,0x0c,0xc0,0x0c,0xc0,0x0c,0x00,0x00,0x00,0x00,0x00,0x3c,0x00,0x3c,0x00,0x0c,0x00,0x0c,0xff,0xfc,0xff,0xfc,0x00,0x0c,0x00,0x0c,0x00,0x3c,0x00,0x3c,0x00,0x00,0x00,0x00,0x3f,0xf0,0x3f,0xf0,0xc0,0x0c,0xc0,0x0c,0xc0,0x0c,0xc0,0x0c,0xc0,0x0c,0xc0,0x0c,0x3f,0xf0,0x3f,0xf0,0x00,0x00,0x00,0x00,0x3f,0xf0,0x3f,0xf0,0xc0,0x0c,0xc0,0x0c,0xc0,0x0c,0xc0,0x0c,0xc0,0x0c,0xc0,0x0c,0x3f,0xf0,0x3f,0xf0,0x00,0x00,0x00,0x00,0x00,0x3c,0x00,0x3c,0x00,0x0c,0x00,0x0c,0xff,0xfc,0xff,0xfc,0x00,0x0c,0x00,0x0c,0x00,0x3c,0x00,0x3c,0x00,0x00,0x00,0x00,0xff,0xfc,0xff,0xfc,0x03,0x00,0x03,0x00,0x03,0x00,0x03,0x00,0x03,0x00,0x03,0x00,0xff,0xfc,0xff,0xfc
-};
-
-const unsigned char PROGMEM image_bt_Layer_8_bits[] = {
-    0x0f,0x00,0x10,0xc0,0x20,0x20,0x20,0x30,0x20,0x10,0x20,0x10,0x20,0x10,0x10,0x20,0x00,0x70,0x00,0x00,0x00,0x00,0x1e,0x10,0x31,0xf0,0x20,0x10,0x20,0x10,0x20,0x00,0x30,0x00,0x10,0x00,0x0f,0x10,0x01,0xf0,0x00,0x10,0x20,0x00,0x30,0x00,0x3f,0x90,0x22,0x70,0x02,0x10,0x02,0x10,0x02,0x10,0x0e,0x10,0x11,0x30,0x20,0xe0,0x00,0x00,0x20,0x00,0x30,0x00,0x3f,0x90,0x22,0x70,0x02,0x10,0x02,0x10,0x02,0x10,0x0e,0x10,0x11,0x30,0x20,0xe0,0x80,0x00,0x80,0x00,0x80,0x00,0x80,0x00,0x80,0x00,0x80,0x00,0x80,0x00,0x80,0x00,0x80,0x00,0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x30,0x20,0x10,0x38,0x10,0x2f,0xd0,0x20,0x30,0x20,0x10,0x00,0x10,0x00,0x10,0x00,0x30,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x10,0x38,0x10,0x27,0xd0,0x20,0x30,0x20,0x10,0x00,0x10,0x00,0x10,0x20,0x00,0x20,0x00,0x3f,0x10,0x20,0xf0,0x00,0x30,0x07,0xc0,0x06,0x00,0x21,0x00,0x20,0xc0,0x3c,0x20,0x27,0xf0,0x00,0x10,0x20,0x10,0x30,0x00,0x3f,0x90,0x21,0x70,0x21,0x10,0x21,0x10,0x23,0x90,0x20,0x10,0x38,0x10,0x00,0x30
-};
-
-const unsigned char PROGMEM image_bt_Layer_9_bits[] = {
-    0x00,0x02,0x00,0x00,0x0f,0x00,0x00,0x0f,0x00,0x00,0x07,0x80,0x00,0x07,0xc0,0x00,0xc3,0xc0,0x01,0xc1,0xe0,0x01,0xe1,0xe0,0x01,0xe1,0xe0,0x00,0xf0,0xf0,0x10,0xf0,0xf0,0x38,0x70,0xf0,0x38,0x78,0xf0,0xf8,0x78,0xf0,0xf8,0x78,0xf0,0x38,0x78,0xf0,0x38,0x70,0xf0,0x10,0xf0,0xf0,0x00,0xf0,0xf0,0x01,0xe1,0xe0,0x01,0xe1,0xe0,0x01,0xc1,0xe0,0x00,0xc3,0xc0,0x00,0x07,0xc0,0x00,0x07,0x80,0x00,0x0f,0x00,0x00,0x0f,0x00,0x00,0x06,0x00
-};
-
-const unsigned char PROGMEM image_bt_Layer_10_bits[] = {
-    0x00,0x00,0x00,0xc0,0x00,0x00,0x00,0x10,0x00,0x00,0x03,0x88,0x00,0x00,0x00,0x24,0x00,0x00,0x29,0x90,0x00,0x00,0x44,0x42,0x00,0x00,0xa2,0x2a,0x00,0x01,0x31,0x28,0x00,0x02,0xc0,0x80,0x00,0x05,0x4c,0x40,0x00,0x09,0x90,0x20,0x00,0x16,0x19,0x20,0x00,0x22,0x61,0xa0,0x00,0x40,0x26,0x40,0x00,0x84,0x08,0x80,0x01,0x1b,0x09,0x00,0x02,0x21,0x32,0x00,0x04,0x21,0x04,0x00,0x09,0x21,0x08,0x00,0x15,0x13,0x10,0x00,0x26,0x0e,0x20,0x00,0x58,0x00,0x40,0x00,0x89,0x80,0x80,0x00,0x32,0x99,0x00,0x00,0x03,0x22,0x00,0x00,0x8c,0x34,0x00,0x00,0x44,0xc8,0x00,0x00,0x21,0x50,0x00,0x00,0x11,0x20,0x00,0x00,0x08,0x40,0x00,0x00,0x04,0x80,0x00,0x00
-};
-
-// IR menu bitmap data
-const unsigned char PROGMEM image_ir_Layer_2_bits[] = {
-    0x0f,0xf0,0x0f,0xf0,0x30,0x00,0x30,0x00,0xc3,0xc0,0xc3,0xc0,0xcc,0x30,0xcc,0x30,0xcc,0x30,0xcc,0x30,0xc3,0xc0,0xc3,0xc0,0xc0,0x00,0xc0,0x00,0xc0,0x00,0xc0,0x00,0xcc,0x00,0xcc,0x00,0xc3,0x00,0xc3,0x00,0xc0,0xc0,0xc0,0xc0,0xcc,0x30,0xcc,0x30,0xc3,0x00,0xc3,0x00,0xc0,0xc0,0xc0,0xc0,0xcc,0x30,0xcc,0x30,0xc3,0x00,0xc3,0x00,0xc0,0xc0,0xc0,0xc0,0xcc,0x30,0xcc,0x30,0xc3,0x00,0xc3,0x00,0xc0,0xc0,0xc0,0xc0,0xcc,0x30,0xcc,0x30,0xc3,0x00,0xc3,0x00,0xc0,0xc0,0xc0,0xc0,0xcc,0x30,0xcc,0x30,0xc3,0x00,0xc3,0x00,0xc0,0xc0,0xc0,0xc0,0xc0,0x30,0xc0,0x30,0xc0,0x00,0xc0,0x00,0x30,0x00,0x30,0x00,0x3c,0x00,0x3c,0x00,0x3f,0x00,0x3f,0x00,0x3f,0xc0,0x3f,0xc0,0x3f,0xf0,0x3f,0xf0,0x33,0xf0,0x33,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0
-};
-
-const unsigned char PROGMEM image_ir_Layer_3_bits[] = {
-    0x3f,0xf8,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x38,0x38,0x08,0x20,0x08,0x20,0x07,0xc0
-};
-
-const unsigned char PROGMEM image_ir_Layer_6_bits[] = {
-    0x0f,0x00,0x10,0xc0,0x20,0x20,0x20,0x30,0x20,0x10,0x20,0x10,0x20,0x10,0x10,0x20,0x00,0x70,0x00,0x00,0x00,0x00,0x1e,0x10,0x31,0xf0,0x20,0x10,0x20,0x10,0x20,0x00,0x30,0x00,0x10,0x00,0x0f,0x10,0x01,0xf0,0x00,0x10,0x20,0x00,0x30,0x00,0x3f,0x90,0x22,0x70,0x02,0x10,0x02,0x10,0x02,0x10,0x0e,0x10,0x11,0x30,0x20,0xe0,0x00,0x00,0x20,0x00,0x30,0x00,0x3f,0x90,0x22,0x70,0x02,0x10,0x02,0x10,0x02,0x10,0x0e,0x10,0x11,0x30,0x20,0xe0,0x80,0x00,0x80,0x00,0x80,0x00,0x80,0x00,0x80,0x00,0x80,0x00,0x80,0x00,0x80,0x00,0x80,0x00,0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x30,0x20,0x10,0x38,0x10,0x2f,0xd0,0x20,0x30,0x20,0x10,0x00,0x10,0x00,0x10,0x00,0x30,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x10,0x38,0x10,0x27,0xd0,0x20,0x30,0x20,0x10,0x00,0x10,0x00,0x10,0x20,0x00,0x20,0x00,0x3f,0x10,0x20,0xf0,0x00,0x30,0x07,0xc0,0x06,0x00,0x21,0x00,0x20,0xc0,0x3c,0x20,0x27,0xf0,0x00,0x10,0x20,0x10,0x30,0x00,0x3f,0x90,0x21,0x70,0x21,0x10,0x21,0x10,0x23,0x90,0x20,0x10,0x38,0x10,0x00,0x30
-};
-
-const unsigned char PROGMEM image_ir_Layer_8_bits[] = {
-    0x00,0x00,0x00,0x01,0xf8,0x00,0x00,0x00,0x00,0x00,0x1c,0x00,0x00,0x00,0x00,0x00,0x03,0x00,0x00,0x00,0x00,0x00,0xe1,0x80,0x00,0x00,0x00,0x00,0x38,0xc0,0x00,0x00,0x00,0x00,0x06,0x60,0x00,0x00,0x00,0x3c,0xe3,0x20,0x00,0x00,0x00,0xc6,0x19,0x30,0x00,0x00,0x00,0x83,0x0d,0x90,0x00,0x00,0x01,0x31,0x84,0x98,0x00,0x00,0x02,0x38,0xc6,0x98,0x00,0x00,0x04,0x90,0x66,0xc8,0x00,0x00,0x09,0xc0,0x30,0x48,0x00,0x00,0x12,0xc7,0x18,0x08,0x00,0x00,0x27,0x03,0x0c,0x00,0x00,0x00,0x43,0x18,0x04,0x00,0x00,0x00,0x98,0x1c,0xe6,0x00,0x00,0x01,0x1c,0x68,0x64,0x00,0x00,0x02,0x08,0x73,0x2c,0x00,0x00,0x04,0x00,0x23,0xd8,0x00,0x00,0x08,0x00,0x0d,0xb0,0x00,0x00,0x10,0x7c,0x0e,0x20,0x00,0x00,0x20,0xfe,0x36,0xc0,0x00,0x00,0x41,0x86,0x31,0x80,0x00,0x00,0x81,0x03,0x3b,0x00,0x00,0x01,0x01,0x03,0x02,0x00,0x00,0x02,0x31,0x83,0x0c,0x00,0x00,0x06,0x31,0x86,0x18,0x00,0x00,0x0d,0xc0,0xfc,0x10,0x00,0x00,0x18,0xc0,0x78,0x20,0x00,0x00,0x26,0x40,0x00,0xc0,0x00,0x00,0x67,0x18,0x00,0x80,0x00,0x00,0xdb,0x1c,0x41,0x00,0x00,0x00,0x9c,0x58,0xe2,0x00,0x00,0x00,0x8c,0xe1,0x64,0x00,0x00,0x00,0x81,0x63,0x88,0x00,0x00,0x00,0xc3,0x81,0x98,0x00,0x00,0x00,0x61,0x8c,0x20,0x00,0x00,0x00,0x10,0x0e,0x60,0x00,0x00,0x00,0x08,0x34,0xc0,0x00,0x00,0x00,0x0c,0x39,0x80,0x00,0x00,0x00,0x02,0x13,0x00,0x00,0x00,0x00,0x01,0x06,0x00,0x00,0x00,0x00,0x00,0xdc,0x00,0x00,0x00,0x00,0x00,0x78,0x00,0x00,0x00,0x00
-};
-
-const unsigned char PROGMEM image_ir_Layer_9_bits[] = {
-    0xc0,0x0c,0xc0,0x0c,0xff,0xfc,0xff,0xfc,0xc0,0x0c,0xc0,0x0c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xff,0xfc,0xff,0xfc,0x03,0x0c,0x03,0x0c,0x0f,0x0c,0x0f,0x0c,0x33,0x0c,0x33,0x0c,0xc0,0xf0,0xc0,0xf0
-};
-
-const unsigned char PROGMEM image_ir_Layer_10_bits[] = {
-    0x00,0x7e,0x00,0x01,0xc3,0x80,0x03,0x00,0xc0,0x00,0x3e,0x00,0x00,0xc3,0x00,0x00,0x00,0x00,0x00,0x3c,0x00,0x00,0x04,0x00,0x00,0x00,0x00,0x04,0x18,0x20,0x06,0x00,0x60,0x03,0x00,0xc0,0x03,0x81,0xc0,0x01,0xc3,0x80,0x00,0xe7,0x00,0x00,0x66,0x00,0x00,0x3c,0x00,0xff,0xff,0xff,0x7f,0xff,0xfe,0x38,0x7e,0x0c,0x18,0xe7,0x18,0x0d,0xc3,0xb0,0x07,0x81,0xe0,0x03,0x00,0xc0,0x00,0x18,0x00,0x00,0x00,0x00,0x00,0x24,0x00,0x00,0x3c,0x00,0x00,0x00,0x00,0x00,0xc3,0x00,0x00,0x3c,0x00,0x03,0x00,0xc0,0x01,0xc3,0x80,0x00,0x7e,0x00
-};
-
-const unsigned char PROGMEM image_ir_Layer_11_bits[] = {
-    0x00,0x00,0x3e,0x00,0x00,0x00,0xc3,0x80,0x80,0x01,0x00,0xc0,0x80,0x02,0x7e,0x40,0xf0,0x00,0xc1,0x00,0xbf,0x00,0x3c,0x00,0x91,0xf0,0x66,0x00,0x8b,0x7e,0x00,0x00,0x86,0x33,0xfc,0x00,0x86,0x33,0xfc,0x00,0x8b,0x7e,0x00,0x00,0x99,0xf0,0x66,0x00,0xbf,0x00,0x1c,0x00,0xf0,0x00,0xc1,0x00,0x80,0x02,0x7e,0x40,0x80,0x03,0x00,0xc0,0x00,0x00,0xc3,0x80,0x00,0x00,0x7e,0x00
-}; 
-
-// RF menu bitmap data
-const unsigned char PROGMEM image_rf_Layer_7_bits[] = {
-    0x0f,0xf0,0x0f,0xf0,0x30,0x00,0x30,0x00,0xc3,0xc0,0xc3,0xc0,0xcc,0x30,0xcc,0x30,0xcc,0x30,0xcc,0x30,0xc3,0xc0,0xc3,0xc0,0xc0,0x00,0xc0,0x00,0xc0,0x00,0xc0,0x00,0xcc,0x00,0xcc,0x00,0xc3,0x00,0xc3,0x00,0xc0,0xc0,0xc0,0xc0,0xcc,0x30,0xcc,0x30,0xc3,0x00,0xc3,0x00,0xc0,0xc0,0xc0,0xc0,0xcc,0x30,0xcc,0x30,0xc3,0x00,0xc3,0x00,0xc0,0xc0,0xc0,0xc0,0xcc,0x30,0xcc,0x30,0xc3,0x00,0xc3,0x00,0xc0,0xc0,0xc0,0xc0,0xcc,0x30,0xcc,0x30,0xc3,0x00,0xc3,0x00,0xc0,0xc0,0xc0,0xc0,0xcc,0x30,0xcc,0x30,0xc3,0x00,0xc3,0x00,0xc0,0xc0,0xc0,0xc0,0xc0,0x30,0xc0,0x30,0xc0,0x00,0xc0,0x00,0x30,0x00,0x30,0x00,0x3c,0x00,0x3c,0x00,0x3f,0x00,0x3f,0x00,0x3f,0xc0,0x3f,0xc0,0x3f,0xf0,0x3f,0xf0,0x33,0xf0,0x33,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0
-};
-
-const unsigned char PROGMEM image_rf_Layer_9_bits[] = {
-    0x3f,0xf8,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x38,0x38,0x08,0x20,0x08,0x20,0x07,0xc0
-};
-
-const unsigned char PROGMEM image_Layer_12_bits[] = {
-    0xff,0xfc,0xff,0xfc,0x03,0x0c,0x03,0x0c,0x0f,0x0c,0x0f,0x0c,0x33,0x0c,0x33,0x0c,0xc0,0xf0,0xc0,0xf0,0x00,0x00,0x00,0x00,0xff,0xfc,0xff,0xfc,0x03,0x0c,0x03,0x0c,0x03,0x0c,0x03,0x0c,0x03,0x0c,0x03,0x0c,0x00,0x0c,0x00,0x0c
-};
-
-const unsigned char PROGMEM image_Layer_13_bits[] = {
-    0x0f,0x00,0x10,0xc0,0x20,0x20,0x20,0x30,0x20,0x10,0x20,0x10,0x20,0x10,0x10,0x20,0x00,0x70,0x00,0x00,0x00,0x00,0x1e,0x10,0x31,0xf0,0x20,0x10,0x20,0x10,0x20,0x00,0x30,0x00,0x10,0x00,0x0f,0x10,0x01,0xf0,0x00,0x10,0x20,0x00,0x30,0x00,0x3f,0x90,0x22,0x70,0x02,0x10,0x02,0x10,0x02,0x10,0x0e,0x10,0x11,0x30,0x20,0xe0,0x00,0x00,0x20,0x00,0x30,0x00,0x3f,0x90,0x22,0x70,0x02,0x10,0x02,0x10,0x02,0x10,0x0e,0x10,0x11,0x30,0x20,0xe0,0x80,0x00,0x80,0x00,0x80,0x00,0x80,0x00,0x80,0x00,0x80,0x00,0x80,0x00,0x80,0x00,0x80,0x00,0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x30,0x20,0x10,0x38,0x10,0x2f,0xd0,0x20,0x30,0x20,0x10,0x00,0x10,0x00,0x10,0x00,0x30,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x10,0x38,0x10,0x27,0xd0,0x20,0x30,0x20,0x10,0x00,0x10,0x00,0x10,0x20,0x00,0x20,0x00,0x3f,0x10,0x20,0xf0,0x00,0x30,0x07,0xc0,0x06,0x00,0x21,0x00,0x20,0xc0,0x3c,0x20,0x27,0xf0,0x00,0x10,0x20,0x10,0x30,0x00,0x3f,0x90,0x21,0x70,0x21,0x10,0x21,0x10,0x23,0x90,0x20,0x10,0x38,0x10,0x00,0x30
-};
-
-const unsigned char PROGMEM image_Layer_14_bits[] = {
-    0x00,0x00,0x00,0x00,0x0f,0xfc,0x00,0x00,0x00,0x00,0x00,0x0f,0xfc,0x00,0x00,0x00,0x00,0x00,0xf0,0x0f,0xc0,0x00,0x00,0x00,0x00,0xf0,0x0f,0xc0,0xc0,0x00,0x00,0x03,0x00,0x00,0xf0,0xc0,0x00,0x00,0x03,0x00,0x00,0xf0,0xc0,0x00,0x00,0x0c,0x3f,0xfc,0x30,0xc0,0x00,0x00,0x0c,0x3f,0xfc,0x30,0xff,0x00,0x00,0x00,0xf0,0x03,0x00,0xff,0x00,0x00,0x00,0xf0,0x03,0x00,0xcf,0xff,0x00,0x00,0x0f,0xf0,0x00,0xcf,0xff,0x00,0x00,0x0f,0xf0,0x00,0xc3,0x03,0xff,0x00,0x3c,0x3c,0x00,0xc3,0x03,0xff,0x00,0x3c,0x3c,0x00,0xc0,0xcf,0x3f,0xfc,0x00,0x00,0x00,0xc0,0xcf,0x3f,0xfc,0x00,0x00,0x00,0xc0,0x3c,0x0f,0x0f,0xff,0xf0,0x00,0xc0,0x3c,0x0f,0x0f,0xff,0xf0,0x00,0xc0,0x3c,0x0f,0x0f,0xff,0xf0,0x00,0xc0,0x3c,0x0f,0x0f,0xff,0xf0,0x00,0xc0,0xcf,0x3f,0xfc,0x00,0x00,0x00,0xc0,0xcf,0x3f,0xfc,0x00,0x00,0x00,0xc3,0xc3,0xff,0x00,0x3c,0x3c,0x00,0xc3,0xc3,0xff,0x00,0x3c,0x3c,0x00,0xcf,0xff,0x00,0x00,0x03,0xf0,0x00,0xcf,0xff,0x00,0x00,0x03,0xf0,0x00,0xff,0x00,0x00,0x00,0xf0,0x03,0x00,0xff,0x00,0x00,0x00,0xf0,0x03,0x00,0xc0,0x00,0x00,0x0c,0x3f,0xfc,0x30,0xc0,0x00,0x00,0x0c,0x3f,0xfc,0x30,0xc0,0x00,0x00,0x0f,0x00,0x00,0xf0,0xc0,0x00,0x00,0x0f,0x00,0x00,0xf0,0x00,0x00,0x00,0x00,0xf0,0x0f,0xc0,0x00,0x00,0x00,0x00,0xf0,0x0f,0xc0,0x00,0x00,0x00,0x00,0x3f,0xfc,0x00,0x00,0x00,0x00,0x00,0x3f,0xfc,0x00
-};
-
-const unsigned char PROGMEM image_Layer_15_bits[] = {
-    0x00,0x00,0x10,0x00,0x00,0xc8,0x00,0x00,0x14,0x00,0x01,0x2a,0x00,0x0c,0x92,0x00,0x12,0x54,0x00,0x29,0x20,0x00,0x52,0x10,0x00,0xa2,0x50,0x01,0x04,0x90,0x02,0x00,0xa0,0x04,0xb1,0x40,0x09,0x12,0x80,0x15,0x11,0x00,0x24,0xb2,0x00,0x48,0x04,0x00,0x96,0x08,0x00,0x68,0xd0,0x00,0x11,0xa0,0x00,0x12,0x40,0x00,0x04,0x80,0x00,0x01,0x00,0x00,0x02,0x00,0x00
-};
-
-const unsigned char PROGMEM image_nrf_4_bits[] = {
-    0x00,0x00,0x01,0x00,0xff,0xff,0xe2,0x80,0x87,0xf8,0x01,0x00,0xa7,0xfc,0xfd,0x40,0x97,0xf8,0x7d,0x00,0x87,0xff,0xe2,0x80,0xa7,0xf8,0xe0,0x80,0x97,0xfd,0xe0,0x00,0x87,0xfa,0xe0,0x00,0xa7,0xdf,0xe0,0x00,0x86,0x1d,0xe0,0x00,0x96,0x1d,0xe0,0x00,0xa4,0x0e,0xe0,0x00,0x84,0x0d,0xe0,0x00,0x94,0x0e,0xe0,0x00,0xa7,0xd9,0xe0,0x00,0x87,0xf8,0xe0,0x00,0xff,0xff,0xe0,0x00
-};
-
-// NRF menu bitmap data
-const unsigned char PROGMEM image_nrf_Layer_7_bits[] = {
-    0x0f,0xf0,0x0f,0xf0,0x30,0x00,0x30,0x00,0xc3,0xc0,0xc3,0xc0,0xcc,0x30,0xcc,0x30,0xcc,0x30,0xcc,0x30,0xc3,0xc0,0xc3,0xc0,0xc0,0x00,0xc0,0x00,0xc0,0x00,0xc0,0x00,0xcc,0x00,0xcc,0x00,0xc3,0x00,0xc3,0x00,0xc0,0xc0,0xc0,0xc0,0xcc,0x30,0xcc,0x30,0xc3,0x00,0xc3,0x00,0xc0,0xc0,0xc0,0xc0,0xcc,0x30,0xcc,0x30,0xc3,0x00,0xc3,0x00,0xc0,0xc0,0xc0,0xc0,0xcc,0x30,0xcc,0x30,0xc3,0x00,0xc3,0x00,0xc0,0xc0,0xc0,0xc0,0xcc,0x30,0xcc,0x30,0xc3,0x00,0xc3,0x00,0xc0,0xc0,0xc0,0xc0,0xcc,0x30,0xcc,0x30,0xc3,0x00,0xc3,0x00,0xc0,0xc0,0xc0,0xc0,0xc0,0x30,0xc0,0x30,0xc0,0x00,0xc0,0x00,0x30,0x00,0x30,0x00,0x3c,0x00,0x3c,0x00,0x3f,0x00,0x3f,0x00,0x3f,0xc0,0x3f,0xc0,0x3f,0xf0,0x3f,0xf0,0x33,0xf0,0x33,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0
-};
-
-const unsigned char PROGMEM image_nrf_Layer_9_bits[] = {
-    0x3f,0xf8,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x38,0x38,0x08,0x20,0x08,0x20,0x07,0xc0
-};
-
-const unsigned char PROGMEM image_nrf_Layer_13_bits[] = {
-    0x0f,0x00,0x10,0xc0,0x20,0x20,0x20,0x30,0x20,0x10,0x20,0x10,0x20,0x10,0x10,0x20,0x00,0x70,0x00,0x00,0x00,0x00,0x1e,0x10,0x31,0xf0,0x20,0x10,0x20,0x10,0x20,0x00,0x30,0x00,0x10,0x00,0x0f,0x10,0x01,0xf0,0x00,0x10,0x20,0x00,0x30,0x00,0x3f,0x90,0x22,0x70,0x02,0x10,0x02,0x10,0x02,0x10,0x0e,0x10,0x11,0x30,0x20,0xe0,0x00,0x00,0x20,0x00,0x30,0x00,0x3f,0x90,0x22,0x70,0x02,0x10,0x02,0x10,0x02,0x10,0x0e,0x10,0x11,0x30,0x20,0xe0,0x80,0x00,0x80,0x00,0x80,0x00,0x80,0x00,0x80,0x00,0x80,0x00,0x80,0x00,0x80,0x00,0x80,0x00,0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x30,0x20,0x10,0x38,0x10,0x2f,0xd0,0x20,0x30,0x20,0x10,0x00,0x10,0x00,0x10,0x00,0x30,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x10,0x38,0x10,0x27,0xd0,0x20,0x30,0x20,0x10,0x00,0x10,0x00,0x10,0x20,0x00,0x20,0x00,0x3f,0x10,0x20,0xf0,0x00,0x30,0x07,0xc0,0x06,0x00,0x21,0x00,0x20,0xc0,0x3c,0x20,0x27,0xf0,0x00,0x10,0x20,0x10,0x30,0x00,0x3f,0x90,0x21,0x70,0x21,0x10,0x21,0x10,0x23,0x90,0x20,0x10,0x38,0x10,0x00,0x30
-};
-
-const unsigned char PROGMEM image_nrf_Layer_14_bits[] = {
-    0x00,0x00,0x3e,0x00,0x00,0x00,0xc3,0x80,0x80,0x01,0x00,0xc0,0x80,0x02,0x7e,0x40,0xf0,0x00,0xc1,0x00,0xbf,0x00,0x3c,0x00,0x91,0xf0,0x66,0x00,0x8b,0x7e,0x00,0x00,0x86,0x33,0xfc,0x00,0x86,0x33,0xfc,0x00,0x8b,0x7e,0x00,0x00,0x99,0xf0,0x66,0x00,0xbf,0x00,0x1c,0x00,0xf0,0x00,0xc1,0x00,0x80,0x02,0x7e,0x40,0x80,0x03,0x00,0xc0,0x00,0x00,0xc3,0x80,0x00,0x00,0x7e,0x00
-};
-
-const unsigned char PROGMEM image__5ti7rmt_RADIOradio_bits[] = {
-    0xe0,0x00,0x00,0x40,0x02,0x00,0x69,0xcc,0x00,0x07,0xcc,0x00,0x51,0xcc,0x00,0x77,0xc5,0x00,0x77,0xc5,0x00,0x77,0xfd,0x00,0x71,0xfc,0x80,0x72,0x0c,0xe0,0x74,0x0c,0xd0,0x71,0xfc,0xf0,0x75,0xfd,0xf8,0x75,0xfd,0xfc,0x75,0xfc,0x3c,0x75,0xfc,0xb4,0x75,0xfd,0x2e,0x75,0xfd,0xda,0x71,0xfd,0xdc,0x74,0x0c,0xb0,0x76,0x04,0xa0,0x77,0xfc,0x00,0x77,0xfc,0x00,0x56,0x44,0x00,0x06,0x64,0x00,0x04,0xc8,0x00,0x01,0xf0,0x00
-};
-
-const unsigned char PROGMEM image_nrf_1_bits[] = {
-    0x00,0x00,0x00,0x00,0x00,0x08,0xff,0xff,0xff,0xff,0xe0,0x0c,0xff,0xff,0xff,0xff,0xe0,0x26,0xc0,0xff,0xff,0xff,0xe0,0x32,0xc0,0x7f,0xff,0x00,0x00,0x13,0xcc,0x7f,0xff,0xf1,0xff,0x99,0xda,0x7f,0xff,0xc7,0xff,0x99,0xda,0x7f,0xff,0x1f,0xff,0x99,0xcc,0x7f,0xff,0x01,0xff,0x11,0xc0,0x7f,0xff,0xfc,0x00,0x13,0xc0,0x7f,0xff,0xff,0xe0,0x32,0xce,0x7f,0xff,0x01,0xe0,0x26,0xd2,0x7f,0xff,0x01,0xe0,0x0c,0xce,0x7f,0xff,0xc9,0xe0,0x08,0xc0,0x7f,0xff,0xc9,0xe0,0x00,0xc0,0x7f,0xff,0x01,0xe0,0x00,0xcc,0x7f,0xff,0x63,0xe0,0x00,0xda,0x7f,0x5f,0xff,0xe0,0x00,0xda,0x7d,0x5f,0x01,0xe0,0x00,0xcc,0x7d,0x5f,0x01,0xe0,0x00,0xc0,0x70,0x07,0xc9,0xe0,0x00,0xc0,0x40,0x03,0xc9,0xe0,0x00,0xce,0x70,0x07,0xc9,0xe0,0x00,0xd2,0x40,0x03,0x7f,0xe0,0x00,0xce,0x70,0x07,0x33,0xe0,0x00,0xc0,0x40,0x03,0x19,0xe0,0x00,0xc0,0x70,0x07,0x41,0xe0,0x00,0xcc,0x40,0x03,0x73,0xe0,0x00,0xda,0x70,0x07,0x9f,0xe0,0x00,0xda,0x7d,0x5f,0x8f,0xe0,0x00,0xce,0x7d,0x5f,0xb3,0xe0,0x00,0xc0,0x7f,0xff,0x01,0xe0,0x00,0xc0,0xff,0xff,0xbf,0xe0,0x00,0xff,0xff,0xff,0xff,0xe0,0x00,0xff,0xff,0xff,0xff,0xe0,0x00
-};
-
-const unsigned char PROGMEM image_nrf_Layer_17_bits[] = {
-    0xff,0xfc,0xff,0xfc,0x00,0xc0,0x00,0xc0,0x03,0x00,0x03,0x00,0x0c,0x00,0x0c,0x00,0xff,0xfc,0xff,0xfc,0x00,0x00,0x00,0x00,0xff,0xfc,0xff,0xfc,0x03,0x0c,0x03,0x0c,0x0f,0x0c,0x0f,0x0c,0x33,0x0c,0x33,0x0c,0xc0,0xf0,0xc0,0xf0,0x00,0x00,0x00,0x00,0xff,0xfc,0xff,0xfc,0x03,0x0c,0x03,0x0c,0x03,0x0c,0x03,0x0c,0x03,0x0c,0x03,0x0c,0x00,0x0c,0x00,0x0c
-};
-
-// Radio menu bitmap data
-const unsigned char PROGMEM image_radio_Layer_2_bits[] = {
-    0x3f,0xf8,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x38,0x38,0x08,0x20,0x08,0x20,0x07,0xc0
-};
-
-const unsigned char PROGMEM image_radio_Layer_3_bits[] = {
-    0x0f,0xf0,0x0f,0xf0,0x30,0x00,0x30,0x00,0xc3,0xc0,0xc3,0xc0,0xcc,0x30,0xcc,0x30,0xcc,0x30,0xcc,0x30,0xc3,0xc0,0xc3,0xc0,0xc0,0x00,0xc0,0x00,0xc0,0x00,0xc0,0x00,0xcc,0x00,0xcc,0x00,0xc3,0x00,0xc3,0x00,0xc0,0xc0,0xc0,0xc0,0xcc,0x30,0xcc,0x30,0xc3,0x00,0xc3,0x00,0xc0,0xc0,0xc0,0xc0,0xcc,0x30,0xcc,0x30,0xc3,0x00,0xc3,0x00,0xc0,0xc0,0xc0,0xc0,0xcc,0x30,0xcc,0x30,0xc3,0x00,0xc3,0x00,0xc0,0xc0,0xc0,0xc0,0xcc,0x30,0xcc,0x30,0xc3,0x00,0xc3,0x00,0xc0,0xc0,0xc0,0xc0,0xcc,0x30,0xcc,0x30,0xc3,0x00,0xc3,0x00,0xc0,0xc0,0xc0,0xc0,0xc0,0x30,0xc0,0x30,0xc0,0x00,0xc0,0x00,0x30,0x00,0x30,0x00,0x3c,0x00,0x3c,0x00,0x3f,0x00,0x3f,0x00,0x3f,0xc0,0x3f,0xc0,0x3f,0xf0,0x3f,0xf0,0x33,0xf0,0x33,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0
-};
-
-const unsigned char PROGMEM image_radio_Layer_6_bits[] = {
-    0x70,0x00,0x00,0x00,0x00,0x00,0xf8,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x70,0x00,0x00,0x70,0x00,0x00,0x18,0x00,0x00,0x02,0x3e,0xb5,0xc8,0x00,0x00,0x38,0x82,0xb5,0xe0,0x00,0x00,0x0e,0x1a,0xb5,0xe0,0x00,0x00,0x00,0x3a,0xb5,0xe0,0x00,0x00,0x78,0x1a,0xb5,0xe0,0x00,0x00,0x77,0x46,0xb5,0xe4,0x00,0x00,0x67,0x7e,0xb5,0xe6,0x00,0x00,0x6f,0x7e,0xb5,0x66,0x00,0x00,0x6f,0x7e,0xb5,0x66,0x00,0x00,0x6f,0x7e,0xb5,0x67,0x00,0x00,0x6f,0x3e,0xb5,0x67,0x00,0x00,0x6f,0x3f,0xff,0xe3,0x00,0x00,0x6f,0x3e,0x22,0x23,0x00,0x00,0x6f,0x03,0xaa,0xa0,0xc0,0x00,0x6f,0x6f,0xba,0xa7,0x70,0x00,0x6f,0x4c,0x00,0xe1,0xec,0x00,0x6f,0x43,0xff,0x27,0xfc,0x00,0x6f,0x64,0x00,0xe5,0xf6,0x00,0x6f,0x77,0xff,0xe5,0xf7,0x00,0x6f,0x47,0xff,0xe5,0xfb,0x00,0x6f,0x67,0xff,0xe7,0xfb,0x80,0x6f,0x67,0xff,0xe6,0xff,0xc0,0x6f,0x47,0xff,0xe6,0xfe,0x00,0x6f,0x67,0xff,0xe6,0xfe,0xe0,0x6f,0x67,0xff,0xe7,0xe3,0x80,0x6f,0x67,0xff,0xe5,0x1f,0xe0,0x6f,0x67,0xff,0xe2,0xf9,0x70,0x6f,0x67,0xff,0xe5,0xce,0x34,0x6f,0x47,0xff,0xe3,0x77,0x3c,0x6f,0x77,0xff,0xe7,0x1c,0xfc,0x6f,0x47,0xff,0xe7,0x67,0x1c,0x6f,0x67,0xff,0xe7,0xf3,0x98,0x6f,0x67,0xff,0xe7,0x9c,0xe8,0x6f,0x47,0xff,0xe3,0xb3,0xb0,0x6f,0x77,0xff,0xe1,0xb9,0xc0,0x6f,0x74,0x00,0xe1,0x8e,0x40,0x6f,0x77,0xff,0xa0,0xf3,0x00,0x6f,0x7c,0x00,0x60,0xd8,0x00,0x6f,0x62,0x22,0x20,0x00,0x00,0x6f,0x7b,0xba,0xa0,0x00,0x00,0x6f,0x6a,0xaa,0xa0,0x00,0x00,0x6f,0x7f,0xff,0xe0,0x00,0x00,0x77,0x72,0xe0,0xe0,0x00,0x00,0x73,0x6d,0x65,0x60,0x00,0x00,0x7c,0x6f,0x7d,0x60,0x00,0x00,0x00,0x6d,0x6d,0x60,0x00,0x00,0x00,0x61,0x61,0x60,0x00,0x00,0x00,0x30,0xf0,0xc0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0xff,0x00,0x00,0x00
-};
-
-const unsigned char PROGMEM image_radio_Layer_7_bits[] = {
-    0x0f,0x00,0x10,0xc0,0x20,0x20,0x20,0x30,0x20,0x10,0x20,0x10,0x20,0x10,0x10,0x20,0x00,0x70,0x00,0x00,0x00,0x00,0x1e,0x10,0x31,0xf0,0x20,0x10,0x20,0x10,0x20,0x00,0x30,0x00,0x10,0x00,0x0f,0x10,0x01,0xf0,0x00,0x10,0x20,0x00,0x30,0x00,0x3f,0x90,0x22,0x70,0x02,0x10,0x02,0x10,0x02,0x10,0x0e,0x10,0x11,0x30,0x20,0xe0,0x00,0x00,0x20,0x00,0x30,0x00,0x3f,0x90,0x22,0x70,0x02,0x10,0x02,0x10,0x02,0x10,0x0e,0x10,0x11,0x30,0x20,0xe0,0x80,0x00,0x80,0x00,0x80,0x00,0x80,0x00,0x80,0x00,0x80,0x00,0x80,0x00,0x80,0x00,0x80,0x00,0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x30,0x20,0x10,0x38,0x10,0x2f,0xd0,0x20,0x30,0x20,0x10,0x00,0x10,0x00,0x10,0x00,0x30,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x10,0x38,0x10,0x27,0xd0,0x20,0x30,0x20,0x10,0x00,0x10,0x00,0x10,0x20,0x00,0x20,0x00,0x3f,0x10,0x20,0xf0,0x00,0x30,0x07,0xc0,0x06,0x00,0x21,0x00,0x20,0xc0,0x3c,0x20,0x27,0xf0,0x00,0x10,0x20,0x10,0x30,0x00,0x3f,0x90,0x21,0x70,0x21,0x10,0x21,0x10,0x23,0x90,0x20,0x10,0x38,0x10,0x00,0x30
-};
-
-const unsigned char PROGMEM image_radio_Layer_8_bits[] = {
-    0xff,0xfc,0xff,0xfc,0x03,0x0c,0x03,0x0c,0x0f,0x0c,0x0f,0x0c,0x33,0x0c,0x33,0x0c,0xc0,0xf0,0xc0,0xf0,0x00,0x00,0x00,0x00,0xff,0xc0,0xff,0xc0,0x0c,0x30,0x0c,0x30,0x0c,0x0c,0x0c,0x0c,0x0c,0x30,0x0c,0x30,0xff,0xc0,0xff,0xc0,0x00,0x00,0x00,0x00,0xff,0xfc,0xff,0xfc,0xc0,0x0c,0xc0,0x0c,0xc0,0x0c,0xc0,0x0c,0xc0,0x0c,0xc0,0x0c,0x3f,0xf0,0x3f,0xf0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xc0,0x0c,0xc0,0x0c,0xff,0xfc,0xff,0xfc,0xc0,0x0c,0xc0,0x0c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3f,0xf0,0x3f,0xf0,0xc0,0x0c,0xc0,0x0c,0xc0,0x0c,0xc0,0x0c,0xc0,0x0c,0xc0,0x0c,0x3f,0xf0,0x3f,0xf0
-};
-
-const unsigned char PROGMEM image_cwg9wyw_black_white_simple_bit_vector_pixel_art_icon_geolocation_map_pin_black_white_simple_flat_bit_vector_pixel_art_icon_312637465black_white_simple_bit_vector_pixel_art_icon_geolocation_map_pin_black_white_simple_flat_bit_vector_pixel_art_icon_312637465_bits[] = {
-    0x00,0x1f,0x00,0x00,0x7f,0x80,0x01,0xff,0xf0,0x0f,0xc0,0x70,0x1f,0xc0,0x38,0x3f,0x80,0x18,0x7f,0x80,0x08,0xff,0x80,0x08,0xff,0x80,0x08,0x7f,0x80,0x08,0x3f,0x80,0x18,0x1f,0x80,0x18,0x0f,0xc0,0x70,0x07,0xf0,0xf0,0x00,0xff,0xe0,0x00,0x7f,0x80
-};
-
-// GPS menu bitmap data
-const unsigned char PROGMEM image_gps_Layer_2_bits[] = {
-    0x3f,0xf8,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x38,0x38,0x08,0x20,0x08,0x20,0x07,0xc0
-};
-
-const unsigned char PROGMEM image_gps_Layer_3_bits[] = {
-    0x0f,0xf0,0x0f,0xf0,0x30,0x00,0x30,0x00,0xc3,0xc0,0xc3,0xc0,0xcc,0x30,0xcc,0x30,0xcc,0x30,0xcc,0x30,0xc3,0xc0,0xc3,0xc0,0xc0,0x00,0xc0,0x00,0xc0,0x00,0xc0,0x00,0xcc,0x00,0xcc,0x00,0xc3,0x00,0xc3,0x00,0xc0,0xc0,0xc0,0xc0,0xcc,0x30,0xcc,0x30,0xc3,0x00,0xc3,0x00,0xc0,0xc0,0xc0,0xc0,0xcc,0x30,0xcc,0x30,0xc3,0x00,0xc3,0x00,0xc0,0xc0,0xc0,0xc0,0xcc,0x30,0xcc,0x30,0xc3,0x00,0xc3,0x00,0xc0,0xc0,0xc0,0xc0,0xcc,0x30,0xcc,0x30,0xc3,0x00,0xc3,0x00,0xc0,0xc0,0xc0,0xc0,0xcc,0x30,0xcc,0x30,0xc3,0x00,0xc3,0x00,0xc0,0xc0,0xc0,0xc0,0xc0,0x30,0xc0,0x30,0xc0,0x00,0xc0,0x00,0x30,0x00,0x30,0x00,0x3c,0x00,0x3c,0x00,0x3f,0x00,0x3f,0x00,0x3f,0xc0,0x3f,0xc0,0x3f,0xf0,0x3f,0xf0,0x33,0xf0,0x33,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0
-};
-
-const unsigned char PROGMEM image_gps_Layer_6_bits[] = {
-    0x40,0x00,0x00,0x00,0x04,0x00,0x17,0xca,0x00,0x33,0xcc,0x00,0x63,0xcc,0x00,0x57,0xcd,0x00,0x77,0xc5,0x00,0x77,0xc5,0x00,0x77,0x55,0x00,0x77,0xfd,0x40,0x71,0xf5,0xe0,0x75,0xfc,0xd0,0x75,0xfd,0xf8,0x71,0xfd,0xf0,0x75,0xfd,0xd8,0x75,0xfd,0xe4,0x71,0xfd,0x56,0x71,0xfd,0x52,0x75,0xfd,0xae,0x75,0xfc,0xe8,0x75,0xfc,0xd0,0x75,0x54,0x00,0x77,0xfc,0x00,0x55,0xcc,0x00,0x67,0x64,0x00,0x04,0x44,0x00,0x00,0x00,0x00
-};
-
-const unsigned char PROGMEM image_gps_Layer_7_bits[] = {
-    0x0f,0x00,0x10,0xc0,0x20,0x20,0x20,0x30,0x20,0x10,0x20,0x10,0x20,0x10,0x10,0x20,0x00,0x70,0x00,0x00,0x00,0x00,0x1e,0x10,0x31,0xf0,0x20,0x10,0x20,0x10,0x20,0x00,0x30,0x00,0x10,0x00,0x0f,0x10,0x01,0xf0,0x00,0x10,0x20,0x00,0x30,0x00,0x3f,0x90,0x22,0x70,0x02,0x10,0x02,0x10,0x02,0x10,0x0e,0x10,0x11,0x30,0x20,0xe0,0x00,0x00,0x20,0x00,0x30,0x00,0x3f,0x90,0x22,0x70,0x02,0x10,0x02,0x10,0x02,0x10,0x0e,0x10,0x11,0x30,0x20,0xe0,0x80,0x00,0x80,0x00,0x80,0x00,0x80,0x00,0x80,0x00,0x80,0x00,0x80,0x00,0x80,0x00,0x80,0x00,0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x30,0x20,0x10,0x38,0x10,0x2f,0xd0,0x20,0x30,0x20,0x10,0x00,0x10,0x00,0x10,0x00,0x30,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x10,0x38,0x10,0x27,0xd0,0x20,0x30,0x20,0x10,0x00,0x10,0x00,0x10,0x20,0x00,0x20,0x00,0x3f,0x10,0x20,0xf0,0x00,0x30,0x07,0xc0,0x06,0x00,0x21,0x00,0x20,0xc0,0x3c,0x20,0x27,0xf0,0x00,0x10,0x20,0x10,0x30,0x00,0x3f,0x90,0x21,0x70,0x21,0x10,0x21,0x10,0x23,0x90,0x20,0x10,0x38,0x10,0x00,0x30
-};
-
-const unsigned char PROGMEM image_gps_Layer_8_bits[] = {
-    0x00,0x00,0x03,0xfe,0x00,0x00,0x00,0x00,0x3f,0xff,0xc0,0x00,0x00,0x00,0x3f,0xff,0xc0,0x00,0x00,0x01,0xff,0xff,0xf8,0x00,0x00,0x07,0xff,0xff,0xfc,0x00,0x00,0x3f,0xfe,0x00,0xff,0x00,0x00,0xff,0xf0,0x00,0x3f,0x00,0x00,0xff,0xf0,0x00,0x3f,0x00,0x03,0xff,0xe0,0x00,0x0f,0x80,0x07,0xff,0xc0,0x00,0x07,0x80,0x0f,0xff,0xc0,0x00,0x07,0x80,0x0f,0xff,0xc0,0x00,0x07,0x80,0x3f,0xff,0x80,0x00,0x03,0xc0,0x7f,0xff,0x80,0x00,0x03,0xc0,0xff,0xff,0x80,0x00,0x03,0xc0,0xff,0xff,0x80,0x00,0x03,0xc0,0xff,0xff,0x80,0x00,0x03,0xc0,0xff,0xff,0x80,0x00,0x03,0xc0,0x7f,0xff,0x80,0x00,0x03,0xc0,0x3f,0xff,0x80,0x00,0x03,0xc0,0x0f,0xff,0xc0,0x00,0x07,0x80,0x0f,0xff,0xc0,0x00,0x07,0x80,0x07,0xff,0xc0,0x00,0x07,0x80,0x03,0xff,0xe0,0x00,0x0f,0x80,0x00,0xff,0xf0,0x00,0x3f,0x00,0x00,0xff,0xf0,0x00,0x3f,0x00,0x00,0x3f,0xfe,0x00,0xff,0x00,0x00,0x07,0xff,0xff,0xfc,0x00,0x00,0x01,0xff,0xff,0xf8,0x00,0x00,0x00,0x3f,0xff,0xc0,0x00,0x00,0x00,0x3f,0xff,0xc0,0x00,0x00,0x00,0x03,0xfe,0x00,0x00
-};
-
-const unsigned char PROGMEM image_gps_Layer_9_bits[] = {
-    0x00,0x70,0x00,0x80,0x06,0x7a,0x03,0x80,0x0f,0x01,0x8e,0x80,0x1f,0x39,0xde,0x80,0x1f,0x7c,0x5d,0x80,0x1e,0x7e,0x53,0x80,0x20,0x7e,0x13,0x00,0xef,0x3d,0xce,0x00,0xef,0xbd,0xc2,0x00,0xef,0x81,0xc0,0x00,0xef,0xbd,0xc6,0x00,0x27,0x7c,0x4f,0x00,0x08,0x7e,0x13,0x00,0x1e,0x7e,0x53,0x80,0x1f,0x7d,0xdd,0x80,0x1f,0x39,0xde,0x80,0x0f,0x33,0x8f,0x80,0x00,0xf8,0x01,0x80,0x00,0x70,0x00,0x80
-};
-
-const unsigned char PROGMEM image_gps_Layer_10_bits[] = {
-    0x3f,0xf0,0x3f,0xf0,0xc0,0x0c,0xc0,0x0c,0xc0,0x0c,0xc0,0x0c,0xcc,0x0c,0xcc,0x0c,0xfc,0x3c,0xfc,0x3c,0x00,0x00,0x00,0x00,0xff,0xfc,0xff,0xfc,0x03,0x0c,0x03,0x0c,0x03,0x0c,0x03,0x0c,0x03,0x0c,0x03,0x0c,0x00,0xf0,0x00,0xf0,0x00,0x00,0x00,0x00,0x30,0xf0,0x30,0xf0,0xc3,0x0c,0xc3,0x0c,0xc3,0x0c,0xc3,0x0c,0xc3,0x0c,0xc3,0x0c,0x3c,0x30,0x3c,0x30
-};
-
-// RPI menu bitmap data
-const unsigned char PROGMEM image_rpi_Layer_2_bits[] = {
-    0x3f,0xf8,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x38,0x38,0x08,0x20,0x08,0x20,0x07,0xc0
-};
-
-const unsigned char PROGMEM image_rpi_Layer_3_bits[] = {
-    0x0f,0xf0,0x0f,0xf0,0x30,0x00,0x30,0x00,0xc3,0xc0,0xc3,0xc0,0xcc,0x30,0xcc,0x30,0xcc,0x30,0xcc,0x30,0xc3,0xc0,0xc3,0xc0,0xc0,0x00,0xc0,0x00,0xc0,0x00,0xc0,0x00,0xcc,0x00,0xcc,0x00,0xc3,0x00,0xc3,0x00,0xc0,0xc0,0xc0,0xc0,0xcc,0x30,0xcc,0x30,0xc3,0x00,0xc3,0x00,0xc0,0xc0,0xc0,0xc0,0xcc,0x30,0xcc,0x30,0xc3,0x00,0xc3,0x00,0xc0,0xc0,0xc0,0xc0,0xcc,0x30,0xcc,0x30,0xc3,0x00,0xc3,0x00,0xc0,0xc0,0xc0,0xc0,0xcc,0x30,0xcc,0x30,0xc3,0x00,0xc3,0x00,0xc0,0xc0,0xc0,0xc0,0xcc,0x30,0xcc,0x30,0xc3,0x00,0xc3,0x00,0xc0,0xc0,0xc0,0xc0,0xc0,0x30,0xc0,0x30,0xc0,0x00,0xc0,0x00,0x30,0x00,0x30,0x00,0x3c,0x00,0x3c,0x00,0x3f,0x00,0x3f,0x00,0x3f,0xc0,0x3f,0xc0,0x3f,0xf0,0x3f,0xf0,0x33,0xf0,0x33,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0
-};
-
-const unsigned char PROGMEM image_rpi_Layer_6_bits[] = {
-    0x00,0x00,0x3e,0x00,0x00,0x00,0xc0,0x00,0x00,0x3e,0x00,0x00,0x01,0xc0,0x00,0x01,0xff,0x80,0x00,0x07,0xc0,0x00,0x38,0x3f,0x8c,0x00,0x1f,0xc0,0x00,0xfe,0x0e,0x0f,0x80,0xff,0xc0,0x00,0xfe,0x00,0x03,0x80,0xf8,0xc0,0x00,0xfe,0x00,0x03,0x80,0xf8,0xc0,0x07,0xfe,0x0f,0x83,0xe3,0xf8,0xc0,0x07,0xfe,0x3f,0xf3,0xe3,0xe7,0xc0,0x07,0xfe,0x3f,0xf0,0x63,0xe7,0xc0,0x07,0xf8,0x3f,0xfc,0x63,0x1f,0xc0,0x07,0xf8,0x3f,0xfc,0x63,0x1f,0xc0,0x00,0xc0,0x3f,0xfc,0x03,0x1f,0x00,0x18,0x00,0x3f,0xfc,0x03,0x1f,0x00,0x18,0x3e,0x3f,0xf0,0x60,0xff,0x00,0xf8,0xfe,0x0f,0xf3,0xe0,0xf8,0x00,0xf8,0xfe,0x0f,0xf3,0xe0,0xf8,0x00,0xf8,0xff,0xcf,0xf3,0xe0,0x18,0x00,0xf8,0xff,0xc0,0x03,0xe0,0x00,0x00,0xf8,0xff,0xc0,0x03,0xe0,0x00,0x00,0xf8,0xff,0xcf,0xf3,0xe0,0x18,0x00,0xf8,0xff,0xcf,0xf3,0xe0,0x38,0x00,0xf8,0xfe,0x0f,0xf3,0xe0,0xf8,0x00,0x18,0x3e,0x3f,0xf0,0x60,0xff,0x00,0x18,0x00,0x3f,0xfc,0x03,0x1f,0x00,0x00,0xc0,0x3f,0xfc,0x03,0x1f,0x00,0x00,0xc0,0x3f,0xfc,0x03,0x1f,0x00,0x07,0xf8,0x3f,0xfc,0x63,0x1f,0xc0,0x07,0xfe,0x3f,0xf0,0x63,0xe7,0xc0,0x07,0xfe,0x3f,0xf3,0xe3,0xe7,0xc0,0x07,0xfe,0x0f,0x83,0xe3,0xf8,0xc0,0x07,0xfe,0x0f,0x83,0xe3,0xf8,0xc0,0x00,0xfe,0x00,0x03,0x80,0xf8,0xc0,0x00,0xfe,0x0e,0x0f,0x80,0xff,0xc0,0x00,0x38,0x3f,0x8c,0x00,0x1f,0xc0,0x00,0x01,0xff,0x80,0x00,0x07,0xc0,0x00,0x01,0xff,0x80,0x00,0x07,0xc0,0x00,0x00,0x3e,0x00,0x00,0x00,0xc0
-};
-
-const unsigned char PROGMEM image_rpi_Layer_7_bits[] = {
-    0x0f,0x00,0x10,0xc0,0x20,0x20,0x20,0x30,0x20,0x10,0x20,0x10,0x20,0x10,0x10,0x20,0x00,0x70,0x00,0x00,0x00,0x00,0x1e,0x10,0x31,0xf0,0x20,0x10,0x20,0x10,0x20,0x00,0x30,0x00,0x10,0x00,0x0f,0x10,0x01,0xf0,0x00,0x10,0x20,0x00,0x30,0x00,0x3f,0x90,0x22,0x70,0x02,0x10,0x02,0x10,0x02,0x10,0x0e,0x10,0x11,0x30,0x20,0xe0,0x00,0x00,0x20,0x00,0x30,0x00,0x3f,0x90,0x22,0x70,0x02,0x10,0x02,0x10,0x02,0x10,0x0e,0x10,0x11,0x30,0x20,0xe0,0x80,0x00,0x80,0x00,0x80,0x00,0x80,0x00,0x80,0x00,0x80,0x00,0x80,0x00,0x80,0x00,0x80,0x00,0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x30,0x20,0x10,0x38,0x10,0x2f,0xd0,0x20,0x30,0x20,0x10,0x00,0x10,0x00,0x10,0x00,0x30,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x10,0x38,0x10,0x27,0xd0,0x20,0x30,0x20,0x10,0x00,0x10,0x00,0x10,0x20,0x00,0x20,0x00,0x3f,0x10,0x20,0xf0,0x00,0x30,0x07,0xc0,0x06,0x00,0x21,0x00,0x20,0xc0,0x3c,0x20,0x27,0xf0,0x00,0x10,0x20,0x10,0x30,0x00,0x3f,0x90,0x21,0x70,0x21,0x10,0x21,0x10,0x23,0x90,0x20,0x10,0x38,0x10,0x00,0x30
-};
-
-const unsigned char PROGMEM image_rpi_Layer_8_bits[] = {
-    0x1f,0xf8,0x15,0x58,0x12,0x48,0x12,0x48,0x12,0x48,0x12,0x48,0x10,0x08,0x3f,0xfc,0x60,0x06,0xc0,0x03,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x83,0xc1,0x8e,0xf1,0x88,0x19,0x90,0x09,0x90,0x0d,0xb0,0x05,0xb2,0x25,0xb6,0x75,0xb6,0x35,0xb0,0x85,0x91,0x8d,0x9c,0x39,0x84,0x31,0x87,0xe1,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0xc0,0x03,0x75,0x5e,0x1f,0xf8
-};
-
-const unsigned char PROGMEM image_rpi_Layer_9_bits[] = {
-    0xff,0xfc,0xff,0xfc,0x03,0x0c,0x03,0x0c,0x0f,0x0c,0x0f,0x0c,0x33,0x0c,0x33,0x0c,0xc0,0xf0,0xc0,0xf0,0x00,0x00,0x00,0x00,0xff,0xfc,0xff,0xfc,0x03,0x0c,0x03,0x0c,0x03,0x0c,0x03,0x0c,0x03,0x0c,0x03,0x0c,0x00,0xf0,0x00,0xf0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xc0,0x0c,0xc0,0x0c,0xff,0xfc,0xff,0xfc,0xc0,0x0c,0xc0,0x0c
-};
-
-const unsigned char PROGMEM image_black_white_simple_bit_vector_pixel_art_icon_geolocation_map_pin_black_white_simple_flat_bit_vector_pixel_art_icon_312637465_312637466_bits[] = {
-    0x00,0x00,0xfe,0x00,0x00,0x07,0xff,0xc0,0x00,0x1f,0xff,0xf0,0x00,0x3f,0xff,0xf8,0x00,0xff,0x80,0xf8,0x03,0xfe,0x00,0x38,0x07,0xfc,0x00,0x1c,0x0f,0xf8,0x00,0x0c,0x1f,0xf8,0x00,0x0c,0x3f,0xf0,0x00,0x06,0x7f,0xf0,0x00,0x06,0xff,0xf0,0x00,0x06,0xff,0xf0,0x00,0x06,0xff,0xf0,0x00,0x06,0x7f,0xf0,0x00,0x06,0x3f,0xf0,0x00,0x06,0x1f,0xf8,0x00,0x0c,0x07,0xfc,0x00,0x1c,0x03,0xfe,0x00,0x38,0x00,0xff,0x80,0xf8,0x00,0x3f,0xff,0xf8,0x00,0x1f,0xff,0xf0,0x00,0x07,0xff,0xc0,0x00,0x00,0xfe,0x00
-};
-
-const unsigned char PROGMEM image_rpi_Layer_10_bits[] = {
-    0x3f,0xf0,0x3f,0xf0,0xc0,0x0c,0xc0,0x0c,0xc0,0x0c,0xc0,0x0c,0xc0,0x0c,0xc0,0x0c,0x30,0x30,0x30,0x30,0x00,0x00,0x00,0x00,0x3f,0xf0,0x3f,0xf0,0xc0,0x0c,0xc0,0x0c,0xc0,0x0c,0xc0,0x0c,0xc0,0x0c,0xc0,0x0c,0x3f,0xf0,0x3f,0xf0,0x00,0x00,0x00,0x00,0xff,0xfc,0xff,0xfc,0x00,0xc0,0x00,0xc0,0x03,0x00,0x03,0x00,0x0c,0x00,0x0c,0x00,0xff,0xfc,0xff,0xfc,0x00,0x00,0x00,0x00,0xff,0xfc,0xff,0xfc,0x00,0xc0,0x00,0xc0,0x03,0x00,0x03,0x00,0x0c,0x00,0x0c,0x00,0xff,0xfc,0xff,0xfc,0x00,0x00,0x00,0x00,0xff,0xfc,0xff,0xfc,0xc3,0x0c,0xc3,0x0c,0xc3,0x0c,0xc3,0x0c,0xc3,0x0c,0xc3,0x0c,0xc0,0x0c,0xc0,0x0c,0x00,0x00,0x00,0x00,0x3f,0xf0,0x3f,0xf0,0xc0,0x0c,0xc0,0x0c,0xc0,0x0c,0xc0,0x0c,0xc0,0x0c,0xc0,0x0c,0x30,0x30,0x30,0x30,0x00,0x00,0x00,0x00,0x00,0x3c,0x00,0x3c,0x00,0x0c,0x00,0x0c,0xff,0xfc,0xff,0xfc,0x00,0x0c,0x00,0x0c,0x00,0x3c,0x00,0x3c
-};
-
-// Bad USB menu bitmap data
-const unsigned char PROGMEM image_badusb_Layer_2_bits[] = {
-    0x3f,0xf8,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x38,0x38,0x08,0x20,0x08,0x20,0x07,0xc0
-};
-
-const unsigned char PROGMEM image_badusb_Layer_3_bits[] = {
-    0x0f,0xf0,0x0f,0xf0,0x30,0x00,0x30,0x00,0xc3,0xc0,0xc3,0xc0,0xcc,0x30,0xcc,0x30,0xcc,0x30,0xcc,0x30,0xc3,0xc0,0xc3,0xc0,0xc0,0x00,0xc0,0x00,0xc0,0x00,0xc0,0x00,0xcc,0x00,0xcc,0x00,0xc3,0x00,0xc3,0x00,0xc0,0xc0,0xc0,0xc0,0xcc,0x30,0xcc,0x30,0xc3,0x00,0xc3,0x00,0xc0,0xc0,0xc0,0xc0,0xcc,0x30,0xcc,0x30,0xc3,0x00,0xc3,0x00,0xc0,0xc0,0xc0,0xc0,0xcc,0x30,0xcc,0x30,0xc3,0x00,0xc3,0x00,0xc0,0xc0,0xc0,0xc0,0xcc,0x30,0xcc,0x30,0xc3,0x00,0xc3,0x00,0xc0,0xc0,0xc0,0xc0,0xcc,0x30,0xcc,0x30,0xc3,0x00,0xc3,0x00,0xc0,0xc0,0xc0,0xc0,0xc0,0x30,0xc0,0x30,0xc0,0x00,0xc0,0x00,0x30,0x00,0x30,0x00,0x3c,0x00,0x3c,0x00,0x3f,0x00,0x3f,0x00,0x3f,0xc0,0x3f,0xc0,0x3f,0xf0,0x3f,0xf0,0x33,0xf0,0x33,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0
-};
-
-const unsigned char PROGMEM image_rspi_1_bits[] = {
-    0x00,0x70,0x00,0x80,0x00,0xf8,0x01,0x80,0x0f,0x33,0x8f,0x80,0x0f,0x01,0x8e,0x80,0x1f,0x7d,0xdd,0x80,0x1e,0x7e,0x53,0x80,0x08,0x7e,0x13,0x00,0x27,0x7c,0x4f,0x00,0xef,0x3d,0xce,0x00,0xef,0x81,0xc0,0x00,0xef,0xbd,0xc2,0x00,0xef,0x3d,0xce,0x00,0x20,0x7e,0x13,0x00,0x08,0x7e,0x13,0x00,0x1f,0x7c,0x5d,0x80,0x1f,0x39,0xde,0x80,0x0f,0x01,0x8e,0x80,0x06,0x7a,0x03,0x80,0x00,0xf8,0x01,0x80
-};
-
-const unsigned char PROGMEM image_USB_KILLER_bits[] = {
-    0x03,0xff,0xf0,0x00,0x07,0xff,0xf8,0x00,0x06,0x00,0x18,0x00,0x06,0x00,0x18,0x00,0x06,0x73,0x18,0x00,0x06,0x73,0x98,0x00,0x06,0x73,0x98,0x00,0x06,0x73,0x98,0x00,0x06,0x31,0x18,0x00,0x06,0x00,0x18,0x00,0x06,0xaa,0xb8,0x00,0x1f,0xff,0xfe,0x00,0x1f,0xff,0xff,0x00,0x38,0x00,0x07,0x00,0x60,0x00,0x01,0x80,0xe0,0x00,0x01,0x80,0xe0,0x00,0x01,0xc0,0xe0,0x00,0x00,0xc0,0xe0,0x00,0x00,0xc0,0xe0,0x00,0x00,0xc0,0xe0,0x00,0x00,0xc0,0xe0,0x00,0x00,0xc0,0xe0,0x00,0x00,0xc0,0xe0,0x7f,0x80,0xc0,0xe0,0xff,0xc0,0xc0,0xe1,0xe0,0xf0,0xc0,0xe3,0x80,0x38,0xc0,0xe3,0x00,0x38,0xc0,0xe6,0x00,0x18,0xc0,0xe6,0x00,0x0c,0xc0,0xee,0x00,0x0c,0xc0,0xec,0x00,0x0c,0xc0,0xec,0x71,0xcc,0xc0,0xec,0xf1,0xec,0xc0,0xec,0xf1,0xec,0xc0,0xec,0xe4,0xec,0xc0,0xee,0x04,0x0c,0xc0,0xe6,0x0e,0x0c,0xc0,0xe7,0x0a,0x38,0xc0,0xe3,0xc0,0x78,0xc0,0xe1,0xc0,0xf0,0xc0,0xe0,0xc0,0xe0,0xc0,0xe0,0xff,0xc0,0xc0,0xe0,0x7f,0xc0,0xc0,0xe0,0x00,0x00,0xc0,0xe0,0x00,0x00,0xc0,0xe0,0x00,0x00,0xc0,0xe0,0x00,0x00,0xc0,0xe0,0x00,0x00,0xc0,0xe0,0x00,0x00,0xc0,0xe0,0x00,0x00,0xc0,0xe0,0x00,0x00,0xc0,0xe0,0x00,0x00,0xc0,0xe0,0x00,0x00,0xc0,0xe0,0x00,0x01,0xc0,0x60,0x00,0x01,0x80,0x70,0x00,0x03,0x80,0x3c,0x00,0x0f,0x00,0x1f,0xff,0xfe,0x00,0x07,0xff,0xf8,0x00
-};
-
-const unsigned char PROGMEM image_badusb_Layer_9_bits[] = {
-    0x0f,0x00,0x10,0xc0,0x20,0x20,0x20,0x30,0x20,0x10,0x20,0x10,0x20,0x10,0x10,0x20,0x00,0x70,0x00,0x00,0x00,0x00,0x1e,0x10,0x31,0xf0,0x20,0x10,0x20,0x10,0x20,0x00,0x30,0x00,0x10,0x00,0x0f,0x10,0x01,0xf0,0x00,0x10,0x20,0x00,0x30,0x00,0x3f,0x90,0x22,0x70,0x02,0x10,0x02,0x10,0x02,0x10,0x0e,0x10,0x11,0x30,0x20,0xe0,0x00,0x00,0x20,0x00,0x30,0x00,0x3f,0x90,0x22,0x70,0x02,0x10,0x02,0x10,0x02,0x10,0x0e,0x10,0x11,0x30,0x20,0xe0,0x80,0x00,0x80,0x00,0x80,0x00,0x80,0x00,0x80,0x00,0x80,0x00,0x80,0x00,0x80,0x00,0x80,0x00,0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x30,0x20,0x10,0x38,0x10,0x2f,0xd0,0x20,0x30,0x20,0x10,0x00,0x10,0x00,0x10,0x00,0x30,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x10,0x38,0x10,0x27,0xd0,0x20,0x30,0x20,0x10,0x00,0x10,0x00,0x10,0x20,0x00,0x20,0x00,0x3f,0x10,0x20,0xf0,0x00,0x30,0x07,0xc0,0x06,0x00,0x21,0x00,0x20,0xc0,0x3c,0x20,0x27,0xf0,0x00,0x10,0x20,0x10,0x30,0x00,0x3f,0x90,0x21,0x70,0x21,0x10,0x21,0x10,0x23,0x90,0x20,0x10,0x38,0x10,0x00,0x30
-};
-
-const unsigned char PROGMEM image_badusb_Layer_10_bits[] = {
-    0xff,0xfc,0xff,0xfc,0xc3,0x0c,0xc3,0x0c,0xc3,0x0c,0xc3,0x0c,0xc3,0x0c,0xc3,0x0c,0x3c,0xf0,0x3c,0xf0,0x00,0x00,0x00,0x00,0xff,0xc0,0xff,0xc0,0x0c,0x30,0x0c,0x30,0x0c,0x0c,0x0c,0x0c,0x0c,0x30,0x0c,0x30,0xff,0xc0,0xff,0xc0,0x00,0x00,0x00,0x00,0xff,0xfc,0xff,0xfc,0xc0,0x0c,0xc0,0x0c,0xc0,0x0c,0xc0,0x0c,0xc0,0x0c,0xc0,0x0c,0x3f,0xf0,0x3f,0xf0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3f,0xfc,0x3f,0xfc,0xc0,0x00,0xc0,0x00,0xc0,0x00,0xc0,0x00,0xc0,0x00,0xc0,0x00,0x3f,0xfc,0x3f,0xfc,0x00,0x00,0x00,0x00,0x30,0xf0,0x30,0xf0,0xc3,0x0c,0xc3,0x0c,0xc3,0x0c,0xc3,0x0c,0xc3,0x0c,0xc3,0x0c,0x3c,0x30,0x3c,0x30,0x00,0x00,0x00,0x00,0xff,0xfc,0xff,0xfc,0xc3,0x0c,0xc3,0x0c,0xc3,0x0c,0xc3,0x0c,0xc3,0x0c,0xc3,0x0c,0x3c,0xf0,0x3c,0xf0
-};
-
-const unsigned char PROGMEM image_equ2z4c_SETTINGSsettings_bits[] = {
-    0x00,0x3f,0x00,0x00,0x00,0x6c,0x80,0x00,0x00,0x13,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x20,0x40,0x00,0x01,0x69,0x60,0x00,0x01,0x69,0x60,0x00,0x00,0x00,0x00,0x00,0x00,0xff,0xe0,0x00,0x47,0x80,0x6c,0x00,0xcf,0x80,0x28,0x40,0xa1,0x80,0x21,0xc0,0xc7,0x80,0x2c,0xa0,0xc1,0x80,0x20,0xa0,0xa1,0x80,0x20,0xa0,0xa7,0x80,0x2d,0x40,0x41,0x80,0x20,0x80,0x0f,0x80,0x68,0x00,0x00,0xff,0xe0,0x00,0x01,0x00,0x00,0x00,0x01,0x69,0x60,0x00,0x00,0x49,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x11,0x00,0x00,0x00,0x1e,0x80,0x00,0x00,0x31,0x00,0x00,0x00,0x0e,0x00,0x00
-};
-
-// Settings menu bitmap data
-const unsigned char PROGMEM image_settings_Layer_2_bits[] = {
-    0x3f,0xf8,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x38,0x38,0x08,0x20,0x08,0x20,0x07,0xc0
-};
-
-const unsigned char PROGMEM image_settings_Layer_3_bits[] = {
-    0x0f,0xf0,0x0f,0xf0,0x30,0x00,0x30,0x00,0xc3,0xc0,0xc3,0xc0,0xcc,0x30,0xcc,0x30,0xcc,0x30,0xcc,0x30,0xc3,0xc0,0xc3,0xc0,0xc0,0x00,0xc0,0x00,0xc0,0x00,0xc0,0x00,0xcc,0x00,0xcc,0x00,0xc3,0x00,0xc3,0x00,0xc0,0xc0,0xc0,0xc0,0xcc,0x30,0xcc,0x30,0xc3,0x00,0xc3,0x00,0xc0,0xc0,0xc0,0xc0,0xcc,0x30,0xcc,0x30,0xc3,0x00,0xc3,0x00,0xc0,0xc0,0xc0,0xc0,0xcc,0x30,0xcc,0x30,0xc3,0x00,0xc3,0x00,0xc0,0xc0,0xc0,0xc0,0xcc,0x30,0xcc,0x30,0xc3,0x00,0xc3,0x00,0xc0,0xc0,0xc0,0xc0,0xcc,0x30,0xcc,0x30,0xc3,0x00,0xc3,0x00,0xc0,0xc0,0xc0,0xc0,0xc0,0x30,0xc0,0x30,0xc0,0x00,0xc0,0x00,0x30,0x00,0x30,0x00,0x3c,0x00,0x3c,0x00,0x3f,0x00,0x3f,0x00,0x3f,0xc0,0x3f,0xc0,0x3f,0xf0,0x3f,0xf0,0x33,0xf0,0x33,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0
-};
-
-const unsigned char PROGMEM image_settings_Layer_7_bits[] = {
-    0x00,0x00,0x01,0xfe,0x00,0x00,0x00,0x00,0x00,0x07,0xff,0x00,0x00,0x00,0x00,0x00,0x0e,0x01,0xc0,0x00,0x00,0x00,0x00,0x1c,0x78,0xc0,0x00,0x00,0x00,0x00,0x01,0xfe,0x00,0x00,0x00,0x00,0x00,0x03,0x87,0x00,0x00,0x00,0x00,0x00,0x02,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x06,0x08,0x30,0x00,0x00,0x00,0x01,0x86,0x08,0x30,0x00,0x00,0x00,0x01,0xb6,0xc9,0xb6,0x00,0x00,0x00,0x01,0xb6,0xc9,0xb6,0x00,0x00,0x00,0x01,0xb6,0xc9,0xb6,0x00,0x00,0x00,0x01,0xb6,0x49,0x36,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x00,0x7f,0xff,0xf8,0x00,0x00,0x00,0x00,0xff,0xff,0xfc,0x00,0x00,0x00,0x1d,0xff,0xff,0xfc,0xf8,0x00,0x10,0x1d,0xc0,0x00,0x1c,0xf0,0x20,0x30,0x01,0xc0,0x00,0x0c,0x00,0x70,0x70,0x7d,0xc0,0x00,0x0c,0xe0,0x30,0x66,0x7d,0xc0,0x00,0x0c,0xe1,0x98,0xcc,0x01,0xc0,0x00,0x0c,0x01,0xd8,0xcc,0x1d,0xc0,0x00,0x0c,0xf0,0xcc,0xd8,0x1d,0xc0,0x00,0x0c,0xf8,0xcc,0xd8,0x01,0xc0,0x00,0x0c,0x00,0x6c,0xd8,0x01,0xc0,0x00,0x0c,0x00,0x6c,0xd8,0x7d,0xc0,0x00,0x0c,0xe0,0xcc,0xcc,0x01,0xc0,0x00,0x0c,0x00,0xcc,0xcc,0x01,0xc0,0x00,0x0c,0x01,0xd8,0x66,0x1d,0xc0,0x00,0x0c,0xf9,0x98,0x30,0x1d,0xc0,0x00,0x0c,0xf0,0x30,0x30,0x01,0xc0,0x00,0x0c,0x00,0x60,0x00,0x7d,0xc0,0x00,0x0c,0xe0,0x00,0x00,0x7d,0xe0,0x00,0x1c,0xe0,0x00,0x00,0x00,0xff,0xff,0xfc,0x00,0x00,0x00,0x00,0xff,0xff,0xfc,0x00,0x00,0x00,0x00,0x7f,0xff,0xf0,0x00,0x00,0x00,0x01,0x00,0x00,0x02,0x00,0x00,0x00,0x01,0xb6,0xc9,0xb6,0x00,0x00,0x00,0x01,0xb6,0xc9,0xb6,0x00,0x00,0x00,0x01,0x36,0xc9,0xb6,0x00,0x00,0x00,0x00,0x30,0xc1,0x86,0x00,0x00,0x00,0x00,0x20,0x41,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x03,0x00,0x00,0x00,0x00,0x00,0x03,0x8f,0x00,0x00,0x00,0x00,0x00,0x09,0xfe,0x40,0x00,0x00,0x00,0x00,0x1c,0x30,0xc0,0x00,0x00,0x00,0x00,0x0f,0x03,0x80,0x00,0x00,0x00,0x00,0x03,0xff,0x00,0x00,0x00,0x00,0x00,0x00,0xfc,0x00,0x00,0x00
-};
-
-const unsigned char PROGMEM image_settings_Layer_8_bits[] = {
-    0x0f,0x00,0x10,0xc0,0x20,0x20,0x20,0x30,0x20,0x10,0x20,0x10,0x20,0x10,0x10,0x20,0x00,0x70,0x00,0x00,0x00,0x00,0x1e,0x10,0x31,0xf0,0x20,0x10,0x20,0x10,0x20,0x00,0x30,0x00,0x10,0x00,0x0f,0x10,0x01,0xf0,0x00,0x10,0x20,0x00,0x30,0x00,0x3f,0x90,0x22,0x70,0x02,0x10,0x02,0x10,0x02,0x10,0x0e,0x10,0x11,0x30,0x20,0xe0,0x00,0x00,0x20,0x00,0x30,0x00,0x3f,0x90,0x22,0x70,0x02,0x10,0x02,0x10,0x02,0x10,0x0e,0x10,0x11,0x30,0x20,0xe0,0x80,0x00,0x80,0x00,0x80,0x00,0x80,0x00,0x80,0x00,0x80,0x00,0x80,0x00,0x80,0x00,0x80,0x00,0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x30,0x20,0x10,0x38,0x10,0x2f,0xd0,0x20,0x30,0x20,0x10,0x00,0x10,0x00,0x10,0x00,0x30,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x10,0x38,0x10,0x27,0xd0,0x20,0x30,0x20,0x10,0x00,0x10,0x00,0x10,0x20,0x00,0x20,0x00,0x3f,0x10,0x20,0xf0,0x00,0x30,0x07,0xc0,0x06,0x00,0x21,0x00,0x20,0xc0,0x3c,0x20,0x27,0xf0,0x00,0x10,0x20,0x10,0x30,0x00,0x3f,0x90,0x21,0x70,0x21,0x10,0x21,0x10,0x23,0x90,0x20,0x10,0x38,0x10,0x00,0x30
-};
-
-const unsigned char PROGMEM image_g87a5zi_USB_KILLERusb_killer_bits[] = {
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3f,0xc0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x40,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x2b,0x40,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x2b,0x40,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x40,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7f,0xe0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xc0,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x80,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x80,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x80,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x80,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x8f,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x99,0x90,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0xa0,0xd0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0xa0,0x50,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0xc0,0x50,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0xd9,0xd0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0xd9,0xd0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0xa6,0x50,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0xb0,0xd0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x91,0x90,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x8f,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x80,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x80,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x80,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x80,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x80,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x80,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xc0,0x60,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3f,0xc0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00
-};
-
-const unsigned char PROGMEM image_settings_Layer_9_bits[] = {
-    0x30,0xf0,0x30,0xf0,0xc3,0x0c,0xc3,0x0c,0xc3,0x0c,0xc3,0x0c,0xc3,0x0c,0xc3,0x0c,0x3c,0x30,0x3c,0x30,0x00,0x00,0x00,0x00,0xff,0xfc,0xff,0xfc,0xc3,0x0c,0xc3,0x0c,0xc3,0x0c,0xc3,0x0c,0xc3,0x0c,0xc3,0x0c,0xc0,0x0c,0xc0,0x0c,0x00,0x00,0x00,0x00,0x00,0x3c,0x00,0x3c,0x00,0x0c,0x00,0x0c,0xff,0xfc,0xff,0xfc,0x00,0x0c,0x00,0x0c,0x00,0x3c,0x00,0x3c,0x00,0x00,0x00,0x00,0x00,0x3c,0x00,0x3c,0x00,0x0c,0x00,0x0c,0xff,0xfc,0xff,0xfc,0x00,0x0c,0x00,0x0c,0x00,0x3c,0x00,0x3c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xc0,0x0c,0xc0,0x0c,0xff,0xfc,0xff,0xfc,0xc0,0x0c,0xc0,0x0c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xff,0xfc,0xff,0xfc,0x00,0xc0,0x00,0xc0,0x03,0x00,0x03,0x00,0x0c,0x00,0x0c,0x00,0xff,0xfc,0xff,0xfc,0x00,0x00,0x00,0x00,0x3f,0xf0,0x3f,0xf0,0xc0,0x0c,0xc0,0x0c,0xc0,0x0c,0xc0,0x0c,0xcc,0x0c,0xcc,0x0c,0xfc,0x3c,0xfc,0x3c,0x00,0x00,0x00,0x00,0x30,0xf0,0x30,0xf0,0xc3,0x0c,0xc3,0x0c,0xc3,0x0c,0xc3,0x0c,0xc3,0x0c,0xc3,0x0c,0x3c,0x30,0x3c,0x30
-};
-
-const unsigned char PROGMEM image_extra_1_bits[] = {
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0xfc,0x00,0x00,0x03,0xfc,0x00,0x0f,0xf3,0xfc,0x00,0x1f,0xf3,0xfc,0x00,0x1f,0xf3,0xfc,0x00,0x1f,0xf3,0xfc,0x00,0x1f,0xf3,0xfc,0x00,0x1f,0xf3,0xfc,0x00,0x1f,0xf3,0xfc,0x00,0x1f,0xf0,0x00,0x00,0x1f,0xf8,0x00,0x00,0x1f,0xff,0xf8,0x00,0x1f,0xff,0xf8,0x00,0x1f,0xff,0xf8,0x00,0x1f,0xff,0xf8,0x00,0x1f,0xff,0xf8,0x00,0x1f,0xff,0xf8,0x00,0x1f,0xff,0xf8,0x00,0x1f,0xff,0xf8,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00
-};
-
-const unsigned char PROGMEM image_ojp6uhu_USB_KILLERusb_killer_bits[] = {
-    0x1f,0xf8,0x15,0x58,0x12,0x48,0x12,0x48,0x12,0x48,0x12,0x48,0x10,0x08,0x3f,0xfc,0x60,0x06,0xc0,0x03,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x83,0xc1,0x8e,0xf1,0x88,0x19,0x90,0x09,0x90,0x0d,0xb0,0x05,0xb2,0x25,0xb6,0x75,0xb6,0x35,0xb0,0x85,0x91,0x8d,0x9c,0x39,0x84,0x31,0x87,0xe1,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0xc0,0x03,0x75,0x5e,0x1f,0xf8
-};
-
-// EXTRAS MENU BITMAPS
-const unsigned char PROGMEM image_extras_Layer_2_bits[] = {
-    0x3f,0xf8,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x38,0x38,0x08,0x20,0x08,0x20,0x07,0xc0
-};
-
-const unsigned char PROGMEM image_extras_Layer_3_bits[] = {
-    0x0f,0xf0,0x0f,0xf0,0x30,0x00,0x30,0x00,0xc3,0xc0,0xc3,0xc0,0xcc,0x30,0xcc,0x30,0xcc,0x30,0xcc,0x30,0xc3,0xc0,0xc3,0xc0,0xc0,0x00,0xc0,0x00,0xc0,0x00,0xc0,0x00,0xcc,0x00,0xcc,0x00,0xc3,0x00,0xc3,0x00,0xc0,0xc0,0xc0,0xc0,0xcc,0x30,0xcc,0x30,0xc3,0x00,0xc3,0x00,0xc0,0xc0,0xc0,0xc0,0xcc,0x30,0xcc,0x30,0xc3,0x00,0xc3,0x00,0xc0,0xc0,0xc0,0xc0,0xcc,0x30,0xcc,0x30,0xc3,0x00,0xc3,0x00,0xc0,0xc0,0xc0,0xc0,0xcc,0x30,0xcc,0x30,0xc3,0x00,0xc3,0x00,0xc0,0xc0,0xc0,0xc0,0xcc,0x30,0xcc,0x30,0xc3,0x00,0xc3,0x00,0xc0,0xc0,0xc0,0xc0,0xc0,0x30,0xc0,0x30,0xc0,0x00,0xc0,0x00,0x30,0x00,0x30,0x00,0x3c,0x00,0x3c,0x00,0x3f,0x00,0x3f,0x00,0x3f,0xc0,0x3f,0xc0,0x3f,0xf0,0x3f,0xf0,0x33,0xf0,0x33,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0
-};
-
-const unsigned char PROGMEM image_extras_Layer_7_bits[] = {
-    0x00,0x0f,0x00,0x00,0x00,0x30,0x80,0x00,0x00,0x0f,0x00,0x00,0x00,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x92,0x40,0x00,0x00,0xda,0xd0,0x00,0x00,0xd2,0x50,0x00,0x00,0x7f,0xe0,0x00,0x02,0xff,0xee,0x00,0x40,0x80,0x20,0x40,0x56,0x80,0x2c,0xa0,0xa2,0x80,0x2c,0xa0,0xa0,0x80,0x20,0x60,0xa6,0x80,0x2c,0xa0,0xa0,0x80,0x20,0xa0,0x42,0x80,0x2c,0x40,0x06,0x80,0x2c,0x00,0x00,0xff,0xe0,0x00,0x00,0x7f,0xc0,0x00,0x00,0xda,0xd0,0x00,0x00,0x5a,0xd0,0x00,0x00,0x40,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x1b,0x00,0x00,0x00,0x24,0x80,0x00,0x00,0x1f,0x00,0x00
-};
-
-const unsigned char PROGMEM image_extras_Layer_8_bits[] = {
-    0x0f,0x00,0x10,0xc0,0x20,0x20,0x20,0x30,0x20,0x10,0x20,0x10,0x20,0x10,0x10,0x20,0x00,0x70,0x00,0x00,0x00,0x00,0x1e,0x10,0x31,0xf0,0x20,0x10,0x20,0x10,0x20,0x00,0x30,0x00,0x10,0x00,0x0f,0x10,0x01,0xf0,0x00,0x10,0x20,0x00,0x30,0x00,0x3f,0x90,0x22,0x70,0x02,0x10,0x02,0x10,0x02,0x10,0x0e,0x10,0x11,0x30,0x20,0xe0,0x00,0x00,0x20,0x00,0x30,0x00,0x3f,0x90,0x22,0x70,0x02,0x10,0x02,0x10,0x02,0x10,0x0e,0x10,0x11,0x30,0x20,0xe0,0x80,0x00,0x80,0x00,0x80,0x00,0x80,0x00,0x80,0x00,0x80,0x00,0x80,0x00,0x80,0x00,0x80,0x00,0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x30,0x20,0x10,0x38,0x10,0x2f,0xd0,0x20,0x30,0x20,0x10,0x00,0x10,0x00,0x10,0x00,0x30,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x10,0x38,0x10,0x27,0xd0,0x20,0x30,0x20,0x10,0x00,0x10,0x00,0x10,0x20,0x00,0x20,0x00,0x3f,0x10,0x20,0xf0,0x00,0x30,0x07,0xc0,0x06,0x00,0x21,0x00,0x20,0xc0,0x3c,0x20,0x27,0xf0,0x00,0x10,0x20,0x10,0x30,0x00,0x3f,0x90,0x21,0x70,0x21,0x10,0x21,0x10,0x23,0x90,0x20,0x10,0x38,0x10,0x00,0x30
-};
-
-const unsigned char PROGMEM image_ot3p4l1_filesfiles_bits[] = {
-    0x3f,0xff,0x80,0x7f,0xff,0xc0,0xc0,0x00,0x60,0xd6,0xad,0x60,0xd6,0xad,0x60,0xd6,0xad,0x60,0xd6,0xad,0x60,0xc0,0x00,0x60,0xc0,0x00,0x30,0xc0,0x00,0x10,0xc0,0x00,0x18,0xc0,0x00,0x18,0xc0,0x00,0x18,0xc0,0x00,0x18,0xc0,0x00,0x18,0xc0,0x00,0x18,0xc0,0x00,0x18,0xc0,0x00,0x18,0xdf,0xff,0xd8,0xdf,0xff,0xd8,0xd8,0x00,0xd8,0xd8,0x00,0xd8,0xd8,0x00,0xd8,0xdf,0xff,0xd8,0xc0,0x00,0x18,0xc0,0x00,0x18,0x60,0x00,0x30,0x3f,0xff,0xe0
-};
-
-const unsigned char PROGMEM image_extras_Layer_11_bits[] = {
-    0xff,0xfc,0xff,0xfc,0xc3,0x0c,0xc3,0x0c,0xc3,0x0c,0xc3,0x0c,0xc3,0x0c,0xc3,0x0c,0xc0,0x0c,0xc0,0x0c,0x00,0x00,0x00,0x00,0xf0,0x3c,0xf0,0x3c,0x0c,0xc0,0x0c,0xc0,0x03,0x00,0x03,0x00,0x0c,0xc0,0x0c,0xc0,0xf0,0x3c,0xf0,0x3c,0x00,0x00,0x00,0x00,0x00,0x3c,0x00,0x3c,0x00,0x0c,0x00,0x0c,0xff,0xfc,0xff,0xfc,0x00,0x0c,0x00,0x0c,0x00,0x3c,0x00,0x3c,0x00,0x00,0x00,0x00,0xff,0xfc,0xff,0xfc,0x03,0x0c,0x03,0x0c,0x0f,0x0c,0x0f,0x0c,0x33,0x0c,0x33,0x0c,0xc0,0xf0,0xc0,0xf0,0x00,0x00,0x00,0x00,0xff,0xc0,0xff,0xc0,0x0c,0x30,0x0c,0x30,0x0c,0x0c,0x0c,0x0c,0x0c,0x30,0x0c,0x30,0xff,0xc0,0xff,0xc0
-};
-
-// FILES MENU BITMAPS
-const unsigned char PROGMEM image_files_Layer_2_bits[] = {
-    0x3f,0xf8,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x38,0x38,0x08,0x20,0x08,0x20,0x07,0xc0
-};
-
-const unsigned char PROGMEM image_files_Layer_3_bits[] = {
-    0x0f,0xf0,0x0f,0xf0,0x30,0x00,0x30,0x00,0xc3,0xc0,0xc3,0xc0,0xcc,0x30,0xcc,0x30,0xcc,0x30,0xcc,0x30,0xc3,0xc0,0xc3,0xc0,0xc0,0x00,0xc0,0x00,0xc0,0x00,0xc0,0x00,0xcc,0x00,0xcc,0x00,0xc3,0x00,0xc3,0x00,0xc0,0xc0,0xc0,0xc0,0xcc,0x30,0xcc,0x30,0xc3,0x00,0xc3,0x00,0xc0,0xc0,0xc0,0xc0,0xcc,0x30,0xcc,0x30,0xc3,0x00,0xc3,0x00,0xc0,0xc0,0xc0,0xc0,0xcc,0x30,0xcc,0x30,0xc3,0x00,0xc3,0x00,0xc0,0xc0,0xc0,0xc0,0xcc,0x30,0xcc,0x30,0xc3,0x00,0xc3,0x00,0xc0,0xc0,0xc0,0xc0,0xcc,0x30,0xcc,0x30,0xc3,0x00,0xc3,0x00,0xc0,0xc0,0xc0,0xc0,0xc0,0x30,0xc0,0x30,0xc0,0x00,0xc0,0x00,0x30,0x00,0x30,0x00,0x3c,0x00,0x3c,0x00,0x3f,0x00,0x3f,0x00,0x3f,0xc0,0x3f,0xc0,0x3f,0xf0,0x3f,0xf0,0x33,0xf0,0x33,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0
-};
-
-const unsigned char PROGMEM image_mi1byse_extraextra_bitsfil[] = {
-    0x00,0x01,0xff,0x80,0x00,0x03,0xff,0xc0,0x7f,0xe3,0xff,0xc0,0xff,0xf3,0xff,0xc0,0xff,0xf3,0xff,0xc0,0xff,0xf3,0xff,0xc0,0xff,0xf3,0xff,0xc0,0xff,0xf3,0xff,0xc0,0xff,0xf3,0xff,0xc0,0xff,0xf3,0xff,0xc0,0xff,0xf3,0xff,0xc0,0xff,0xf3,0xff,0xc0,0xff,0xf0,0x00,0x00,0xff,0xf8,0x00,0x00,0xff,0xff,0xfe,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0x7f,0xff,0xff,0x00
-};
-
-const unsigned char PROGMEM image_files_Layer_8_bits[] = {
-    0x0f,0x00,0x10,0xc0,0x20,0x20,0x20,0x30,0x20,0x10,0x20,0x10,0x20,0x10,0x10,0x20,0x00,0x70,0x00,0x00,0x00,0x00,0x1e,0x10,0x31,0xf0,0x20,0x10,0x20,0x10,0x20,0x00,0x30,0x00,0x10,0x00,0x0f,0x10,0x01,0xf0,0x00,0x10,0x20,0x00,0x30,0x00,0x3f,0x90,0x22,0x70,0x02,0x10,0x02,0x10,0x02,0x10,0x0e,0x10,0x11,0x30,0x20,0xe0,0x00,0x00,0x20,0x00,0x30,0x00,0x3f,0x90,0x22,0x70,0x02,0x10,0x02,0x10,0x02,0x10,0x0e,0x10,0x11,0x30,0x20,0xe0,0x80,0x00,0x80,0x00,0x80,0x00,0x80,0x00,0x80,0x00,0x80,0x00,0x80,0x00,0x80,0x00,0x80,0x00,0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x30,0x20,0x10,0x38,0x10,0x2f,0xd0,0x20,0x30,0x20,0x10,0x00,0x10,0x00,0x10,0x00,0x30,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x10,0x38,0x10,0x27,0xd0,0x20,0x30,0x20,0x10,0x00,0x10,0x00,0x10,0x20,0x00,0x20,0x00,0x3f,0x10,0x20,0xf0,0x00,0x30,0x07,0xc0,0x06,0x00,0x21,0x00,0x20,0xc0,0x3c,0x20,0x27,0xf0,0x00,0x10,0x20,0x10,0x30,0x00,0x3f,0x90,0x21,0x70,0x21,0x10,0x21,0x10,0x23,0x90,0x20,0x10,0x38,0x10,0x00,0x30
-};
-
-const unsigned char PROGMEM image_files_Layer_10_bits[] = {
-    0xff,0xfc,0xff,0xfc,0x03,0x0c,0x03,0x0c,0x03,0x0c,0x03,0x0c,0x03,0x0c,0x03,0x0c,0x00,0x0c,0x00,0x0c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xc0,0x0c,0xc0,0x0c,0xff,0xfc,0xff,0xfc,0xc0,0x0c,0xc0,0x0c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xff,0xfc,0xff,0xfc,0xc0,0x00,0xc0,0x00,0xc0,0x00,0xc0,0x00,0xc0,0x00,0xc0,0x00,0xc0,0x00,0xc0,0x00,0x00,0x00,0x00,0x00,0xff,0xfc,0xff,0xfc,0xc3,0x0c,0xc3,0x0c,0xc3,0x0c,0xc3,0x0c,0xc3,0x0c,0xc3,0x0c,0xc0,0x0c,0xc0,0x0c,0x00,0x00,0x00,0x00,0x30,0xf0,0x30,0xf0,0xc3,0x0c,0xc3,0x0c,0xc3,0x0c,0xc3,0x0c,0xc3,0x0c,0xc3,0x0c,0x3c,0x30,0x3c,0x30
-};
-
-// RFID MENU BITMAPS
-const unsigned char PROGMEM image_rfid_Layer_2_bits[] = {
-    0x0f,0xf0,0x0f,0xf0,0x30,0x00,0x30,0x00,0xc3,0xc0,0xc3,0xc0,0xcc,0x30,0xcc,0x30,0xcc,0x30,0xcc,0x30,0xc3,0xc0,0xc3,0xc0,0xc0,0x00,0xc0,0x00,0xc0,0x00,0xc0,0x00,0xcc,0x00,0xcc,0x00,0xc3,0x00,0xc3,0x00,0xc0,0xc0,0xc0,0xc0,0xcc,0x30,0xcc,0x30,0xc3,0x00,0xc3,0x00,0xc0,0xc0,0xc0,0xc0,0xcc,0x30,0xcc,0x30,0xc3,0x00,0xc3,0x00,0xc0,0xc0,0xc0,0xc0,0xcc,0x30,0xcc,0x30,0xc3,0x00,0xc3,0x00,0xc0,0xc0,0xc0,0xc0,0xcc,0x30,0xcc,0x30,0xc3,0x00,0xc3,0x00,0xc0,0xc0,0xc0,0xc0,0xcc,0x30,0xcc,0x30,0xc3,0x00,0xc3,0x00,0xc0,0xc0,0xc0,0xc0,0xc0,0x30,0xc0,0x30,0xc0,0x00,0xc0,0x00,0x30,0x00,0x30,0x00,0x3c,0x00,0x3c,0x00,0x3f,0x00,0x3f,0x00,0x3f,0xc0,0x3f,0xc0,0x3f,0xf0,0x3f,0xf0,0x33,0xf0,0x33,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0
-};
-
-const unsigned char PROGMEM image_rfid_Layer_3_bits[] = {
-    0x3f,0xf8,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x38,0x38,0x08,0x20,0x08,0x20,0x07,0xc0
-};
-
-const unsigned char PROGMEM image_filesrfid_Layer_6_bits[] = {
-    0x7f,0xff,0xc0,0x40,0x00,0x40,0xd6,0xad,0x60,0xd6,0xad,0x60,0xd6,0xad,0x60,0xd6,0xad,0x60,0xd6,0xad,0x60,0xc0,0x00,0x60,0xc0,0x00,0x30,0xc0,0x00,0x18,0xc0,0x00,0x18,0xc0,0x00,0x18,0xc0,0x00,0x18,0xc0,0x00,0x18,0xc0,0x00,0x18,0xc0,0x00,0x18,0xc0,0x00,0x18,0xc0,0x00,0x18,0xdf,0xff,0xd8,0xd8,0x00,0xd8,0xd8,0x00,0xd8,0xd8,0x00,0xd8,0xdf,0xff,0xd8,0xdf,0xff,0xd8,0xc0,0x00,0x18,0xc0,0x00,0x10,0x7f,0xff,0xf0
-};
-
-const unsigned char PROGMEM image_rfid_Layer_6_bits[] = {
-    0x7f,0xff,0xff,0xff,0xf0,0xff,0xff,0xff,0xff,0xf8,0xe0,0x00,0x00,0x00,0x38,0xdf,0xbf,0xff,0xff,0xd8,0xdf,0x5f,0xff,0xff,0xd8,0xde,0xa0,0x00,0x00,0xd8,0xdd,0x50,0x00,0x00,0xd8,0xda,0xb0,0x00,0x04,0xd8,0xd5,0x6f,0xff,0xfc,0xd8,0xca,0x97,0xff,0xfc,0xd8,0xd5,0x28,0x00,0x1c,0xd8,0xdb,0x50,0x00,0x1c,0xd8,0xd8,0xa0,0x00,0x1c,0xd8,0xd8,0xc7,0xff,0x1c,0xd8,0xd8,0xc7,0xff,0x1c,0xd8,0xd8,0xc7,0xff,0x1c,0xd8,0xd8,0xc0,0x31,0x1c,0xd8,0xd8,0xc0,0x31,0x1c,0xd8,0xd8,0xc0,0x73,0x1c,0xd8,0xd8,0xc7,0xff,0x1c,0xd8,0xd8,0xc7,0xdf,0x1c,0xd8,0xd8,0xc0,0x0c,0x1c,0xd8,0xd8,0xc0,0x00,0x1c,0xd8,0xd8,0xc0,0x00,0x1c,0xd8,0xd8,0xc7,0xff,0x1c,0xd8,0xd8,0xc7,0xff,0x1c,0xd8,0xd8,0xc0,0x33,0x1c,0xd8,0xd8,0x80,0x33,0x0c,0xd8,0xd8,0xc0,0x33,0x1c,0xd8,0xd9,0xc0,0x33,0x1c,0xd8,0xd8,0x00,0x23,0x00,0xd8,0xd8,0x00,0x00,0x00,0xd8,0xdf,0xc0,0x00,0x1f,0xd8,0xcf,0xc7,0xff,0x1f,0x98,0xff,0xc7,0xff,0x1f,0xf8,0x7f,0xc0,0x00,0x1f,0xf0,0x3f,0xc0,0x00,0x1f,0xe0,0x00,0x07,0xff,0x00,0x00,0x00,0x07,0xff,0x00,0x00,0x00,0x07,0xff,0x00,0x00,0x00,0x06,0x01,0x00,0x00,0x00,0x06,0x03,0x00,0x00,0x00,0x06,0x03,0x00,0x00,0x00,0x07,0x07,0x40,0x00,0x00,0x03,0xfe,0x20,0x00,0x00,0x01,0xfc,0xb0,0x00,0x00,0x00,0x71,0x50,0x00,0x00,0x00,0x06,0xa0,0x00,0x00,0x00,0x03,0x40,0x00,0x00,0x00,0x00,0x80,0x00,0x00,0x00,0x06,0x00,0x00
-};
-
-const unsigned char PROGMEM image_rfid_Layer_8_bits[] = {
-    0x00,0x3f,0x00,0x00,0x00,0xff,0xc0,0x00,0x00,0xff,0xc0,0x00,0x00,0x47,0x80,0x00,0x00,0x07,0x00,0x00,0x00,0x0e,0x00,0x00,0x00,0x1c,0x00,0x00,0x00,0x38,0x00,0x00,0x00,0x70,0x00,0x00,0x00,0xf0,0x40,0x00,0x01,0xe1,0xe0,0x00,0x00,0xff,0xc0,0x00,0x00,0x7f,0x80,0x00,0x0c,0x00,0x0c,0x00,0x0e,0x00,0x1c,0x00,0x0f,0x80,0x7c,0x00,0x07,0xff,0xf8,0x00,0x41,0xff,0xe0,0x80,0xe0,0x1e,0x01,0xc0,0xf8,0x00,0x07,0xc0,0x3e,0x00,0x1f,0x00,0x1f,0xff,0xfe,0x00,0x07,0xff,0xf8,0x00,0x00,0x7f,0x80,0x00
-};
-
-const unsigned char PROGMEM image_rfid_Layer_9_bits[] = {
-    0xff,0xfc,0xff,0xfc,0x03,0x0c,0x03,0x0c,0x0f,0x0c,0x0f,0x0c,0x33,0x0c,0x33,0x0c,0xc0,0xf0,0xc0,0xf0,0x00,0x00,0x00,0x00,0xff,0xfc,0xff,0xfc,0x03,0x0c,0x03,0x0c,0x03,0x0c,0x03,0x0c,0x03,0x0c,0x03,0x0c,0x00,0x0c,0x00,0x0c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xc0,0x0c,0xc0,0x0c,0xff,0xfc,0xff,0xfc,0xc0,0x0c,0xc0,0x0c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xff,0xfc,0xff,0xfc,0xc0,0x0c,0xc0,0x0c,0xc0,0x0c,0xc0,0x0c,0xc0,0x0c,0xc0,0x0c,0x3f,0xf0,0x3f,0xf0
-};
-
-const unsigned char PROGMEM image_rfid_Layer_10_bits[] = {
-    0x0f,0x00,0x10,0xc0,0x20,0x20,0x20,0x30,0x20,0x10,0x20,0x10,0x20,0x10,0x10,0x20,0x00,0x70,0x00,0x00,0x00,0x00,0x1e,0x10,0x31,0xf0,0x20,0x10,0x20,0x10,0x20,0x00,0x30,0x00,0x10,0x00,0x0f,0x10,0x01,0xf0,0x00,0x10,0x20,0x00,0x30,0x00,0x3f,0x90,0x22,0x70,0x02,0x10,0x02,0x10,0x02,0x10,0x0e,0x10,0x11,0x30,0x20,0xe0,0x00,0x00,0x20,0x00,0x30,0x00,0x3f,0x90,0x22,0x70,0x02,0x10,0x02,0x10,0x02,0x10,0x0e,0x10,0x11,0x30,0x20,0xe0,0x80,0x00,0x80,0x00,0x80,0x00,0x80,0x00,0x80,0x00,0x80,0x00,0x80,0x00,0x80,0x00,0x80,0x00,0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x30,0x20,0x10,0x38,0x10,0x2f,0xd0,0x20,0x30,0x20,0x10,0x00,0x10,0x00,0x10,0x00,0x30,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x10,0x38,0x10,0x27,0xd0,0x20,0x30,0x20,0x10,0x00,0x10,0x00,0x10,0x20,0x00,0x20,0x00,0x3f,0x10,0x20,0xf0,0x00,0x30,0x07,0xc0,0x06,0x00,0x21,0x00,0x20,0xc0,0x3c,0x20,0x27,0xf0,0x00,0x10,0x20,0x10,0x30,0x00,0x3f,0x90,0x21,0x70,0x21,0x10,0x21,0x10,0x23,0x90,0x20,0x10,0x38,0x10,0x00,0x30
-};
-
-// SHARED ICON BITMAPS (used across multiple menus)
-const unsigned char PROGMEM image_files_Layer_6_bits[] = {
-    0x0f,0xff,0xff,0xff,0x80,0x00,0x3f,0xff,0xff,0xff,0xe0,0x00,0x7f,0xff,0xff,0xff,0xf0,0x00,0x70,0x00,0x00,0x00,0x70,0x00,0xf0,0x00,0x00,0x00,0x38,0x00,0xe7,0x39,0xdc,0xe7,0x38,0x00,0xe7,0x39,0xdc,0xe7,0x38,0x00,0xe7,0x39,0xdc,0xe7,0x38,0x00,0xe7,0x39,0xdc,0xe7,0x38,0x00,0xe7,0x39,0xdc,0xe7,0x38,0x00,0xe7,0x39,0xdc,0xe7,0x38,0x00,0xe7,0x39,0xdc,0xe7,0x38,0x00,0xe7,0x39,0xdc,0xe7,0x38,0x00,0xe7,0x39,0x8c,0xe7,0x38,0x00,0xe0,0x00,0x00,0x00,0x38,0x00,0xe0,0x00,0x00,0x00,0x3c,0x00,0xe0,0x00,0x00,0x00,0x1e,0x00,0xe0,0x00,0x00,0x00,0x0f,0x00,0xe0,0x00,0x00,0x00,0x07,0x00,0xe0,0x00,0x00,0x00,0x03,0x80,0xe0,0x00,0x00,0x00,0x03,0x80,0xe0,0x00,0x00,0x00,0x03,0x80,0xe0,0x00,0x00,0x00,0x03,0x80,0xe0,0x00,0x00,0x00,0x03,0x80,0xe0,0x00,0x00,0x00,0x03,0x80,0xe0,0x00,0x00,0x00,0x03,0x80,0xe0,0x00,0x00,0x00,0x03,0x80,0xe0,0x00,0x00,0x00,0x03,0x80,0xe0,0x00,0x00,0x00,0x03,0x80,0xe0,0x00,0x00,0x00,0x03,0x80,0xe0,0x00,0x00,0x00,0x03,0x80,0xe0,0x00,0x00,0x00,0x03,0x80,0xe0,0x00,0x00,0x00,0x03,0x80,0xe0,0x00,0x00,0x00,0x03,0x80,0xe0,0x00,0x00,0x00,0x03,0x80,0xe0,0x00,0x00,0x00,0x03,0x80,0xe3,0xff,0xff,0xff,0xe3,0x80,0xe3,0xff,0xff,0xff,0xe3,0x80,0xe3,0xff,0xff,0xff,0xe3,0x80,0xe3,0x80,0x00,0x00,0xe3,0x80,0xe3,0x80,0x00,0x00,0xe3,0x80,0xe3,0x80,0x00,0x00,0xe3,0x80,0xe3,0x80,0x00,0x00,0xe3,0x80,0xe3,0x80,0x00,0x00,0xe3,0x80,0xe3,0x80,0x00,0x00,0xe3,0x80,0xe3,0xff,0xff,0xff,0xe3,0x80,0xe3,0xff,0xff,0xff,0xe3,0x80,0xe3,0xff,0xff,0xff,0xe3,0x80,0xe0,0x00,0x00,0x00,0x03,0x80,0xe0,0x00,0x00,0x00,0x03,0x80,0xe0,0x00,0x00,0x00,0x03,0x80,0xf0,0x00,0x00,0x00,0x07,0x00,0x7c,0x00,0x00,0x00,0x1f,0x00,0x3f,0xff,0xff,0xff,0xfe,0x00,0x1f,0xff,0xff,0xff,0xfc,0x00
-};
-
-const unsigned char PROGMEM image_mi1byse_extraextra_bits[] = {
-    0x00,0x00,0x00,0x07,0xff,0xff,0xc0,0x00,0x00,0x00,0x0f,0xff,0xff,0xe0,0x00,0x00,0x00,0x0f,0xff,0xff,0xf0,0x00,0x00,0x00,0x0f,0xff,0xff,0xf0,0x3f,0xff,0xfc,0x0f,0xff,0xff,0xf0,0x7f,0xff,0xfe,0x0f,0xff,0xff,0xf0,0xff,0xff,0xff,0x0f,0xff,0xff,0xf0,0xff,0xff,0xff,0x0f,0xff,0xff,0xf0,0xff,0xff,0xff,0x0f,0xff,0xff,0xf0,0xff,0xff,0xff,0x0f,0xff,0xff,0xf0,0xff,0xff,0xff,0x0f,0xff,0xff,0xf0,0xff,0xff,0xff,0x0f,0xff,0xff,0xf0,0xff,0xff,0xff,0x0f,0xff,0xff,0xf0,0xff,0xff,0xff,0x0f,0xff,0xff,0xf0,0xff,0xff,0xff,0x0f,0xff,0xff,0xf0,0xff,0xff,0xff,0x0f,0xff,0xff,0xf0,0xff,0xff,0xff,0x0f,0xff,0xff,0xf0,0xff,0xff,0xff,0x0f,0xff,0xff,0xf0,0xff,0xff,0xff,0x0f,0xff,0xff,0xf0,0xff,0xff,0xff,0x0f,0xff,0xff,0xf0,0xff,0xff,0xff,0x0f,0xff,0xff,0xf0,0xff,0xff,0xff,0x0f,0xff,0xff,0xf0,0xff,0xff,0xff,0x0f,0xff,0xff,0xf0,0xff,0xff,0xff,0x07,0xff,0xff,0xe0,0xff,0xff,0xff,0x00,0x00,0x00,0x00,0xff,0xff,0xff,0x00,0x00,0x00,0x00,0xff,0xff,0xff,0x80,0x00,0x00,0x00,0xff,0xff,0xff,0xc0,0x00,0x00,0x00,0xff,0xff,0xff,0xff,0xff,0xfc,0x00,0xff,0xff,0xff,0xff,0xff,0xfe,0x00,0xff,0xff,0xff,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0xff,0xff,0xff,0x00,0x7f,0xff,0xff,0xff,0xff,0xfe,0x00,0x3f,0xff,0xff,0xff,0xff,0xfc,0x00
-};
-
-const unsigned char PROGMEM image_yhj24xz_RFIDrfid_bits[] = {
-    0xff,0xff,0xc0,0x80,0x00,0x40,0xff,0xff,0xc0,0xfc,0x00,0xc0,0xfb,0xfe,0xc0,0xf0,0x06,0xc0,0xc0,0x06,0xc0,0xcb,0xf6,0xc0,0xc8,0x56,0xc0,0xc8,0xd6,0xc0,0xcb,0xf6,0xc0,0xc8,0x06,0xc0,0xcb,0xf6,0xc0,0xc8,0x56,0xc0,0xc8,0x56,0xc0,0xc0,0x10,0xc0,0xf8,0x07,0xc0,0xfb,0xf7,0xc0,0x78,0x07,0x80,0x03,0xf0,0x00,0x02,0x10,0x00,0x02,0x10,0x00,0x01,0xe0,0x00,0x00,0xdc,0x00,0x00,0x18,0x00,0x00,0x20,0x00
-};
-
-// NFC menu bitmap data
-const unsigned char PROGMEM image_nfc_Layer_2_bits[] = {
-    0x0f,0xf0,0x0f,0xf0,0x30,0x00,0x30,0x00,0xc3,0xc0,0xc3,0xc0,0xcc,0x30,0xcc,0x30,0xcc,0x30,0xcc,0x30,0xc3,0xc0,0xc3,0xc0,0xc0,0x00,0xc0,0x00,0xc0,0x00,0xc0,0x00,0xcc,0x00,0xcc,0x00,0xc3,0x00,0xc3,0x00,0xc0,0xc0,0xc0,0xc0,0xcc,0x30,0xcc,0x30,0xc3,0x00,0xc3,0x00,0xc0,0xc0,0xc0,0xc0,0xcc,0x30,0xcc,0x30,0xc3,0x00,0xc3,0x00,0xc0,0xc0,0xc0,0xc0,0xcc,0x30,0xcc,0x30,0xc3,0x00,0xc3,0x00,0xc0,0xc0,0xc0,0xc0,0xcc,0x30,0xcc,0x30,0xc3,0x00,0xc3,0x00,0xc0,0xc0,0xc0,0xc0,0xcc,0x30,0xcc,0x30,0xc3,0x00,0xc3,0x00,0xc0,0xc0,0xc0,0xc0,0xc0,0x30,0xc0,0x30,0xc0,0x00,0xc0,0x00,0x30,0x00,0x30,0x00,0x3c,0x00,0x3c,0x00,0x3f,0x00,0x3f,0x00,0x3f,0xc0,0x3f,0xc0,0x3f,0xf0,0x3f,0xf0,0x33,0xf0,0x33,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0
-};
-
-const unsigned char PROGMEM image_nfc_Layer_3_bits[] = {
-    0x3f,0xf8,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x38,0x38,0x08,0x20,0x08,0x20,0x07,0xc0
-};
-
-const unsigned char PROGMEM image_nfc_Layer_6_bits[] = {
-    0x00,0x00,0x00,0x78,0x00,0x00,0x00,0x00,0x00,0x07,0xff,0x00,0x00,0x00,0x00,0x00,0x3f,0xff,0xe0,0x00,0x00,0x00,0x00,0x7f,0xff,0xf8,0x00,0x00,0x00,0x00,0xff,0xff,0xf8,0x00,0x00,0x00,0x00,0x7f,0xff,0xf0,0x00,0x00,0x00,0x00,0x3c,0x0f,0xe0,0x00,0x00,0x00,0x00,0x10,0x1f,0xc0,0x00,0x00,0x00,0x00,0x00,0x1f,0xc0,0x00,0x00,0x00,0x00,0x00,0x3f,0x00,0x00,0x00,0x00,0x00,0x00,0x7f,0x00,0x00,0x00,0x00,0x00,0x00,0xfe,0x00,0x00,0x00,0x00,0x00,0x01,0xfc,0x00,0x00,0x00,0x00,0x00,0x03,0xf8,0x00,0x00,0x00,0x00,0x00,0x07,0xf0,0x00,0x00,0x00,0x00,0x00,0x0f,0xe0,0x00,0x00,0x00,0x00,0x00,0x1f,0xc0,0x00,0x00,0x00,0x00,0x00,0x3f,0x80,0x00,0x00,0x00,0x00,0x00,0x3f,0x80,0x00,0x00,0x00,0x00,0x00,0x7f,0x00,0x30,0x00,0x00,0x00,0x00,0xfe,0x00,0xf8,0x00,0x00,0x00,0x01,0xfe,0x03,0xfc,0x00,0x00,0x00,0x03,0xff,0xff,0xfe,0x00,0x00,0x00,0x00,0xff,0xff,0xf8,0x00,0x00,0x00,0x00,0x7f,0xff,0xf0,0x00,0x00,0x00,0x00,0x1f,0xff,0xc0,0x00,0x00,0x00,0x00,0x03,0xfe,0x00,0x00,0x00,0x00,0x70,0x00,0x00,0x00,0x70,0x00,0x00,0x78,0x00,0x00,0x00,0xf0,0x00,0x00,0xfe,0x00,0x00,0x03,0xf8,0x00,0x01,0xff,0x80,0x00,0x0f,0xfc,0x00,0x00,0xff,0xe0,0x00,0x3f,0xf8,0x00,0x00,0x3f,0xff,0x07,0xff,0xe0,0x00,0x00,0x1f,0xff,0xff,0xff,0xc0,0x00,0x10,0x07,0xff,0xff,0xff,0x00,0x00,0x30,0x01,0xff,0xff,0xfc,0x00,0x60,0x3c,0x00,0x3f,0xff,0xe0,0x01,0xf0,0x7e,0x00,0x01,0xfc,0x00,0x03,0xf0,0xff,0x00,0x00,0x00,0x00,0x0f,0xf8,0x7f,0xe0,0x00,0x00,0x00,0x3f,0xf0,0x3f,0xf8,0x00,0x00,0x00,0xff,0xe0,0x0f,0xfe,0x00,0x00,0x03,0xff,0x80,0x07,0xff,0xc0,0x00,0x3f,0xff,0x00,0x01,0xff,0xff,0xff,0xff,0xfc,0x00,0x00,0x7f,0xff,0xff,0xff,0xf0,0x00,0x00,0x1f,0xff,0xff,0xff,0xc0,0x00,0x00,0x03,0xff,0xff,0xfe,0x00,0x00,0x00,0x00,0x3f,0xff,0xe0,0x00,0x00,0x00,0x00,0x01,0xf8,0x00,0x00,0x00
-};
-
-const unsigned char PROGMEM image_nfc_Layer_7_bits[] = {
-    0xff,0xfc,0xff,0xfc,0x00,0xc0,0x00,0xc0,0x03,0x00,0x03,0x00,0x0c,0x00,0x0c,0x00,0xff,0xfc,0xff,0xfc,0x00,0x00,0x00,0x00,0xff,0xfc,0xff,0xfc,0x03,0x0c,0x03,0x0c,0x03,0x0c,0x03,0x0c,0x03,0x0c,0x03,0x0c,0x00,0x0c,0x00,0x0c,0x00,0x00,0x00,0x00,0x3f,0xf0,0x3f,0xf0,0xc0,0x0c,0xc0,0x0c,0xc0,0x0c,0xc0,0x0c,0xc0,0x0c,0xc0,0x0c,0x30,0x30,0x30,0x30
-};
-
-const unsigned char PROGMEM image_nfc_Layer_8_bits[] = {
-    0x00,0x02,0x00,0x00,0x0f,0x00,0x00,0x0f,0x00,0x00,0x07,0x80,0x00,0x07,0xc0,0x00,0xc3,0xc0,0x01,0xc1,0xe0,0x01,0xe1,0xe0,0x01,0xe1,0xe0,0x00,0xf0,0xf0,0x10,0xf0,0xf0,0x38,0x70,0xf0,0x38,0x78,0xf0,0xf8,0x78,0xf0,0xf8,0x78,0xf0,0x38,0x78,0xf0,0x38,0x70,0xf0,0x10,0xf0,0xf0,0x00,0xf0,0xf0,0x01,0xe1,0xe0,0x01,0xe1,0xe0,0x01,0xc1,0xe0,0x00,0xc3,0xc0,0x00,0x07,0xc0,0x00,0x07,0x80,0x00,0x0f,0x00,0x00,0x0f,0x00,0x00,0x06,0x00
-};
-
-const unsigned char PROGMEM image_nfc_Layer_9_bits[] = {
-    0xff,0xff,0xc0,0x80,0x00,0x40,0xff,0xff,0xc0,0xfc,0x00,0xc0,0xfb,0xfe,0xc0,0xf0,0x06,0xc0,0xc0,0x06,0xc0,0xcb,0xf6,0xc0,0xc8,0x56,0xc0,0xc8,0xd6,0xc0,0xcb,0xf6,0xc0,0xc8,0x06,0xc0,0xcb,0xf6,0xc0,0xc8,0x56,0xc0,0xc8,0x56,0xc0,0xc0,0x10,0xc0,0xf8,0x07,0xc0,0xfb,0xf7,0xc0,0x78,0x07,0x80,0x03,0xf0,0x00,0x02,0x10,0x00,0x02,0x10,0x00,0x01,0xe0,0x00,0x00,0xdc,0x00,0x00,0x18,0x00,0x00,0x20,0x00
-};
-
-const unsigned char PROGMEM image_nfc_Layer_10_bits[] = {
-    0x0f,0x00,0x10,0xc0,0x20,0x20,0x20,0x30,0x20,0x10,0x20,0x10,0x20,0x10,0x10,0x20,0x00,0x70,0x00,0x00,0x00,0x00,0x1e,0x10,0x31,0xf0,0x20,0x10,0x20,0x10,0x20,0x00,0x30,0x00,0x10,0x00,0x0f,0x10,0x01,0xf0,0x00,0x10,0x20,0x00,0x30,0x00,0x3f,0x90,0x22,0x70,0x02,0x10,0x02,0x10,0x02,0x10,0x0e,0x10,0x11,0x30,0x20,0xe0,0x00,0x00,0x20,0x00,0x30,0x00,0x3f,0x90,0x22,0x70,0x02,0x10,0x02,0x10,0x02,0x10,0x0e,0x10,0x11,0x30,0x20,0xe0,0x80,0x00,0x80,0x00,0x80,0x00,0x80,0x00,0x80,0x00,0x80,0x00,0x80,0x00,0x80,0x00,0x80,0x00,0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x30,0x20,0x10,0x38,0x10,0x2f,0xd0,0x20,0x30,0x20,0x10,0x00,0x10,0x00,0x10,0x00,0x30,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x10,0x38,0x10,0x27,0xd0,0x20,0x30,0x20,0x10,0x00,0x10,0x00,0x10,0x20,0x00,0x20,0x00,0x3f,0x10,0x20,0xf0,0x00,0x30,0x07,0xc0,0x06,0x00,0x21,0x00,0x20,0xc0,0x3c,0x20,0x27,0xf0,0x00,0x10,0x20,0x10,0x30,0x00,0x3f,0x90,0x21,0x70,0x21,0x10,0x21,0x10,0x23,0x90,0x20,0x10,0x38,0x10,0x00,0x30
-};
-
-//Options
-const unsigned char OptionsLayer_7_bits[] = {
-    0x0f,0xf0,0x0f,0xf0,0x30,0x00,0x30,0x00,0xc3,0xc0,0xc3,0xc0,0xcc,0x30,0xcc,0x30,0xcc,0x30,0xcc,0x30,0xc3,0xc0,0xc3,0xc0,0xc0,0x00,0xc0,0x00,0xc0,0x00,0xc0,0x00,0xcc,0x00,0xcc,0x00,0xc3,0x00,0xc3,0x00,0xc0,0xc0,0xc0,0xc0,0xcc,0x30,0xcc,0x30,0xc3,0x00,0xc3,0x00,0xc0,0xc0,0xc0,0xc0,0xcc,0x30,0xcc,0x30,0xc3,0x00,0xc3,0x00,0xc0,0xc0,0xc0,0xc0,0xcc,0x30,0xcc,0x30,0xc3,0x00,0xc3,0x00,0xc0,0xc0,0xc0,0xc0,0xcc,0x30,0xcc,0x30,0xc3,0x00,0xc3,0x00,0xc0,0xc0,0xc0,0xc0,0xcc,0x30,0xcc,0x30,0xc3,0x00,0xc3,0x00,0xc0,0xc0,0xc0,0xc0,0xc0,0x30,0xc0,0x30,0xc0,0x00,0xc0,0x00,0x30,0x00,0x30,0x00,0x3c,0x00,0x3c,0x00,0x3f,0x00,0x3f,0x00,0x3f,0xc0,0x3f,0xc0,0x3f,0xf0,0x3f,0xf0,0x33,0xf0,0x33,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0
-};
-const unsigned char OptionsLayer_9_bits[] = {
-    0x3f,0xf8,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x38,0x38,0x08,0x20,0x08,0x20,0x07,0xc0
-    };
-
 void drawWiFiMenu(void) {
     tft.fillScreen(TFT_BLACK);
     
@@ -429,28 +11,28 @@ void drawWiFiMenu(void) {
     tft.drawRect(1, 0, 134, 239, 0xFFFF);
 
     // Layer 10
-    tft.drawBitmap(50, 106, image_wifi_Layer_10_bits, 21, 66, 0xFFFF);
+    tft.drawBitmap(50, 106, asset(AssetId::WIFI_LAYER_10), 21, 66, 0xFFFF);
 
     // Layer 11
-    tft.drawBitmap(122, 146, image_wifi_Layer_11_bits, 12, 92, 0xFFFF);
+    tft.drawBitmap(122, 146, asset(AssetId::WIFI_LAYER_11), 12, 92, 0xFFFF);
 
     // Layer 13
-    tft.drawBitmap(117, 4, image_wifi_Layer_13_bits, 16, 24, 0xFFFF);
+    tft.drawBitmap(117, 4, asset(AssetId::WIFI_LAYER_13), 16, 24, 0xFFFF);
 
     // Layer 16
     tft.drawLine(114, 239, 114, 2, 0xFFFF);
 
     // Layer 18
-    tft.drawBitmap(94, 44, image_Layer_18_bits, 16, 22, 0x73AE);
+    tft.drawBitmap(94, 44, asset(AssetId::LAYER_18), 16, 22, 0x73AE);
 
     // Layer 20
-    tft.drawBitmap(-16, 21, image_Layer_20_bits, 68, 68, 0x73AE);
+    tft.drawBitmap(-16, 21, asset(AssetId::LAYER_20), 68, 68, 0x73AE);
 
     // Layer 21
-    tft.drawBitmap(118, 39, image_wifi_Layer_21_bits, 12, 97, 0xFFFF);
+    tft.drawBitmap(118, 39, asset(AssetId::WIFI_LAYER_21), 12, 97, 0xFFFF);
 
     // Layer 22
-    tft.drawBitmap(46, 35, image_Layer_22_bits, 29, 42, 0xFFFF);
+    tft.drawBitmap(46, 35, asset(AssetId::LAYER_22), 29, 42, 0xFFFF);
 }
 
 void drawBluetoothMenu(void) {
@@ -460,28 +42,28 @@ void drawBluetoothMenu(void) {
     tft.drawRect(1, 0, 134, 239, 0xFFFF);
 
     // Layer 2
-    tft.drawBitmap(117, 4, image_bt_Layer_2_bits, 16, 24, 0xFFFF);
+    tft.drawBitmap(117, 4, asset(AssetId::BT_LAYER_2), 16, 24, 0xFFFF);
 
     // Layer 3
-    tft.drawBitmap(122, 146, image_bt_Layer_3_bits, 12, 92, 0xFFFF);
+    tft.drawBitmap(122, 146, asset(AssetId::BT_LAYER_3), 12, 92, 0xFFFF);
 
     // Layer 5
     tft.drawLine(114, 239, 114, 2, 0xFFFF);
 
     // Layer 6
-    tft.drawBitmap(41, 35, image_bt_Layer_6_bits, 33, 45, 0xFFFF);
+    tft.drawBitmap(41, 35, asset(AssetId::BT_LAYER_6), 33, 45, 0xFFFF);
 
     // Layer 7
-    tft.drawBitmap(50, 106, image_bt_Layer_7_bits, 14, 106, 0xFFFF);
+    tft.drawBitmap(50, 106, asset(AssetId::BT_LAYER_7), 14, 106, 0xFFFF);
 
     // Layer 8
-    tft.drawBitmap(118, 39, image_bt_Layer_8_bits, 12, 97, 0xFFFF);
+    tft.drawBitmap(118, 39, asset(AssetId::BT_LAYER_8), 12, 97, 0xFFFF);
 
     // Layer 9
-    tft.drawBitmap(9, 44, image_bt_Layer_9_bits, 20, 28, 0x73AE);
+    tft.drawBitmap(9, 44, asset(AssetId::BT_LAYER_9), 20, 28, 0x73AE);
 
     // Layer 10
-    tft.drawBitmap(80, 43, image_bt_Layer_10_bits, 31, 31, 0x73AE);
+    tft.drawBitmap(80, 43, asset(AssetId::BT_LAYER_10), 31, 31, 0x73AE);
 }
 
 void drawIRMenu(void) {
@@ -491,28 +73,28 @@ void drawIRMenu(void) {
     tft.drawRect(1, 0, 134, 239, 0xFFFF);
 
     // Layer 2
-    tft.drawBitmap(122, 146, image_ir_Layer_2_bits, 12, 92, 0xFFFF);
+    tft.drawBitmap(122, 146, asset(AssetId::IR_LAYER_2), 12, 92, 0xFFFF);
 
     // Layer 3
-    tft.drawBitmap(117, 4, image_ir_Layer_3_bits, 16, 24, 0xFFFF);
+    tft.drawBitmap(117, 4, asset(AssetId::IR_LAYER_3), 16, 24, 0xFFFF);
 
     // Layer 5
     tft.drawLine(114, 239, 114, 2, 0xFFFF);
 
     // Layer 6
-    tft.drawBitmap(118, 39, image_ir_Layer_6_bits, 12, 97, 0xFFFF);
+    tft.drawBitmap(118, 39, asset(AssetId::IR_LAYER_6), 12, 97, 0xFFFF);
 
     // Layer 8 (note: Layer_8_x variable - you'll need to define this)
-    tft.drawBitmap(38, 35, image_ir_Layer_8_bits, 45, 45, 0xFFFF);
+    tft.drawBitmap(38, 35, asset(AssetId::IR_LAYER_8), 45, 45, 0xFFFF);
 
     // Layer 9
-    tft.drawBitmap(50, 106, image_ir_Layer_9_bits, 14, 20, 0xFFFF);
+    tft.drawBitmap(50, 106, asset(AssetId::IR_LAYER_9), 14, 20, 0xFFFF);
 
     // Layer 10
-    tft.drawBitmap(4, 43, image_ir_Layer_10_bits, 24, 34, 0x73AE);
+    tft.drawBitmap(4, 43, asset(AssetId::IR_LAYER_10), 24, 34, 0x73AE);
 
     // Layer 11
-    tft.drawBitmap(84, 52, image_ir_Layer_11_bits, 26, 18, 0x73AE);
+    tft.drawBitmap(84, 52, asset(AssetId::IR_LAYER_11), 26, 18, 0x73AE);
 }
 
 void drawRFMenu(void) {
@@ -522,28 +104,28 @@ void drawRFMenu(void) {
     tft.drawRect(1, 1, 134, 239, 0xFFFF);
 
     // Layer 7
-    tft.drawBitmap(122, 146, image_rf_Layer_7_bits, 12, 92, 0xFFFF);
+    tft.drawBitmap(122, 146, asset(AssetId::RF_LAYER_7), 12, 92, 0xFFFF);
 
     // Layer 9
-    tft.drawBitmap(117, 4, image_rf_Layer_9_bits, 16, 24, 0xFFFF);
+    tft.drawBitmap(117, 4, asset(AssetId::RF_LAYER_9), 16, 24, 0xFFFF);
 
     // Layer 11
     tft.drawLine(114, 239, 114, 2, 0xFFFF);
 
     // Layer 12
-    tft.drawBitmap(54, 125, image_Layer_12_bits, 14, 22, 0xFFFF);
+    tft.drawBitmap(54, 125, asset(AssetId::LAYER_12), 14, 22, 0xFFFF);
 
     // Layer 13
-    tft.drawBitmap(118, 39, image_Layer_13_bits, 12, 97, 0xFFFF);
+    tft.drawBitmap(118, 39, asset(AssetId::LAYER_13), 12, 97, 0xFFFF);
 
     // Layer 14
-    tft.drawBitmap(34, 42, image_Layer_14_bits, 52, 36, 0xFFFF);
+    tft.drawBitmap(34, 42, asset(AssetId::LAYER_14), 52, 36, 0xFFFF);
 
     // Layer 15
-    tft.drawBitmap(5, 48, image_Layer_15_bits, 23, 23, 0x73AE);
+    tft.drawBitmap(5, 48, asset(AssetId::LAYER_15), 23, 23, 0x73AE);
 
     // nrf_4
-    tft.drawBitmap(87, 50, image_nrf_4_bits, 26, 18, 0x73AE);
+    tft.drawBitmap(87, 50, asset(AssetId::NRF_4), 26, 18, 0x73AE);
 }
 
 void drawNRFMenu(void) {
@@ -553,28 +135,28 @@ void drawNRFMenu(void) {
     tft.drawRect(1, 1, 134, 239, 0xFFFF);
 
     // Layer 7
-    tft.drawBitmap(122, 146, image_nrf_Layer_7_bits, 12, 92, 0xFFFF);
+    tft.drawBitmap(122, 146, asset(AssetId::NRF_LAYER_7), 12, 92, 0xFFFF);
 
     // Layer 9
-    tft.drawBitmap(117, 4, image_nrf_Layer_9_bits, 16, 24, 0xFFFF);
+    tft.drawBitmap(117, 4, asset(AssetId::NRF_LAYER_9), 16, 24, 0xFFFF);
 
     // Layer 11
     tft.drawLine(114, 239, 114, 2, 0xFFFF);
 
     // Layer 13
-    tft.drawBitmap(118, 39, image_nrf_Layer_13_bits, 12, 97, 0xFFFF);
+    tft.drawBitmap(118, 39, asset(AssetId::NRF_LAYER_13), 12, 97, 0xFFFF);
 
     // Layer 14
-    tft.drawBitmap(7, 51, image_nrf_Layer_14_bits, 26, 18, 0x73AE);
+    tft.drawBitmap(7, 51, asset(AssetId::NRF_LAYER_14), 26, 18, 0x73AE);
 
     // 5ti7rmt#RADIOradio
-    tft.drawBitmap(89, 45, image__5ti7rmt_RADIOradio_bits, 23, 27, 0x73AE);
+    tft.drawBitmap(89, 45, asset(AssetId::IMG_5TI7RMT_RADIORADIO), 23, 27, 0x73AE);
 
     // nrf_1
-    tft.drawBitmap(37, 43, image_nrf_1_bits, 48, 35, 0xFFFF);
+    tft.drawBitmap(37, 43, asset(AssetId::NRF_1), 48, 35, 0xFFFF);
 
     // Layer 17
-    tft.drawBitmap(54, 125, image_nrf_Layer_17_bits, 14, 34, 0xFFFF);
+    tft.drawBitmap(54, 125, asset(AssetId::NRF_LAYER_17), 14, 34, 0xFFFF);
 }
 
 void drawRadioMenu(void) {
@@ -584,28 +166,28 @@ void drawRadioMenu(void) {
     tft.drawRect(1, 1, 134, 239, 0xFFFF);
 
     // Layer 2
-    tft.drawBitmap(117, 4, image_radio_Layer_2_bits, 16, 24, 0xFFFF);
+    tft.drawBitmap(117, 4, asset(AssetId::RADIO_LAYER_2), 16, 24, 0xFFFF);
 
     // Layer 3
-    tft.drawBitmap(122, 146, image_radio_Layer_3_bits, 12, 92, 0xFFFF);
+    tft.drawBitmap(122, 146, asset(AssetId::RADIO_LAYER_3), 12, 92, 0xFFFF);
 
     // Layer 5
     tft.drawLine(114, 239, 114, 2, 0xFFFF);
 
     // Layer 6
-    tft.drawBitmap(40, 42, image_radio_Layer_6_bits, 46, 54, 0xFFFF);
+    tft.drawBitmap(40, 42, asset(AssetId::RADIO_LAYER_6), 46, 54, 0xFFFF);
 
     // Layer 7
-    tft.drawBitmap(118, 39, image_radio_Layer_7_bits, 12, 97, 0xFFFF);
+    tft.drawBitmap(118, 39, asset(AssetId::RADIO_LAYER_7), 12, 97, 0xFFFF);
 
     // Layer 8
-    tft.drawBitmap(54, 125, image_radio_Layer_8_bits, 14, 58, 0xFFFF);
+    tft.drawBitmap(54, 125, asset(AssetId::RADIO_LAYER_8), 14, 58, 0xFFFF);
 
     // GPS pin icon
-    tft.drawBitmap(89, 62, image_cwg9wyw_black_white_simple_bit_vector_pixel_art_icon_geolocation_map_pin_black_white_simple_flat_bit_vector_pixel_art_icon_312637465black_white_simple_bit_vector_pixel_art_icon_geolocation_map_pin_black_white_simple_flat_bit_vector_pixel_art_icon_312637465_bits, 21, 16, 0x73AE);
+    tft.drawBitmap(89, 62, asset(AssetId::RADIO_MAP_PIN), 21, 16, 0x73AE);
 
     // nrf_4
-    tft.drawBitmap(7, 62, image_nrf_4_bits, 26, 18, 0x73AE);
+    tft.drawBitmap(7, 62, asset(AssetId::NRF_4), 26, 18, 0x73AE);
 }
 
 void drawGPSMenu(void) {
@@ -615,28 +197,28 @@ void drawGPSMenu(void) {
     tft.drawRect(1, 1, 134, 239, 0xFFFF);
 
     // Layer 2
-    tft.drawBitmap(117, 4, image_gps_Layer_2_bits, 16, 24, 0xFFFF);
+    tft.drawBitmap(117, 4, asset(AssetId::GPS_LAYER_2), 16, 24, 0xFFFF);
 
     // Layer 3
-    tft.drawBitmap(122, 146, image_gps_Layer_3_bits, 12, 92, 0xFFFF);
+    tft.drawBitmap(122, 146, asset(AssetId::GPS_LAYER_3), 12, 92, 0xFFFF);
 
     // Layer 5
     tft.drawLine(114, 239, 114, 2, 0xFFFF);
 
     // Layer 6
-    tft.drawBitmap(7, 45, image_gps_Layer_6_bits, 23, 27, 0x73AE);
+    tft.drawBitmap(7, 45, asset(AssetId::GPS_LAYER_6), 23, 27, 0x73AE);
 
     // Layer 7
-    tft.drawBitmap(118, 39, image_gps_Layer_7_bits, 12, 97, 0xFFFF);
+    tft.drawBitmap(118, 39, asset(AssetId::GPS_LAYER_7), 12, 97, 0xFFFF);
 
     // Layer 8
-    tft.drawBitmap(38, 42, image_gps_Layer_8_bits, 42, 32, 0xFFFF);
+    tft.drawBitmap(38, 42, asset(AssetId::GPS_LAYER_8), 42, 32, 0xFFFF);
 
     // Layer 9
-    tft.drawBitmap(85, 49, image_gps_Layer_9_bits, 25, 19, 0x73AE);
+    tft.drawBitmap(85, 49, asset(AssetId::GPS_LAYER_9), 25, 19, 0x73AE);
 
     // Layer 10
-    tft.drawBitmap(54, 125, image_gps_Layer_10_bits, 14, 34, 0xFFFF);
+    tft.drawBitmap(54, 125, asset(AssetId::GPS_LAYER_10), 14, 34, 0xFFFF);
 }
 
 void drawRPIMenu(void) {
@@ -646,31 +228,31 @@ void drawRPIMenu(void) {
     tft.drawRect(1, 0, 134, 240, 0xFFFF);
 
     // Layer 2
-    tft.drawBitmap(117, 4, image_rpi_Layer_2_bits, 16, 24, 0xFFFF);
+    tft.drawBitmap(117, 4, asset(AssetId::RPI_LAYER_2), 16, 24, 0xFFFF);
 
     // Layer 3
-    tft.drawBitmap(122, 146, image_rpi_Layer_3_bits, 12, 92, 0xFFFF);
+    tft.drawBitmap(122, 146, asset(AssetId::RPI_LAYER_3), 12, 92, 0xFFFF);
 
     // Layer 4
     tft.drawLine(114, 239, 114, 2, 0xFFFF);
 
     // Layer 6
-    tft.drawBitmap(40, 42, image_rpi_Layer_6_bits, 50, 38, 0xFFFF);
+    tft.drawBitmap(40, 42, asset(AssetId::RPI_LAYER_6), 50, 38, 0xFFFF);
 
     // Layer 7
-    tft.drawBitmap(118, 39, image_rpi_Layer_7_bits, 12, 97, 0xFFFF);
+    tft.drawBitmap(118, 39, asset(AssetId::RPI_LAYER_7), 12, 97, 0xFFFF);
 
     // Layer 8
-    tft.drawBitmap(94, 40, image_rpi_Layer_8_bits, 16, 40, 0x73AE);
+    tft.drawBitmap(94, 40, asset(AssetId::RPI_LAYER_8), 16, 40, 0x73AE);
 
     // Layer 9
-    tft.drawBitmap(67, 107, image_rpi_Layer_9_bits, 14, 32, 0xFFFF);
+    tft.drawBitmap(67, 107, asset(AssetId::RPI_LAYER_9), 14, 32, 0xFFFF);
 
     // GPS pin icon
-    tft.drawBitmap(5, 50, image_black_white_simple_bit_vector_pixel_art_icon_geolocation_map_pin_black_white_simple_flat_bit_vector_pixel_art_icon_312637465_312637466_bits, 31, 24, 0x73AE);
+    tft.drawBitmap(5, 50, asset(AssetId::RPI_MAP_PIN), 31, 24, 0x73AE);
 
     // Layer 10
-    tft.drawBitmap(50, 106, image_rpi_Layer_10_bits, 14, 82, 0xFFFF);
+    tft.drawBitmap(50, 106, asset(AssetId::RPI_LAYER_10), 14, 82, 0xFFFF);
 }
 
 void drawBadUSBMenu(void) {
@@ -680,28 +262,28 @@ void drawBadUSBMenu(void) {
     tft.drawRect(1, 0, 134, 240, 0xFFFF);
 
     // Layer 2
-    tft.drawBitmap(117, 4, image_badusb_Layer_2_bits, 16, 24, 0xFFFF);
+    tft.drawBitmap(117, 4, asset(AssetId::BADUSB_LAYER_2), 16, 24, 0xFFFF);
 
     // Layer 3
-    tft.drawBitmap(122, 146, image_badusb_Layer_3_bits, 12, 92, 0xFFFF);
+    tft.drawBitmap(122, 146, asset(AssetId::BADUSB_LAYER_3), 12, 92, 0xFFFF);
 
     // Layer 5
     tft.drawLine(114, 239, 114, 2, 0xFFFF);
 
     // rspi_1
-    tft.drawBitmap(7, 59, image_rspi_1_bits, 25, 19, 0x73AE);
+    tft.drawBitmap(7, 59, asset(AssetId::RSPI_1), 25, 19, 0x73AE);
 
     // USB_KILLER
-    tft.drawBitmap(47, 35, image_USB_KILLER_bits, 26, 60, 0xFFFF);
+    tft.drawBitmap(47, 35, asset(AssetId::USB_KILLER), 26, 60, 0xFFFF);
 
     // Layer 9
-    tft.drawBitmap(118, 39, image_badusb_Layer_9_bits, 12, 97, 0xFFFF);
+    tft.drawBitmap(118, 39, asset(AssetId::BADUSB_LAYER_9), 12, 97, 0xFFFF);
 
     // Layer 10
-    tft.drawBitmap(50, 106, image_badusb_Layer_10_bits, 14, 82, 0xFFFF);
+    tft.drawBitmap(50, 106, asset(AssetId::BADUSB_LAYER_10), 14, 82, 0xFFFF);
 
     // Settings icon
-    tft.drawBitmap(81, 55, image_equ2z4c_SETTINGSsettings_bits, 27, 27, 0x73AE);
+    tft.drawBitmap(81, 55, asset(AssetId::EQU2Z4C_SETTINGSSETTINGS), 27, 27, 0x73AE);
 }
 
 // Continue from where it was cut off:
@@ -713,31 +295,31 @@ void drawSettingsMenu(void) {
     tft.drawRect(1, 1, 134, 239, 0xFFFF);
 
     // Layer 2
-    tft.drawBitmap(117, 4, image_settings_Layer_2_bits, 16, 24, 0xFFFF);
+    tft.drawBitmap(117, 4, asset(AssetId::SETTINGS_LAYER_2), 16, 24, 0xFFFF);
 
     // Layer 3
-    tft.drawBitmap(122, 146, image_settings_Layer_3_bits, 12, 92, 0xFFFF);
+    tft.drawBitmap(122, 146, asset(AssetId::SETTINGS_LAYER_3), 12, 92, 0xFFFF);
 
     // Layer 5
     tft.drawLine(114, 239, 114, 2, 0xFFFF);
 
     // Layer 7
-    tft.drawBitmap(32, 47, image_settings_Layer_7_bits, 54, 54, 0xFFFF);
+    tft.drawBitmap(32, 47, asset(AssetId::SETTINGS_LAYER_7), 54, 54, 0xFFFF);
 
     // Layer 8
-    tft.drawBitmap(118, 39, image_settings_Layer_8_bits, 12, 97, 0xFFFF);
+    tft.drawBitmap(118, 39, asset(AssetId::SETTINGS_LAYER_8), 12, 97, 0xFFFF);
 
     // USB Killer icon (large)
-    tft.drawBitmap(-60, 8, image_g87a5zi_USB_KILLERusb_killer_bits, 75, 75, 0xFFFF);
+    tft.drawBitmap(-60, 8, asset(AssetId::G87A5ZI_USB_KILLERUSB_KILLER), 75, 75, 0xFFFF);
 
     // Layer 9
-    tft.drawBitmap(54, 125, image_settings_Layer_9_bits, 14, 94, 0xFFFF);
+    tft.drawBitmap(54, 125, asset(AssetId::SETTINGS_LAYER_9), 14, 94, 0xFFFF);
 
     // extra_1
-    tft.drawBitmap(88, 61, image_extra_1_bits, 25, 25, 0x73AE);
+    tft.drawBitmap(88, 61, asset(AssetId::EXTRA_1), 25, 25, 0x73AE);
 
     // USB Killer icon (small)
-    tft.drawBitmap(8, 55, image_ojp6uhu_USB_KILLERusb_killer_bits, 16, 40, 0x73AE);
+    tft.drawBitmap(8, 55, asset(AssetId::OJP6UHU_USB_KILLERUSB_KILLER), 16, 40, 0x73AE);
 }
 
 void drawExtrasMenu(void) {
@@ -747,31 +329,31 @@ void drawExtrasMenu(void) {
     tft.drawRect(1, 1, 134, 239, 0xFFFF);
 
     // Layer 2
-    tft.drawBitmap(117, 4, image_extras_Layer_2_bits, 16, 24, 0xFFFF);
+    tft.drawBitmap(117, 4, asset(AssetId::EXTRAS_LAYER_2), 16, 24, 0xFFFF);
 
     // Layer 3
-    tft.drawBitmap(122, 146, image_extras_Layer_3_bits, 12, 92, 0xFFFF);
+    tft.drawBitmap(122, 146, asset(AssetId::EXTRAS_LAYER_3), 12, 92, 0xFFFF);
 
     // Layer 5
     tft.drawLine(114, 239, 114, 2, 0xFFFF);
 
     // Layer 7
-    tft.drawBitmap(7, 60, image_extras_Layer_7_bits, 27, 27, 0x73AE);
+    tft.drawBitmap(7, 60, asset(AssetId::EXTRAS_LAYER_7), 27, 27, 0x73AE);
 
     // Layer 8
-    tft.drawBitmap(118, 39, image_extras_Layer_8_bits, 12, 97, 0xFFFF);
+    tft.drawBitmap(118, 39, asset(AssetId::EXTRAS_LAYER_8), 12, 97, 0xFFFF);
 
     // Extra icon (main)
-    tft.drawBitmap(36, 45, image_mi1byse_extraextra_bits, 52, 52, 0xFFFF);
+    tft.drawBitmap(36, 45, asset(AssetId::MI1BYSE_EXTRAEXTRA), 52, 52, 0xFFFF);
 
     // USB Killer icon (background)
-    tft.drawBitmap(-60, 8, image_g87a5zi_USB_KILLERusb_killer_bits, 75, 75, 0xFFFF);
+    tft.drawBitmap(-60, 8, asset(AssetId::G87A5ZI_USB_KILLERUSB_KILLER), 75, 75, 0xFFFF);
 
     // Files icon
-    tft.drawBitmap(90, 60, image_ot3p4l1_filesfiles_bits, 21, 28, 0x73AE);
+    tft.drawBitmap(90, 60, asset(AssetId::OT3P4L1_FILESFILES), 21, 28, 0x73AE);
 
     // Layer 11
-    tft.drawBitmap(54, 125, image_extras_Layer_11_bits, 14, 58, 0xFFFF);
+    tft.drawBitmap(54, 125, asset(AssetId::EXTRAS_LAYER_11), 14, 58, 0xFFFF);
 }
 
 void drawFilesMenu(void) {
@@ -781,31 +363,31 @@ void drawFilesMenu(void) {
     tft.drawRect(1, 1, 134, 239, 0xFFFF);
 
     // Layer 2
-    tft.drawBitmap(117, 4, image_files_Layer_2_bits, 16, 24, 0xFFFF);
+    tft.drawBitmap(117, 4, asset(AssetId::FILES_LAYER_2), 16, 24, 0xFFFF);
 
     // Layer 3
-    tft.drawBitmap(122, 146, image_files_Layer_3_bits, 12, 92, 0xFFFF);
+    tft.drawBitmap(122, 146, asset(AssetId::FILES_LAYER_3), 12, 92, 0xFFFF);
 
     // Layer 5
     tft.drawLine(114, 239, 114, 2, 0xFFFF);
 
     // Layer 8
-    tft.drawBitmap(118, 39, image_files_Layer_8_bits, 12, 97, 0xFFFF);
+    tft.drawBitmap(118, 39, asset(AssetId::FILES_LAYER_8), 12, 97, 0xFFFF);
 
     // mi1byse#extraextra
-    tft.drawBitmap(7, 60, image_mi1byse_extraextra_bitsfil, 26, 26, 0x73AE);
+    tft.drawBitmap(7, 60, asset(AssetId::MI1BYSE_EXTRAEXTRA_BITSFIL), 26, 26, 0x73AE);
 
     // g87a5zi#USB_KILLERusb_killer
-    tft.drawBitmap(-60, 8, image_g87a5zi_USB_KILLERusb_killer_bits, 75, 75, 0xFFFF);
+    tft.drawBitmap(-60, 8, asset(AssetId::G87A5ZI_USB_KILLERUSB_KILLER), 75, 75, 0xFFFF);
 
     // ot3p4l1#filesfiles
-    tft.drawBitmap(41, 43, image_files_Layer_6_bits, 41, 55, 0xFFFF);
+    tft.drawBitmap(41, 43, asset(AssetId::FILES_LAYER_6), 41, 55, 0xFFFF);
 
     // yhj24xz#RFIDrfid
-    tft.drawBitmap(92, 63, image_yhj24xz_RFIDrfid_bits, 18, 26, 0x73AE);
+    tft.drawBitmap(92, 63, asset(AssetId::YHJ24XZ_RFIDRFID), 18, 26, 0x73AE);
 
     // Layer 10
-    tft.drawBitmap(54, 125, image_files_Layer_10_bits, 14, 58, 0xFFFF);
+    tft.drawBitmap(54, 125, asset(AssetId::FILES_LAYER_10), 14, 58, 0xFFFF);
 }
 
 void drawRfidMenu(void) {
@@ -815,28 +397,28 @@ void drawRfidMenu(void) {
     tft.drawRect(1, 1, 134, 239, 0xFFFF);
 
     // Layer 2
-    tft.drawBitmap(122, 146, image_rfid_Layer_2_bits, 12, 92, 0xFFFF);
+    tft.drawBitmap(122, 146, asset(AssetId::RFID_LAYER_2), 12, 92, 0xFFFF);
 
     // Layer 3
-    tft.drawBitmap(117, 4, image_rfid_Layer_3_bits, 16, 24, 0xFFFF);
+    tft.drawBitmap(117, 4, asset(AssetId::RFID_LAYER_3), 16, 24, 0xFFFF);
 
     // Layer 5
     tft.drawLine(114, 239, 114, 2, 0xFFFF);
 
     // Layer 6
-    tft.drawBitmap(42, 35, image_rfid_Layer_6_bits, 37, 51, 0xFFFF);
+    tft.drawBitmap(42, 35, asset(AssetId::RFID_LAYER_6), 37, 51, 0xFFFF);
 
     // Layer 8
-    tft.drawBitmap(85, 43, image_rfid_Layer_8_bits, 26, 24, 0x73AE);
+    tft.drawBitmap(85, 43, asset(AssetId::RFID_LAYER_8), 26, 24, 0x73AE);
 
     // Layer 9
-    tft.drawBitmap(50, 106, image_rfid_Layer_9_bits, 14, 46, 0xFFFF);
+    tft.drawBitmap(50, 106, asset(AssetId::RFID_LAYER_9), 14, 46, 0xFFFF);
 
     // Files icon
-    tft.drawBitmap(10, 41, image_filesrfid_Layer_6_bits, 21, 27, 0x73AE);
+    tft.drawBitmap(10, 41, asset(AssetId::FILESRFID_LAYER_6), 21, 27, 0x73AE);
 
     // Layer 10
-    tft.drawBitmap(118, 39, image_rfid_Layer_10_bits, 12, 97, 0xFFFF);
+    tft.drawBitmap(118, 39, asset(AssetId::RFID_LAYER_10), 12, 97, 0xFFFF);
 }
 
 void drawNfcMenu(void) {
@@ -846,26 +428,26 @@ void drawNfcMenu(void) {
     tft.drawRect(1, 1, 134, 239, 0xFFFF);
 
     // Layer 2
-    tft.drawBitmap(122, 146, image_nfc_Layer_2_bits, 12, 92, 0xFFFF);
+    tft.drawBitmap(122, 146, asset(AssetId::NFC_LAYER_2), 12, 92, 0xFFFF);
 
     // Layer 3
-    tft.drawBitmap(117, 4, image_nfc_Layer_3_bits, 16, 24, 0xFFFF);
+    tft.drawBitmap(117, 4, asset(AssetId::NFC_LAYER_3), 16, 24, 0xFFFF);
 
     // Layer 5
     tft.drawLine(114, 239, 114, 2, 0xFFFF);
 
     // Layer 6
-    tft.drawBitmap(32, 35, image_nfc_Layer_6_bits, 53, 49, 0xFFFF);
+    tft.drawBitmap(32, 35, asset(AssetId::NFC_LAYER_6), 53, 49, 0xFFFF);
 
     // Layer 7
-    tft.drawBitmap(53, 107, image_nfc_Layer_7_bits, 14, 34, 0xFFFF);
+    tft.drawBitmap(53, 107, asset(AssetId::NFC_LAYER_7), 14, 34, 0xFFFF);
 
     // Layer 8
-    tft.drawBitmap(90, 44, image_nfc_Layer_8_bits, 20, 28, 0x73AE);
+    tft.drawBitmap(90, 44, asset(AssetId::NFC_LAYER_8), 20, 28, 0x73AE);
 
     // Layer 9
-    tft.drawBitmap(9, 45, image_nfc_Layer_9_bits, 18, 26, 0x73AE);
+    tft.drawBitmap(9, 45, asset(AssetId::NFC_LAYER_9), 18, 26, 0x73AE);
 
     // Layer 10
-    tft.drawBitmap(118, 39, image_nfc_Layer_10_bits, 12, 97, 0xFFFF);
+    tft.drawBitmap(118, 39, asset(AssetId::NFC_LAYER_10), 12, 97, 0xFFFF);
 }
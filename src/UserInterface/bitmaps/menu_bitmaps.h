@@ -3,145 +3,9 @@
 
 #include <Arduino.h>
 
-// WiFi menu bitmaps
-extern const unsigned char PROGMEM image__16_bits[];
-extern const unsigned char PROGMEM image__17_bits[];
-extern const unsigned char PROGMEM image__21_bits[];
-extern const unsigned char PROGMEM image_battery_empty_bits[];
-extern const unsigned char PROGMEM image_Layer_10_bits[];
-extern const unsigned char PROGMEM image_Layer_4_bits[];
-extern const unsigned char PROGMEM image_passport_left_bits[];
-extern const unsigned char PROGMEM image_Layer_18_bits[];
-extern const unsigned char PROGMEM image_Layer_20_bits[];
-extern const unsigned char PROGMEM image_Layer_22_bits[];
-
-// Bluetooth menu bitmaps
-extern const unsigned char PROGMEM image_bt_Layer_2_bits[];
-extern const unsigned char PROGMEM image_bt_Layer_3_bits[];
-extern const unsigned char PROGMEM image_bt_Layer_6_bits[];
-extern const unsigned char PROGMEM image_bt_Layer_7_bits[];
-extern const unsigned char PROGMEM image_bt_Layer_8_bits[];
-extern const unsigned char PROGMEM image_bt_Layer_9_bits[];
-extern const unsigned char PROGMEM image_bt_Layer_10_bits[];
-
-// IR menu bitmaps
-extern const unsigned char PROGMEM image_ir_Layer_2_bits[];
-extern const unsigned char PROGMEM image_ir_Layer_3_bits[];
-extern const unsigned char PROGMEM image_ir_Layer_6_bits[];
-extern const unsigned char PROGMEM image_ir_Layer_8_bits[];
-extern const unsigned char PROGMEM image_ir_Layer_9_bits[];
-extern const unsigned char PROGMEM image_ir_Layer_10_bits[];
-extern const unsigned char PROGMEM image_ir_Layer_11_bits[];
-
-// RF menu bitmaps
-extern const unsigned char PROGMEM image_rf_Layer_7_bits[];
-extern const unsigned char PROGMEM image_rf_Layer_9_bits[];
-extern const unsigned char PROGMEM image_Layer_12_bits[];
-extern const unsigned char PROGMEM image_Layer_13_bits[];
-extern const unsigned char PROGMEM image_Layer_14_bits[];
-extern const unsigned char PROGMEM image_Layer_15_bits[];
-extern const unsigned char PROGMEM image_nrf_4_bits[];
-
-// NRF menu bitmaps
-extern const unsigned char PROGMEM image_nrf_Layer_7_bits[];
-extern const unsigned char PROGMEM image_nrf_Layer_9_bits[];
-extern const unsigned char PROGMEM image_nrf_Layer_13_bits[];
-extern const unsigned char PROGMEM image_nrf_Layer_14_bits[];
-extern const unsigned char PROGMEM image__5ti7rmt_RADIOradio_bits[];
-extern const unsigned char PROGMEM image_nrf_1_bits[];
-extern const unsigned char PROGMEM image_nrf_Layer_17_bits[];
-
-// Radio menu bitmaps
-extern const unsigned char PROGMEM image_radio_Layer_2_bits[];
-extern const unsigned char PROGMEM image_radio_Layer_3_bits[];
-extern const unsigned char PROGMEM image_radio_Layer_6_bits[];
-extern const unsigned char PROGMEM image_radio_Layer_7_bits[];
-extern const unsigned char PROGMEM image_radio_Layer_8_bits[];
-extern const unsigned char PROGMEM image_cwg9wyw_black_white_simple_bit_vector_pixel_art_icon_geolocation_map_pin_black_white_simple_flat_bit_vector_pixel_art_icon_312637465black_white_simple_bit_vector_pixel_art_icon_geolocation_map_pin_black_white_simple_flat_bit_vector_pixel_art_icon_312637465_bits[];
-
-// GPS menu bitmaps
-extern const unsigned char PROGMEM image_gps_Layer_2_bits[];
-extern const unsigned char PROGMEM image_gps_Layer_3_bits[];
-extern const unsigned char PROGMEM image_gps_Layer_6_bits[];
-extern const unsigned char PROGMEM image_gps_Layer_7_bits[];
-extern const unsigned char PROGMEM image_gps_Layer_8_bits[];
-extern const unsigned char PROGMEM image_gps_Layer_9_bits[];
-extern const unsigned char PROGMEM image_gps_Layer_10_bits[];
-
-// RPI menu bitmaps
-extern const unsigned char PROGMEM image_rpi_Layer_2_bits[];
-extern const unsigned char PROGMEM image_rpi_Layer_3_bits[];
-extern const unsigned char PROGMEM image_rpi_Layer_6_bits[];
-extern const unsigned char PROGMEM image_rpi_Layer_7_bits[];
-extern const unsigned char PROGMEM image_rpi_Layer_8_bits[];
-extern const unsigned char PROGMEM image_rpi_Layer_9_bits[];
-extern const unsigned char PROGMEM image_black_white_simple_bit_vector_pixel_art_icon_geolocation_map_pin_black_white_simple_flat_bit_vector_pixel_art_icon_312637465_312637466_bits[];
-extern const unsigned char PROGMEM image_rpi_Layer_10_bits[];
-
-// Bad USB menu bitmaps
-extern const unsigned char PROGMEM image_badusb_Layer_2_bits[];
-extern const unsigned char PROGMEM image_badusb_Layer_3_bits[];
-extern const unsigned char PROGMEM image_rspi_1_bits[];
-extern const unsigned char PROGMEM image_USB_KILLER_bits[];
-extern const unsigned char PROGMEM image_badusb_Layer_9_bits[];
-extern const unsigned char PROGMEM image_badusb_Layer_10_bits[];
-extern const unsigned char PROGMEM image_equ2z4c_SETTINGSsettings_bits[];
-
-// Settings menu bitmaps
-extern const unsigned char PROGMEM image_settings_Layer_2_bits[];
-extern const unsigned char PROGMEM image_settings_Layer_3_bits[];
-extern const unsigned char PROGMEM image_settings_Layer_7_bits[];
-extern const unsigned char PROGMEM image_settings_Layer_8_bits[];
-extern const unsigned char PROGMEM image_g87a5zi_USB_KILLERusb_killer_bits[];
-extern const unsigned char PROGMEM image_settings_Layer_9_bits[];
-extern const unsigned char PROGMEM image_extra_1_bits[];
-extern const unsigned char PROGMEM image_ojp6uhu_USB_KILLERusb_killer_bits[];
-
-// EXTRAS MENU BITMAPS
-extern const unsigned char PROGMEM image_extras_Layer_2_bits[];
-extern const unsigned char PROGMEM image_extras_Layer_3_bits[];
-extern const unsigned char PROGMEM image_extras_Layer_7_bits[];
-extern const unsigned char PROGMEM image_extras_Layer_8_bits[];
-extern const unsigned char PROGMEM image_ot3p4l1_filesfiles_bits[];
-extern const unsigned char PROGMEM image_extras_Layer_11_bits[];
-
-// FILES MENU BITMAPS
-extern const unsigned char PROGMEM image_files_Layer_2_bits[];
-extern const unsigned char PROGMEM image_files_Layer_3_bits[];
-extern const unsigned char PROGMEM image_files_Layer_8_bits[];
-extern const unsigned char PROGMEM image_mi1byse_extraextrafil_bits[];
-extern const unsigned char PROGMEM image_files_Layer_10_bits[];
-
-// RFID MENU BITMAPS
-extern const unsigned char PROGMEM image_rfid_Layer_2_bits[];
-extern const unsigned char PROGMEM image_rfid_Layer_3_bits[];
-extern const unsigned char PROGMEM image_rfid_Layer_6_bits[];
-extern const unsigned char PROGMEM image_rfid_Layer_8_bits[];
-extern const unsigned char PROGMEM image_rfid_Layer_9_bits[];
-extern const unsigned char PROGMEM image_filesrfid_Layer_6_bits[];
-extern const unsigned char PROGMEM image_rfid_Layer_10_bits[];
- 
-// NFC menu bitmaps
-extern const unsigned char PROGMEM image_nfc_Layer_2_bits[];
-extern const unsigned char PROGMEM image_nfc_Layer_3_bits[];
-extern const unsigned char PROGMEM image_nfc_Layer_6_bits[];
-extern const unsigned char PROGMEM image_nfc_Layer_7_bits[];
-extern const unsigned char PROGMEM image_nfc_Layer_8_bits[];
-extern const unsigned char PROGMEM image_nfc_Layer_9_bits[];
-extern const unsigned char PROGMEM image_nfc_Layer_10_bits[];
-
-// SHARED ICON BITMAPS
-extern const unsigned char PROGMEM image_mi1byse_extraextra_bits[];
-extern const unsigned char PROGMEM image_files_Layer_6_bits[];
-extern const unsigned char PROGMEM image_g87a5zi_USB_KILLERusb_killer_bits[];
-extern const unsigned char PROGMEM image_yhj24xz_RFIDrfid_bits[];
-
 // menu_bitmaps.h
 #pragma once
 
-extern const unsigned char OptionsLayer_7_bits[];
-extern const unsigned char OptionsLayer_9_bits[];
-
 // Function declarations
 void drawWiFiMenu();
 void drawBluetoothMenu();
@@ -1,260 +1,11 @@
 #include <TFT_eSPI.h>
 #include "menu_submenus.h"
 #include "userinterface/bitmaps/menu_bitmaps.h"
+#include "../../Modules/Core/assets.h"
 #include "submenu_options.h"  
 // made by jews FOR jews
 extern TFT_eSPI tft;
 
-// WiFi submenumenu bitmap data
-const unsigned char PROGMEM image__16_bits[] = {
-    0x01,0x00,0x03,0x00,0x01,0x80,0x0c,0xc0,0x0c,0xc0,0x0c,0xc0,0x46,0xc0,0xc6,0xc0,0x44,0xc0,0x0c,0xc0,0x0c,0xc0,0x09,0x80,0x01,0x80,0x03,0x00
-};
-
-const unsigned char PROGMEM image_battery_empty_bits[] = {
-    0x3f,0xf8,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x38,0x38,0x08,0x20,0x08,0x20,0x07,0xc0
-};
-
-const unsigned char PROGMEM image_Layer_9_bits[] = {
-    0x7e,0x80,0x70,0x80,0x7e,0x00,0x00,0x82,0xfe,0x82,0x00,0x00,0xfe,0x12,0x12,0x12,0x02,0x00,0x00,0x82,0xfe,0x82
-};
-
-const unsigned char PROGMEM image_passport_left_bits[] = {
-    0x0f,0xf0,0x0f,0xf0,0x30,0x00,0x30,0x00,0xc3,0xc0,0xc3,0xc0,0xcc,0x30,0xcc,0x30,0xcc,0x30,0xcc,0x30,0xc3,0xc0,0xc3,0xc0,0xc0,0x00,0xc0,0x00,0xc0,0x00,0xc0,0x00,0xcc,0x00,0xcc,0x00,0xc3,0x00,0xc3,0x00,0xc0,0xc0,0xc0,0xc0,0xcc,0x30,0xcc,0x30,0xc3,0x00,0xc3,0x00,0xc0,0xc0,0xc0,0xc0,0xcc,0x30,0xcc,0x30,0xc3,0x00,0xc3,0x00,0xc0,0xc0,0xc0,0xc0,0xcc,0x30,0xcc,0x30,0xc3,0x00,0xc3,0x00,0xc0,0xc0,0xc0,0xc0,0xcc,0x30,0xcc,0x30,0xc3,0x00,0xc3,0x00,0xc0,0xc0,0xc0,0xc0,0xcc,0x30,0xcc,0x30,0xc3,0x00,0xc3,0x00,0xc0,0xc0,0xc0,0xc0,0xc0,0x30,0xc0,0x30,0xc0,0x00,0xc0,0x00,0x30,0x00,0x30,0x00,0x3c,0x00,0x3c,0x00,0x3f,0x00,0x3f,0x00,0x3f,0xc0,0x3f,0xc0,0x3f,0xf0,0x3f,0xf0,0x33,0xf0,0x33,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0
-};
-
-//Bluetooth submenu bitmap data
-const unsigned char PROGMEM image_bleLayer_2_bits[] = {
-    0x3f,0xf8,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x38,0x38,0x08,0x20,0x08,0x20,0x07,0xc0
-};
-
-const unsigned char PROGMEM image_bleLayer_3_bits[] = {
-    0x0f,0xf0,0x0f,0xf0,0x30,0x00,0x30,0x00,0xc3,0xc0,0xc3,0xc0,0xcc,0x30,0xcc,0x30,0xcc,0x30,0xcc,0x30,0xc3,0xc0,0xc3,0xc0,0xc0,0x00,0xc0,0x00,0xc0,0x00,0xc0,0x00,0xcc,0x00,0xcc,0x00,0xc3,0x00,0xc3,0x00,0xc0,0xc0,0xc0,0xc0,0xcc,0x30,0xcc,0x30,0xc3,0x00,0xc3,0x00,0xc0,0xc0,0xc0,0xc0,0xcc,0x30,0xcc,0x30,0xc3,0x00,0xc3,0x00,0xc0,0xc0,0xc0,0xc0,0xcc,0x30,0xcc,0x30,0xc3,0x00,0xc3,0x00,0xc0,0xc0,0xc0,0xc0,0xcc,0x30,0xcc,0x30,0xc3,0x00,0xc3,0x00,0xc0,0xc0,0xc0,0xc0,0xcc,0x30,0xcc,0x30,0xc3,0x00,0xc3,0x00,0xc0,0xc0,0xc0,0xc0,0xc0,0x30,0xc0,0x30,0xc0,0x00,0xc0,0x00,0x30,0x00,0x30,0x00,0x3c,0x00,0x3c,0x00,0x3f,0x00,0x3f,0x00,0x3f,0xc0,0x3f,0xc0,0x3f,0xf0,0x3f,0xf0,0x33,0xf0,0x33,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0
-};
-
-const unsigned char PROGMEM image_bleLayer_6_bits[] = {
-    0x03,0xe0,0x00,0x04,0x10,0x00,0x01,0xc0,0x00,0x00,0x00,0x00,0x01,0xc0,0x00,0x00,0x00,0x00,0x08,0x88,0x00,0x0c,0x18,0x00,0x04,0x10,0x00,0x02,0x20,0x00,0x03,0x60,0x00,0xff,0xff,0x80,0x61,0xc3,0x00,0x33,0x66,0x00,0x1e,0x3c,0x00,0x0c,0x18,0x00,0x00,0x80,0x00,0x00,0x00,0x00,0x01,0xc0,0x00,0x00,0x00,0x00,0x01,0xc0,0x00,0x04,0x10,0x00,0x03,0xe0,0x00
-};
-
-const unsigned char PROGMEM image_bleLayer_8_bits[] = {
-    0xfe,0x92,0x92,0x92,0x6c,0x00,0xfe,0x80,0x80,0x80,0x80,0x00,0x7e,0x80,0x80,0x80,0x7e,0x00,0xfe,0x92,0x92,0x92,0x82,0x00,0x06,0x02,0xfe,0x02,0x06,0x00,0x7c,0x82,0x82,0x82,0x7c,0x00,0x7c,0x82,0x82,0x82,0x7c,0x00,0x06,0x02,0xfe,0x02,0x06,0x00,0xfe,0x10,0x10,0x10,0xfe
-};
-
-//Ir submenu bitmap data
-const unsigned char PROGMEM image_irLayer_2_bits[] = {
-    0x0f,0xf0,0x0f,0xf0,0x30,0x00,0x30,0x00,0xc3,0xc0,0xc3,0xc0,0xcc,0x30,0xcc,0x30,0xcc,0x30,0xcc,0x30,0xc3,0xc0,0xc3,0xc0,0xc0,0x00,0xc0,0x00,0xc0,0x00,0xc0,0x00,0xcc,0x00,0xcc,0x00,0xc3,0x00,0xc3,0x00,0xc0,0xc0,0xc0,0xc0,0xcc,0x30,0xcc,0x30,0xc3,0x00,0xc3,0x00,0xc0,0xc0,0xc0,0xc0,0xcc,0x30,0xcc,0x30,0xc3,0x00,0xc3,0x00,0xc0,0xc0,0xc0,0xc0,0xcc,0x30,0xcc,0x30,0xc3,0x00,0xc3,0x00,0xc0,0xc0,0xc0,0xc0,0xcc,0x30,0xcc,0x30,0xc3,0x00,0xc3,0x00,0xc0,0xc0,0xc0,0xc0,0xcc,0x30,0xcc,0x30,0xc3,0x00,0xc3,0x00,0xc0,0xc0,0xc0,0xc0,0xc0,0x30,0xc0,0x30,0xc0,0x00,0xc0,0x00,0x30,0x00,0x30,0x00,0x3c,0x00,0x3c,0x00,0x3f,0x00,0x3f,0x00,0x3f,0xc0,0x3f,0xc0,0x3f,0xf0,0x3f,0xf0,0x33,0xf0,0x33,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0
-};
-
-const unsigned char PROGMEM image_irLayer_3_bits[] = {
-    0x3f,0xf8,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x38,0x38,0x08,0x20,0x08,0x20,0x07,0xc0
-};
-
-const unsigned char PROGMEM image_irLayer_6_bits[] = {
-    0x3f,0xfc,0x20,0x04,0x20,0x04,0x3f,0xfc,0x08,0x10,0x06,0x60,0x03,0xc0,0x30,0x0c,0x48,0x12,0x47,0xe2,0x40,0x02,0x38,0x1c,0x07,0xe0,0x00,0x00,0x60,0x06,0x90,0x09,0x8f,0xf1,0x80,0x01,0x40,0x02,0x20,0x04,0x1f,0xf8
-};
-
-const unsigned char PROGMEM image_irLayer_8_bits[] = {
-    0x82,0xfe,0x82,0x00,0x00,0xfe,0x12,0x32,0x52,0x8c
-};
-
-//RF submenu bitmap data
-const unsigned char PROGMEM image_rfLayer_13_1_bits[] = {
-    0xfe,0x12,0x32,0x52,0x8c,0x00,0xfe,0x12,0x12,0x12,0x02
-};
-
-const unsigned char PROGMEM image_rfLayer_13_bits[] = {
-    0x00,0x1f,0x00,0x00,0x61,0xc0,0x00,0x80,0x60,0x01,0x3f,0x20,0x00,0x60,0x80,0x80,0x1e,0x00,0xf8,0x33,0x00,0xbf,0x00,0x00,0x19,0xfe,0x00,0x19,0xfe,0x00,0xbf,0x00,0x00,0xf8,0x33,0x00,0x80,0x0e,0x00,0x00,0x60,0x80,0x01,0x3f,0x20,0x01,0x80,0x60,0x00,0x61,0xc0,0x00,0x3f,0x00
-};
-
-const unsigned char PROGMEM image_rfLayer_7_bits[] = {
-    0x0f,0xf0,0x0f,0xf0,0x30,0x00,0x30,0x00,0xc3,0xc0,0xc3,0xc0,0xcc,0x30,0xcc,0x30,0xcc,0x30,0xcc,0x30,0xc3,0xc0,0xc3,0xc0,0xc0,0x00,0xc0,0x00,0xc0,0x00,0xc0,0x00,0xcc,0x00,0xcc,0x00,0xc3,0x00,0xc3,0x00,0xc0,0xc0,0xc0,0xc0,0xcc,0x30,0xcc,0x30,0xc3,0x00,0xc3,0x00,0xc0,0xc0,0xc0,0xc0,0xcc,0x30,0xcc,0x30,0xc3,0x00,0xc3,0x00,0xc0,0xc0,0xc0,0xc0,0xcc,0x30,0xcc,0x30,0xc3,0x00,0xc3,0x00,0xc0,0xc0,0xc0,0xc0,0xcc,0x30,0xcc,0x30,0xc3,0x00,0xc3,0x00,0xc0,0xc0,0xc0,0xc0,0xcc,0x30,0xcc,0x30,0xc3,0x00,0xc3,0x00,0xc0,0xc0,0xc0,0xc0,0xc0,0x30,0xc0,0x30,0xc0,0x00,0xc0,0x00,0x30,0x00,0x30,0x00,0x3c,0x00,0x3c,0x00,0x3f,0x00,0x3f,0x00,0x3f,0xc0,0x3f,0xc0,0x3f,0xf0,0x3f,0xf0,0x33,0xf0,0x33,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0
-};
-
-const unsigned char PROGMEM image_rfLayer_8_bits[] = {
-    0x3f,0xf8,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x38,0x38,0x08,0x20,0x08,0x20,0x07,0xc0
-};
-
-//NRF submenu bitmap data
-const unsigned char PROGMEM image_nrfimage_2_bits[] = {
-    0x07,0xe0,0x00,0x08,0x18,0x00,0x30,0x06,0x00,0x47,0xe1,0x00,0x88,0x19,0x00,0x10,0x04,0x00,0x23,0xe0,0x00,0x04,0x10,0x00,0x01,0xc0,0x00,0x01,0xc0,0x00,0x01,0xc0,0x00,0x00,0x00,0x00,0x04,0x10,0x00,0x23,0xe4,0x00,0x98,0x08,0x80,0x4c,0x11,0x00,0x63,0xe2,0x00,0x10,0x04,0x00,0x0f,0xf8,0x00
-};
-
-const unsigned char PROGMEM image_nrfLayer_14_bits[] = {
-    0xfe,0x08,0x10,0x20,0xfe,0x00,0xfe,0x12,0x32,0x52,0x8c,0x00,0xfe,0x12,0x12,0x12,0x02
-};
-
-const unsigned char PROGMEM image_nrfLayer_15_bits[] = {
-    0x80
-};
-
-const unsigned char PROGMEM image_nrfLayer_7_bits[] = {
-    0x0f,0xf0,0x0f,0xf0,0x30,0x00,0x30,0x00,0xc3,0xc0,0xc3,0xc0,0xcc,0x30,0xcc,0x30,0xcc,0x30,0xcc,0x30,0xc3,0xc0,0xc3,0xc0,0xc0,0x00,0xc0,0x00,0xc0,0x00,0xc0,0x00,0xcc,0x00,0xcc,0x00,0xc3,0x00,0xc3,0x00,0xc0,0xc0,0xc0,0xc0,0xcc,0x30,0xcc,0x30,0xc3,0x00,0xc3,0x00,0xc0,0xc0,0xc0,0xc0,0xcc,0x30,0xcc,0x30,0xc3,0x00,0xc3,0x00,0xc0,0xc0,0xc0,0xc0,0xcc,0x30,0xcc,0x30,0xc3,0x00,0xc3,0x00,0xc0,0xc0,0xc0,0xc0,0xcc,0x30,0xcc,0x30,0xc3,0x00,0xc3,0x00,0xc0,0xc0,0xc0,0xc0,0xcc,0x30,0xcc,0x30,0xc3,0x00,0xc3,0x00,0xc0,0xc0,0xc0,0xc0,0xc0,0x30,0xc0,0x30,0xc0,0x00,0xc0,0x00,0x30,0x00,0x30,0x00,0x3c,0x00,0x3c,0x00,0x3f,0x00,0x3f,0x00,0x3f,0xc0,0x3f,0xc0,0x3f,0xf0,0x3f,0xf0,0x33,0xf0,0x33,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0
-};
-
-const unsigned char PROGMEM image_nrfLayer_9_bits[] = {
-    0x7f,0xf0,0x80,0x08,0x80,0x08,0x80,0x08,0x80,0x08,0x80,0x08,0x80,0x08,0x80,0x08,0x80,0x08,0x80,0x08,0x80,0x08,0x80,0x08,0x80,0x08,0x80,0x08,0x80,0x08,0x80,0x08,0x80,0x08,0x80,0x08,0x80,0x08,0x80,0x08,0x70,0x70,0x10,0x40,0x10,0x40,0x0f,0x80
-};
-
-//radio submenu bitmap data
-const unsigned char PROGMEM image_RadioLayer_2_bits[] = {
-    0x3f,0xf8,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x38,0x38,0x08,0x20,0x08,0x20,0x07,0xc0
-};
-
-const unsigned char PROGMEM image_RadioLayer_3_bits[] = {
-    0x0f,0xf0,0x0f,0xf0,0x30,0x00,0x30,0x00,0xc3,0xc0,0xc3,0xc0,0xcc,0x30,0xcc,0x30,0xcc,0x30,0xcc,0x30,0xc3,0xc0,0xc3,0xc0,0xc0,0x00,0xc0,0x00,0xc0,0x00,0xc0,0x00,0xcc,0x00,0xcc,0x00,0xc3,0x00,0xc3,0x00,0xc0,0xc0,0xc0,0xc0,0xcc,0x30,0xcc,0x30,0xc3,0x00,0xc3,0x00,0xc0,0xc0,0xc0,0xc0,0xcc,0x30,0xcc,0x30,0xc3,0x00,0xc3,0x00,0xc0,0xc0,0xc0,0xc0,0xcc,0x30,0xcc,0x30,0xc3,0x00,0xc3,0x00,0xc0,0xc0,0xc0,0xc0,0xcc,0x30,0xcc,0x30,0xc3,0x00,0xc3,0x00,0xc0,0xc0,0xc0,0xc0,0xcc,0x30,0xcc,0x30,0xc3,0x00,0xc3,0x00,0xc0,0xc0,0xc0,0xc0,0xc0,0x30,0xc0,0x30,0xc0,0x00,0xc0,0x00,0x30,0x00,0x30,0x00,0x3c,0x00,0x3c,0x00,0x3f,0x00,0x3f,0x00,0x3f,0xc0,0x3f,0xc0,0x3f,0xf0,0x3f,0xf0,0x33,0xf0,0x33,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0
-};
-
-const unsigned char PROGMEM image_RadioLayer_6_bits[] = {
-    0x40,0x00,0x00,0x00,0x04,0x00,0x17,0xca,0x00,0x33,0xcc,0x00,0x63,0xcc,0x00,0x57,0xcd,0x00,0x77,0xc5,0x00,0x77,0xc5,0x00,0x77,0x55,0x00,0x77,0xfd,0x40,0x71,0xf5,0xe0,0x75,0xfc,0xd0,0x75,0xfd,0xf8,0x71,0xfd,0xf0,0x75,0xfd,0xd8,0x75,0xfd,0xe4,0x71,0xfd,0x56,0x71,0xfd,0x52,0x75,0xfd,0xae,0x75,0xfc,0xe8,0x75,0xfc,0xd0,0x75,0x54,0x00,0x77,0xfc,0x00,0x55,0xcc,0x00,0x67,0x64,0x00,0x04,0x44,0x00,0x00,0x00,0x00
-};
-
-const unsigned char PROGMEM image_RadioLayer_8_bits[] = {
-    0xfe,0x12,0x32,0x52,0x8c,0x00,0xf8,0x24,0x22,0x24,0xf8,0x00,0xfe,0x82,0x82,0x82,0x7c,0x00,0x00,0x82,0xfe,0x82,0x00,0x00,0x7c,0x82,0x82,0x82,0x7c
-};
-
-//Gps submenu bitmap data
-const unsigned char PROGMEM image_GpsLayer_6_bits[] = {
-    0x01,0xf8,0x07,0xfe,0x1f,0x06,0x3e,0x02,0x7c,0x01,0xfc,0x01,0xfc,0x01,0x7c,0x01,0x1e,0x02,0x0f,0x8e,0x03,0xfc,0x00,0xf0
-};
-
-const unsigned char PROGMEM image_GpsLayer_2_bits[] = {
-    0x3f,0xf8,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x38,0x38,0x08,0x20,0x08,0x20,0x07,0xc0
-};
-
-const unsigned char PROGMEM image_GpsLayer_3_bits[] = {
-    0x0f,0xf0,0x0f,0xf0,0x30,0x00,0x30,0x00,0xc3,0xc0,0xc3,0xc0,0xcc,0x30,0xcc,0x30,0xcc,0x30,0xcc,0x30,0xc3,0xc0,0xc3,0xc0,0xc0,0x00,0xc0,0x00,0xc0,0x00,0xc0,0x00,0xcc,0x00,0xcc,0x00,0xc3,0x00,0xc3,0x00,0xc0,0xc0,0xc0,0xc0,0xcc,0x30,0xcc,0x30,0xc3,0x00,0xc3,0x00,0xc0,0xc0,0xc0,0xc0,0xcc,0x30,0xcc,0x30,0xc3,0x00,0xc3,0x00,0xc0,0xc0,0xc0,0xc0,0xcc,0x30,0xcc,0x30,0xc3,0x00,0xc3,0x00,0xc0,0xc0,0xc0,0xc0,0xcc,0x30,0xcc,0x30,0xc3,0x00,0xc3,0x00,0xc0,0xc0,0xc0,0xc0,0xcc,0x30,0xcc,0x30,0xc3,0x00,0xc3,0x00,0xc0,0xc0,0xc0,0xc0,0xc0,0x30,0xc0,0x30,0xc0,0x00,0xc0,0x00,0x30,0x00,0x30,0x00,0x3c,0x00,0x3c,0x00,0x3f,0x00,0x3f,0x00,0x3f,0xc0,0x3f,0xc0,0x3f,0xf0,0x3f,0xf0,0x33,0xf0,0x33,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0
-};
-
-const unsigned char PROGMEM image_GpsLayer_8_bits[] = {
-    0x7c,0x82,0x82,0xa2,0xe6,0x00,0xfe,0x12,0x12,0x12,0x0c,0x00,0x4c,0x92,0x92,0x92,0x64
-};
-
-//Rpi submenu bitmap data
-const unsigned char PROGMEM image_RpiLayer_2_bits[] = {
-0x3f,0xf8,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x38,0x38,0x08,0x20,0x08,0x20,0x07,0xc0
-};
-
-const unsigned char PROGMEM image_RpiLayer_3_bits[] = {
-0x0f,0xf0,0x0f,0xf0,0x30,0x00,0x30,0x00,0xc3,0xc0,0xc3,0xc0,0xcc,0x30,0xcc,0x30,0xcc,0x30,0xcc,0x30,0xc3,0xc0,0xc3,0xc0,0xc0,0x00,0xc0,0x00,0xc0,0x00,0xc0,0x00,0xcc,0x00,0xcc,0x00,0xc3,0x00,0xc3,0x00,0xc0,0xc0,0xc0,0xc0,0xcc,0x30,0xcc,0x30,0xc3,0x00,0xc3,0x00,0xc0,0xc0,0xc0,0xc0,0xcc,0x30,0xcc,0x30,0xc3,0x00,0xc3,0x00,0xc0,0xc0,0xc0,0xc0,0xcc,0x30,0xcc,0x30,0xc3,0x00,0xc3,0x00,0xc0,0xc0,0xc0,0xc0,0xcc,0x30,0xcc,0x30,0xc3,0x00,0xc3,0x00,0xc0,0xc0,0xc0,0xc0,0xcc,0x30,0xcc,0x30,0xc3,0x00,0xc3,0x00,0xc0,0xc0,0xc0,0xc0,0xc0,0x30,0xc0,0x30,0xc0,0x00,0xc0,0x00,0x30,0x00,0x30,0x00,0x3c,0x00,0x3c,0x00,0x3f,0x00,0x3f,0x00,0x3f,0xc0,0x3f,0xc0,0x3f,0xf0,0x3f,0xf0,0x33,0xf0,0x33,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0
-};
-
-const unsigned char PROGMEM image_RpiLayer_6_bits[] = {
-0x1c,0x00,0x20,0x3e,0x00,0x60,0xcc,0xe3,0xe0,0xc0,0x63,0xa0,0xdf,0x77,0x60,0x9f,0x94,0xe0,0x1f,0x84,0xc0,0xdf,0x13,0xc0,0xcf,0x73,0x80,0xe0,0x70,0x00,0xef,0x70,0x80,0xcf,0x73,0x80,0x1f,0x84,0xc0,0x1f,0x84,0xc0,0xdf,0x17,0x60,0xce,0x77,0xa0,0xc0,0x63,0xa0,0x9e,0x80,0xe0,0x3e,0x00,0x60
-};
-
-const unsigned char PROGMEM image_RpiLayer_8_1_bits[] = {
-0xfe,0x12,0x32,0x52,0x8c,0x00,0xfe,0x12,0x12,0x12,0x0c,0x00,0x00,0x82,0xfe,0x82
-};
-
-const unsigned char PROGMEM image_RpiLayer_9_bits[] = {
-0x7c,0x82,0x82,0x82,0x44,0x00,0x7c,0x82,0x82,0x82,0x7c,0x00,0xfe,0x08,0x10,0x20,0xfe,0x00,0xfe,0x08,0x10,0x20,0xfe,0x00,0xfe,0x92,0x92,0x92,0x82,0x00,0x7c,0x82,0x82,0x82,0x44,0x00,0x06,0x02,0xfe,0x02,0x06
-};
-
-//BadUsb submenu bitmap data
-const unsigned char PROGMEM image_BadLayer_2_bits[] = {
-0x3f,0xf8,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x38,0x38,0x08,0x20,0x08,0x20,0x07,0xc0
-};
-
-const unsigned char PROGMEM image_BadLayer_3_bits[] = {
-0x0f,0xf0,0x0f,0xf0,0x30,0x00,0x30,0x00,0xc3,0xc0,0xc3,0xc0,0xcc,0x30,0xcc,0x30,0xcc,0x30,0xcc,0x30,0xc3,0xc0,0xc3,0xc0,0xc0,0x00,0xc0,0x00,0xc0,0x00,0xc0,0x00,0xcc,0x00,0xcc,0x00,0xc3,0x00,0xc3,0x00,0xc0,0xc0,0xc0,0xc0,0xcc,0x30,0xcc,0x30,0xc3,0x00,0xc3,0x00,0xc0,0xc0,0xc0,0xc0,0xcc,0x30,0xcc,0x30,0xc3,0x00,0xc3,0x00,0xc0,0xc0,0xc0,0xc0,0xcc,0x30,0xcc,0x30,0xc3,0x00,0xc3,0x00,0xc0,0xc0,0xc0,0xc0,0xcc,0x30,0xcc,0x30,0xc3,0x00,0xc3,0x00,0xc0,0xc0,0xc0,0xc0,0xcc,0x30,0xcc,0x30,0xc3,0x00,0xc3,0x00,0xc0,0xc0,0xc0,0xc0,0xc0,0x30,0xc0,0x30,0xc0,0x00,0xc0,0x00,0x30,0x00,0x30,0x00,0x3c,0x00,0x3c,0x00,0x3f,0x00,0x3f,0x00,0x3f,0xc0,0x3f,0xc0,0x3f,0xf0,0x3f,0xf0,0x33,0xf0,0x33,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0
-};
-
-const unsigned char PROGMEM image_BadLayer_8_bits[] = {
-0xfe,0x92,0x92,0x92,0x6c,0x00,0xf8,0x24,0x22,0x24,0xf8,0x00,0xfe,0x82,0x82,0x82,0x7c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7e,0x80,0x80,0x80,0x7e,0x00,0x4c,0x92,0x92,0x92,0x64,0x00,0xfe,0x92,0x92,0x92,0x6c
-};
-
-const unsigned char PROGMEM image_BadLayer_6_bits[] = {
-0x1f,0xc0,0x10,0x20,0x15,0x20,0x15,0xa0,0x14,0x20,0x1f,0xe0,0x3f,0xf0,0x40,0x08,0xc0,0x08,0xc0,0x08,0xc0,0x08,0xc0,0x08,0xcf,0x88,0xd8,0x68,0xd0,0x28,0xf0,0x28,0xe4,0xa8,0xec,0xe8,0xf0,0x28,0xd3,0x68,0xc8,0xc8,0xcf,0x88,0xc0,0x08,0xc0,0x08,0xc0,0x08,0xc0,0x08,0xc0,0x08,0xc0,0x08,0x40,0x18,0x3f,0xf0
-};
-
-//Settings submenu bitmap data
-const unsigned char PROGMEM image_SetLayer_11_bits[] = {
-0x03,0x00,0x03,0x00,0x00,0x00,0x0b,0x80,0x07,0xc0,0x08,0x40,0xd8,0x6c,0xd8,0x6c,0x18,0x60,0x0f,0xc0,0x0b,0x80,0x00,0x00,0x03,0x00,0x03,0x00
-};
-
-const unsigned char PROGMEM image_SetLayer_12_bits[] = {
-0x4c,0x92,0x92,0x92,0x64,0x00,0xfe,0x92,0x92,0x92,0x82,0x00,0x06,0x02,0xfe,0x02,0x06,0x00,0x06,0x02,0xfe,0x02,0x06,0x00,0x00,0x82,0xfe,0x82,0x00,0x00,0xfe,0x08,0x10,0x20,0xfe,0x00,0x7c,0x82,0x82,0xa2,0xe6,0x00,0x4c,0x92,0x92,0x92,0x64
-};
-
-const unsigned char PROGMEM image_SetLayer_6_bits[] = {
-0x3f,0xf8,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x38,0x38,0x08,0x20,0x08,0x20,0x07,0xc0
-};
-
-const unsigned char PROGMEM image_SetLayer_7_bits[] = {
-0x0f,0xf0,0x0f,0xf0,0x30,0x00,0x30,0x00,0xc3,0xc0,0xc3,0xc0,0xcc,0x30,0xcc,0x30,0xcc,0x30,0xcc,0x30,0xc3,0xc0,0xc3,0xc0,0xc0,0x00,0xc0,0x00,0xc0,0x00,0xc0,0x00,0xcc,0x00,0xcc,0x00,0xc3,0x00,0xc3,0x00,0xc0,0xc0,0xc0,0xc0,0xcc,0x30,0xcc,0x30,0xc3,0x00,0xc3,0x00,0xc0,0xc0,0xc0,0xc0,0xcc,0x30,0xcc,0x30,0xc3,0x00,0xc3,0x00,0xc0,0xc0,0xc0,0xc0,0xcc,0x30,0xcc,0x30,0xc3,0x00,0xc3,0x00,0xc0,0xc0,0xc0,0xc0,0xcc,0x30,0xcc,0x30,0xc3,0x00,0xc3,0x00,0xc0,0xc0,0xc0,0xc0,0xcc,0x30,0xcc,0x30,0xc3,0x00,0xc3,0x00,0xc0,0xc0,0xc0,0xc0,0xc0,0x30,0xc0,0x30,0xc0,0x00,0xc0,0x00,0x30,0x00,0x30,0x00,0x3c,0x00,0x3c,0x00,0x3f,0x00,0x3f,0x00,0x3f,0xc0,0x3f,0xc0,0x3f,0xf0,0x3f,0xf0,0x33,0xf0,0x33,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0
-};
-
-//Extras submenu bitmap data
-const unsigned char PROGMEM image_exLayer_2_bits[] = {
-0x3f,0xf8,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x38,0x38,0x08,0x20,0x08,0x20,0x07,0xc0
-};
-
-const unsigned char PROGMEM image_exLayer_3_bits[] = {
-0x0f,0xf0,0x0f,0xf0,0x30,0x00,0x30,0x00,0xc3,0xc0,0xc3,0xc0,0xcc,0x30,0xcc,0x30,0xcc,0x30,0xcc,0x30,0xc3,0xc0,0xc3,0xc0,0xc0,0x00,0xc0,0x00,0xc0,0x00,0xc0,0x00,0xcc,0x00,0xcc,0x00,0xc3,0x00,0xc3,0x00,0xc0,0xc0,0xc0,0xc0,0xcc,0x30,0xcc,0x30,0xc3,0x00,0xc3,0x00,0xc0,0xc0,0xc0,0xc0,0xcc,0x30,0xcc,0x30,0xc3,0x00,0xc3,0x00,0xc0,0xc0,0xc0,0xc0,0xcc,0x30,0xcc,0x30,0xc3,0x00,0xc3,0x00,0xc0,0xc0,0xc0,0xc0,0xcc,0x30,0xcc,0x30,0xc3,0x00,0xc3,0x00,0xc0,0xc0,0xc0,0xc0,0xcc,0x30,0xcc,0x30,0xc3,0x00,0xc3,0x00,0xc0,0xc0,0xc0,0xc0,0xc0,0x30,0xc0,0x30,0xc0,0x00,0xc0,0x00,0x30,0x00,0x30,0x00,0x3c,0x00,0x3c,0x00,0x3f,0x00,0x3f,0x00,0x3f,0xc0,0x3f,0xc0,0x3f,0xf0,0x3f,0xf0,0x33,0xf0,0x33,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0
-};
-
-const unsigned char PROGMEM image_exLayer_7_bits[] = {
-0x00,0xf8,0x7d,0xf8,0xfd,0xf8,0xfd,0xf8,0xfd,0xf8,0xfd,0xf8,0xfc,0x00,0xff,0xf0,0xff,0xf0,0xff,0xf0,0xff,0xf0,0xff,0xf0,0xff,0xf0
-};
-
-const unsigned char PROGMEM image_exLayer_8_1_bits[] = {
-0xfe,0x92,0x92,0x92,0x82,0x00,0xc6,0x28,0x10,0x28,0xc6,0x00,0x06,0x02,0xfe,0x02,0x06,0x00,0xfe,0x12,0x32,0x52,0x8c,0x00,0xf8,0x24,0x22,0x24,0xf8
-};
-//made by jews FOR jews
-const unsigned char PROGMEM image_exLayer_8_bits[] = {
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3f,0xc0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x40,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x2b,0x40,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x2b,0x40,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x40,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7f,0xe0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xc0,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x80,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x80,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x80,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x80,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x8f,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x99,0x90,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0xa0,0xd0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0xa0,0x50,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0xc0,0x50,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0xd9,0xd0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0xd9,0xd0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0xa6,0x50,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0xb0,0xd0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x91,0x90,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x8f,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x80,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x80,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x80,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x80,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x80,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x80,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xc0,0x60,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3f,0xc0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00
-};
-
-//Files submenu bitmap data
-const unsigned char PROGMEM image_fileLayer_6_bits[] = {
-0xff,0xf8,0xa5,0x48,0xa5,0x68,0xa5,0x68,0xa5,0x68,0x80,0x04,0x80,0x06,0x80,0x02,0x80,0x02,0x80,0x02,0x80,0x02,0x80,0x02,0x80,0x02,0xbf,0xfa,0xa0,0x0a,0xa0,0x0a,0xbf,0xfa,0x80,0x02,0x80,0x02,0x7f,0xfc
-};
-
-const unsigned char PROGMEM image_fileLayer_2_bits[] = {
-0x3f,0xf8,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x38,0x38,0x08,0x20,0x08,0x20,0x07,0xc0
-};
-
-const unsigned char PROGMEM image_fileLayer_3_bits[] = {
-0x0f,0xf0,0x0f,0xf0,0x30,0x00,0x30,0x00,0xc3,0xc0,0xc3,0xc0,0xcc,0x30,0xcc,0x30,0xcc,0x30,0xcc,0x30,0xc3,0xc0,0xc3,0xc0,0xc0,0x00,0xc0,0x00,0xc0,0x00,0xc0,0x00,0xcc,0x00,0xcc,0x00,0xc3,0x00,0xc3,0x00,0xc0,0xc0,0xc0,0xc0,0xcc,0x30,0xcc,0x30,0xc3,0x00,0xc3,0x00,0xc0,0xc0,0xc0,0xc0,0xcc,0x30,0xcc,0x30,0xc3,0x00,0xc3,0x00,0xc0,0xc0,0xc0,0xc0,0xcc,0x30,0xcc,0x30,0xc3,0x00,0xc3,0x00,0xc0,0xc0,0xc0,0xc0,0xcc,0x30,0xcc,0x30,0xc3,0x00,0xc3,0x00,0xc0,0xc0,0xc0,0xc0,0xcc,0x30,0xcc,0x30,0xc3,0x00,0xc3,0x00,0xc0,0xc0,0xc0,0xc0,0xc0,0x30,0xc0,0x30,0xc0,0x00,0xc0,0x00,0x30,0x00,0x30,0x00,0x3c,0x00,0x3c,0x00,0x3f,0x00,0x3f,0x00,0x3f,0xc0,0x3f,0xc0,0x3f,0xf0,0x3f,0xf0,0x33,0xf0,0x33,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0
-};
-
-const unsigned char PROGMEM image_fileLayer_7_bits[] = {
-0xfe,0x12,0x12,0x12,0x02,0x00,0x00,0x82,0xfe,0x82,0x00,0x00,0xfe,0x80,0x80,0x80,0x80,0x00,0xfe,0x92,0x92,0x92,0x82,0x00,0x4c,0x92,0x92,0x92,0x64
-};
-
-//rfid submenu bitmap data
-const unsigned char PROGMEM image_rfidLayer_2_bits[] = {
-0x0f,0xf0,0x0f,0xf0,0x30,0x00,0x30,0x00,0xc3,0xc0,0xc3,0xc0,0xcc,0x30,0xcc,0x30,0xcc,0x30,0xcc,0x30,0xc3,0xc0,0xc3,0xc0,0xc0,0x00,0xc0,0x00,0xc0,0x00,0xc0,0x00,0xcc,0x00,0xcc,0x00,0xc3,0x00,0xc3,0x00,0xc0,0xc0,0xc0,0xc0,0xcc,0x30,0xcc,0x30,0xc3,0x00,0xc3,0x00,0xc0,0xc0,0xc0,0xc0,0xcc,0x30,0xcc,0x30,0xc3,0x00,0xc3,0x00,0xc0,0xc0,0xc0,0xc0,0xcc,0x30,0xcc,0x30,0xc3,0x00,0xc3,0x00,0xc0,0xc0,0xc0,0xc0,0xcc,0x30,0xcc,0x30,0xc3,0x00,0xc3,0x00,0xc0,0xc0,0xc0,0xc0,0xcc,0x30,0xcc,0x30,0xc3,0x00,0xc3,0x00,0xc0,0xc0,0xc0,0xc0,0xc0,0x30,0xc0,0x30,0xc0,0x00,0xc0,0x00,0x30,0x00,0x30,0x00,0x3c,0x00,0x3c,0x00,0x3f,0x00,0x3f,0x00,0x3f,0xc0,0x3f,0xc0,0x3f,0xf0,0x3f,0xf0,0x33,0xf0,0x33,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0
-};
-
-const unsigned char PROGMEM image_rfidLayer_3_bits[] = {
-0x3f,0xf8,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x38,0x38,0x08,0x20,0x08,0x20,0x07,0xc0
-};
- 
-const unsigned char PROGMEM image_rfidLayer_6_bits[] = {
-0x7f,0xff,0xc0,0xc0,0x00,0x60,0xb3,0xff,0xa0,0xa0,0x00,0xa0,0x87,0xfe,0xa0,0x86,0x02,0xa0,0xac,0x02,0xa0,0xa9,0xf2,0xa0,0xa8,0x42,0xa0,0xa8,0x52,0xa0,0xa9,0xb2,0xa0,0xa8,0x02,0xa0,0xa9,0xf2,0xa0,0xa8,0x52,0xa0,0xa8,0x52,0xa0,0xa0,0x50,0xa0,0xb8,0x03,0xa0,0xf9,0xf3,0xe0,0x78,0x03,0xc0,0x01,0xf0,0x00,0x01,0x00,0x00,0x01,0x10,0x00,0x01,0xf4,0x00,0x00,0x40,0x00,0x00,0x10,0x00,0x00,0x10,0x00
-};
-
-const unsigned char PROGMEM image_rfidLayer_8_bits[] = {
-0xfe,0x12,0x32,0x52,0x8c,0x00,0xfe,0x12,0x12,0x12,0x02,0x00,0x00,0x82,0xfe,0x82,0x00,0x00,0xfe,0x82,0x82,0x82,0x7c
-};
-
-//Nfc submenu bitmap data
-const unsigned char PROGMEM image_nfcLayer_2_bits[] = {
-0x0f,0xf0,0x0f,0xf0,0x30,0x00,0x30,0x00,0xc3,0xc0,0xc3,0xc0,0xcc,0x30,0xcc,0x30,0xcc,0x30,0xcc,0x30,0xc3,0xc0,0xc3,0xc0,0xc0,0x00,0xc0,0x00,0xc0,0x00,0xc0,0x00,0xcc,0x00,0xcc,0x00,0xc3,0x00,0xc3,0x00,0xc0,0xc0,0xc0,0xc0,0xcc,0x30,0xcc,0x30,0xc3,0x00,0xc3,0x00,0xc0,0xc0,0xc0,0xc0,0xcc,0x30,0xcc,0x30,0xc3,0x00,0xc3,0x00,0xc0,0xc0,0xc0,0xc0,0xcc,0x30,0xcc,0x30,0xc3,0x00,0xc3,0x00,0xc0,0xc0,0xc0,0xc0,0xcc,0x30,0xcc,0x30,0xc3,0x00,0xc3,0x00,0xc0,0xc0,0xc0,0xc0,0xcc,0x30,0xcc,0x30,0xc3,0x00,0xc3,0x00,0xc0,0xc0,0xc0,0xc0,0xc0,0x30,0xc0,0x30,0xc0,0x00,0xc0,0x00,0x30,0x00,0x30,0x00,0x3c,0x00,0x3c,0x00,0x3f,0x00,0x3f,0x00,0x3f,0xc0,0x3f,0xc0,0x3f,0xf0,0x3f,0xf0,0x33,0xf0,0x33,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0,0x30,0xf0
-};
-
-const unsigned char PROGMEM image_nfcLayer_3_bits[] = {
-0x3f,0xf8,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x38,0x38,0x08,0x20,0x08,0x20,0x07,0xc0
-};
-
-const unsigned char PROGMEM image_nfcLayer_6_bits[] = {
-0x01,0x00,0x0f,0xc0,0x01,0x80,0x03,0x00,0x06,0x00,0x0c,0xc0,0x07,0x80,0x10,0x20,0x1c,0xe0,0x47,0x88,0x70,0x38,0x1f,0xe0,0x03,0x00
-};
-
-const unsigned char PROGMEM image_nfcLayer_8_bits[] = {
-0xfe,0x08,0x10,0x20,0xfe,0x00,0xfe,0x12,0x12,0x12,0x02,0x00,0x7c,0x82,0x82,0x82,0x44
-};
-
 void drawWiFisubmenu(void) {  
     tft.fillScreen(TFT_BLACK);
     setSubmenuType(SUBMENU_WIFI);
@@ -263,10 +14,10 @@ void drawWiFisubmenu(void) {
     tft.drawRect(1, 0, 134, 239, 0xFFFF);
 
     // passport_left bitmap
-    tft.drawBitmap(122, 146, image_passport_left_bits, 12, 92, 0xFFFF);
+    tft.drawBitmap(122, 146, asset(AssetId::PASSPORT_LEFT), 12, 92, 0xFFFF);
 
     // battery_empty bitmap
-    tft.drawBitmap(117, 4, image_battery_empty_bits, 16, 24, 0xFFFF);
+    tft.drawBitmap(117, 4, asset(AssetId::BATTERY_EMPTY), 16, 24, 0xFFFF);
 
     // Layer 7
     tft.drawLine(0, 0, 0, 0, 0xFFFF);
@@ -275,10 +26,10 @@ void drawWiFisubmenu(void) {
     tft.drawLine(114, 239, 114, 2, 0xFFFF);
 
     // _16 bitmap (tiny Wi-Fi icon)
-    tft.drawBitmap(120, 44, image__16_bits, 10, 14, 0xFFFF);
+    tft.drawBitmap(120, 44, asset(AssetId::IMG_16), 10, 14, 0xFFFF);
 
     // Layer 9
-    tft.drawBitmap(121, 64, image_Layer_9_bits, 7, 22, 0xFFFF);
+    tft.drawBitmap(121, 64, asset(AssetId::LAYER_9), 7, 22, 0xFFFF);
 
 }
 
@@ -290,10 +41,10 @@ void drawBluetoothSubmenu(void) {
     tft.drawRect(1, 0, 134, 239, 0xFFFF);
 
     // Layer 2
-    tft.drawBitmap(117, 4, image_bleLayer_2_bits, 16, 24, 0xFFFF);
+    tft.drawBitmap(117, 4, asset(AssetId::BLELAYER_2), 16, 24, 0xFFFF);
 
     // Layer 3
-    tft.drawBitmap(122, 146, image_bleLayer_3_bits, 12, 92, 0xFFFF);
+    tft.drawBitmap(122, 146, asset(AssetId::BLELAYER_3), 12, 92, 0xFFFF);
 
     // Layer 4
     tft.drawLine(0, 0, 0, 0, 0xFFFF);
@@ -302,10 +53,10 @@ void drawBluetoothSubmenu(void) {
     tft.drawLine(114, 239, 114, 2, 0xFFFF);
 
     // Layer 6
-    tft.drawBitmap(117, 38, image_bleLayer_6_bits, 17, 23, 0xFFFF);
+    tft.drawBitmap(117, 38, asset(AssetId::BLELAYER_6), 17, 23, 0xFFFF);
 
     // Layer 8
-    tft.drawBitmap(121, 65, image_bleLayer_8_bits, 7, 53, 0xFFFF);
+    tft.drawBitmap(121, 65, asset(AssetId::BLELAYER_8), 7, 53, 0xFFFF);
 
 }
 
@@ -317,10 +68,10 @@ void drawIrSubmenu(void) {
     tft.drawRect(0, 1, 134, 239, 0xFFFF);
 
     // Layer 2
-    tft.drawBitmap(122, 146, image_irLayer_2_bits, 12, 92, 0xFFFF);
+    tft.drawBitmap(122, 146, asset(AssetId::IRLAYER_2), 12, 92, 0xFFFF);
 
     // Layer 3
-    tft.drawBitmap(117, 4, image_irLayer_3_bits, 16, 24, 0xFFFF);
+    tft.drawBitmap(117, 4, asset(AssetId::IRLAYER_3), 16, 24, 0xFFFF);
 
     // Layer 4
     tft.drawLine(0, 0, 0, 0, 0xFFFF);
@@ -329,13 +80,13 @@ void drawIrSubmenu(void) {
     tft.drawLine(114, 239, 114, 2, 0xFFFF);
 
     // Layer 6
-    tft.drawBitmap(116, 38, image_irLayer_6_bits, 16, 21, 0xFFFF);
+    tft.drawBitmap(116, 38, asset(AssetId::IRLAYER_6), 16, 21, 0xFFFF);
 
     // Layer 7
     tft.drawLine(0, 0, 0, 0, 0xFFFF);
 
     // Layer 8
-    tft.drawBitmap(120, 66, image_irLayer_8_bits, 7, 10, 0xFFFF);
+    tft.drawBitmap(120, 66, asset(AssetId::IRLAYER_8), 7, 10, 0xFFFF);
 
 }
 
@@ -347,19 +98,19 @@ void drawRfSubmenu(void) {
     tft.drawRect(1, 1, 134, 239, 0xFFFF);
 
     // Layer 7
-    tft.drawBitmap(122, 146, image_rfLayer_7_bits, 12, 92, 0xFFFF);
+    tft.drawBitmap(122, 146, asset(AssetId::RFLAYER_7), 12, 92, 0xFFFF);
 
     // Layer 8
-    tft.drawBitmap(117, 4, image_rfLayer_8_bits, 16, 24, 0xFFFF);
+    tft.drawBitmap(117, 4, asset(AssetId::RFLAYER_8), 16, 24, 0xFFFF);
 
     // Layer 10
     tft.drawLine(114, 239, 114, 2, 0xFFFF);
 
     // Layer 13
-    tft.drawBitmap(114, 39, image_rfLayer_13_bits, 19, 18, 0xFFFF);
+    tft.drawBitmap(114, 39, asset(AssetId::RFLAYER_13), 19, 18, 0xFFFF);
 
     // Layer 13
-    tft.drawBitmap(121, 62, image_rfLayer_13_1_bits, 7, 11, 0xFFFF);
+    tft.drawBitmap(121, 62, asset(AssetId::RFLAYER_13_1), 7, 11, 0xFFFF);
 
     // Layer 15
     tft.drawRect(1, 1, 134, 239, 0xFFFF);
@@ -377,22 +128,22 @@ void drawNrfSubmenu(void) {
     tft.drawRect(1, 1, 134, 239, 0xFFFF);
 
     // Layer 7
-    tft.drawBitmap(122, 146, image_nrfLayer_7_bits, 12, 92, 0xFFFF);
+    tft.drawBitmap(122, 146, asset(AssetId::NRFLAYER_7), 12, 92, 0xFFFF);
 
     // Layer 9
-    tft.drawBitmap(118, 4, image_nrfLayer_9_bits, 13, 24, 0xFFFF);
+    tft.drawBitmap(118, 4, asset(AssetId::NRFLAYER_9), 13, 24, 0xFFFF);
 
     // Layer 11
     tft.drawLine(114, 239, 114, 2, 0xFFFF);
 
     // image
-    tft.drawBitmap(116, 37, image_nrfimage_2_bits, 17, 19, 0xFFFF);
+    tft.drawBitmap(116, 37, asset(AssetId::NRFIMAGE_2), 17, 19, 0xFFFF);
 
     // Layer 14
-    tft.drawBitmap(121, 62, image_nrfLayer_14_bits, 7, 17, 0xFFFF);
+    tft.drawBitmap(121, 62, asset(AssetId::NRFLAYER_14), 7, 17, 0xFFFF);
 
     // Layer 15
-    tft.drawBitmap(121, 55, image_nrfLayer_15_bits, 1, 1, 0xFFFF);
+    tft.drawBitmap(121, 55, asset(AssetId::NRFLAYER_15), 1, 1, 0xFFFF);
 
 }
 
@@ -404,10 +155,10 @@ void drawRadioSubmenu(void) {
     tft.drawRect(1, 1, 134, 239, 0xFFFF);
 
     // Layer 2
-    tft.drawBitmap(117, 4, image_RadioLayer_2_bits, 16, 24, 0xFFFF);
+    tft.drawBitmap(117, 4, asset(AssetId::RADIOLAYER_2), 16, 24, 0xFFFF);
 
     // Layer 3
-    tft.drawBitmap(122, 146, image_RadioLayer_3_bits, 12, 92, 0xFFFF);
+    tft.drawBitmap(122, 146, asset(AssetId::RADIOLAYER_3), 12, 92, 0xFFFF);
 
     // Layer 4
     tft.drawLine(0, 0, 0, 0, 0xFFFF);
@@ -416,10 +167,10 @@ void drawRadioSubmenu(void) {
     tft.drawLine(114, 239, 114, 2, 0xFFFF);
 
     // Layer 6
-    tft.drawBitmap(114, 35, image_RadioLayer_6_bits, 23, 27, 0xFFFF);
+    tft.drawBitmap(114, 35, asset(AssetId::RADIOLAYER_6), 23, 27, 0xFFFF);
 
     // Layer 8
-    tft.drawBitmap(120, 66, image_RadioLayer_8_bits, 7, 29, 0xFFFF);
+    tft.drawBitmap(120, 66, asset(AssetId::RADIOLAYER_8), 7, 29, 0xFFFF);
 
 }
 
@@ -431,10 +182,10 @@ void drawGpsSubmenu(void) {
     tft.drawRect(1, 1, 134, 239, 0xFFFF);
 
     // Layer 2
-    tft.drawBitmap(117, 4, image_GpsLayer_2_bits, 16, 24, 0xFFFF);
+    tft.drawBitmap(117, 4, asset(AssetId::GPSLAYER_2), 16, 24, 0xFFFF);
 
     // Layer 3
-    tft.drawBitmap(122, 146, image_GpsLayer_3_bits, 12, 92, 0xFFFF);
+    tft.drawBitmap(122, 146, asset(AssetId::GPSLAYER_3), 12, 92, 0xFFFF);
 
     // Layer 4
     tft.drawLine(0, 0, 0, 0, 0xFFFF);
@@ -443,10 +194,10 @@ void drawGpsSubmenu(void) {
     tft.drawLine(114, 239, 114, 2, 0xFFFF);
 
     // black_white_simple_bit_vector_pixel_art_icon_geolocation_map_pin_black_white_simple_flat_bit_vector_pixel_art_icon_312637465_312637466
-    tft.drawBitmap(116, 43, image_GpsLayer_6_bits, 16, 12, 0xFFFF);
+    tft.drawBitmap(116, 43, asset(AssetId::GPSLAYER_6), 16, 12, 0xFFFF);
 
     // Layer 8
-    tft.drawBitmap(121, 60, image_GpsLayer_8_bits, 7, 17, 0xFFFF);
+    tft.drawBitmap(121, 60, asset(AssetId::GPSLAYER_8), 7, 17, 0xFFFF);
 
 }
 
@@ -458,22 +209,22 @@ void drawRpiSubmenu(void) {
     tft.drawRect(1, 0, 134, 240, 0xFFFF);
 
     // Layer 2
-    tft.drawBitmap(117, 4, image_RpiLayer_2_bits, 16, 24, 0xFFFF);
+    tft.drawBitmap(117, 4, asset(AssetId::RPILAYER_2), 16, 24, 0xFFFF);
 
     // Layer 3
-    tft.drawBitmap(122, 146, image_RpiLayer_3_bits, 12, 92, 0xFFFF);
+    tft.drawBitmap(122, 146, asset(AssetId::RPILAYER_3), 12, 92, 0xFFFF);
 
     // Layer 4
     tft.drawLine(114, 239, 114, 2, 0xFFFF);
 
     // Layer 6
-    tft.drawBitmap(114, 36, image_RpiLayer_6_bits, 19, 19, 0xFFFF);
+    tft.drawBitmap(114, 36, asset(AssetId::RPILAYER_6), 19, 19, 0xFFFF);
 
     // Layer 8
-    tft.drawBitmap(125, 61, image_RpiLayer_8_1_bits, 7, 16, 0xFFFF);
+    tft.drawBitmap(125, 61, asset(AssetId::RPILAYER_8_1), 7, 16, 0xFFFF);
 
     // Layer 9
-    tft.drawBitmap(117, 61, image_RpiLayer_9_bits, 7, 41, 0xFFFF);
+    tft.drawBitmap(117, 61, asset(AssetId::RPILAYER_9), 7, 41, 0xFFFF);
 
 }
 
@@ -485,19 +236,19 @@ void drawBadUsbSubmenu(void) {
     tft.drawRect(1, 0, 134, 240, 0xFFFF);
 
     // Layer 2
-    tft.drawBitmap(117, 4, image_BadLayer_2_bits, 16, 24, 0xFFFF);
+    tft.drawBitmap(117, 4, asset(AssetId::BADLAYER_2), 16, 24, 0xFFFF);
 
     // Layer 3
-    tft.drawBitmap(122, 146, image_BadLayer_3_bits, 12, 92, 0xFFFF);
+    tft.drawBitmap(122, 146, asset(AssetId::BADLAYER_3), 12, 92, 0xFFFF);
 
     // Layer 5
     tft.drawLine(114, 239, 114, 2, 0xFFFF);
 
     // Layer 8
-    tft.drawBitmap(121, 71, image_BadLayer_8_bits, 7, 41, 0xFFFF);
+    tft.drawBitmap(121, 71, asset(AssetId::BADLAYER_8), 7, 41, 0xFFFF);
 
     // USB_KILLER
-    tft.drawBitmap(118, 37, image_BadLayer_6_bits, 13, 30, 0xFFFF);
+    tft.drawBitmap(118, 37, asset(AssetId::BADLAYER_6), 13, 30, 0xFFFF);
 
 }
 
@@ -509,19 +260,19 @@ void drawSettingsSubmenu(void) {
     tft.drawRect(1, 1, 134, 239, 0xFFFF);
 
     // Layer 6
-    tft.drawBitmap(117, 4, image_SetLayer_6_bits, 16, 24, 0xFFFF);
+    tft.drawBitmap(117, 4, asset(AssetId::SETLAYER_6), 16, 24, 0xFFFF);
 
     // Layer 7
-    tft.drawBitmap(122, 146, image_SetLayer_7_bits, 12, 92, 0xFFFF);
+    tft.drawBitmap(122, 146, asset(AssetId::SETLAYER_7), 12, 92, 0xFFFF);
 
     // Layer 9
     tft.drawLine(114, 239, 114, 2, 0xFFFF);
 
     // Layer 11
-    tft.drawBitmap(117, 44, image_SetLayer_11_bits, 14, 14, 0xFFFF);
+    tft.drawBitmap(117, 44, asset(AssetId::SETLAYER_11), 14, 14, 0xFFFF);
 
     // Layer 12
-    tft.drawBitmap(121, 64, image_SetLayer_12_bits, 7, 47, 0xFFFF);
+    tft.drawBitmap(121, 64, asset(AssetId::SETLAYER_12), 7, 47, 0xFFFF);
 
 }
 
@@ -533,22 +284,22 @@ void drawExtrasSubmenu(void) {
     tft.drawRect(1, 1, 134, 239, 0xFFFF);
 
     // Layer 2
-    tft.drawBitmap(117, 4, image_exLayer_2_bits, 16, 24, 0xFFFF);
+    tft.drawBitmap(117, 4, asset(AssetId::EXLAYER_2), 16, 24, 0xFFFF);
 
     // Layer 3
-    tft.drawBitmap(122, 146, image_exLayer_3_bits, 12, 92, 0xFFFF);
+    tft.drawBitmap(122, 146, asset(AssetId::EXLAYER_3), 12, 92, 0xFFFF);
 
     // Layer 4
     tft.drawLine(114, 239, 114, 2, 0xFFFF);
 
     // Layer 7
-    tft.drawBitmap(118, 42, image_exLayer_7_bits, 13, 13, 0xFFFF);
+    tft.drawBitmap(118, 42, asset(AssetId::EXLAYER_7), 13, 13, 0xFFFF);
 
     // Layer 8
-    tft.drawBitmap(-60, 8, image_exLayer_8_bits, 75, 75, 0xFFFF);
+    tft.drawBitmap(-60, 8, asset(AssetId::EXLAYER_8), 75, 75, 0xFFFF);
 
     // Layer 8
-    tft.drawBitmap(121, 59, image_exLayer_8_1_bits, 7, 29, 0xFFFF);
+    tft.drawBitmap(121, 59, asset(AssetId::EXLAYER_8_1), 7, 29, 0xFFFF);
 
 }
 
@@ -556,23 +307,28 @@ void drawFilesSubmenu(void) {
     tft.fillScreen(TFT_BLACK);
     setSubmenuType(SUBMENU_FILES);
     drawSubmenuOptions();
+    drawFilesFrame();
+}
+
+// Files chrome only; the file browser draws its own list inside it
+void drawFilesFrame(void) {
     // Layer 1
     tft.drawRect(1, 1, 134, 239, 0xFFFF);
 
     // Layer 2
-    tft.drawBitmap(117, 4, image_fileLayer_2_bits, 16, 24, 0xFFFF);
+    tft.drawBitmap(117, 4, asset(AssetId::FILELAYER_2), 16, 24, 0xFFFF);
 
     // Layer 3
-    tft.drawBitmap(122, 146, image_fileLayer_3_bits, 12, 92, 0xFFFF);
+    tft.drawBitmap(122, 146, asset(AssetId::FILELAYER_3), 12, 92, 0xFFFF);
 
     // Layer 4
     tft.drawLine(114, 239, 114, 2, 0xFFFF);
 
     // files
-    tft.drawBitmap(117, 42, image_fileLayer_6_bits, 15, 20, 0xFFFF);
+    tft.drawBitmap(117, 42, asset(AssetId::FILELAYER_6), 15, 20, 0xFFFF);
 
     // Layer 7
-    tft.drawBitmap(121, 66, image_fileLayer_7_bits, 7, 29, 0xFFFF);
+    tft.drawBitmap(121, 66, asset(AssetId::FILELAYER_7), 7, 29, 0xFFFF);
 
 }
 
@@ -584,10 +340,10 @@ void drawRfidSubmenu(void) {
     tft.drawRect(1, 1, 134, 239, 0xFFFF);
 
     // Layer 2
-    tft.drawBitmap(122, 146, image_rfidLayer_2_bits, 12, 92, 0xFFFF);
+    tft.drawBitmap(122, 146, asset(AssetId::RFIDLAYER_2), 12, 92, 0xFFFF);
 
     // Layer 3
-    tft.drawBitmap(117, 4, image_rfidLayer_3_bits, 16, 24, 0xFFFF);
+    tft.drawBitmap(117, 4, asset(AssetId::RFIDLAYER_3), 16, 24, 0xFFFF);
 
     // Layer 4
     tft.drawLine(0, 0, 0, 0, 0xFFFF);
@@ -596,10 +352,10 @@ void drawRfidSubmenu(void) {
     tft.drawLine(114, 239, 114, 2, 0xFFFF);
 
     // Layer 6
-    tft.drawBitmap(114, 42, image_rfidLayer_6_bits, 19, 26, 0xFFFF);
+    tft.drawBitmap(114, 42, asset(AssetId::RFIDLAYER_6), 19, 26, 0xFFFF);
 
     // Layer 8
-    tft.drawBitmap(121, 74, image_rfidLayer_8_bits, 7, 23, 0xFFFF);
+    tft.drawBitmap(121, 74, asset(AssetId::RFIDLAYER_8), 7, 23, 0xFFFF);
 
 }
 
@@ -611,10 +367,10 @@ void drawNfcSubmenu(void) {
     tft.drawRect(1, 1, 134, 239, 0xFFFF);
 
     // Layer 2
-    tft.drawBitmap(122, 146, image_nfcLayer_2_bits, 12, 92, 0xFFFF);
+    tft.drawBitmap(122, 146, asset(AssetId::NFCLAYER_2), 12, 92, 0xFFFF);
 
     // Layer 3
-    tft.drawBitmap(117, 4, image_nfcLayer_3_bits, 16, 24, 0xFFFF);
+    tft.drawBitmap(117, 4, asset(AssetId::NFCLAYER_3), 16, 24, 0xFFFF);
 
     // Layer 4
     tft.drawLine(0, 0, 0, 0, 0xFFFF);
@@ -623,17 +379,17 @@ void drawNfcSubmenu(void) {
     tft.drawLine(114, 239, 114, 2, 0xFFFF);
 
     // Layer 6
-    tft.drawBitmap(118, 45, image_nfcLayer_6_bits, 14, 13, 0xFFFF);
+    tft.drawBitmap(118, 45, asset(AssetId::NFCLAYER_6), 14, 13, 0xFFFF);
 
     // Layer 8
-    tft.drawBitmap(121, 62, image_nfcLayer_8_bits, 7, 17, 0xFFFF);
+    tft.drawBitmap(121, 62, asset(AssetId::NFCLAYER_8), 7, 17, 0xFFFF);
 
 }
 
 void drawOptionsLayerBackground(TFT_eSPI& tft) {
     tft.fillScreen(TFT_BLACK);
     tft.drawRect(1, 1, 134, 239, 0xFFFF);
-    tft.drawBitmap(122, 146, OptionsLayer_7_bits, 12, 92, 0xFFFF);
-    tft.drawBitmap(117, 4, OptionsLayer_9_bits, 16, 24, 0xFFFF);
+    tft.drawBitmap(122, 146, asset(AssetId::OPTIONSLAYER_7), 12, 92, 0xFFFF);
+    tft.drawBitmap(117, 4, asset(AssetId::OPTIONSLAYER_9), 16, 24, 0xFFFF);
     tft.drawLine(114, 239, 114, 2, 0xFFFF);
 }
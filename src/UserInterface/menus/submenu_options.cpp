@@ -2,6 +2,7 @@
 #include <TFT_eSPI.h>
 #include "submenu_options.h"
 #include "menu_submenus.h"
+#include "../../Modules/Core/settings.h"
 #include <algorithm>
 
 // ---------- Entry lists ----------
@@ -12,7 +13,7 @@ static const String btEntries[] = {
   "<- Back", "Scan Dev", "Hijack", "Keyboard", "Google", "iOS", "Android", "Samsung", "Windows"
 };
 static const String irEntries[] = {
-  "<- Back", "B Gone", "Remotes", "Custom", "Read", "IR Interrupt"
+  "<- Back", "B Gone", "Remotes", "Custom", "Read", "IR Interrupt", "Analyzer"
 };
 static const String rfEntries[] = {
   "<- Back", "Find Fq", "RF Visualizer", "RF Jammer", "Custom Sub", "Spectogram"
@@ -33,7 +34,7 @@ static const String badusbEntries[] = {
   "<- Back", "Execute", "Bad Ble", "Monitor Pc", "Keyboard", "Mouse"
 };
 static const String settingsEntries[] = {
-  "<- Back", "Theme", "Brightness", "Audio", "Volume", "Time", "Bat Saver", "Config Pins"
+  "<- Back", "Theme", "Brightness", "Audio", "Volume", "Time", "Bat Saver", "Config Pins", "Fw Update"
 };
 static const String extrasEntries[] = {
   "<- Back", "Stopwatch", "Mic Spect", "Creds", "Schematics"
@@ -129,30 +130,50 @@ void setSubmenuType(SubmenuType type) {
 #endif
 
 // ---------- Drawing helpers ----------
-static void drawEntry(int idx, int bubbleX, int bubbleW, int y0, bool sel) {
+// Settings → Theme picks the highlight colour of the selected row
+static uint16_t themeAccent() {
+  static const uint16_t kAccents[] = { TFT_WHITE, 0xFD20, TFT_CYAN, TFT_GREEN };
+  return kAccents[settingsGet(Setting::THEME)];
+}
+
+// Labels longer than the bubble are cut with a trailing '~'
+static constexpr int maxLabelChars = (screenW - sbW - sbRightMargin - padSelX * 2 - 8) / charWSel;
+
+static void drawEntry(const char* label, int bubbleX, int bubbleW, int y0, bool sel) {
   const int txtSz = sel ? textSzSel : textSzUns;
   const int chW   = sel ? charWSel  : charWUns;
   const int padY  = sel ? padSelY   : padUnsY;
   const int boxH  = sel ? boxHSel   : boxHUns;
   const int boxY  = y0 + (lineH - boxH)/2;
 
-  tftPtr->drawRoundRect(bubbleX, boxY, bubbleW, boxH, 8, TFT_WHITE);
+  const uint16_t col = sel ? themeAccent() : TFT_WHITE;
+  tftPtr->drawRoundRect(bubbleX, boxY, bubbleW, boxH, 8, col);
   if (sel) {
-    tftPtr->drawRoundRect(bubbleX+1, boxY+1, bubbleW-2, boxH-2, 7, TFT_WHITE);
+    tftPtr->drawRoundRect(bubbleX+1, boxY+1, bubbleW-2, boxH-2, 7, col);
+  }
+
+  char text[maxLabelChars + 1];
+  int  len = strlen(label);
+  if (len > maxLabelChars) {
+    memcpy(text, label, maxLabelChars - 1);
+    text[maxLabelChars - 1] = '~';
+    text[maxLabelChars]     = '\0';
+    label = text;
+    len   = maxLabelChars;
   }
 
   tftPtr->setTextSize(txtSz);
-  tftPtr->setTextColor(TFT_WHITE, TFT_BLACK);
-  const int textW = entries[idx].length() * chW;
+  tftPtr->setTextColor(col, TFT_BLACK);
+  const int textW = len * chW;
   const int tx    = bubbleX + (bubbleW - textW)/2;
   const int ty    = boxY + (boxH - (8*txtSz))/2;
   tftPtr->setCursor(tx, ty);
-  tftPtr->print(entries[idx]);
+  tftPtr->print(label);
 }
 
 // ---------- Main render ----------
-void drawSubmenuOptions() {
-  if (!tftPtr || !entries) return;
+void drawOptionList(OptionLabelFn label, int count, int selected, int maxLen, bool wrap) {
+  if (!tftPtr || count <= 0) return;
 
 #if defined(M5CARDPUTER)
   static constexpr uint8_t SUBMENU_ROT = 1;  // you chose 1 for Cardputer list
@@ -166,11 +187,7 @@ void drawSubmenuOptions() {
   const int totalH = lineH * maxVisible;
   const int startY = ((screenH - totalH) / 2) + verticalOffset;
 
-  int maxLen = 0;
-  for (int i = 0; i < entryCount; ++i) {
-    maxLen = std::max(maxLen, (int)entries[i].length());
-  }
-
+  maxLen = std::min(maxLen, maxLabelChars);
   const int bubbleWsel = maxLen * charWSel + padSelX * 2;
   const int bubbleWuns = maxLen * charWUns + padUnsX * 2;
   const int bubbleXsel = (screenW - bubbleWsel) / 2;
@@ -179,12 +196,14 @@ void drawSubmenuOptions() {
   tftPtr->fillRect(bubbleXsel - 4, startY - 2, bubbleWsel + 8, totalH + 4, TFT_BLACK);
 
   for (int off = -1; off <= 1; ++off) {
-    const int idx = (selectedEntry + off + entryCount) % entryCount;
+    int idx = selected + off;
+    if (wrap)                            idx = (idx + count) % count;
+    else if (idx < 0 || idx >= count)    continue;
     const int y0  = startY + (off + 1) * lineH;
     const bool sel = (off == 0);
     const int bw   = sel ? bubbleWsel : bubbleWuns;
     const int bx   = sel ? bubbleXsel : bubbleXuns;
-    drawEntry(idx, bx, bw, y0, sel);
+    drawEntry(label(idx), bx, bw, y0, sel);
   }
 
   const int sbX = screenW - sbW - sbRightMargin;
@@ -192,9 +211,9 @@ void drawSubmenuOptions() {
   const int sbH = totalH - (sbMarginTop + sbMarginBottom);
   tftPtr->fillRoundRect(sbX, sbY, sbW, sbH, 2, 0x2104);
 
-  if (entryCount > 1) {
-    const float pos = float(selectedEntry) / (entryCount - 1);
-    const int th = std::max(sbH * maxVisible / entryCount, sbW);
+  if (count > 1) {
+    const float pos = float(selected) / (count - 1);
+    const int th = std::max(sbH * maxVisible / count, sbW);
     const int ty = sbY + int((sbH - th) * pos);
     tftPtr->fillRoundRect(sbX, ty, sbW, th, 2, TFT_WHITE);
   }
@@ -202,6 +221,17 @@ void drawSubmenuOptions() {
   tftPtr->setRotation(orig);
 }
 
+static const char* entryLabel(int idx) { return entries[idx].c_str(); }
+
+void drawSubmenuOptions() {
+  if (!entries) return;
+  int maxLen = 0;
+  for (int i = 0; i < entryCount; ++i) {
+    maxLen = std::max(maxLen, (int)entries[i].length());
+  }
+  drawOptionList(entryLabel, entryCount, selectedEntry, maxLen, true);
+}
+
 // ---------- Navigation helpers ----------
 void nextSubmenuOption()     { if (entries) selectedEntry = (selectedEntry + 1) % entryCount; }
 void previousSubmenuOption() { if (entries) selectedEntry = (selectedEntry - 1 + entryCount) % entryCount; }
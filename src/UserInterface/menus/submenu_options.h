@@ -24,6 +24,11 @@ enum SubmenuType {
 void initSubmenuOptions(TFT_eSPI* display);
 void setSubmenuType(SubmenuType type);
 void drawSubmenuOptions();
+
+// The same list widget for callers that page their rows in lazily
+// (labels are fetched only for the three visible rows).
+typedef const char* (*OptionLabelFn)(int idx);
+void drawOptionList(OptionLabelFn label, int count, int selected, int maxLen, bool wrap);
 void nextSubmenuOption();
 void previousSubmenuOption();
 int    getSubmenuOptionIndex();
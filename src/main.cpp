@@ -13,6 +13,13 @@
 #include "UserInterface/menus/submenu_options.h"
 #include "Modules/Functions/stopwatch.h"
 #include "Modules/Core/buttons.h"
+#include "Modules/Core/storage.h"
+#include "Modules/Core/settings.h"
+#include "Modules/Core/backlight.h"
+#include "Modules/Core/assets.h"
+#include "Modules/Core/telemetry.h"
+#include "Modules/Core/profile.h"
+#include "Modules/Functions/settings_screen.h"
 
 #if defined(M5CARDPUTER)
   static constexpr uint8_t ROT_TOP = 4;
@@ -20,12 +27,6 @@
   static constexpr uint8_t ROT_TOP = 2;
 #endif
 
-#if defined(M5CARDPUTER)
-  #define BACKLIGHT_PIN 38
-#else
-  #define BACKLIGHT_PIN 27
-#endif
-
 TFT_eSPI tft;
 MenuState currentMenu = WIFI_MENU;
 bool inOptionScreen = false;
@@ -35,27 +36,53 @@ bool inIRRead       = false;   // ← NEW: IR Reader app active flag
 
 void setup() {
   Serial.begin(115200);
+  telemetryBegin();                 // report how the previous run ended
+  profileBegin();                   // cached profile: setting defaults before the FS is up
 #if defined(M5CARDPUTER)
   M5Cardputer.begin();
 #else
   M5.begin();
 #endif
 
-  pinMode(BACKLIGHT_PIN, OUTPUT);
-  digitalWrite(BACKLIGHT_PIN, HIGH);
-
   tft.begin();
+  backlightBegin();                 // after tft.begin(), which claims TFT_BL as GPIO
   tft.setRotation(ROT_TOP);
   tft.fillScreen(TFT_BLACK);
   delay(100);
 
+  assetsBegin();                    // maps the bitmap partition the menus draw from
   initButtons();
   initSubmenuOptions(&tft);
   drawWiFiMenu();
+
+  // Nothing below is needed for the first frame
+  settingsApplyAfterBoot();
+  storageBegin();
+  telemetryFlush();
+  if (profileRefresh()) {           // profile.json edited since the cached copy
+    settingsReloadDefaults();
+    settingsApplyAfterBoot();
+    backlightApply();
+  }
+}
+
+static TelemetryMode activeMode(int8_t& arg) {
+  arg = (int8_t)buttonsActiveApp();
+  if (arg >= 0)       return TelemetryMode::APP;
+  if (inStopwatch)    return TelemetryMode::STOPWATCH;
+  if (inBGone)        return TelemetryMode::BGONE;
+  if (inIRRead)       return TelemetryMode::IR_READ;
+  if (inOptionScreen) return TelemetryMode::OPTIONS;
+  return TelemetryMode::MENU;
 }
 
 void loop() {
+  int8_t appRow;
+  TelemetryMode mode = activeMode(appRow);
+  telemetryLoop(currentMenu, mode, appRow);
   updateButtons();
+  settingsPoll();
+  backlightPoll(buttonsIdleMs());
   // Updated call includes the new inIRRead flag (5th bool reference)
   handleAllButtonLogic(&tft, inOptionScreen, inStopwatch, inBGone, inIRRead, currentMenu);
 }
@@ -0,0 +1,170 @@
+#!/usr/bin/env python3
+"""Pack UI bitmaps into the asset partition image and generate their IDs.
+
+Source: assets/ui_bitmaps.c, plain C byte arrays in drawBitmap() format.
+Outputs:
+  - the partition image (read in place on the device by src/Modules/Core/assets.cpp)
+  - src/UserInterface/bitmaps/asset_ids.h (AssetId enum, one entry per array)
+
+Image layout (little endian):
+  header  20 bytes   "FTWA", u16 version, u16 count, u32 total size,
+                     u16 entry size, u16 reserved, u32 FNV-1a of bytes [20:total)
+  index   count * (u32 key, u32 offset, u32 size), sorted by key,
+          offsets from the image start
+  data    entries in index order, each 4-byte aligned
+
+An asset's key is the FNV-1a of its AssetId name, so it does not move when
+arrays are added, removed or reordered. The firmware looks each of its IDs
+up by key and accepts any image version in its supported range: a delta OTA
+that only rewrites the app slot keeps drawing every asset the old pack
+already has, and only new or resized bitmaps stay blank until the pack is
+reflashed. Renaming an array changes its key.
+"""
+
+import argparse
+import os
+import re
+import struct
+import sys
+
+MAGIC = b"FTWA"
+VERSION = 2
+HEADER = struct.Struct("<4sHHIHHI")
+ENTRY = struct.Struct("<III")
+ALIGN = 4
+
+_ARRAY = re.compile(r"const\s+unsigned\s+char\s+(\w+)\s*\[\s*\]\s*=\s*\{(.*?)\};", re.S)
+
+
+def fnv1a(data: bytes, h: int = 0x811C9DC5) -> int:
+    for b in data:
+        h = ((h ^ b) * 0x01000193) & 0xFFFFFFFF
+    return h
+
+
+def asset_id(name: str) -> str:
+    n = name[len("image_"):] if name.startswith("image_") else name
+    n = re.sub(r"_bits$", "", n).lstrip("_").upper()
+    return "IMG_" + n if n[:1].isdigit() else n
+
+
+def parse(src: str):
+    with open(src) as f:
+        text = re.sub(r"//[^\n]*", "", f.read())
+    assets, seen = [], {}
+    for m in _ARRAY.finditer(text):
+        ident = asset_id(m.group(1))
+        if ident in seen:
+            raise ValueError(f"{m.group(1)} and {seen[ident]} both map to {ident}")
+        seen[ident] = m.group(1)
+        data = bytes(int(v, 0) for v in re.findall(r"0x[0-9a-fA-F]+|\b\d+\b", m.group(2)))
+        assets.append((ident, data))
+    if not assets:
+        raise ValueError(f"no arrays in {src}")
+    return assets
+
+
+def key(ident: str) -> int:
+    return fnv1a(ident.encode())
+
+
+def check_keys(assets) -> None:
+    seen = {}
+    for ident, _ in assets:
+        k = key(ident)
+        if k in seen:
+            raise ValueError(f"{ident} and {seen[k]} hash to the same key 0x{k:08X}")
+        seen[k] = ident
+
+
+def pack(assets) -> bytes:
+    count = len(assets)
+    pos = HEADER.size + ENTRY.size * count
+    entries, body = [], bytearray()
+    for ident, data in assets:
+        pad = -pos % ALIGN
+        body += bytes(pad)
+        pos += pad
+        entries.append(ENTRY.pack(key(ident), pos, len(data)))
+        body += data
+        pos += len(data)
+    entries.sort(key=lambda e: ENTRY.unpack(e)[0])
+    rest = b"".join(entries) + bytes(body)
+    head = HEADER.pack(MAGIC, VERSION, count, HEADER.size + len(rest), ENTRY.size, 0, fnv1a(rest))
+    return head + rest
+
+
+def table(ctype: str, name: str, values, fmt: str, per_line: int) -> list:
+    lines = [f"static constexpr {ctype} {name}[] = {{"]
+    for i in range(0, len(values), per_line):
+        lines.append("  " + " ".join(fmt.format(v) + "," for v in values[i:i + per_line]))
+    return lines + ["};"]
+
+
+def header(assets) -> str:
+    lines = [
+        "#pragma once",
+        "#include <Arduino.h>",
+        "",
+        "// Generated by tools/assetpack.py from assets/ui_bitmaps.c. Do not edit.",
+        "",
+        "enum class AssetId : uint16_t {",
+    ]
+    lines += [f"  {ident}," for ident, _ in assets]
+    lines += [
+        "  COUNT",
+        "};",
+        "",
+        f"static constexpr uint16_t ASSET_MAX_SIZE = {max(len(d) for _, d in assets)};",
+        "",
+        "// Pack lookup key and expected size, indexed by AssetId",
+    ]
+    lines += table("uint32_t", "ASSET_KEYS", [key(i) for i, _ in assets], "0x{:08X}", 6)
+    lines += table("uint16_t", "ASSET_SIZES", [len(d) for _, d in assets], "{:4}", 12)
+    lines += [""]
+    return "\n".join(lines)
+
+
+def write_if_changed(path: str, data: bytes) -> bool:
+    try:
+        with open(path, "rb") as f:
+            if f.read() == data:
+                return False
+    except OSError:
+        pass
+    os.makedirs(os.path.dirname(os.path.abspath(path)), exist_ok=True)
+    with open(path, "wb") as f:
+        f.write(data)
+    return True
+
+
+def build(src: str, out: str, hdr: str, limit: int = 0) -> int:
+    assets = parse(src)
+    check_keys(assets)
+    image = pack(assets)
+    if limit and len(image) > limit:
+        raise ValueError(f"{len(image)} bytes of assets do not fit the {limit}-byte partition")
+    write_if_changed(out, image)
+    write_if_changed(hdr, header(assets).encode())
+    return len(image)
+
+
+def main(argv=None) -> int:
+    root = os.path.dirname(os.path.dirname(os.path.abspath(__file__)))
+    ap = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    ap.add_argument("--src", default=os.path.join(root, "assets", "ui_bitmaps.c"))
+    ap.add_argument("--out", default=os.path.join(root, "files", "assets.bin"))
+    ap.add_argument("--header", default=os.path.join(root, "src", "UserInterface", "bitmaps", "asset_ids.h"))
+    ap.add_argument("--limit", type=lambda v: int(v, 0), default=0, help="partition size")
+    args = ap.parse_args(argv)
+    try:
+        n = build(args.src, args.out, args.header, args.limit)
+    except (ValueError, OSError) as e:
+        print(f"assetpack: {e}", file=sys.stderr)
+        return 1
+    print(f"{args.out}: {n} bytes")
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
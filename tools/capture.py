@@ -0,0 +1,196 @@
+#!/usr/bin/env python3
+"""Read, validate and repair capture containers (.ftc) pulled off the device.
+
+Format: see src/Modules/Core/capture.h. Summary (little endian):
+
+  header  "FTWC", u16 version, u16 header size (24), u32 start Unix time,
+          u32 max chunk size, u32 reserved, u32 CRC-32 of bytes [0:20)
+  chunk   "CHNK", u32 seq, u32 payload size, u32 first ms, u32 last ms,
+          u32 CRC-32 of the 20 header bytes before it + payload; payload is
+          records of u8 type, u8 flags, u16 size, u32 ms, data
+  index   "FIDX", u32 count, u32 stride, u32 chunks, u32 last ms,
+          count * (u32 offset, u32 first ms), u32 CRC-32 of the block
+  trailer u32 index offset, "FEND"
+
+A file without a valid index (power cut while recording) is read by walking
+the chunks; everything after the first bad chunk is reported as a torn tail.
+"""
+
+import argparse
+import bisect
+import os
+import struct
+import sys
+import zlib
+
+HEADER = struct.Struct("<4sHHIIII")
+CHUNK = struct.Struct("<4sIIIII")
+RECORD = struct.Struct("<BBHI")
+INDEX = struct.Struct("<4sIIII")
+ENTRY = struct.Struct("<II")
+TRAILER = struct.Struct("<I4s")
+VERSION = 1
+INDEX_MAX = 512              # CaptureConfig::indexMax default
+
+TYPES = {1: "ir", 2: "wifi_ap", 3: "gps", 4: "audio", 5: "mark"}
+
+
+class Capture:
+    def __init__(self, data: bytes):
+        if len(data) < HEADER.size:
+            raise ValueError("truncated header")
+        magic, ver, hsize, self.start, self.chunk_bytes, _, crc = HEADER.unpack_from(data)
+        if magic != b"FTWC" or ver != VERSION or hsize != HEADER.size:
+            raise ValueError("not a capture file")
+        if crc != zlib.crc32(data[:20]):
+            raise ValueError("header CRC mismatch")
+        self.data = data
+        self.bad_chunks = []          # offsets of chunks failing their CRC
+        self.index = self._load_index()
+        self.index_rebuilt = self.index is None
+        if self.index is None:
+            self.index, self.stride, self.chunks, self.first_ms, self.last_ms, self.data_end = self._scan()
+        self.tail = 0 if not self.index_rebuilt else len(data) - self.data_end
+
+    def _load_index(self):
+        d = self.data
+        if len(d) < HEADER.size + INDEX.size + 4 + TRAILER.size:
+            return None
+        at, end = TRAILER.unpack_from(d, len(d) - TRAILER.size)
+        if end != b"FEND" or at < HEADER.size or at + INDEX.size > len(d):
+            return None
+        magic, count, stride, chunks, last_ms = INDEX.unpack_from(d, at)
+        size = INDEX.size + count * ENTRY.size
+        if magic != b"FIDX" or at + size + 4 + TRAILER.size != len(d):
+            return None
+        (crc,) = struct.unpack_from("<I", d, at + size)
+        if crc != zlib.crc32(d[at:at + size]):
+            return None
+        entries = [ENTRY.unpack_from(d, at + INDEX.size + i * ENTRY.size) for i in range(count)]
+        self.stride, self.chunks, self.last_ms, self.data_end = stride, chunks, last_ms, at
+        self.first_ms = entries[0][1] if entries else 0
+        return entries
+
+    def _chunk(self, off):
+        """(seq, payload size, t0, t1, crc ok) or None if no chunk header fits."""
+        d = self.data
+        if off + CHUNK.size > len(d):
+            return None
+        magic, seq, n, t0, t1, crc = CHUNK.unpack_from(d, off)
+        if magic != b"CHNK" or n + CHUNK.size > self.chunk_bytes or off + CHUNK.size + n > len(d):
+            return None
+        ok = zlib.crc32(d[off + CHUNK.size:off + CHUNK.size + n], zlib.crc32(d[off:off + 20])) == crc
+        return seq, n, t0, t1, ok
+
+    def _scan(self):
+        entries, stride, chunks, first, last = [], 1, 0, 0, 0
+        off = HEADER.size
+        while True:
+            c = self._chunk(off)
+            if c is None or c[0] != chunks or not c[4]:
+                break
+            seq, n, t0, t1, _ = c
+            if seq % stride == 0:
+                if len(entries) == INDEX_MAX:
+                    entries, stride = entries[::2], stride * 2
+                if seq % stride == 0:
+                    entries.append((off, t0))
+            if not chunks:
+                first = t0
+            last = t1
+            chunks += 1
+            off += CHUNK.size + n
+        return entries, stride, chunks, first, last, off
+
+    def records(self, from_ms=0):
+        off = HEADER.size
+        if from_ms and self.index:
+            i = bisect.bisect_right([t for _, t in self.index], from_ms) - 1
+            if i >= 0:
+                off = self.index[i][0]
+        while off < self.data_end:
+            c = self._chunk(off)
+            if c is None:
+                break
+            _, n, _, t1, ok = c
+            body, off = off + CHUNK.size, off + CHUNK.size + n
+            if not ok:
+                self.bad_chunks.append(body - CHUNK.size)
+                continue
+            if t1 < from_ms:
+                continue
+            p, end = body, body + n
+            while p + RECORD.size <= end:
+                typ, flags, size, ms = RECORD.unpack_from(self.data, p)
+                if p + RECORD.size + size > end:
+                    break
+                if ms >= from_ms:
+                    yield typ, flags, ms, self.data[p + RECORD.size:p + RECORD.size + size]
+                p += RECORD.size + size
+
+    def index_block(self) -> bytes:
+        body = INDEX.pack(b"FIDX", len(self.index), self.stride, self.chunks, self.last_ms)
+        body += b"".join(ENTRY.pack(o, t) for o, t in self.index)
+        return body + struct.pack("<I", zlib.crc32(body)) + TRAILER.pack(self.data_end, b"FEND")
+
+
+def _info(cap: Capture, name: str) -> None:
+    print(f"{name}: {len(cap.data)} bytes, chunk size {cap.chunk_bytes}")
+    if cap.start:
+        print(f"  start    {cap.start} (Unix)")
+    print(f"  chunks   {cap.chunks}, {cap.first_ms} .. {cap.last_ms} ms")
+    print(f"  index    {len(cap.index)} entries, stride {cap.stride}"
+          f"{' (rebuilt: file has no valid index)' if cap.index_rebuilt else ''}")
+    if cap.tail:
+        print(f"  tail     {cap.tail} bytes after the last good chunk ignored")
+
+
+def main(argv=None) -> int:
+    ap = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    sub = ap.add_subparsers(dest="cmd", required=True)
+    i = sub.add_parser("info", help="header, chunk and index summary")
+    i.add_argument("file")
+    v = sub.add_parser("validate", help="check every chunk CRC; exit 1 on any problem")
+    v.add_argument("file")
+    d = sub.add_parser("dump", help="list records")
+    d.add_argument("file")
+    d.add_argument("--from", dest="from_ms", type=int, default=0, help="start at this time (ms)")
+    d.add_argument("--type", type=int, help="only this record type")
+    d.add_argument("--hex", type=int, default=16, help="data bytes shown per record")
+    r = sub.add_parser("reindex", help="drop a torn tail and write a fresh index")
+    r.add_argument("file")
+    r.add_argument("-o", "--out", help="output file (default: in place)")
+    args = ap.parse_args(argv)
+
+    try:
+        with open(args.file, "rb") as f:
+            cap = Capture(f.read())
+        name = os.path.basename(args.file)
+        if args.cmd == "info":
+            _info(cap, name)
+        elif args.cmd == "validate":
+            n = sum(1 for _ in cap.records())
+            _info(cap, name)
+            print(f"  records  {n}, {len(cap.bad_chunks)} chunk(s) failed CRC")
+            return 1 if cap.bad_chunks or cap.tail or cap.index_rebuilt else 0
+        elif args.cmd == "dump":
+            for typ, flags, ms, data in cap.records(args.from_ms):
+                if args.type is not None and typ != args.type:
+                    continue
+                more = "…" if len(data) > args.hex else ""
+                print(f"{ms:10d}  {TYPES.get(typ, typ):<8} {flags:02x} {len(data):5d}  "
+                      f"{data[:args.hex].hex(' ')}{more}")
+        else:
+            out = cap.data[:cap.data_end] + cap.index_block()
+            with open(args.out or args.file, "wb") as f:
+                f.write(out)
+            print(f"{args.out or args.file}: {cap.chunks} chunks, "
+                  f"{len(cap.index)} index entries, {cap.tail} tail bytes dropped")
+    except (ValueError, OSError) as e:
+        print(f"capture: {e}", file=sys.stderr)
+        return 1
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
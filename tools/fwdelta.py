@@ -0,0 +1,262 @@
+#!/usr/bin/env python3
+"""Firmware delta tool: diff two firmware.bin files, apply/verify a delta, send it.
+
+Delta format (little endian), consumed by src/Modules/Core/ota_patch.cpp:
+
+  header (116 bytes, never compressed)
+    0   magic   "FTWD"
+    4   u8      version (1)
+    5   u8      codec   (0 stored, 1 raw deflate)
+    6   u8      flags   (bit0: base has an appended SHA-256 digest)
+    7   u8      reserved
+    8   u32     old size
+    12  u32     new size
+    16  32s     SHA-256 of the base image
+    48  32s     SHA-256 of the new image
+    80  2s      base image bytes [2:4) (flash mode / size)
+    82  2s      reserved
+    84  32s     base image trailing digest (if flags bit0)
+
+  body (codec-encoded), a sequence of records
+    u32 extra_len, u32 diff_len, u32 old_off
+    extra_len literal bytes
+    diff_len  bytes, each added (mod 256) to old[old_off + i]
+
+esptool rewrites the flash mode/size bytes and the appended digest of the
+image it flashes, so the header carries the base's original values and the
+applier reads the running partition through them.
+"""
+
+import argparse
+import hashlib
+import struct
+import sys
+import zlib
+
+MAGIC = b"FTWD"
+VERSION = 1
+CODEC_STORED, CODEC_DEFLATE = 0, 1
+FLAG_DIGEST = 0x01
+HEADER = struct.Struct("<4sBBBBII32s32s2s2s32s")
+RECORD = struct.Struct("<III")
+
+KEY = 8            # seed length used for the index
+MIN_SEED = 16      # exact bytes required before a seed is trusted
+CANDIDATES = 8     # old positions remembered per key
+GIVE_UP = 256      # stop extending after this many bytes without gain
+
+
+def _has_digest(img: bytes) -> bool:
+    return len(img) >= 24 + 32 and img[0] == 0xE9 and img[23] == 1
+
+
+def _base_view(old: bytes, hdr: bytes, tail: bytes, flags: int) -> bytes:
+    """The base as the applier sees it once header values are overlaid."""
+    b = bytearray(old)
+    b[2:4] = hdr
+    if flags & FLAG_DIGEST:
+        b[-32:] = tail
+    return bytes(b)
+
+
+# ─────────────────────────────────────────────────────────────────────────────
+# Diff
+# ─────────────────────────────────────────────────────────────────────────────
+def _index(old: bytes):
+    idx = {}
+    for i in range(len(old) - KEY + 1):
+        k = old[i:i + KEY]
+        slot = idx.get(k)
+        if slot is None:
+            idx[k] = [i]
+        elif len(slot) < CANDIDATES:
+            slot.append(i)
+    return idx
+
+
+def _exact(old: bytes, o: int, new: bytes, n: int) -> int:
+    lim = min(len(old) - o, len(new) - n)
+    i = 0
+    while i < lim and old[o + i] == new[n + i]:
+        i += 1
+    return i
+
+
+def _extend_fwd(old: bytes, o: int, new: bytes, n: int) -> int:
+    """bsdiff-style: longest prefix maximising 2*matches - length."""
+    lim = min(len(old) - o, len(new) - n)
+    s = best = length = 0
+    i = 0
+    while i < lim and i - length < GIVE_UP:
+        if old[o + i] == new[n + i]:
+            s += 1
+        i += 1
+        if 2 * s - i > best:
+            best, length = 2 * s - i, i
+    return length
+
+
+def _extend_back(old: bytes, o: int, new: bytes, n: int, floor: int) -> int:
+    lim = min(o, n - floor)
+    s = best = length = 0
+    i = 0
+    while i < lim and i - length < GIVE_UP:
+        i += 1
+        if old[o - i] == new[n - i]:
+            s += 1
+        if 2 * s - i > best:
+            best, length = 2 * s - i, i
+    return length
+
+
+def diff(old: bytes, new: bytes) -> bytes:
+    idx = _index(old)
+    out = bytearray()
+    extra_start = 0
+    n = 0
+    prev_delta = None          # old - new of the last match, tried first
+    while n < len(new) - KEY + 1:
+        cands = idx.get(new[n:n + KEY], ())
+        if prev_delta is not None and 0 <= n + prev_delta < len(old):
+            cands = [n + prev_delta, *cands]
+        best_o, best_len = -1, 0
+        for o in cands:
+            ln = _exact(old, o, new, n)
+            if ln > best_len:
+                best_o, best_len = o, ln
+        if best_len < MIN_SEED:
+            n += 1
+            continue
+
+        back = _extend_back(old, best_o, new, n, extra_start)
+        fwd = _extend_fwd(old, best_o, new, n)
+        o0, n0 = best_o - back, n - back
+        length = back + fwd
+        out += RECORD.pack(n0 - extra_start, length, o0)
+        out += new[extra_start:n0]
+        out += bytes((new[n0 + i] - old[o0 + i]) & 0xFF for i in range(length))
+        n = extra_start = n0 + length
+        prev_delta = o0 - n0
+    if extra_start < len(new):
+        out += RECORD.pack(len(new) - extra_start, 0, 0)
+        out += new[extra_start:]
+    return bytes(out)
+
+
+def make_delta(old: bytes, new: bytes, codec: int = CODEC_DEFLATE) -> bytes:
+    flags = FLAG_DIGEST if _has_digest(old) else 0
+    hdr, tail = old[2:4], (old[-32:] if flags & FLAG_DIGEST else bytes(32))
+    body = diff(old, new)
+    if codec == CODEC_DEFLATE:
+        c = zlib.compressobj(9, zlib.DEFLATED, -15)
+        body = c.compress(body) + c.flush()
+    head = HEADER.pack(MAGIC, VERSION, codec, flags, 0, len(old), len(new),
+                       hashlib.sha256(old).digest(), hashlib.sha256(new).digest(),
+                       hdr, bytes(2), tail)
+    return head + body
+
+
+# ─────────────────────────────────────────────────────────────────────────────
+# Apply (reference implementation of the on-device applier)
+# ─────────────────────────────────────────────────────────────────────────────
+def apply(old: bytes, delta: bytes) -> bytes:
+    if len(delta) < HEADER.size:
+        raise ValueError("truncated header")
+    (magic, ver, codec, flags, _, old_size, new_size,
+     old_sha, new_sha, hdr, _, tail) = HEADER.unpack_from(delta)
+    if magic != MAGIC or ver != VERSION:
+        raise ValueError("not a delta")
+    if len(old) != old_size:
+        raise ValueError(f"base is {len(old)} bytes, delta expects {old_size}")
+    base = _base_view(old, hdr, tail, flags)
+    if hashlib.sha256(base).digest() != old_sha:
+        raise ValueError("base image does not match")
+
+    body = delta[HEADER.size:]
+    if codec == CODEC_DEFLATE:
+        body = zlib.decompress(body, -15)
+    elif codec != CODEC_STORED:
+        raise ValueError(f"unknown codec {codec}")
+
+    out = bytearray()
+    p = 0
+    while p < len(body):
+        extra, dlen, off = RECORD.unpack_from(body, p)
+        p += RECORD.size
+        if off + dlen > old_size or len(out) + extra + dlen > new_size:
+            raise ValueError("record out of range")
+        out += body[p:p + extra]
+        p += extra
+        out += bytes((base[off + i] + body[p + i]) & 0xFF for i in range(dlen))
+        p += dlen
+    if len(out) != new_size or hashlib.sha256(out).digest() != new_sha:
+        raise ValueError("result does not match the new image")
+    return bytes(out)
+
+
+# ─────────────────────────────────────────────────────────────────────────────
+# Serial upload (Settings > Fw Update on the device)
+# ─────────────────────────────────────────────────────────────────────────────
+def send(delta: bytes, port: str, baud: int) -> None:
+    import serial   # pyserial, only needed for this command
+
+    with serial.Serial(port, baud, timeout=30) as s:
+        s.reset_input_buffer()
+        s.write(f"delta {len(delta)}\n".encode())
+        if s.readline().strip() != b"ok":
+            raise RuntimeError("device is not waiting for a delta")
+        block = 1024
+        for p in range(0, len(delta), block):
+            s.write(delta[p:p + block])
+            ack = s.read(1)
+            if ack != b".":
+                raise RuntimeError(f"device stopped at {p}: {ack + s.readline()!r}")
+            print(f"\r{min(p + block, len(delta))}/{len(delta)}", end="", flush=True)
+        print()
+        print(s.readline().decode(errors="replace").strip())
+
+
+def main(argv=None) -> int:
+    ap = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    sub = ap.add_subparsers(dest="cmd", required=True)
+    d = sub.add_parser("diff", help="old.bin new.bin -> delta")
+    d.add_argument("old"); d.add_argument("new"); d.add_argument("out")
+    d.add_argument("--stored", action="store_true", help="do not deflate the body")
+    a = sub.add_parser("apply", help="old.bin delta -> new.bin")
+    a.add_argument("old"); a.add_argument("delta"); a.add_argument("out")
+    v = sub.add_parser("verify", help="check that delta turns old.bin into new.bin")
+    v.add_argument("old"); v.add_argument("new"); v.add_argument("delta")
+    s = sub.add_parser("send", help="stream a delta to the device over serial")
+    s.add_argument("delta"); s.add_argument("port")
+    s.add_argument("--baud", type=int, default=115200)
+    args = ap.parse_args(argv)
+
+    def rd(p):
+        with open(p, "rb") as f:
+            return f.read()
+
+    try:
+        if args.cmd == "diff":
+            old, new = rd(args.old), rd(args.new)
+            delta = make_delta(old, new, CODEC_STORED if args.stored else CODEC_DEFLATE)
+            apply(old, delta)          # never ship a delta that doesn't round-trip
+            with open(args.out, "wb") as f:
+                f.write(delta)
+            print(f"{args.out}: {len(delta)} bytes ({100 * len(delta) / len(new):.1f}% of {len(new)})")
+        elif args.cmd == "apply":
+            with open(args.out, "wb") as f:
+                f.write(apply(rd(args.old), rd(args.delta)))
+        elif args.cmd == "verify":
+            if apply(rd(args.old), rd(args.delta)) != rd(args.new):
+                raise ValueError("output differs from new image")
+            print("ok")
+        else:
+            send(rd(args.delta), args.port, args.baud)
+    except (ValueError, RuntimeError, OSError) as e:
+        print(f"fwdelta: {e}", file=sys.stderr)
+        return 1
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -0,0 +1,211 @@
+// Host build and loopback client for the file server (src/Modules/Core/http_files).
+//
+//   g++ -O2 -std=gnu++17 -pthread -Isrc/Modules/Core tools/http_loopback.cpp src/Modules/Core/http_files.cpp -o http_loopback
+//
+//   http_loopback [-n passes] [-s MB]
+//
+// Builds a scratch tree under /tmp, serves it as /sd on a loopback port and
+// checks full and ranged downloads, HEAD, error codes, folder listings and
+// HTTP_MAX_CLIENTS concurrent transfers against the bytes on disk. One line
+// per check goes to stdout; the exit status is the number of failures.
+// Download throughput over -n passes of the -s MB file goes to stderr.
+
+#include "http_files.h"
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <sys/socket.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include <atomic>
+#include <chrono>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <string>
+#include <thread>
+#include <vector>
+
+// ─────────────────────────────────────────────────────────────────────────────
+// Client
+// ─────────────────────────────────────────────────────────────────────────────
+struct Reply {
+  int         status = 0;
+  std::string head;              // status line + headers
+  std::string body;              // de-chunked
+};
+
+static std::string header(const Reply& r, const char* name) {
+  std::string key = std::string("\r\n") + name + ":";
+  size_t p = r.head.find(key);
+  if (p == std::string::npos) return "";
+  p += key.size();
+  while (p < r.head.size() && r.head[p] == ' ') ++p;
+  return r.head.substr(p, r.head.find("\r\n", p) - p);
+}
+
+static bool dechunk(const std::string& in, std::string& out) {
+  size_t p = 0;
+  for (;;) {
+    size_t eol = in.find("\r\n", p);
+    if (eol == std::string::npos) return false;
+    size_t n = strtoul(in.c_str() + p, nullptr, 16);
+    p = eol + 2;
+    if (!n) return true;
+    if (p + n + 2 > in.size()) return false;
+    out.append(in, p, n);
+    p += n + 2;
+  }
+}
+
+static bool request(uint16_t port, const std::string& req, Reply& r) {
+  int fd = socket(AF_INET, SOCK_STREAM, 0);
+  if (fd < 0) return false;
+  sockaddr_in addr = {};
+  addr.sin_family = AF_INET;
+  addr.sin_port = htons(port);
+  addr.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+  if (connect(fd, (sockaddr*)&addr, sizeof(addr)) != 0) { close(fd); return false; }
+  send(fd, req.data(), req.size(), MSG_NOSIGNAL);
+
+  std::string raw;
+  char buf[65536];
+  ssize_t n;
+  while ((n = recv(fd, buf, sizeof(buf), 0)) > 0) raw.append(buf, n);
+  close(fd);
+
+  size_t end = raw.find("\r\n\r\n");
+  if (end == std::string::npos) return false;
+  r.head = raw.substr(0, end + 2);
+  r.status = atoi(r.head.c_str() + 9);
+  r.body.clear();
+  if (header(r, "Transfer-Encoding") == "chunked") return dechunk(raw.substr(end + 4), r.body);
+  r.body = raw.substr(end + 4);
+  return true;
+}
+
+static bool get(uint16_t port, const char* path, Reply& r, const char* extra = "", const char* method = "GET") {
+  return request(port, std::string(method) + " " + path + " HTTP/1.1\r\nHost: loopback\r\n" + extra + "\r\n", r);
+}
+
+// ─────────────────────────────────────────────────────────────────────────────
+// Fixture
+// ─────────────────────────────────────────────────────────────────────────────
+static std::string writeFile(const std::string& path, size_t size, uint32_t seed) {
+  std::string data(size, '\0');
+  for (size_t i = 0; i < size; ++i) {
+    seed = seed * 1664525u + 1013904223u;
+    data[i] = (char)(seed >> 24);
+  }
+  FILE* f = fopen(path.c_str(), "wb");
+  if (!f || fwrite(data.data(), 1, size, f) != size) { perror(path.c_str()); exit(2); }
+  fclose(f);
+  return data;
+}
+
+static int sFailures = 0;
+
+static void check(const char* what, bool ok) {
+  printf("%-44s %s\n", what, ok ? "ok" : "FAIL");
+  if (!ok) sFailures++;
+}
+
+// ─────────────────────────────────────────────────────────────────────────────
+// Main
+// ─────────────────────────────────────────────────────────────────────────────
+int main(int argc, char** argv) {
+  int    passes = 0;
+  size_t mb     = 8;
+  for (int i = 1; i < argc; ++i) {
+    if (!strcmp(argv[i], "-n") && i + 1 < argc)      passes = atoi(argv[++i]);
+    else if (!strcmp(argv[i], "-s") && i + 1 < argc) mb = (size_t)atoi(argv[++i]);
+    else { fprintf(stderr, "usage: %s [-n passes] [-s MB]\n", argv[0]); return 2; }
+  }
+
+  char tmpl[] = "/tmp/http_loopback.XXXXXX";
+  if (!mkdtemp(tmpl)) { perror("mkdtemp"); return 2; }
+  const std::string root = tmpl;
+  mkdir((root + "/sub").c_str(), 0777);
+  const std::string big   = writeFile(root + "/data.bin", mb << 20, 1);
+  const std::string small = writeFile(root + "/a b&c.txt", 1000, 2);
+  writeFile(root + "/sub/x.log", 10, 3);
+
+  static const HttpRoot roots[] = { { "/sd", tmpl } };
+  if (!httpFilesStart(0, roots, 1)) { perror("httpFilesStart"); return 2; }
+  const uint16_t port = httpFilesPort();
+
+  std::atomic<bool> quit{ false };
+  std::thread server([&] { while (!quit) httpFilesPoll(20); });
+
+  Reply r;
+  bool ok = get(port, "/sd/data.bin", r);
+  check("GET file", ok && r.status == 200 && r.body == big);
+
+  ok = get(port, "/sd/data.bin", r, "", "HEAD");
+  check("HEAD file", ok && r.status == 200 && r.body.empty() &&
+                     header(r, "Content-Length") == std::to_string(big.size()));
+
+  ok = get(port, "/sd/a%20b%26c.txt", r, "Range: bytes=100-199\r\n");
+  check("Range a-b", ok && r.status == 206 && r.body == small.substr(100, 100) &&
+                     header(r, "Content-Range") == "bytes 100-199/1000");
+
+  ok = get(port, "/sd/a%20b%26c.txt", r, "Range: bytes=900-\r\n");
+  check("Range a-", ok && r.status == 206 && r.body == small.substr(900));
+
+  ok = get(port, "/sd/a%20b%26c.txt", r, "Range: bytes=-10\r\n");
+  check("Range -n", ok && r.status == 206 && r.body == small.substr(990));
+
+  ok = get(port, "/sd/a%20b%26c.txt", r, "Range: bytes=1000-\r\n");
+  check("Range past end -> 416", ok && r.status == 416 && header(r, "Content-Range") == "bytes */1000");
+
+  ok = get(port, "/sd/missing", r);
+  check("missing -> 404", ok && r.status == 404);
+
+  ok = get(port, "/sd/../etc/passwd", r);
+  check("dot-dot -> 404", ok && r.status == 404);
+
+  ok = get(port, "/sd/data.bin", r, "", "POST");
+  check("POST -> 405", ok && r.status == 405);
+
+  ok = get(port, "/sd", r);
+  check("folder listing", ok && r.status == 200 &&
+                          r.body.find("href=\"/sd/a%20b%26c.txt\">a b&amp;c.txt<") != std::string::npos &&
+                          r.body.find("href=\"/sd/sub/\">sub/<") != std::string::npos &&
+                          r.body.find("</html>") != std::string::npos);
+
+  ok = get(port, "/", r);
+  check("root listing", ok && r.status == 200 && r.body.find("href=\"/sd/\"") != std::string::npos);
+
+  // Every client slot busy with the big file at once
+  std::vector<std::thread> clients;
+  std::atomic<int> good{ 0 };
+  for (uint8_t i = 0; i < HTTP_MAX_CLIENTS; ++i) {
+    clients.emplace_back([&] {
+      Reply cr;
+      if (get(port, "/sd/data.bin", cr) && cr.status == 200 && cr.body == big) good++;
+    });
+  }
+  for (auto& t : clients) t.join();
+  check("concurrent downloads", good == HTTP_MAX_CLIENTS);
+
+  if (passes > 0) {
+    auto t0 = std::chrono::steady_clock::now();
+    for (int i = 0; i < passes; ++i) get(port, "/sd/data.bin", r);
+    double s = std::chrono::duration<double>(std::chrono::steady_clock::now() - t0).count();
+    fprintf(stderr, "%d x %zu MB in %.3f s, %.1f MB/s (HTTP_CHUNK %d)\n",
+            passes, mb, s, passes * (double)mb / s, HTTP_CHUNK);
+  }
+
+  quit = true;
+  server.join();
+  HttpFilesStats st = httpFilesStats();
+  httpFilesStop();
+  fprintf(stderr, "%u requests, %llu bytes sent, %u errors\n",
+          st.requests, (unsigned long long)st.bytesSent, st.errors);
+
+  unlink((root + "/sub/x.log").c_str());
+  unlink((root + "/a b&c.txt").c_str());
+  unlink((root + "/data.bin").c_str());
+  rmdir((root + "/sub").c_str());
+  rmdir(root.c_str());
+  return sFailures;
+}
@@ -0,0 +1,169 @@
+// Host replay and benchmark for the NMEA parser (src/Modules/Core/nmea).
+//
+//   g++ -O2 -std=gnu++17 -Isrc/Modules/Core tools/nmea_bench.cpp src/Modules/Core/nmea.cpp -o nmea_bench
+//
+//   nmea_bench --check                   decode reference sentences, compare every field
+//   nmea_bench [-n passes] log.nmea ...  replay logs, one line per fix epoch
+//
+// Logs are raw receiver output (u-center, gpsd, `cat /dev/ttyUSB0`), fed
+// byte by byte exactly as the reader task does. tools/nmea_sample.nmea
+// is a 90 s GN/GP/GL session in u-blox M8 format with a cold start, one
+// corrupted checksum and one truncated sentence. Epochs go to stdout, so a
+// run can be diffed against a saved one; parser counters and timing go to
+// stderr. -n repeats the parse over the loaded logs for steadier numbers.
+
+#include "nmea.h"
+#include <chrono>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <string>
+#include <vector>
+
+// ─────────────────────────────────────────────────────────────────────────────
+// Reference sentences
+// ─────────────────────────────────────────────────────────────────────────────
+static int sFailures = 0;
+
+static void expect(const char* what, long long got, long long want) {
+  bool ok = got == want;
+  printf("%-28s %12lld %s\n", what, got, ok ? "ok" : "FAIL");
+  if (!ok) { printf("%-28s %12lld expected\n", "", want); sFailures++; }
+}
+
+static void feedLine(NmeaParser& p, const char* s) {
+  p.feed(s, strlen(s));
+  p.feed("\r\n", 2);
+}
+
+static int check() {
+  NmeaParser p;
+
+  // The textbook examples from the NMEA 0183 sentence descriptions
+  feedLine(p, "$GPGGA,123519,4807.038,N,01131.000,E,1,08,0.9,545.4,M,46.9,M,,*47");
+  feedLine(p, "$GPRMC,123519,A,4807.038,N,01131.000,E,022.4,084.4,230394,003.1,W*6A");
+  feedLine(p, "$GPGSA,A,3,04,05,,09,12,,,24,,,,,2.5,1.3,2.1*39");
+  const GpsFix& f = p.fix();
+  expect("valid",         f.valid,      1);
+  expect("quality",       f.quality,    1);
+  expect("sats",          f.sats,       8);
+  expect("latE7",         f.latE7,      481173000);
+  expect("lonE7",         f.lonE7,      115166666);
+  expect("altCm",         f.altCm,      54540);
+  expect("speedCmS",      f.speedCmS,   1152);        // 22.4 kn
+  expect("courseX100",    f.courseX100, 8440);
+  expect("date",          f.year * 10000 + f.month * 100 + f.day, 20940323);   // yy is 20yy
+  expect("time",          f.hour * 10000 + f.minute * 100 + f.second, 123519);
+  expect("mode",          f.mode,       3);
+  expect("pdopX100",      f.pdopX100,   250);
+  expect("hdopX100",      f.hdopX100,   130);         // GSA after GGA
+  expect("vdopX100",      f.vdopX100,   210);
+
+  // Southern / western hemispheres, fractional seconds, GN talker
+  feedLine(p, "$GNRMC,235959.25,A,3351.8412,S,15112.6450,W,0.0,,010100,,,A*6D");
+  expect("south latE7",   p.fix().latE7, -338640200);
+  expect("west lonE7",    p.fix().lonE7, -1512107500);
+  expect("millis",        p.fix().millis, 250);
+  expect("year 2000",     p.fix().year,   2000);
+
+  // Rejections: bad checksum, no checksum, overlong, unknown type
+  NmeaStats before = p.stats();
+  feedLine(p, "$GPGGA,123519,4807.038,N,01131.000,E,1,08,0.9,545.4,M,46.9,M,,*48");
+  feedLine(p, "$GPGGA,123519,4807.038,N,01131.000,E,1,08,0.9,545.4,M,46.9,M,,");
+  feedLine(p, "$GPGGA,123519,4807.038,N,01131.000,E,1,08,0.9,545.4,M,46.9,M,,"
+              "0000000000000000000000*47");
+  feedLine(p, "$GPVTG,054.7,T,034.4,M,005.5,N,010.2,K*48");
+  expect("checksum errors", p.stats().checksumErrors - before.checksumErrors, 1);
+  expect("malformed",       p.stats().malformed - before.malformed, 2);
+  expect("ignored",         p.stats().ignored - before.ignored, 1);
+  expect("fix untouched",   p.fix().latE7, -338640200);
+
+  // Losing the fix clears valid
+  feedLine(p, "$GPRMC,123520,V,,,,,,,230394,,,N*5B");
+  feedLine(p, "$GPGGA,123520,,,,,0,00,,,M,,M,,*61");
+  expect("valid after loss", p.fix().valid, 0);
+
+  printf("%d failure%s\n", sFailures, sFailures == 1 ? "" : "s");
+  return sFailures;
+}
+
+// ─────────────────────────────────────────────────────────────────────────────
+// Replay
+// ─────────────────────────────────────────────────────────────────────────────
+static bool load(const char* path, std::string& out) {
+  FILE* f = fopen(path, "rb");
+  if (!f) return false;
+  char buf[65536];
+  size_t n;
+  while ((n = fread(buf, 1, sizeof(buf), f)) > 0) out.append(buf, n);
+  fclose(f);
+  return true;
+}
+
+static void printEpoch(const GpsFix& f) {
+  printf("%02u:%02u:%02u.%03u %c q%u m%u %2u sats %11.7f %12.7f %7.2f m %6.2f m/s hdop %.2f\n",
+         f.hour, f.minute, f.second, f.millis, f.valid ? 'A' : 'V', f.quality, f.mode, f.sats,
+         f.latE7 / 1e7, f.lonE7 / 1e7, f.altCm / 100.0, f.speedCmS / 100.0, f.hdopX100 / 100.0);
+}
+
+// One pass over a log; prints an epoch line whenever the fix time moves on
+static size_t replay(const std::string& log, bool print, NmeaStats& stats) {
+  NmeaParser p;
+  size_t applied = 0;
+  GpsFix last = {};
+  bool   have = false;
+  for (char c : log) {
+    if (!p.feed(c)) continue;
+    applied++;
+    const GpsFix& f = p.fix();
+    bool moved = have && (f.hour != last.hour || f.minute != last.minute ||
+                          f.second != last.second || f.millis != last.millis);
+    if (print && moved) printEpoch(last);
+    last = f;
+    have = true;
+  }
+  if (print && have) printEpoch(last);
+  stats = p.stats();
+  return applied;
+}
+
+int main(int argc, char** argv) {
+  int passes = 0;
+  std::vector<const char*> paths;
+  for (int i = 1; i < argc; ++i) {
+    if (!strcmp(argv[i], "--check")) return check();
+    if (!strcmp(argv[i], "-n") && i + 1 < argc) passes = atoi(argv[++i]);
+    else paths.push_back(argv[i]);
+  }
+  if (paths.empty()) {
+    fprintf(stderr, "usage: %s --check | [-n passes] log.nmea ...\n", argv[0]);
+    return 2;
+  }
+
+  std::vector<std::string> logs;
+  size_t bytes = 0;
+  for (const char* path : paths) {
+    std::string log;
+    if (!load(path, log)) { perror(path); return 2; }
+    NmeaStats st;
+    printf("# %s\n", path);
+    size_t applied = replay(log, true, st);
+    fprintf(stderr, "%s: %zu bytes, %zu applied, %u ignored, %u checksum errors, %u malformed\n",
+            path, log.size(), applied, st.ignored, st.checksumErrors, st.malformed);
+    bytes += log.size();
+    logs.push_back(std::move(log));
+  }
+
+  if (passes > 0) {
+    size_t applied = 0;
+    auto t0 = std::chrono::steady_clock::now();
+    for (int i = 0; i < passes; ++i) {
+      for (const std::string& log : logs) { NmeaStats st; applied += replay(log, false, st); }
+    }
+    double s = std::chrono::duration<double>(std::chrono::steady_clock::now() - t0).count();
+    fprintf(stderr, "%d passes, %.1f MB/s, %.0f ns/byte, %.0f ns/sentence\n",
+            passes, passes * (double)bytes / s / 1e6, s * 1e9 / (passes * (double)bytes),
+            applied ? s * 1e9 / applied : 0.0);
+  }
+  return 0;
+}
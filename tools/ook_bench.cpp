@@ -0,0 +1,155 @@
+// Host replay and benchmark for the OOK decoders (src/Modules/Core/ook_decode).
+//
+//   g++ -O2 -std=gnu++17 -Isrc/Modules/Core tools/ook_bench.cpp src/Modules/Core/ook_decode.cpp -o ook_bench
+//
+//   ook_bench [-n passes] file.ook ...   decode every train, one line per reading
+//   ook_bench --synth out.ook            write one train per built-in protocol
+//
+// Readings go to stdout, so a corpus of recordings (rtl_433 -w x.ook, or
+// /sd/ook/ from the device) can be diffed against a saved run; timing goes
+// to stderr. -n repeats the decode over the loaded trains for steadier
+// numbers.
+
+#include "ook_decode.h"
+#include <chrono>
+#include <string.h>
+#include <stdlib.h>
+#include <vector>
+
+// ─────────────────────────────────────────────────────────────────────────────
+// Synthetic trains
+// ─────────────────────────────────────────────────────────────────────────────
+struct Builder {
+  OokPulses& p;
+  void add(uint16_t pulse, uint16_t gap) {
+    if (p.count < OOK_MAX_PULSES) { p.pulse[p.count] = pulse; p.gap[p.count] = gap; p.count++; }
+  }
+};
+
+static void synthEv1527(OokPulses& p, uint32_t code) {
+  const uint16_t t = 350;
+  Builder b{ p };
+  for (int rep = 0; rep < 4; ++rep) {
+    b.add(t, 31 * t);
+    for (int i = 23; i >= 0; --i) {
+      if (code >> i & 1) b.add(3 * t, t);
+      else               b.add(t, 3 * t);
+    }
+  }
+  b.add(t, 31 * t);
+}
+
+static void synthNexus(OokPulses& p, uint8_t id, uint8_t ch, int16_t tempC10, uint8_t hum) {
+  uint64_t v = (uint64_t)id << 28;
+  v |= (uint64_t)1 << 27;                                      // battery OK
+  v |= (uint64_t)((ch - 1) & 3) << 24;
+  v |= (uint64_t)(tempC10 & 0xFFF) << 12;
+  v |= (uint64_t)0xF << 8;
+  v |= hum;
+  Builder b{ p };
+  for (int rep = 0; rep < 10; ++rep) {
+    for (int i = 35; i >= 0; --i) b.add(500, v >> i & 1 ? 2000 : 1000);
+    b.add(500, 4000);
+  }
+}
+
+static uint16_t crc16(const uint8_t* d, size_t n, uint16_t poly) {
+  uint16_t c = 0;
+  for (size_t i = 0; i < n; ++i) {
+    c ^= (uint16_t)d[i] << 8;
+    for (int k = 0; k < 8; ++k) c = c & 0x8000 ? (c << 1) ^ poly : c << 1;
+  }
+  return c;
+}
+
+// Honeywell on air per rtl_433's zero-bit Manchester: a 0 is low then high,
+// a 1 is high then low, and the frame is preceded by the 0 whose rising edge
+// the receiver treats as the first mid-bit edge.
+static void synthHoneywell(OokPulses& p, uint8_t ch, uint32_t id, uint8_t event) {
+  uint8_t msg[4] = { (uint8_t)(ch << 4 | id >> 16), (uint8_t)(id >> 8), (uint8_t)id, event };
+  uint16_t crc = crc16(msg, 4, ch == 0x2 || ch == 0x4 || ch == 0xA ? 0x8050 : 0x8005);
+  std::vector<uint8_t> bits{ 0 };
+  for (int i = 15; i >= 0; --i) bits.push_back(0xFFFE >> i & 1);
+  for (int k = 0; k < 4; ++k) for (int i = 7; i >= 0; --i) bits.push_back(msg[k] >> i & 1);
+  for (int i = 15; i >= 0; --i) bits.push_back(crc >> i & 1);
+
+  std::vector<uint8_t> halves;                       // 1 = carrier on
+  for (uint8_t v : bits) { halves.push_back(v); halves.push_back(!v); }
+
+  // The leading low half is silence; merge equal halves into pulses and gaps
+  const uint16_t t = 156;
+  Builder b{ p };
+  size_t i = 1;
+  while (i < halves.size()) {
+    size_t hi = 0, lo = 0;
+    while (i < halves.size() && halves[i])  { hi++; i++; }
+    while (i < halves.size() && !halves[i]) { lo++; i++; }
+    b.add(hi * t, i == halves.size() ? 2000 : lo * t);
+  }
+}
+
+static int synth(const char* path) {
+  FILE* f = fopen(path, "w");
+  if (!f) { perror(path); return 1; }
+  static OokPulses p;
+  p.count = 0; synthEv1527(p, 0xA5C3D2);            ookWritePulses(f, p);
+  p.count = 0; synthNexus(p, 0x5B, 2, -123, 56);    ookWritePulses(f, p);
+  p.count = 0; synthHoneywell(p, 0x8, 0x12345, 0x80); ookWritePulses(f, p);
+  fclose(f);
+  return 0;
+}
+
+// ─────────────────────────────────────────────────────────────────────────────
+// Replay
+// ─────────────────────────────────────────────────────────────────────────────
+static void print(const char* file, size_t train, const OokReading& r) {
+  printf("%s:%zu %s id=%lX", file, train, r.model, (unsigned long)r.id);
+  if (r.flags & OOK_HAS_CHANNEL)  printf(" ch=%u", r.channel);
+  if (r.flags & OOK_HAS_STATE)    printf(" state=%02X", r.state);
+  if (r.flags & OOK_HAS_TEMP)     printf(" temp=%.1f", r.tempC10 / 10.0);
+  if (r.flags & OOK_HAS_HUMIDITY) printf(" hum=%u", r.humidity);
+  if (r.flags & OOK_BATTERY_LOW)  printf(" batt=low");
+  putchar('\n');
+}
+
+int main(int argc, char** argv) {
+  if (argc == 3 && !strcmp(argv[1], "--synth")) return synth(argv[2]);
+  int passes = 1, first = 1;
+  if (argc > 2 && !strcmp(argv[1], "-n")) { passes = atoi(argv[2]); first = 3; }
+  if (first >= argc || passes < 1) {
+    fprintf(stderr, "usage: %s [-n passes] file.ook ... | --synth out.ook\n", argv[0]);
+    return 2;
+  }
+
+  std::vector<OokPulses> trains;
+  std::vector<const char*> origin;
+  for (int a = first; a < argc; ++a) {
+    FILE* f = fopen(argv[a], "r");
+    if (!f) { perror(argv[a]); return 1; }
+    static OokPulses p;
+    while (ookReadPulses(f, p)) { trains.push_back(p); origin.push_back(argv[a]); }
+    fclose(f);
+  }
+
+  OokReading out[8];
+  size_t readings = 0;
+  for (size_t i = 0; i < trains.size(); ++i) {
+    size_t n = ookDecode(trains[i], out, 8);
+    for (size_t k = 0; k < n; ++k) print(origin[i], i, out[k]);
+    readings += n;
+  }
+
+  uint64_t pulses = 0;
+  for (const OokPulses& t : trains) pulses += t.count;
+  auto t0 = std::chrono::steady_clock::now();
+  size_t sink = 0;
+  for (int pass = 0; pass < passes; ++pass) {
+    for (const OokPulses& t : trains) sink += ookDecode(t, out, 8);
+  }
+  double us = std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - t0).count();
+  double per = trains.empty() ? 0 : us / ((double)passes * trains.size());
+  fprintf(stderr, "%zu trains, %llu pulses, %zu readings; %.2f us/train, %.1f Mpulses/s (%zu)\n",
+          trains.size(), (unsigned long long)pulses, readings, per,
+          us ? pulses * passes / us : 0.0, sink);
+  return 0;
+}